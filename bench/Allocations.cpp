@@ -0,0 +1,75 @@
+/*
+ * This file replaces global operator new and delete to count the calling thread's heap allocations,
+ * for benchmarks that report allocations per operation. Link it into an executable to turn counting on.
+ */
+
+#include "Harness.hpp"
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+thread_local std::uint64_t allocation_count = 0;
+thread_local std::uint64_t allocated_bytes = 0;
+
+void* allocate(std::size_t size, std::size_t alignment = 0) {
+    allocation_count++;
+    allocated_bytes += size;
+
+    if (size == 0) {
+        size = 1;
+    }
+    void* pointer = nullptr;
+    if (alignment > alignof(std::max_align_t)) {
+        // aligned_alloc needs the size to be a multiple of the alignment
+        pointer = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+    } else {
+        pointer = std::malloc(size);
+    }
+    if (pointer == nullptr) {
+        throw std::bad_alloc{};
+    }
+    return pointer;
+}
+
+}
+
+namespace milsymbol::bench {
+
+AllocationCounts get_allocation_counts() noexcept {
+    return AllocationCounts{allocation_count, allocated_bytes};
+}
+
+}
+
+void* operator new(std::size_t size) {return allocate(size);}
+void* operator new[](std::size_t size) {return allocate(size);}
+void* operator new(std::size_t size, std::align_val_t alignment) {return allocate(size, static_cast<std::size_t>(alignment));}
+void* operator new[](std::size_t size, std::align_val_t alignment) {return allocate(size, static_cast<std::size_t>(alignment));}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return allocate(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return allocate(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void operator delete(void* pointer) noexcept {std::free(pointer);}
+void operator delete[](void* pointer) noexcept {std::free(pointer);}
+void operator delete(void* pointer, std::size_t) noexcept {std::free(pointer);}
+void operator delete[](void* pointer, std::size_t) noexcept {std::free(pointer);}
+void operator delete(void* pointer, std::align_val_t) noexcept {std::free(pointer);}
+void operator delete[](void* pointer, std::align_val_t) noexcept {std::free(pointer);}
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept {std::free(pointer);}
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept {std::free(pointer);}
@@ -0,0 +1,209 @@
+#include "Harness.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sched.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace milsymbol::bench {
+
+namespace {
+
+#ifdef __linux__
+/// Opens a user-space counter of the given event on the calling thread, stopped, returning its descriptor or -1
+int open_counter(std::uint32_t type, std::uint64_t config) noexcept {
+    perf_event_attr attributes;
+    std::memset(&attributes, 0, sizeof(attributes));
+    attributes.size = sizeof(attributes);
+    attributes.type = type;
+    attributes.config = config;
+    attributes.disabled = 1;
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv = 1;
+    attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+}
+#endif
+
+}
+
+const char* get_name(Counter counter) noexcept {
+    switch (counter) {
+    case Counter::CYCLES: return "cycles";
+    case Counter::INSTRUCTIONS: return "instructions";
+    case Counter::L1D_MISSES: return "l1d_misses";
+    case Counter::LLC_MISSES: return "llc_misses";
+    case Counter::BRANCH_MISSES: return "branch_misses";
+    default: return "unknown";
+    }
+}
+
+bool hardware_counters_requested() noexcept {
+    static const bool requested = [] {
+        const char* value = std::getenv("MILSYMBOL_BENCH_COUNTERS");
+        return value != nullptr && *value != '\0' && std::strcmp(value, "0") != 0;
+    }();
+    return requested;
+}
+
+HardwareCounters::HardwareCounters(bool open) noexcept {
+    descriptors.fill(-1);
+#ifdef __linux__
+    if (!open) {
+        return;
+    }
+    descriptors[static_cast<std::size_t>(Counter::CYCLES)] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    descriptors[static_cast<std::size_t>(Counter::INSTRUCTIONS)] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    descriptors[static_cast<std::size_t>(Counter::L1D_MISSES)] = open_counter(PERF_TYPE_HW_CACHE,
+        PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+    descriptors[static_cast<std::size_t>(Counter::LLC_MISSES)] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+    descriptors[static_cast<std::size_t>(Counter::BRANCH_MISSES)] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+#else
+    (void) open;
+#endif
+}
+
+HardwareCounters::~HardwareCounters() noexcept {
+#ifdef __linux__
+    for (int descriptor : descriptors) {
+        if (descriptor >= 0) {
+            close(descriptor);
+        }
+    }
+#endif
+}
+
+bool HardwareCounters::any_available() const noexcept {
+    return std::any_of(descriptors.begin(), descriptors.end(), [](int descriptor) {return descriptor >= 0;});
+}
+
+void HardwareCounters::start() noexcept {
+#ifdef __linux__
+    for (int descriptor : descriptors) {
+        if (descriptor >= 0) {
+            ioctl(descriptor, PERF_EVENT_IOC_RESET, 0);
+        }
+    }
+#endif
+    resume();
+}
+
+void HardwareCounters::pause() noexcept {
+#ifdef __linux__
+    for (int descriptor : descriptors) {
+        if (descriptor >= 0) {
+            ioctl(descriptor, PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+#endif
+}
+
+void HardwareCounters::resume() noexcept {
+#ifdef __linux__
+    for (int descriptor : descriptors) {
+        if (descriptor >= 0) {
+            ioctl(descriptor, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#endif
+}
+
+HardwareCounters::Values HardwareCounters::stop() noexcept {
+    Values values;
+    values.fill(-1);
+    pause();
+#ifdef __linux__
+    for (std::size_t i = 0; i < COUNTER_COUNT; i++) {
+        // The count, then the time the counter was enabled and the time it was actually counting
+        std::uint64_t data[3];
+        if (descriptors[i] < 0 || read(descriptors[i], data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)) || data[2] == 0) {
+            continue;
+        }
+        values[i] = static_cast<double>(data[0]) * (static_cast<double>(data[1]) / static_cast<double>(data[2]));
+    }
+#endif
+    return values;
+}
+
+bool pin_to_cpu(int cpu) noexcept {
+#ifdef __linux__
+    if (cpu < 0) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    (void) cpu;
+    return false;
+#endif
+}
+
+void write_json_string(std::ostream& out, std::string_view value) {
+    out << '"';
+    for (char c : value) {
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            out << escaped;
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+}
+
+void write_counters(std::ostream& out, const HardwareCounters::Values& values, std::string_view unit) {
+    for (std::size_t i = 0; i < COUNTER_COUNT; i++) {
+        if (values[i] >= 0) {
+            out << ", " << values[i] << " " << get_name(static_cast<Counter>(i)) << unit;
+        }
+    }
+
+    double cycles = values[static_cast<std::size_t>(Counter::CYCLES)];
+    double instructions = values[static_cast<std::size_t>(Counter::INSTRUCTIONS)];
+    if (cycles > 0 && instructions >= 0) {
+        out << ", " << instructions / cycles << " IPC";
+    }
+}
+
+void write_json(std::ostream& out, std::string_view suite, int cpu, const std::vector<Result>& results) {
+    out << "{\"suite\": ";
+    write_json_string(out, suite);
+    out << ", \"cpu\": " << cpu << ", \"results\": [";
+    for (std::size_t i = 0; i < results.size(); i++) {
+        const Result& result = results[i];
+        out << (i == 0 ? "\n" : ",\n") << "  {\"name\": ";
+        write_json_string(out, result.name);
+        out << ", \"iterations\": " << result.iterations <<
+            ", \"repetitions\": " << result.repetitions <<
+            ", \"ns_per_op\": " << result.ns_per_op <<
+            ", \"min_ns_per_op\": " << result.min_ns_per_op <<
+            ", \"allocations_per_op\": " << result.allocations_per_op <<
+            ", \"bytes_per_op\": " << result.bytes_per_op;
+
+        bool first_counter = true;
+        for (std::size_t counter = 0; counter < COUNTER_COUNT; counter++) {
+            if (result.counters_per_op[counter] < 0) {
+                continue;
+            }
+            out << (first_counter ? ", \"counters_per_op\": {" : ", ") << "\"" << get_name(static_cast<Counter>(counter)) <<
+                "\": " << result.counters_per_op[counter];
+            first_counter = false;
+        }
+        out << (first_counter ? "}" : "}}");
+    }
+    out << "\n]}" << std::endl;
+}
+
+}
@@ -0,0 +1,204 @@
+#pragma once
+
+/*
+ * This file contains the pieces the benchmark executables share: counting heap allocations, reading hardware
+ * performance counters, pinning to a CPU, timing fixed numbers of iterations, and writing results as JSON.
+ */
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace milsymbol::bench {
+
+/**
+ * @brief Heap allocations made through global operator new on the calling thread since it started
+ */
+struct AllocationCounts {
+    std::uint64_t allocations = 0; /// Number of allocations
+    std::uint64_t bytes = 0; /// Total bytes requested
+
+    inline AllocationCounts operator-(const AllocationCounts& other) const noexcept {
+        return AllocationCounts{allocations - other.allocations, bytes - other.bytes};
+    }
+};
+
+/**
+ * @brief Returns the calling thread's allocation counts. Defined in bench/Allocations.cpp, which replaces global
+ * operator new and delete to count them, so every executable using the harness links it.
+ */
+AllocationCounts get_allocation_counts() noexcept;
+
+/**
+ * @brief A hardware performance counter
+ */
+enum class Counter {
+    CYCLES = 0, /// CPU cycles
+    INSTRUCTIONS, /// Instructions retired
+    L1D_MISSES, /// Level 1 data cache read misses
+    LLC_MISSES, /// Last level cache misses
+    BRANCH_MISSES, /// Mispredicted branches
+    COUNT
+};
+
+static constexpr std::size_t COUNTER_COUNT = static_cast<std::size_t>(Counter::COUNT);
+
+/**
+ * @brief Returns the name of a counter, as used in output
+ */
+const char* get_name(Counter counter) noexcept;
+
+/**
+ * @brief Returns whether benchmarks should read hardware counters, which is when the MILSYMBOL_BENCH_COUNTERS
+ * environment variable is set to anything but "0"
+ */
+bool hardware_counters_requested() noexcept;
+
+/**
+ * @brief Counts hardware events on the calling thread, in user space, with Linux perf_event_open. Counters the
+ * kernel doesn't allow (as under a restrictive perf_event_paranoid, or in most containers) or the CPU lacks are
+ * left out; outside Linux, none are available. Counts are scaled up when the kernel multiplexes counters.
+ */
+class HardwareCounters {
+public:
+    /// Counts of each counter, or -1 for those that aren't available
+    using Values = std::array<double, COUNTER_COUNT>;
+
+    /**
+     * @brief Opens every available counter, stopped, or none if `open` is false
+     */
+    explicit HardwareCounters(bool open = true) noexcept;
+    ~HardwareCounters() noexcept;
+
+    HardwareCounters(const HardwareCounters&) = delete;
+    HardwareCounters& operator=(const HardwareCounters&) = delete;
+
+    /**
+     * @brief Returns whether any counter could be opened
+     */
+    bool any_available() const noexcept;
+
+    /**
+     * @brief Zeroes the counters and starts counting
+     */
+    void start() noexcept;
+
+    /**
+     * @brief Stops counting until resume is called, keeping the counts so far
+     */
+    void pause() noexcept;
+
+    /**
+     * @brief Starts counting again after pause
+     */
+    void resume() noexcept;
+
+    /**
+     * @brief Stops counting and returns the counts since start
+     */
+    Values stop() noexcept;
+
+private:
+    std::array<int, COUNTER_COUNT> descriptors;
+};
+
+/**
+ * @brief Pins the calling thread to a CPU so runs are repeatable. Does nothing if `cpu` is negative.
+ * @return Whether the thread is pinned; always false outside Linux
+ */
+bool pin_to_cpu(int cpu) noexcept;
+
+/**
+ * @brief Keeps the compiler from optimizing away a value that a benchmark computes but doesn't use
+ */
+template<typename T>
+inline void keep(const T& value) noexcept {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * @brief Timing and allocations of one benchmark, per operation
+ */
+struct Result {
+    std::string name;
+    std::uint64_t iterations = 0; /// Operations in each repetition
+    int repetitions = 0;
+    double ns_per_op = 0; /// Median over repetitions
+    double min_ns_per_op = 0; /// Fastest repetition
+    double allocations_per_op = 0;
+    double bytes_per_op = 0; /// Bytes allocated per operation
+    HardwareCounters::Values counters_per_op{-1, -1, -1, -1, -1}; /// Hardware counts per operation, or -1 where not read
+};
+
+/// Number of times each benchmark is repeated, after one untimed warm-up repetition
+static constexpr int REPETITIONS = 5;
+
+/**
+ * @brief Runs `operation(std::uint64_t i)` for i from 0 to `iterations` in each of REPETITIONS timed
+ * repetitions, after an untimed one to warm caches. Allocations, and hardware counters if requested, are
+ * counted over the timed repetitions.
+ */
+template<typename Operation>
+inline Result run(std::string_view name, std::uint64_t iterations, Operation&& operation) {
+    using clock = std::chrono::steady_clock;
+
+    for (std::uint64_t i = 0; i < iterations; i++) {
+        operation(i);
+    }
+
+    std::vector<double> times;
+    times.reserve(REPETITIONS);
+    HardwareCounters counters{hardware_counters_requested()};
+    bool count_hardware = counters.any_available();
+    if (count_hardware) {
+        counters.start();
+    }
+    AllocationCounts before = get_allocation_counts();
+    for (int repetition = 0; repetition < REPETITIONS; repetition++) {
+        auto start = clock::now();
+        for (std::uint64_t i = 0; i < iterations; i++) {
+            operation(i);
+        }
+        times.push_back(std::chrono::duration<double, std::nano>(clock::now() - start).count() / iterations);
+    }
+    AllocationCounts allocated = get_allocation_counts() - before;
+    HardwareCounters::Values counts;
+    counts.fill(-1);
+    if (count_hardware) {
+        counts = counters.stop();
+    }
+
+    std::sort(times.begin(), times.end());
+    double operations = static_cast<double>(iterations) * REPETITIONS;
+    Result result{std::string{name}, iterations, REPETITIONS, times[times.size() / 2], times.front(),
+                  allocated.allocations / operations, allocated.bytes / operations};
+    for (std::size_t i = 0; i < COUNTER_COUNT; i++) {
+        result.counters_per_op[i] = (counts[i] < 0 ? -1 : counts[i] / operations);
+    }
+    return result;
+}
+
+/**
+ * @brief Writes a string as a JSON string literal
+ */
+void write_json_string(std::ostream& out, std::string_view value);
+
+/**
+ * @brief Writes the hardware counts that were read, and instructions per cycle if both were, as ", name value"
+ * pairs labeled with `unit` (such as "/op"), for human-readable output. Writes nothing if none were read.
+ */
+void write_counters(std::ostream& out, const HardwareCounters::Values& values, std::string_view unit);
+
+/**
+ * @brief Writes results as a JSON object with the benchmark suite's name, the CPU it was pinned to
+ * (-1 if none), and an array of results. Results with hardware counts have a "counters_per_op" object of the
+ * counters that were read.
+ */
+void write_json(std::ostream& out, std::string_view suite, int cpu, const std::vector<Result>& results);
+
+}
@@ -0,0 +1,181 @@
+#include "Symbol.hpp"
+#include "Atlas.hpp"
+#include "Rasterizer.hpp"
+#include "PngWriter.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fcntl.h>
+#include <iostream>
+#include <streambuf>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+
+/// Counts the bytes written to it and drops them
+struct CountingBuffer : std::streambuf {
+    std::size_t count = 0;
+
+protected:
+    int_type overflow(int_type c) override {
+        count += (c != traits_type::eof());
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize xsputn(const char*, std::streamsize size) override {
+        count += static_cast<std::size_t>(size);
+        return size;
+    }
+};
+
+/// Rows drawn at a time when streaming the atlas to a PNG
+constexpr int BAND_HEIGHT = 128;
+
+}
+
+/**
+ * @brief Lays out and rasterizes an atlas of the whole catalog - every entity with the four base
+ * affiliations and every echelon - once on a single thread and once on several, reporting each stage.
+ *
+ * The multi-threaded image must match the single-threaded one byte for byte. The atlas is then drawn
+ * again in bands of rows and streamed out as a PNG, holding only one band at a time, and the bands must
+ * match the whole image too byte for byte. Takes the icon size, the number of threads (0 for one per hardware thread),
+ * the number of echelons to use, from team upwards, and a path to write the PNG to as optional
+ * arguments; without a path, the PNG is only counted.
+ */
+int main(int argc, const char** argv) {
+    int icon_size = (argc > 1 ? std::atoi(argv[1]) : 32);
+    unsigned threads = (argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : 0);
+    int echelon_count = (argc > 3 ? std::atoi(argv[3]) : static_cast<int>(milsymbol::Echelon::COMMAND) + 1);
+    const char* png_path = (argc > 4 ? argv[4] : nullptr);
+
+    using clock = std::chrono::steady_clock;
+    auto to_ms = [](clock::duration duration) {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    };
+
+    milsymbol::SymbolStyle style;
+    style.set_icon_size(icon_size);
+
+    auto start = clock::now();
+    milsymbol::AtlasBuilder builder;
+    builder.with_style(style).with_max_width(4096);
+    for (auto symbol_set : milsymbol::Symbol::get_all_symbol_sets()) {
+        for (auto entity : milsymbol::Symbol::get_all_entities(static_cast<milsymbol::SymbolSet>(symbol_set))) {
+            for (auto affiliation : {milsymbol::Affiliation::HOSTILE, milsymbol::Affiliation::FRIEND,
+                                     milsymbol::Affiliation::NEUTRAL, milsymbol::Affiliation::UNKNOWN}) {
+                for (int echelon = 0; echelon < echelon_count; echelon++) {
+                    builder.add(milsymbol::Symbol{}
+                        .with_entity(static_cast<milsymbol::Entities>(symbol_set * 1000000 + entity))
+                        .with_affiliation(affiliation)
+                        .with_echelon(static_cast<milsymbol::Echelon>(echelon)));
+                }
+            }
+        }
+    }
+    auto collected = clock::now();
+    milsymbol::Atlas atlas = builder.build();
+    auto packed = clock::now();
+
+    std::cout << atlas.placements.size() << " symbols at icon size " << icon_size << " in a " <<
+        atlas.width << "x" << atlas.height << " atlas" << std::endl;
+    std::cout << "collect: " << to_ms(collected - start) << " ms" << std::endl;
+    std::cout << "layout and pack: " << to_ms(packed - collected) << " ms" << std::endl;
+
+    auto report = [&](const milsymbol::AtlasImage& image) {
+        std::cout << "  allocate: " << to_ms(image.stats.allocation) << " ms" << std::endl;
+        std::cout << "  rasterize: " << to_ms(image.stats.rasterization) << " ms wall, " <<
+            image.stats.workers.size() << " threads" << std::endl;
+        for (std::size_t i = 0; i < image.stats.workers.size(); i++) {
+            const auto& worker = image.stats.workers[i];
+            std::cout << "    thread " << i << ": " << worker.symbols << " symbols, geometry " <<
+                to_ms(worker.geometry) << " ms, drawing " << to_ms(worker.drawing) << " ms" << std::endl;
+        }
+    };
+
+    std::cout << "single thread:" << std::endl;
+    milsymbol::AtlasImage reference = milsymbol::AtlasRasterizer{}.with_threads(1).rasterize(atlas);
+    report(reference);
+
+    unsigned thread_count = (threads != 0 ? threads : std::max(1u, std::thread::hardware_concurrency()));
+    std::cout << thread_count << " threads:" << std::endl;
+    milsymbol::AtlasImage image = milsymbol::AtlasRasterizer{}.with_threads(thread_count).rasterize(atlas);
+    report(image);
+    std::cout << "speedup: " << to_ms(reference.stats.rasterization) / to_ms(image.stats.rasterization) << "x" << std::endl;
+
+    if (image.pixels != reference.pixels) {
+        std::cout << "multi-threaded image differs from the single-threaded one" << std::endl;
+        return 1;
+    }
+
+    // Stream the atlas to a PNG a band at a time, to a file or just counted
+    int fd = -1;
+    if (png_path != nullptr) {
+#if defined(_WIN32)
+        fd = open(png_path, O_WRONLY | O_CREAT | O_TRUNC | O_BINARY, 0644);
+#else
+        fd = open(png_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+#endif
+        if (fd < 0) {
+            std::cout << "couldn't open " << png_path << std::endl;
+            return 1;
+        }
+    }
+    CountingBuffer counter;
+    std::ostream counted(&counter);
+    milsymbol::PngWriter writer = (fd >= 0 ? milsymbol::PngWriter(fd, atlas.width, atlas.height) :
+                                   milsymbol::PngWriter(counted, atlas.width, atlas.height));
+    writer.with_premultiplied_alpha(true);
+
+    milsymbol::AtlasRasterizer banded = milsymbol::AtlasRasterizer{}.with_threads(thread_count);
+    std::vector<std::uint8_t> band(static_cast<std::size_t>(atlas.width) * BAND_HEIGHT * 4);
+    std::size_t row_bytes = static_cast<std::size_t>(atlas.width) * 4;
+    std::size_t bands_differing = 0;
+    clock::duration band_drawing{0};
+    int band_start = -BAND_HEIGHT;
+
+    start = clock::now();
+    bool written = writer.write_image([&](int y) {
+        if (y >= band_start + BAND_HEIGHT) {
+            band_start = y;
+            int rows = std::min(BAND_HEIGHT, atlas.height - y);
+            std::fill(band.begin(), band.end(), 0);
+            auto stats = banded.rasterize_rows(atlas, band_start, milsymbol::RasterTarget{band.data(), atlas.width, rows, 0});
+            band_drawing += stats.rasterization;
+            bands_differing += !std::equal(band.begin(), band.begin() + rows * row_bytes,
+                                           reference.pixels.begin() + band_start * row_bytes);
+        }
+        return band.data() + (y - band_start) * row_bytes;
+    });
+    auto streamed = clock::now();
+    std::size_t png_bytes = counter.count;
+    if (fd >= 0) {
+        png_bytes = static_cast<std::size_t>(lseek(fd, 0, SEEK_CUR));
+        close(fd);
+    }
+
+    std::cout << "banded PNG export, " << BAND_HEIGHT << " rows per band:" << std::endl;
+    std::cout << "  total: " << to_ms(streamed - start) << " ms, of which rasterizing " << to_ms(band_drawing) <<
+        " ms and encoding " << to_ms(streamed - start - band_drawing) << " ms" << std::endl;
+    std::cout << "  " << png_bytes << " bytes of PNG for " << reference.pixels.size() << " bytes of pixels" << std::endl;
+    std::cout << "  memory held: " << band.size() << " bytes of band and " << writer.get_buffer_size() <<
+        " bytes of encoder buffers, against " << reference.pixels.size() << " for the whole image" << std::endl;
+
+    if (!written) {
+        std::cout << "writing the PNG failed" << std::endl;
+        return 1;
+    }
+    if (bands_differing != 0) {
+        std::cout << bands_differing << " bands differ from the whole image" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,239 @@
+#include "Symbol.hpp"
+#include "Atlas.hpp"
+#include "SpriteSheet.hpp"
+#include "Tessellator.hpp"
+#include "HitTest.hpp"
+
+#include "Harness.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace milsymbol;
+
+namespace {
+
+/// A stream buffer that only counts what's written to it, so writing output doesn't allocate
+struct CountingBuffer : std::streambuf {
+    std::size_t count = 0;
+
+protected:
+    int_type overflow(int_type c) override {
+        count += (c != traits_type::eof());
+        return c;
+    }
+
+    std::streamsize xsputn(const char*, std::streamsize n) override {
+        count += static_cast<std::size_t>(n);
+        return n;
+    }
+};
+
+/// Allocations an API made, per symbol
+struct Measurement {
+    std::uint64_t allocations = 0;
+    std::uint64_t bytes = 0;
+};
+
+/// The most allocations and bytes of any single call of `call(symbol)` over every symbol, each after an
+/// uncounted call of `prepare(symbol)`
+template<typename Call, typename Prepare>
+Measurement measure_worst(const std::vector<Symbol>& symbols, Call&& call, Prepare&& prepare) {
+    Measurement worst;
+    for (const auto& symbol : symbols) {
+        prepare(symbol);
+        bench::AllocationCounts before = bench::get_allocation_counts();
+        call(symbol);
+        bench::AllocationCounts counts = bench::get_allocation_counts() - before;
+        worst.allocations = std::max(worst.allocations, counts.allocations);
+        worst.bytes = std::max(worst.bytes, counts.bytes);
+    }
+    return worst;
+}
+
+template<typename Call>
+Measurement measure_worst(const std::vector<Symbol>& symbols, Call&& call) {
+    return measure_worst(symbols, call, [](const Symbol&) {});
+}
+
+/// The allocations and bytes of one call of `call()` over every symbol, divided by the number of symbols and rounded up
+template<typename Call>
+Measurement measure_batch(const std::vector<Symbol>& symbols, Call&& call) {
+    bench::AllocationCounts before = bench::get_allocation_counts();
+    call();
+    bench::AllocationCounts counts = bench::get_allocation_counts() - before;
+    return Measurement{(counts.allocations + symbols.size() - 1) / symbols.size(), (counts.bytes + symbols.size() - 1) / symbols.size()};
+}
+
+}
+
+/**
+ * @brief Counts the heap allocations and bytes each public API makes per symbol over the catalog, and checks them
+ * against the budgets checked in to bench/allocation_budgets.txt, failing if any is exceeded or missing.
+ *
+ * Takes the budget file as its first argument. With "update" as the second, prints a budget file of the measured
+ * values instead of checking them, to be given headroom and checked in.
+ */
+int main(int argc, const char** argv) {
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0] << " <budget file> [update]" << std::endl;
+        return 2;
+    }
+    bool update = (argc > 2 && std::string_view{argv[2]} == "update");
+
+    // Every catalog entity, cycling through affiliations and amplifiers
+    constexpr Affiliation AFFILIATIONS[] = {Affiliation::PENDING, Affiliation::UNKNOWN, Affiliation::ASSUMED_FRIEND,
+                                           Affiliation::FRIEND, Affiliation::NEUTRAL, Affiliation::SUSPECT, Affiliation::HOSTILE};
+    std::vector<Symbol> symbols;
+    std::vector<std::string> sidcs;
+    for (auto symbol_set : Symbol::get_all_symbol_sets()) {
+        for (auto entity : Symbol::get_all_entities(static_cast<SymbolSet>(symbol_set))) {
+            int i = static_cast<int>(symbols.size());
+            symbols.push_back(Symbol{}
+                .with_entity(static_cast<Entities>(symbol_set * 1000000 + entity))
+                .with_affiliation(AFFILIATIONS[i % 7])
+                .with_echelon(i % 3 == 0 ? Echelon::BATTALION : Echelon::UNDEFINED)
+                .as_headquarters(i % 5 == 0)
+                .as_task_force(i % 4 == 0));
+
+            char sidc[20];
+            symbols.back().to_sidc(sidc);
+            sidcs.emplace_back(sidc, sizeof(sidc));
+        }
+    }
+
+    SymbolStyle style;
+
+    // Schema tables are built on first use; render everything once so building them isn't counted
+    for (const auto& symbol : symbols) {
+        bench::keep(symbol.get_svg(style).svg.size());
+    }
+
+    CountingBuffer counter;
+    std::ostream sink{&counter};
+
+    Atlas atlas;
+    {
+        AtlasBuilder builder;
+        for (const auto& symbol : symbols) {
+            builder.add(symbol);
+        }
+        atlas = builder.with_style(style).build();
+    }
+
+    Tessellator tessellator;
+    Mesh mesh;
+    for (const auto& symbol : symbols) {
+        tessellator.append(symbol, style, mesh);
+    }
+
+    std::map<std::string, Measurement> measured;
+    std::size_t next_sidc = 0;
+    measured["Symbol::from_sidc"] = measure_worst(symbols, [&](const Symbol&) {
+        bench::keep(Symbol::from_sidc(sidcs[next_sidc++ % sidcs.size()]));
+    });
+    measured["Symbol::get_layout"] = measure_worst(symbols, [&](const Symbol& symbol) {
+        bench::keep(symbol.get_layout(style).symbol_anchor);
+    });
+    measured["Symbol::get_svg"] = measure_worst(symbols, [&](const Symbol& symbol) {
+        bench::keep(symbol.get_svg(style).svg.size());
+    });
+    measured["Symbol::hit_test"] = measure_worst(symbols, [&](const Symbol& symbol) {
+        bench::keep(symbol.hit_test(Vector2{1, 1}, style));
+    }, [&](const Symbol& symbol) {
+        // Only tests of cached shapes are counted; building them is HitShape::from_symbol
+        symbol.hit_test(Vector2{0, 0}, style);
+    });
+    measured["HitShape::from_symbol"] = measure_worst(symbols, [&](const Symbol& symbol) {
+        bench::keep(HitShape::from_symbol(symbol, style).with_grid(HitShape::DEFAULT_GRID_SIZE).get_edge_count());
+    });
+    measured["Tessellator::append"] = measure_worst(symbols, [&](const Symbol& symbol) {
+        // Into a mesh with room to spare, as when rebuilding a batch each frame
+        mesh.clear();
+        bench::keep(tessellator.append(symbol, style, mesh).symbol_anchor);
+    });
+    std::size_t next_placement = 0;
+    measured["Atlas::write_placement_svg"] = measure_worst(symbols, [&](const Symbol&) {
+        atlas.write_placement_svg(sink, atlas.placements[next_placement++ % atlas.placements.size()]);
+    });
+    measured["AtlasBuilder::build"] = measure_batch(symbols, [&]() {
+        AtlasBuilder builder;
+        for (const auto& symbol : symbols) {
+            builder.add(symbol);
+        }
+        bench::keep(builder.with_style(style).build().height);
+    });
+    measured["Atlas::write_svg"] = measure_batch(symbols, [&]() {
+        atlas.write_svg(sink);
+    });
+    measured["SpriteSheetBuilder::build"] = measure_batch(symbols, [&]() {
+        SpriteSheetBuilder builder;
+        for (const auto& symbol : symbols) {
+            builder.add(symbol);
+        }
+        bench::keep(builder.with_style(style).build().svg.size());
+    });
+
+    if (update) {
+        std::cout << "# Allocation budgets checked by milsymbol-alloc-budgets. Each line is an API, then the most heap" << std::endl;
+        std::cout << "# allocations and bytes it may make per symbol: the worst single call over the catalog for" << std::endl;
+        std::cout << "# per-symbol calls, or the total divided by the number of symbols for calls taking many." << std::endl;
+        std::cout << "# Budgets are the measured values plus about 5% for differences between standard libraries; when an" << std::endl;
+        std::cout << "# intended change moves them, regenerate with `milsymbol-alloc-budgets <file> update`." << std::endl;
+        for (const auto& [name, measurement] : measured) {
+            std::cout << std::left << std::setw(32) << name << " " << std::setw(8) << measurement.allocations << " " <<
+                measurement.bytes << std::endl;
+        }
+        return 0;
+    }
+
+    std::ifstream file{argv[1]};
+    if (!file) {
+        std::cerr << "can't open budget file " << argv[1] << std::endl;
+        return 2;
+    }
+
+    std::map<std::string, Measurement> budgets;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream fields{line};
+        std::string name;
+        Measurement budget;
+        if (fields >> name >> budget.allocations >> budget.bytes) {
+            budgets[name] = budget;
+        }
+    }
+
+    int failures = 0;
+    for (const auto& [name, measurement] : measured) {
+        auto budget = budgets.find(name);
+        bool over = (budget == budgets.end() || measurement.allocations > budget->second.allocations ||
+                     measurement.bytes > budget->second.bytes);
+        failures += over;
+
+        std::cout << (over ? "OVER " : "ok   ") << std::left << std::setw(32) << name << " " << measurement.allocations <<
+            " allocations, " << measurement.bytes << " bytes";
+        if (budget == budgets.end()) {
+            std::cout << " (no budget)";
+        } else {
+            std::cout << " (budget " << budget->second.allocations << ", " << budget->second.bytes << ")";
+        }
+        std::cout << std::endl;
+    }
+
+    if (failures > 0) {
+        std::cout << failures << " APIs over their allocation budgets" << std::endl;
+    }
+    return (failures == 0 ? 0 : 1);
+}
@@ -0,0 +1,75 @@
+import os
+import sys
+import json
+import time
+import argparse
+import subprocess
+
+"""
+This file measures what it costs to compile each translation unit of the library: wall time
+and the compiler's peak memory, one file at a time so they don't compete. It's run as the
+`build` benchmark, and writes JSON to standard output, to track over time, with a table on
+standard error.
+"""
+
+"""
+Compiles one source file to a throwaway object file with the given command, returning its
+wall time in seconds and peak resident memory in megabytes, or None if it failed
+"""
+def measure_compile(compiler:list, flags:list, source:str) -> tuple:
+	command = compiler + flags + ['-c', source, '-o', os.devnull]
+	start = time.monotonic()
+	process = subprocess.Popen(command)
+
+	# wait4 reports the resources of this one child, rather than every child so far
+	_, status, usage = os.wait4(process.pid, 0)
+	seconds = time.monotonic() - start
+	process.returncode = os.waitstatus_to_exitcode(status) # Reaped here, so Popen mustn't wait for it again
+	if process.returncode != 0:
+		print(f'Compiling "{source}" failed', file=sys.stderr)
+		return None
+
+	# ru_maxrss is in kilobytes on Linux, but bytes on macOS
+	peak_bytes = usage.ru_maxrss if sys.platform == 'darwin' else usage.ru_maxrss * 1024
+	return seconds, peak_bytes / (1024 * 1024)
+
+if __name__ == '__main__':
+	parser = argparse.ArgumentParser('milsymbol-build-time', description='Measures compile time and peak compiler memory per source file')
+	parser.add_argument('--compiler', dest='compiler', nargs='+', default=[os.environ.get('CXX', 'c++')],
+		help='Compiler command, which may be several words (e.g. ccache c++)')
+	parser.add_argument('--flag', dest='flags', action='append', default=[],
+		help='Flag to compile with, such as -O2; can be given several times')
+	parser.add_argument('--include', dest='includes', action='append', default=[],
+		help='Include directory; can be given several times')
+	parser.add_argument('sources', nargs='+', help='Source files to compile')
+	arguments = parser.parse_args()
+
+	flags = ['-std=c++20'] + arguments.flags + [f'-I{directory}' for directory in arguments.includes]
+
+	results = []
+	for source in arguments.sources:
+		measured = measure_compile(arguments.compiler, flags, source)
+		if measured is None:
+			sys.exit(1)
+		results.append({'source': source, 'seconds': measured[0], 'peak_mb': measured[1]})
+
+	# Slowest first, since those bound a parallel build
+	results.sort(key=lambda result: result['seconds'], reverse=True)
+	total_seconds = sum(result['seconds'] for result in results)
+	slowest_seconds = max(result['seconds'] for result in results)
+	peak_mb = max(result['peak_mb'] for result in results)
+
+	print(f'{"source":<56} {"seconds":>8} {"peak MB":>8}', file=sys.stderr)
+	for result in results:
+		print(f'{os.path.relpath(result["source"]):<56} {result["seconds"]:>8.2f} {result["peak_mb"]:>8.0f}', file=sys.stderr)
+	print(f'{"total (serial)":<56} {total_seconds:>8.2f} {peak_mb:>8.0f}', file=sys.stderr)
+
+	print(json.dumps({
+		'suite': 'milsymbol-build-time',
+		'compiler': ' '.join(arguments.compiler),
+		'flags': flags,
+		'total_seconds': total_seconds,
+		'slowest_seconds': slowest_seconds,
+		'peak_mb': peak_mb,
+		'results': results
+	}, indent=1))
@@ -0,0 +1,194 @@
+#include "Symbol.hpp"
+
+#include "Harness.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace milsymbol;
+
+namespace {
+
+constexpr Affiliation AFFILIATIONS[] = {Affiliation::PENDING, Affiliation::UNKNOWN, Affiliation::ASSUMED_FRIEND,
+                                       Affiliation::FRIEND, Affiliation::NEUTRAL, Affiliation::SUSPECT, Affiliation::HOSTILE};
+constexpr ColorMode COLOR_MODES[] = {ColorMode::LIGHT, ColorMode::MEDIUM, ColorMode::DARK, ColorMode::UNFILLED};
+constexpr const char* COLOR_MODE_NAMES[] = {"light", "medium", "dark", "unfilled"};
+
+constexpr int ECHELON_COUNT = static_cast<int>(Echelon::COMMAND) + 2; /// Every echelon, and none
+constexpr int MOBILITY_COUNT = static_cast<int>(Mobility::LONG_TOWED_ARRAY) + 1; /// Every mobility, and none
+constexpr int FLAG_COUNT = 8; /// Every combination of headquarters, task force and feint/dummy
+
+/// One rendered symbol
+struct Render {
+    char sidc[20];
+    int color_mode;
+    double ns;
+    std::size_t bytes;
+};
+
+/// Returns the number of echelon or mobility options a symbol set takes; equipment has mobility, units have echelons
+int get_amplifier_count(SymbolSet symbol_set) {
+    switch (symbol_set) {
+    case SymbolSet::LAND_UNIT:
+    case SymbolSet::LAND_CIVILIAN_UNIT_ORGANIZATION:
+        return ECHELON_COUNT;
+    case SymbolSet::LAND_EQUIPMENT:
+        return MOBILITY_COUNT;
+    default:
+        return 1;
+    }
+}
+
+/// Sets the symbol set's echelon or mobility option and the flag combination, each by index
+Symbol with_amplifiers(Symbol symbol, SymbolSet symbol_set, int amplifier, int flags) {
+    if (symbol_set == SymbolSet::LAND_EQUIPMENT) {
+        symbol.with_mobility(static_cast<Mobility>(amplifier));
+    } else if (get_amplifier_count(symbol_set) > 1) {
+        symbol.with_echelon(static_cast<Echelon>(amplifier - 1));
+    }
+    return symbol.as_headquarters(flags & 1).as_task_force(flags & 2).as_feint_or_dummy(flags & 4);
+}
+
+/// Returns a symbol with its modifier 1 or 2 set, through its SIDC, since symbols only take modifiers from SIDCs
+Symbol with_modifier(const Symbol& symbol, int index, int modifier) {
+    char sidc[20];
+    symbol.to_sidc(sidc);
+    sidc[16 + 2 * (index - 1)] = static_cast<char>('0' + modifier / 10 % 10);
+    sidc[17 + 2 * (index - 1)] = static_cast<char>('0' + modifier % 10);
+    return Symbol::from_sidc(std::string_view{sidc, sizeof(sidc)});
+}
+
+}
+
+/**
+ * @brief Renders the whole catalog through get_svg: every entity and every modifier 1 and 2 of each symbol
+ * set, with every affiliation and color mode. Echelons (for units), mobility (for equipment) and headquarters,
+ * task force and feint/dummy combinations are cycled through across entities, or crossed with every entity if
+ * the first argument is "full". Reports symbols/sec and output MB/sec overall and per symbol set, along with
+ * the ten slowest and ten largest outputs of each set. The second argument is the CPU to pin to (default 0,
+ * or -1 for none). Set MILSYMBOL_BENCH_COUNTERS=1 to also report hardware counters per symbol, counted only
+ * inside get_svg.
+ */
+int main(int argc, const char** argv) {
+    bool full = (argc > 1 && std::string_view{argv[1]} == "full");
+    int cpu = (argc > 2 ? std::atoi(argv[2]) : 0);
+    bench::pin_to_cpu(cpu);
+
+    using clock = std::chrono::steady_clock;
+    SymbolStyle styles[4];
+    for (int i = 0; i < 4; i++) {
+        styles[i].color_mode = COLOR_MODES[i];
+    }
+
+    std::size_t total_count = 0, total_bytes = 0;
+    double total_ns = 0;
+    bench::AllocationCounts allocations_before = bench::get_allocation_counts();
+
+    bench::HardwareCounters counters{bench::hardware_counters_requested()};
+    bench::HardwareCounters::Values total_counts;
+    total_counts.fill(-1);
+
+    std::vector<Render> renders;
+    auto render = [&](const Symbol& symbol) {
+        for (int color_mode = 0; color_mode < 4; color_mode++) {
+            counters.resume();
+            auto start = clock::now();
+            Symbol::RichOutput output = symbol.get_svg(styles[color_mode]);
+            double ns = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+            counters.pause();
+
+            Render result{{}, color_mode, ns, output.svg.size()};
+            symbol.to_sidc(result.sidc);
+            renders.push_back(result);
+        }
+    };
+
+    std::cout << std::fixed << std::setprecision(1);
+    for (auto symbol_set_code : Symbol::get_all_symbol_sets()) {
+        auto symbol_set = static_cast<SymbolSet>(symbol_set_code);
+        auto entities = Symbol::get_all_entities(symbol_set);
+        int amplifier_count = get_amplifier_count(symbol_set);
+        renders.clear();
+        counters.start();
+        counters.pause();
+
+        int cycle = 0;
+        for (auto entity : entities) {
+            Symbol base = Symbol{}.with_entity(static_cast<Entities>(symbol_set_code * 1000000 + entity));
+            for (auto affiliation : AFFILIATIONS) {
+                base.with_affiliation(affiliation);
+                if (full) {
+                    for (int amplifier = 0; amplifier < amplifier_count; amplifier++) {
+                        for (int flags = 0; flags < FLAG_COUNT; flags++) {
+                            render(with_amplifiers(base, symbol_set, amplifier, flags));
+                        }
+                    }
+                } else {
+                    render(with_amplifiers(base, symbol_set, cycle % amplifier_count, cycle % FLAG_COUNT));
+                    cycle++;
+                }
+            }
+        }
+
+        Symbol first = Symbol{}.with_entity(static_cast<Entities>(symbol_set_code * 1000000 + (entities.empty() ? 0 : entities[0])));
+        for (int index : {1, 2}) {
+            for (auto modifier : (index == 1 ? Symbol::get_all_modifier_1s(symbol_set) : Symbol::get_all_modifier_2s(symbol_set))) {
+                for (auto affiliation : AFFILIATIONS) {
+                    render(with_modifier(Symbol{first}.with_affiliation(affiliation), index, modifier));
+                }
+            }
+        }
+
+        bench::HardwareCounters::Values set_counts = counters.stop();
+        for (std::size_t i = 0; i < bench::COUNTER_COUNT; i++) {
+            total_counts[i] = (set_counts[i] < 0 ? -1 : std::max(total_counts[i], 0.0) + set_counts[i]);
+            set_counts[i] = (set_counts[i] < 0 ? -1 : set_counts[i] / renders.size());
+        }
+
+        std::size_t set_bytes = 0;
+        double set_ns = 0;
+        for (const auto& result : renders) {
+            set_bytes += result.bytes;
+            set_ns += result.ns;
+        }
+        total_count += renders.size();
+        total_bytes += set_bytes;
+        total_ns += set_ns;
+
+        std::cout << "symbol set " << symbol_set_code << ": " << renders.size() << " symbols, " <<
+            renders.size() / (set_ns / 1e9) << " symbols/sec, " << set_bytes / 1e6 / (set_ns / 1e9) << " MB/sec, " <<
+            static_cast<double>(set_bytes) / renders.size() << " bytes/symbol";
+        bench::write_counters(std::cout, set_counts, "/symbol");
+        std::cout << std::endl;
+
+        auto print_top = [&](const char* title, auto&& greater) {
+            std::size_t count = std::min<std::size_t>(10, renders.size());
+            std::partial_sort(renders.begin(), renders.begin() + count, renders.end(), greater);
+            std::cout << "  " << title << ":" << std::endl;
+            for (std::size_t i = 0; i < count; i++) {
+                const Render& result = renders[i];
+                std::cout << "    " << std::string_view{result.sidc, sizeof(result.sidc)} << " " <<
+                    COLOR_MODE_NAMES[result.color_mode] << ": " << result.ns / 1000 << " us, " << result.bytes << " bytes" << std::endl;
+            }
+        };
+        print_top("slowest", [](const Render& a, const Render& b) {return a.ns > b.ns;});
+        print_top("largest", [](const Render& a, const Render& b) {return a.bytes > b.bytes;});
+    }
+
+    bench::AllocationCounts allocations = bench::get_allocation_counts() - allocations_before;
+    std::cout << "total: " << total_count << " symbols in " << total_ns / 1e9 << " s, " << total_count / (total_ns / 1e9) <<
+        " symbols/sec, " << total_bytes / 1e6 / (total_ns / 1e9) << " MB/sec, " << static_cast<double>(total_bytes) / total_count <<
+        " bytes/symbol, " << static_cast<double>(allocations.allocations) / total_count << " allocations/symbol";
+    for (auto& count : total_counts) {
+        count = (count < 0 ? -1 : count / total_count);
+    }
+    bench::write_counters(std::cout, total_counts, "/symbol");
+    std::cout << std::endl;
+    return 0;
+}
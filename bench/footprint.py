@@ -0,0 +1,121 @@
+import os
+import sys
+import json
+import struct
+import argparse
+import statistics
+import subprocess
+
+"""
+This file measures the footprint of a built library: its size on disk, the size of the code and
+data it loads, and how long loading it takes. Given a baseline library, such as one built with
+every symbol set when the `symbol_sets` option leaves some out, it also reports what was saved.
+It's run as the `footprint` benchmark, and writes JSON to standard output, to track over time,
+with a table on standard error.
+"""
+
+# Section flags and types from the ELF specification
+SHF_WRITE = 0x1
+SHF_ALLOC = 0x2
+SHF_EXECINSTR = 0x4
+SHT_NOBITS = 8
+
+"""
+Returns the bytes a 64-bit ELF file loads into memory, split like the `size` tool into `text`
+(code), `rodata` (constants), `data` (initialized writable data) and `bss` (zeroed data), or
+None if the file isn't one
+"""
+def get_section_sizes(path:str) -> dict:
+	with open(path, 'rb') as library_file:
+		data = library_file.read()
+	if len(data) < 0x40 or data[:4] != b'\x7fELF' or data[4] != 2:
+		return None
+
+	endian = '<' if data[5] == 1 else '>'
+	(section_offset,) = struct.unpack_from(endian + 'Q', data, 0x28)
+	section_entry_size, section_count = struct.unpack_from(endian + 'HH', data, 0x3A)
+
+	sizes = {'text': 0, 'rodata': 0, 'data': 0, 'bss': 0}
+	for index in range(section_count):
+		entry = section_offset + index * section_entry_size
+		section_type, flags = struct.unpack_from(endian + 'IQ', data, entry + 0x4)
+		(size,) = struct.unpack_from(endian + 'Q', data, entry + 0x20)
+		if not flags & SHF_ALLOC:
+			continue
+		if section_type == SHT_NOBITS:
+			sizes['bss'] += size
+		elif flags & SHF_EXECINSTR:
+			sizes['text'] += size
+		elif flags & SHF_WRITE:
+			sizes['data'] += size
+		else:
+			sizes['rodata'] += size
+	return sizes
+
+"""
+Returns how long each of `trials` fresh processes took to load the shared library at `path`,
+resolving every symbol and running its static initializers, in milliseconds
+"""
+def measure_load_times(path:str, trials:int) -> list:
+	# Timed inside the child, so interpreter startup isn't counted
+	script = ('import ctypes, os, time\n'
+		'start = time.perf_counter()\n'
+		f'ctypes.CDLL({path!r}, mode=os.RTLD_NOW)\n'
+		'print((time.perf_counter() - start) * 1000)\n')
+	times = []
+	for _ in range(trials):
+		output = subprocess.run([sys.executable, '-c', script], check=True, capture_output=True, text=True).stdout
+		times.append(float(output))
+	return times
+
+"""
+Measures one library, leaving out load times if it's a static library that can't be loaded
+"""
+def measure_library(path:str, trials:int) -> dict:
+	result = {'path': path, 'file_bytes': os.path.getsize(path), 'sections': get_section_sizes(path)}
+	if result['sections'] is not None:
+		result['loaded_bytes'] = sum(result['sections'].values())
+
+	if not path.endswith(('.a', '.lib')):
+		times = measure_load_times(path, trials)
+		result['load_ms'] = {'median': statistics.median(times), 'min': min(times)}
+	return result
+
+def write_row(name:str, values:dict) -> None:
+	sections = values.get('sections') or {}
+	columns = [values.get('file_bytes'), values.get('loaded_bytes')] + [sections.get(key) for key in ['text', 'rodata', 'data', 'bss']]
+	load = values.get('load_ms', {}).get('median')
+	print(f'{name:<10}' + ''.join(f'{value:>12}' if value is not None else f'{"-":>12}' for value in columns) +
+		(f'{load:>10.2f}' if load is not None else f'{"-":>10}'), file=sys.stderr)
+
+if __name__ == '__main__':
+	parser = argparse.ArgumentParser('milsymbol-footprint', description='Measures the size and load time of a built library')
+	parser.add_argument('library', help='Library to measure')
+	parser.add_argument('--baseline', dest='baseline', default=None,
+		help='Library to compare against, such as one built with every symbol set')
+	parser.add_argument('--trials', dest='trials', type=int, default=25,
+		help='Processes to time loading each library in; the median is reported')
+	arguments = parser.parse_args()
+
+	library = measure_library(arguments.library, arguments.trials)
+	baseline = measure_library(arguments.baseline, arguments.trials) if arguments.baseline is not None else None
+
+	report = {'suite': 'milsymbol-footprint', 'library': library}
+	print(f'{"":<10}{"file":>12}{"loaded":>12}{"text":>12}{"rodata":>12}{"data":>12}{"bss":>12}{"load ms":>10}', file=sys.stderr)
+	write_row('library', library)
+
+	if baseline is not None:
+		saved = {'file_bytes': baseline['file_bytes'] - library['file_bytes']}
+		if library['sections'] is not None and baseline['sections'] is not None:
+			saved['loaded_bytes'] = baseline['loaded_bytes'] - library['loaded_bytes']
+			saved['sections'] = {key: baseline['sections'][key] - library['sections'][key] for key in library['sections']}
+		if 'load_ms' in library and 'load_ms' in baseline:
+			saved['load_ms'] = {'median': baseline['load_ms']['median'] - library['load_ms']['median']}
+		report['baseline'] = baseline
+		report['saved'] = saved
+
+		write_row('baseline', baseline)
+		write_row('saved', saved)
+		print(f'saved {100 * saved["file_bytes"] / baseline["file_bytes"]:.1f}% of the file size', file=sys.stderr)
+
+	print(json.dumps(report, indent=1))
@@ -0,0 +1,115 @@
+#include "Symbol.hpp"
+#include "HitTest.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+/**
+ * @brief Builds hit shapes for every catalog entity with the four base affiliations and tests random points
+ * around each of them, checking that the grid gives the same answers as walking every edge and timing each
+ * way, along with Symbol::hit_test. Takes the icon size and the number of points per symbol as optional arguments.
+ */
+int main(int argc, const char** argv) {
+    int icon_size = (argc > 1 ? std::atoi(argv[1]) : 64);
+    int points_per_symbol = (argc > 2 ? std::atoi(argv[2]) : 256);
+
+    milsymbol::SymbolStyle style;
+    style.set_icon_size(icon_size);
+
+    std::vector<milsymbol::Symbol> symbols;
+    for (auto symbol_set : milsymbol::Symbol::get_all_symbol_sets()) {
+        for (auto entity : milsymbol::Symbol::get_all_entities(static_cast<milsymbol::SymbolSet>(symbol_set))) {
+            for (auto affiliation : {milsymbol::Affiliation::HOSTILE, milsymbol::Affiliation::FRIEND,
+                                     milsymbol::Affiliation::NEUTRAL, milsymbol::Affiliation::UNKNOWN}) {
+                symbols.push_back(milsymbol::Symbol{}
+                    .with_entity(static_cast<milsymbol::Entities>(symbol_set * 1000000 + entity))
+                    .with_affiliation(affiliation));
+            }
+        }
+    }
+
+    using clock = std::chrono::steady_clock;
+    std::vector<milsymbol::HitShape> shapes;
+    shapes.reserve(symbols.size());
+
+    auto start = clock::now();
+    for (const auto& symbol : symbols) {
+        shapes.push_back(milsymbol::HitShape::from_symbol(symbol, style));
+    }
+    double build_ns = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+
+    start = clock::now();
+    for (auto& shape : shapes) {
+        shape.with_grid(milsymbol::HitShape::DEFAULT_GRID_SIZE);
+    }
+    double grid_ns = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+
+    // Points spread over each symbol's bounding box and a margin around it, from a fixed generator
+    std::uint32_t state = 12345;
+    auto next = [&state]() {
+        state = state * 1664525u + 1013904223u;
+        return static_cast<float>(state >> 8) / static_cast<float>(1u << 24);
+    };
+    std::vector<milsymbol::Vector2> points;
+    points.reserve(symbols.size() * points_per_symbol);
+    std::size_t edges = 0, bytes = 0;
+    for (const auto& shape : shapes) {
+        const auto& bbox = shape.get_bbox();
+        for (int i = 0; i < points_per_symbol; i++) {
+            points.push_back(milsymbol::Vector2{bbox.x1 - 4 + next() * (bbox.width() + 8), bbox.y1 - 4 + next() * (bbox.height() + 8)});
+        }
+        edges += shape.get_edge_count();
+        bytes += shape.get_memory_size();
+    }
+
+    // Brute force, without the grid
+    std::vector<milsymbol::HitShape> plain = shapes;
+    for (auto& shape : plain) {
+        shape.with_grid(0);
+    }
+
+    std::vector<bool> expected(points.size());
+    start = clock::now();
+    for (std::size_t i = 0; i < points.size(); i++) {
+        expected[i] = plain[i / points_per_symbol].contains(points[i]);
+    }
+    double plain_ns = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+
+    std::size_t hits = 0, mismatches = 0;
+    start = clock::now();
+    for (std::size_t i = 0; i < points.size(); i++) {
+        bool hit = shapes[i / points_per_symbol].contains(points[i]);
+        hits += hit;
+        mismatches += (hit != expected[i]);
+    }
+    double gridded_ns = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+
+    // Symbol::hit_test, with a cursor moving over one symbol at a time; the first test of each symbol builds
+    // its shape and isn't timed
+    std::size_t cached_mismatches = 0;
+    double cached_ns = 0;
+    for (std::size_t s = 0; s < symbols.size(); s++) {
+        std::size_t first = s * points_per_symbol;
+        cached_mismatches += (symbols[s].hit_test(points[first], style) != expected[first]);
+
+        start = clock::now();
+        for (std::size_t i = first + 1; i < first + points_per_symbol; i++) {
+            cached_mismatches += (symbols[s].hit_test(points[i], style) != expected[i]);
+        }
+        cached_ns += std::chrono::duration<double, std::nano>(clock::now() - start).count();
+    }
+
+    std::cout << symbols.size() << " symbols at icon size " << icon_size << ", " << points.size() << " points, " <<
+        static_cast<double>(hits) / points.size() * 100 << "% hits" << std::endl;
+    std::cout << "building: " << build_ns / symbols.size() << " ns/symbol, grid " << grid_ns / symbols.size() <<
+        " ns/symbol; " << static_cast<double>(edges) / symbols.size() << " edges and " <<
+        static_cast<double>(bytes) / symbols.size() << " bytes per symbol" << std::endl;
+    std::cout << "testing: " << plain_ns / points.size() << " ns/point walking every edge, " <<
+        gridded_ns / points.size() << " ns/point with the grid, " << cached_ns / (points.size() - symbols.size()) <<
+        " ns/point through Symbol::hit_test" << std::endl;
+    std::cout << mismatches + cached_mismatches << " mismatches" << std::endl;
+    return (mismatches + cached_mismatches == 0 ? 0 : 1);
+}
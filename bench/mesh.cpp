@@ -0,0 +1,86 @@
+#include "Symbol.hpp"
+#include "Tessellator.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+/**
+ * @brief Tessellates every catalog entity with the four base affiliations into one batched mesh, as a
+ * client would at startup, and checks the buffers: indices in range, finite positions and clockwise
+ * triangles. Takes the icon size and the number of passes as optional arguments.
+ */
+int main(int argc, const char** argv) {
+    int icon_size = (argc > 1 ? std::atoi(argv[1]) : 64);
+    int passes = (argc > 2 ? std::atoi(argv[2]) : 3);
+
+    milsymbol::SymbolStyle style;
+    style.set_icon_size(icon_size);
+
+    std::vector<milsymbol::Symbol> symbols;
+    for (auto symbol_set : milsymbol::Symbol::get_all_symbol_sets()) {
+        for (auto entity : milsymbol::Symbol::get_all_entities(static_cast<milsymbol::SymbolSet>(symbol_set))) {
+            for (auto affiliation : {milsymbol::Affiliation::HOSTILE, milsymbol::Affiliation::FRIEND,
+                                     milsymbol::Affiliation::NEUTRAL, milsymbol::Affiliation::UNKNOWN}) {
+                symbols.push_back(milsymbol::Symbol{}
+                    .with_entity(static_cast<milsymbol::Entities>(symbol_set * 1000000 + entity))
+                    .with_affiliation(affiliation));
+            }
+        }
+    }
+
+    using clock = std::chrono::steady_clock;
+    milsymbol::Tessellator tessellator;
+    milsymbol::Mesh mesh;
+    std::vector<std::size_t> first_indices(symbols.size());
+
+    auto start = clock::now();
+    for (int pass = 0; pass < passes; pass++) {
+        mesh.clear();
+        for (std::size_t i = 0; i < symbols.size(); i++) {
+            first_indices[i] = mesh.indices.size();
+            tessellator.append(symbols[i], style, mesh);
+        }
+    }
+    double total_ns = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+
+    std::cout << symbols.size() << " symbols at icon size " << icon_size << ", " << passes << " passes" << std::endl;
+    std::cout << "tessellation: " << total_ns / (symbols.size() * passes) << " ns/symbol, " <<
+        total_ns / 1e6 / passes << " ms per pass" << std::endl;
+    std::cout << mesh.get_triangle_count() << " triangles, " << mesh.vertices.size() << " vertices (" <<
+        static_cast<double>(mesh.get_triangle_count()) / symbols.size() << " triangles per symbol), " <<
+        mesh.vertices.size() * sizeof(milsymbol::Mesh::Vertex) + mesh.indices.size() * sizeof(std::uint32_t) <<
+        " buffer bytes" << std::endl;
+
+    // Every symbol should have triangles, and every triangle should be valid
+    std::size_t empty = 0;
+    for (std::size_t i = 0; i < symbols.size(); i++) {
+        std::size_t end = (i + 1 < symbols.size() ? first_indices[i + 1] : mesh.indices.size());
+        empty += (first_indices[i] == end);
+    }
+
+    std::size_t invalid = 0;
+    for (std::size_t i = 0; i + 2 < mesh.indices.size(); i += 3) {
+        bool in_range = true;
+        for (int corner = 0; corner < 3; corner++) {
+            in_range = in_range && mesh.indices[i + corner] < mesh.vertices.size();
+        }
+        if (!in_range) {
+            invalid++;
+            continue;
+        }
+
+        const auto& a = mesh.vertices[mesh.indices[i]];
+        const auto& b = mesh.vertices[mesh.indices[i + 1]];
+        const auto& c = mesh.vertices[mesh.indices[i + 2]];
+        float area = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+        if (!std::isfinite(area) || area < -1e-3f) {
+            invalid++;
+        }
+    }
+
+    std::cout << empty << " symbols without triangles, " << invalid << " invalid triangles" << std::endl;
+    return (invalid == 0 ? 0 : 1);
+}
@@ -0,0 +1,125 @@
+#include "Symbol.hpp"
+#include "Schema.hpp"
+#include "SymbolGeometries.hpp"
+#include "SymbolParts.hpp"
+
+#include "Harness.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace milsymbol;
+
+/**
+ * @brief Micro-benchmarks of each stage of rendering a symbol: parsing SIDCs, looking up entity layers, building
+ * frames and amplifiers, serializing draw commands, and whole get_svg calls. Iteration counts are fixed, and
+ * the process is pinned to one CPU, so runs are comparable. Results are written to standard output as JSON,
+ * with a table on standard error.
+ *
+ * Takes the CPU to pin to (default 0, or -1 for none) and a substring that benchmark names must contain to
+ * run as optional arguments. Set MILSYMBOL_BENCH_COUNTERS=1 to also report hardware counters per operation.
+ */
+int main(int argc, const char** argv) {
+    int cpu = (argc > 1 ? std::atoi(argv[1]) : 0);
+    std::string_view filter = (argc > 2 ? argv[2] : "");
+    if (!bench::pin_to_cpu(cpu)) {
+        cpu = -1;
+    }
+
+    // Every catalog entity, cycling through affiliations and a few amplifiers so no one branch is hot
+    constexpr Affiliation AFFILIATIONS[] = {Affiliation::PENDING, Affiliation::UNKNOWN, Affiliation::ASSUMED_FRIEND,
+                                           Affiliation::FRIEND, Affiliation::NEUTRAL, Affiliation::SUSPECT, Affiliation::HOSTILE};
+    std::vector<Symbol> symbols;
+    for (auto symbol_set : Symbol::get_all_symbol_sets()) {
+        for (auto entity : Symbol::get_all_entities(static_cast<SymbolSet>(symbol_set))) {
+            int i = static_cast<int>(symbols.size());
+            symbols.push_back(Symbol{}
+                .with_entity(static_cast<Entities>(symbol_set * 1000000 + entity))
+                .with_affiliation(AFFILIATIONS[i % 7])
+                .with_echelon(i % 3 == 0 ? Echelon::BATTALION : Echelon::UNDEFINED)
+                .as_headquarters(i % 5 == 0));
+        }
+    }
+
+    std::vector<std::string> sidcs;
+    for (const auto& symbol : symbols) {
+        char sidc[20];
+        symbol.to_sidc(sidc);
+        sidcs.emplace_back(sidc, sizeof(sidc));
+    }
+
+    SymbolStyle style;
+    std::vector<_impl::SymbolParts> parts;
+    for (std::size_t i = 0; i < symbols.size(); i += 16) {
+        parts.push_back(_impl::get_symbol_parts(symbols[i], style));
+    }
+
+    std::vector<bench::Result> results;
+    auto add = [&](std::string_view name, std::uint64_t iterations, auto&& operation) {
+        if (name.find(filter) == std::string_view::npos) {
+            return;
+        }
+        results.push_back(bench::run(name, iterations, operation));
+        const auto& result = results.back();
+        std::cerr << result.name << ": " << result.ns_per_op << " ns/op, " << result.allocations_per_op <<
+            " allocs/op, " << result.bytes_per_op << " bytes/op";
+        bench::write_counters(std::cerr, result.counters_per_op, "/op");
+        std::cerr << std::endl;
+    };
+
+    add("from_sidc", 1000000, [&](std::uint64_t i) {
+        bench::keep(Symbol::from_sidc(sidcs[i % sidcs.size()]));
+    });
+
+    add("get_symbol_layer", 2000, [&](std::uint64_t i) {
+        const Symbol& symbol = symbols[i % symbols.size()];
+        auto layer = _impl::get_symbol_layer(symbol.get_symbol_set(), symbol.get_entity(), _impl::IconType::ENTITY);
+        bench::keep(layer.draw_items.size());
+    });
+
+    add("get_base_symbol_geometry", 100000, [&](std::uint64_t i) {
+        auto dimension = static_cast<Dimension>(i % 6);
+        auto geometry = _impl::get_base_symbol_geometry(dimension, _impl::get_base_affiliation(AFFILIATIONS[i / 6 % 7]));
+        bench::keep(geometry.get_type());
+    });
+
+    std::vector<_impl::DrawCommand> amplifiers;
+    add("apply_amplifiers", 100000, [&](std::uint64_t i) {
+        const Symbol& symbol = symbols[i % symbols.size()];
+        Vector2 staff_base;
+        amplifiers.clear();
+        bench::keep(_impl::apply_amplifiers(style, symbol, BoundingBox{25, 50, 175, 150}, amplifiers, staff_base));
+    });
+
+    add("get_symbol_parts", 2000, [&](std::uint64_t i) {
+        auto symbol_parts = _impl::get_symbol_parts(symbols[i % symbols.size()], style);
+        bench::keep(symbol_parts.valid);
+    });
+
+    add("serialize", 10000, [&](std::uint64_t i) {
+        const auto& symbol_parts = parts[i % parts.size()];
+        std::stringstream ss;
+        for (const auto* part : {&symbol_parts.frame, &symbol_parts.amplifiers, &symbol_parts.entity,
+                                 &symbol_parts.modifier_1, &symbol_parts.modifier_2}) {
+            for (const auto& command : *part) {
+                ss << command.get_svg_string(symbol_parts.style) << std::endl;
+            }
+        }
+        bench::keep(ss.tellp());
+    });
+
+    add("get_layout", 100000, [&](std::uint64_t i) {
+        bench::keep(symbols[i % symbols.size()].get_layout(style).symbol_anchor);
+    });
+
+    add("get_svg", 2000, [&](std::uint64_t i) {
+        bench::keep(symbols[i % symbols.size()].get_svg(style).svg.size());
+    });
+
+    bench::write_json(std::cout, "milsymbol-bench", cpu, results);
+    return 0;
+}
@@ -0,0 +1,212 @@
+#include "Symbol.hpp"
+#include "Rasterizer.hpp"
+#include "DistanceField.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+static constexpr const char* INSTRUCTION_SET_NAMES[] = {"automatic", "scalar", "SSE2", "AVX2"};
+
+// Defined by Meson when nanosvg is found; its implementation is compiled here when only its headers were
+#ifdef MILSYMBOL_BENCH_NANOSVG
+#include <cstdio>
+#ifdef MILSYMBOL_BENCH_NANOSVG_IMPLEMENTATION
+#define NANOSVG_IMPLEMENTATION
+#define NANOSVGRAST_IMPLEMENTATION
+#endif
+#include <nanosvg.h>
+#include <nanosvgrast.h>
+#endif
+
+/**
+ * @brief Compares drawing every catalog entity with the built-in rasterizer against going through SVG.
+ *
+ * The SVG path is always timed up to producing the SVG string, which is the least any SVG-based
+ * pipeline pays; if Meson found nanosvg, parsing and rasterizing the SVG with it is timed too.
+ * Direct rasterization is run with each instruction set the CPU supports, as are the row kernels on
+ * their own, and the benchmark fails if any differ from the scalar reference by a single bit. Signed
+ * distance field generation is timed for both channel layouts.
+ * Takes the icon size and the number of passes over the catalog as optional arguments.
+ */
+int main(int argc, const char** argv) {
+    int icon_size = (argc > 1 ? std::atoi(argv[1]) : 64);
+    int passes = (argc > 2 ? std::atoi(argv[2]) : 3);
+
+    milsymbol::SymbolStyle style;
+    style.set_icon_size(icon_size);
+
+    std::vector<milsymbol::Symbol> symbols;
+    for (auto symbol_set : milsymbol::Symbol::get_all_symbol_sets()) {
+        for (auto entity : milsymbol::Symbol::get_all_entities(static_cast<milsymbol::SymbolSet>(symbol_set))) {
+            symbols.push_back(milsymbol::Symbol{}
+                .with_entity(static_cast<milsymbol::Entities>(symbol_set * 1000000 + entity))
+                .with_affiliation(milsymbol::Affiliation::FRIEND)
+                .with_echelon(milsymbol::Echelon::BATTALION));
+        }
+    }
+
+    // One buffer big enough for any symbol, cleared between symbols as a caller would
+    std::vector<milsymbol::Symbol::RichOutput> layouts;
+    int max_width = 0;
+    int max_height = 0;
+    for (const auto& symbol : symbols) {
+        layouts.push_back(symbol.get_layout(style));
+        max_width = std::max(max_width, static_cast<int>(std::ceil(layouts.back().svg_bounding_box.width())));
+        max_height = std::max(max_height, static_cast<int>(std::ceil(layouts.back().svg_bounding_box.height())));
+    }
+    std::vector<std::uint8_t> pixels(static_cast<std::size_t>(max_width) * max_height * 4);
+
+    using clock = std::chrono::steady_clock;
+    auto report = [&](const char* name, clock::duration elapsed) {
+        double total_ns = std::chrono::duration<double, std::nano>(elapsed).count();
+        std::cout << name << ": " << total_ns / (symbols.size() * passes) << " ns/symbol, " <<
+            total_ns / 1e6 / passes << " ms per pass" << std::endl;
+    };
+
+    std::cout << symbols.size() << " symbols at icon size " << icon_size << ", " << passes << " passes" << std::endl;
+
+    // Direct rasterization with each instruction set, which must all produce the same pixels
+    bool mismatch = false;
+    std::uint64_t reference_hash = 0;
+    for (auto instruction_set : {milsymbol::RasterInstructionSet::SCALAR, milsymbol::RasterInstructionSet::SSE2,
+                                 milsymbol::RasterInstructionSet::AVX2}) {
+        if (!milsymbol::_impl::is_supported(instruction_set)) {
+            continue;
+        }
+
+        milsymbol::Rasterizer rasterizer;
+        rasterizer.with_instruction_set(instruction_set);
+
+        std::uint64_t hash = 14695981039346656037ull;
+        auto start = clock::now();
+        for (int pass = 0; pass < passes; pass++) {
+            for (std::size_t i = 0; i < symbols.size(); i++) {
+                int width = static_cast<int>(std::ceil(layouts[i].svg_bounding_box.width()));
+                int height = static_cast<int>(std::ceil(layouts[i].svg_bounding_box.height()));
+                std::size_t bytes = static_cast<std::size_t>(width) * height * 4;
+                std::fill(pixels.begin(), pixels.begin() + bytes, 0);
+                rasterizer.draw(symbols[i], milsymbol::RasterTarget{pixels.data(), width, height, 0}, style);
+
+                if (pass == 0) {
+                    for (std::size_t b = 0; b < bytes; b++) {
+                        hash = (hash ^ pixels[b]) * 1099511628211ull;
+                    }
+                }
+            }
+        }
+        auto elapsed = clock::now() - start;
+
+        const char* name = INSTRUCTION_SET_NAMES[static_cast<int>(instruction_set)];
+        report((std::string("rasterizer (") + name + ")").c_str(), elapsed);
+
+        if (instruction_set == milsymbol::RasterInstructionSet::SCALAR) {
+            reference_hash = hash;
+        } else if (hash != reference_hash) {
+            std::cout << "  output differs from the scalar reference" << std::endl;
+            mismatch = true;
+        }
+    }
+
+    // The row kernels alone, on rows of random edges
+    {
+        constexpr int ROW_WIDTH = 256;
+        constexpr int ROWS = 64;
+        constexpr int REPEATS = 2000;
+
+        std::vector<std::int32_t> source(ROW_WIDTH * ROWS);
+        std::uint32_t seed = 12345;
+        for (auto& value : source) {
+            seed = seed * 1664525 + 1013904223;
+            value = (seed >> 8) % 5 == 0 ? static_cast<std::int32_t>(seed % (4 * milsymbol::_impl::COVERAGE_ONE)) - 2 * milsymbol::_impl::COVERAGE_ONE : 0;
+        }
+        std::uint8_t color[4] = {28, 113, 216, 255};
+
+        std::vector<std::uint8_t> reference_pixels;
+        for (auto instruction_set : {milsymbol::RasterInstructionSet::SCALAR, milsymbol::RasterInstructionSet::SSE2,
+                                     milsymbol::RasterInstructionSet::AVX2}) {
+            if (!milsymbol::_impl::is_supported(instruction_set)) {
+                continue;
+            }
+
+            const auto& kernels = milsymbol::_impl::get_raster_kernels(instruction_set);
+            std::vector<std::int32_t> accumulation(source.size());
+            std::vector<std::uint8_t> coverage(ROW_WIDTH);
+            std::vector<std::uint8_t> row_pixels(ROW_WIDTH * ROWS * 4, 64);
+
+            auto start = clock::now();
+            for (int repeat = 0; repeat < REPEATS; repeat++) {
+                std::copy(source.begin(), source.end(), accumulation.begin());
+                for (int row = 0; row < ROWS; row++) {
+                    kernels.accumulate_coverage(accumulation.data() + row * ROW_WIDTH, coverage.data(), ROW_WIDTH);
+                    kernels.composite_span(row_pixels.data() + row * ROW_WIDTH * 4, coverage.data(), ROW_WIDTH, color);
+                }
+            }
+            double ns = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+            std::cout << "row kernels (" << INSTRUCTION_SET_NAMES[static_cast<int>(instruction_set)] << "): " <<
+                ns / (static_cast<double>(REPEATS) * ROWS * ROW_WIDTH) << " ns/pixel" << std::endl;
+
+            if (instruction_set == milsymbol::RasterInstructionSet::SCALAR) {
+                reference_pixels = row_pixels;
+            } else if (row_pixels != reference_pixels) {
+                std::cout << "  output differs from the scalar reference" << std::endl;
+                mismatch = true;
+            }
+        }
+    }
+
+    // Signed distance fields, per channel layout
+    for (auto channels : {milsymbol::DistanceFieldChannels::SILHOUETTE, milsymbol::DistanceFieldChannels::COLOR_CLASSES}) {
+        milsymbol::DistanceFieldGenerator generator;
+        generator.with_channels(channels);
+
+        std::size_t field_bytes = 0;
+        auto start = clock::now();
+        for (int pass = 0; pass < passes; pass++) {
+            for (const auto& symbol : symbols) {
+                field_bytes += generator.generate(symbol, style).values.size();
+            }
+        }
+        report(channels == milsymbol::DistanceFieldChannels::SILHOUETTE ? "distance field (silhouette)" :
+               "distance field (color classes)", clock::now() - start);
+        std::cout << "  (" << field_bytes / passes << " field bytes per pass)" << std::endl;
+    }
+
+    // SVG serialization alone
+    auto start = clock::now();
+    std::size_t svg_bytes = 0;
+    for (int pass = 0; pass < passes; pass++) {
+        for (const auto& symbol : symbols) {
+            svg_bytes += symbol.get_svg(style).svg.size();
+        }
+    }
+    report("get_svg only", clock::now() - start);
+
+#ifdef MILSYMBOL_BENCH_NANOSVG
+    // SVG serialization, parsing and rasterization
+    NSVGrasterizer* svg_rasterizer = nsvgCreateRasterizer();
+    start = clock::now();
+    for (int pass = 0; pass < passes; pass++) {
+        for (const auto& symbol : symbols) {
+            std::string svg = symbol.get_svg(style).svg;
+            NSVGimage* image = nsvgParse(svg.data(), "px", 96);
+            int width = static_cast<int>(std::ceil(image->width));
+            int height = static_cast<int>(std::ceil(image->height));
+            std::fill(pixels.begin(), pixels.begin() + static_cast<std::size_t>(width) * height * 4, 0);
+            nsvgRasterize(svg_rasterizer, image, 0, 0, 1, pixels.data(), width, height, width * 4);
+            nsvgDelete(image);
+        }
+    }
+    report("get_svg + nanosvg", clock::now() - start);
+    nsvgDeleteRasterizer(svg_rasterizer);
+#else
+    std::cout << "get_svg + nanosvg: skipped, nanosvg not found when configuring" << std::endl;
+#endif
+
+    std::cout << "(" << svg_bytes / passes << " SVG bytes per pass)" << std::endl;
+    return mismatch ? 1 : 0;
+}
@@ -0,0 +1,183 @@
+#include "Symbol.hpp"
+#include "SymbolParts.hpp"
+
+#include "Harness.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <latch>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace milsymbol;
+
+namespace {
+
+constexpr Affiliation AFFILIATIONS[] = {Affiliation::PENDING, Affiliation::UNKNOWN, Affiliation::ASSUMED_FRIEND,
+                                       Affiliation::FRIEND, Affiliation::NEUTRAL, Affiliation::SUSPECT, Affiliation::HOSTILE};
+constexpr ColorMode COLOR_MODES[] = {ColorMode::LIGHT, ColorMode::MEDIUM, ColorMode::DARK, ColorMode::UNFILLED};
+
+/// Renders each thread makes before the timed run, to fill per-thread caches
+constexpr int WARM_UP_RENDERS = 64;
+
+/// One run of a workload at some number of threads
+struct Run {
+    unsigned threads = 0;
+    double seconds = 0; /// Wall time from releasing the threads until the last finished
+    double per_second = 0; /// Renders per second over every thread
+    std::vector<double> latencies; /// Every render's latency in nanoseconds, sorted
+    double allocations = 0; /// Heap allocations per render
+
+    /// Returns the latency at the given quantile (0 to 1)
+    inline double get_quantile(double quantile) const noexcept {
+        std::size_t index = std::min(latencies.size() - 1, static_cast<std::size_t>(quantile * latencies.size()));
+        return latencies[index];
+    }
+};
+
+/**
+ * @brief Runs `render(symbol, style)` over `renders` symbols on each of `threads` threads at once, each thread
+ * starting at a different point in the mix, and records every call's latency
+ */
+template<typename Render>
+Run run_threads(unsigned threads, int renders, bool pin, const std::vector<Symbol>& symbols,
+                const std::vector<SymbolStyle>& styles, Render&& render) {
+    using clock = std::chrono::steady_clock;
+
+    std::vector<std::vector<double>> latencies(threads, std::vector<double>(renders));
+    std::vector<std::uint64_t> allocations(threads);
+    std::latch ready{static_cast<std::ptrdiff_t>(threads) + 1};
+    std::latch go{1};
+
+    std::vector<std::thread> workers;
+    for (unsigned thread = 0; thread < threads; thread++) {
+        workers.emplace_back([&, thread]() {
+            if (pin) {
+                bench::pin_to_cpu(static_cast<int>(thread % std::max(1u, std::thread::hardware_concurrency())));
+            }
+
+            // Spread threads out over the mix so they don't render the same symbol at the same time
+            std::size_t next = thread * symbols.size() / threads;
+            for (int i = 0; i < WARM_UP_RENDERS; i++) {
+                render(symbols[(next + i) % symbols.size()], styles[i % styles.size()]);
+            }
+
+            ready.count_down();
+            go.wait();
+
+            std::vector<double>& times = latencies[thread];
+            bench::AllocationCounts before = bench::get_allocation_counts();
+            for (int i = 0; i < renders; i++) {
+                auto start = clock::now();
+                render(symbols[next % symbols.size()], styles[next % styles.size()]);
+                times[i] = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+                next++;
+            }
+            allocations[thread] = (bench::get_allocation_counts() - before).allocations;
+        });
+    }
+
+    ready.arrive_and_wait();
+    auto start = clock::now();
+    go.count_down();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    Run run;
+    run.threads = threads;
+    run.seconds = std::chrono::duration<double>(clock::now() - start).count();
+    run.per_second = static_cast<double>(threads) * renders / run.seconds;
+    run.latencies.reserve(static_cast<std::size_t>(threads) * renders);
+    std::uint64_t total_allocations = 0;
+    for (unsigned thread = 0; thread < threads; thread++) {
+        run.latencies.insert(run.latencies.end(), latencies[thread].begin(), latencies[thread].end());
+        total_allocations += allocations[thread];
+    }
+    std::sort(run.latencies.begin(), run.latencies.end());
+    run.allocations = static_cast<double>(total_allocations) / run.latencies.size();
+    return run;
+}
+
+}
+
+/**
+ * @brief Renders a mix of catalog symbols from 1, 2, 4 and so on up to N threads at once, and reports throughput,
+ * scaling efficiency against one thread, and p50, p99 and p99.9 latency for each thread count.
+ *
+ * Runs two workloads: whole get_svg calls, and building the same symbol parts without serializing them to SVG.
+ * Efficiency well below 100% points to contention on shared state - locks or shared counters inside the library,
+ * the global allocator, or locale and iostream state - and a gap between the two workloads points to
+ * serialization in particular.
+ *
+ * Takes the highest thread count (default one per hardware thread), the renders per thread (default 2000),
+ * and "pin" to pin thread i to CPU i as optional arguments.
+ */
+int main(int argc, const char** argv) {
+    unsigned max_threads = (argc > 1 ? static_cast<unsigned>(std::atoi(argv[1])) : 0);
+    int renders = (argc > 2 ? std::atoi(argv[2]) : 2000);
+    bool pin = (argc > 3 && std::string_view{argv[3]} == "pin");
+    if (max_threads == 0) {
+        max_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // Every catalog entity, cycling through affiliations and amplifiers
+    std::vector<Symbol> symbols;
+    for (auto symbol_set : Symbol::get_all_symbol_sets()) {
+        for (auto entity : Symbol::get_all_entities(static_cast<SymbolSet>(symbol_set))) {
+            int i = static_cast<int>(symbols.size());
+            symbols.push_back(Symbol{}
+                .with_entity(static_cast<Entities>(symbol_set * 1000000 + entity))
+                .with_affiliation(AFFILIATIONS[i % 7])
+                .with_echelon(i % 3 == 0 ? Echelon::BATTALION : Echelon::UNDEFINED)
+                .as_headquarters(i % 5 == 0)
+                .as_task_force(i % 4 == 0));
+        }
+    }
+
+    // Color modes cycle at a different period than the symbols, so each symbol is drawn in several
+    std::vector<SymbolStyle> styles;
+    for (auto color_mode : COLOR_MODES) {
+        SymbolStyle style;
+        style.color_mode = color_mode;
+        styles.push_back(style);
+    }
+
+    std::vector<unsigned> thread_counts;
+    for (unsigned threads = 1; threads < max_threads; threads *= 2) {
+        thread_counts.push_back(threads);
+    }
+    thread_counts.push_back(max_threads);
+
+    std::cout << std::fixed << std::setprecision(1);
+    auto report = [&](const char* name, auto&& render) {
+        std::cout << name << ":" << std::endl;
+        std::cout << "  threads  renders/sec  efficiency   p50 us   p99 us  p99.9 us  allocs/render" << std::endl;
+
+        double single_thread = 0;
+        for (unsigned threads : thread_counts) {
+            Run run = run_threads(threads, renders, pin, symbols, styles, render);
+            if (threads == 1) {
+                single_thread = run.per_second;
+            }
+            double efficiency = run.per_second / (single_thread * threads);
+
+            std::cout << "  " << std::setw(7) << threads << std::setw(13) << run.per_second <<
+                std::setw(11) << efficiency * 100 << "%" << std::setw(9) << run.get_quantile(0.5) / 1000 <<
+                std::setw(9) << run.get_quantile(0.99) / 1000 << std::setw(10) << run.get_quantile(0.999) / 1000 <<
+                std::setw(15) << run.allocations << std::endl;
+        }
+    };
+
+    report("get_svg", [](const Symbol& symbol, const SymbolStyle& style) {
+        bench::keep(symbol.get_svg(style).svg.size());
+    });
+    report("get_symbol_parts", [](const Symbol& symbol, const SymbolStyle& style) {
+        bench::keep(_impl::get_symbol_parts(symbol, style).valid);
+    });
+    return 0;
+}
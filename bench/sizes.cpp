@@ -0,0 +1,312 @@
+#include "Symbol.hpp"
+#include "SymbolParts.hpp"
+
+#include "Harness.hpp"
+
+#include <algorithm>
+#include <array>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace milsymbol;
+
+namespace {
+
+constexpr Affiliation AFFILIATIONS[] = {Affiliation::FRIEND, Affiliation::HOSTILE, Affiliation::NEUTRAL, Affiliation::UNKNOWN};
+
+/// The part of a symbol output bytes belong to
+enum Part {
+    FRAME = 0, /// Frame, context letters and space/activity modifiers
+    ICON, /// Entity and sector 1 and 2 modifier icons
+    AMPLIFIERS, /// Headquarters staff, task force, feint/dummy, installation, echelon and mobility
+    DOCUMENT, /// The enclosing <svg> element and line breaks
+    PART_COUNT
+};
+
+/// What output bytes encode
+enum Content {
+    PATH_DATA = 0, /// Values of path `d` attributes
+    TEXT, /// Text elements, including glyph paths when text is drawn as paths
+    MARKUP, /// Element and attribute names and every other attribute value, such as colors, widths and transforms
+    CONTENT_COUNT
+};
+
+constexpr const char* PART_NAMES[] = {"frame", "icon", "amplifiers", "document"};
+constexpr const char* CONTENT_NAMES[] = {"path_data", "text", "markup"};
+
+/// Output bytes of a symbol or group of symbols, by part and content
+struct Sizes {
+    std::array<std::array<double, CONTENT_COUNT>, PART_COUNT> bytes{};
+
+    inline double get_total() const noexcept {
+        double total = 0;
+        for (const auto& part : bytes) {
+            for (double value : part) {
+                total += value;
+            }
+        }
+        return total;
+    }
+
+    inline double get_part(Part part) const noexcept {
+        double total = 0;
+        for (double value : bytes[part]) {
+            total += value;
+        }
+        return total;
+    }
+
+    inline double get_content(Content content) const noexcept {
+        double total = 0;
+        for (const auto& part : bytes) {
+            total += part[content];
+        }
+        return total;
+    }
+
+    inline Sizes& operator+=(const Sizes& other) noexcept {
+        for (int part = 0; part < PART_COUNT; part++) {
+            for (int content = 0; content < CONTENT_COUNT; content++) {
+                bytes[part][content] += other.bytes[part][content];
+            }
+        }
+        return *this;
+    }
+
+    inline Sizes operator/(double count) const noexcept {
+        Sizes result = *this;
+        for (auto& part : result.bytes) {
+            for (double& value : part) {
+                value /= count;
+            }
+        }
+        return result;
+    }
+};
+
+/// Returns the bytes of `d="..."` attribute values in an element's SVG
+std::size_t get_path_data_bytes(std::string_view svg) noexcept {
+    std::size_t bytes = 0;
+    for (std::string_view marker : {std::string_view{" d = \""}, std::string_view{" d=\""}}) {
+        for (std::size_t start = svg.find(marker); start != std::string_view::npos; start = svg.find(marker, start)) {
+            start += marker.size();
+            std::size_t end = svg.find('"', start);
+            if (end == std::string_view::npos) {
+                break;
+            }
+            bytes += end - start;
+            start = end;
+        }
+    }
+    return bytes;
+}
+
+/// Adds the SVG bytes of a draw command to `part`, walking into groups so their contents are classified separately
+void add_command(const _impl::DrawCommand& command, const _impl::Style& style, Sizes& sizes, Part part) {
+    using Type = _impl::DrawCommand::Type;
+    std::string svg = command.get_svg_string(style);
+
+    if (command.get_type() == Type::TEXT) {
+        sizes.bytes[part][TEXT] += svg.size();
+        return;
+    }
+
+    if (command.get_type() == Type::TRANSLATE || command.get_type() == Type::SCALE) {
+        // The group's own tags are markup; its children are classified on their own
+        std::size_t children_bytes = 0;
+        for (const auto& child : command.children) {
+            children_bytes += child.get_svg_string(style).size();
+            add_command(child, style, sizes, part);
+        }
+        sizes.bytes[part][MARKUP] += svg.size() - children_bytes;
+        return;
+    }
+
+    std::size_t path_data = get_path_data_bytes(svg);
+    sizes.bytes[part][PATH_DATA] += path_data;
+    sizes.bytes[part][MARKUP] += svg.size() - path_data;
+}
+
+/**
+ * @brief Returns the output bytes of a symbol's get_svg by part and content, or nothing if it isn't valid.
+ * Commands are serialized as get_svg does, one per line; what's left of the whole output is the document.
+ */
+bool measure(const Symbol& symbol, const SymbolStyle& style, Sizes& sizes) {
+    std::size_t total = symbol.get_svg(style).svg.size();
+    _impl::SymbolParts parts = _impl::get_symbol_parts(symbol, style);
+    if (!parts.valid || total == 0) {
+        return false;
+    }
+
+    sizes = Sizes{};
+    const std::pair<const std::vector<_impl::DrawCommand>*, Part> groups[] = {
+        {&parts.frame, FRAME}, {&parts.amplifiers, AMPLIFIERS}, {&parts.entity, ICON}, {&parts.modifier_1, ICON}, {&parts.modifier_2, ICON}
+    };
+    for (const auto& [commands, part] : groups) {
+        for (const auto& command : *commands) {
+            add_command(command, parts.style, sizes, part);
+            sizes.bytes[DOCUMENT][MARKUP] += 1; // Line break
+        }
+    }
+    sizes.bytes[DOCUMENT][MARKUP] += total - sizes.get_total();
+    return true;
+}
+
+/// A catalog entity or modifier and its average output over every affiliation
+struct Entry {
+    std::string name; /// Symbol set and entity or modifier code
+    Sizes sizes; /// Average bytes per symbol
+};
+
+void write_sizes_json(std::ostream& out, const Sizes& sizes) {
+    out << "{\"total\": " << sizes.get_total();
+    for (int part = 0; part < PART_COUNT; part++) {
+        out << ", \"" << PART_NAMES[part] << "\": {";
+        for (int content = 0; content < CONTENT_COUNT; content++) {
+            out << (content == 0 ? "" : ", ") << "\"" << CONTENT_NAMES[content] << "\": " << sizes.bytes[part][content];
+        }
+        out << "}";
+    }
+    out << "}";
+}
+
+/// Writes one line of the table: the total, then bytes by part, then by content
+void write_sizes_row(std::ostream& out, std::string_view name, const Sizes& sizes) {
+    out << std::left << std::setw(24) << name << std::right << std::setw(9) << sizes.get_total();
+    for (int part = 0; part < PART_COUNT; part++) {
+        out << std::setw(11) << sizes.get_part(static_cast<Part>(part));
+    }
+    for (int content = 0; content < CONTENT_COUNT; content++) {
+        out << std::setw(11) << sizes.get_content(static_cast<Content>(content));
+    }
+    out << std::endl;
+}
+
+}
+
+/**
+ * @brief Renders every entity and modifier 1 and 2 of each symbol set with the four base affiliations through
+ * get_svg, and breaks its output bytes down by part - frame, icon, amplifiers and the enclosing document - and
+ * by content - path data, text, and other markup and attributes. Echelons, headquarters and task force are cycled
+ * through across entities so amplifiers are represented.
+ *
+ * Writes bytes per symbol overall, per symbol set, and for the heaviest entities and modifiers as JSON to
+ * standard output, to track over time, and as a table to standard error. Takes the number of heaviest entries to
+ * list (default 25) as an optional argument.
+ */
+int main(int argc, const char** argv) {
+    std::size_t heaviest_count = (argc > 1 ? static_cast<std::size_t>(std::atoi(argv[1])) : 25);
+
+    SymbolStyle style;
+    Sizes total;
+    std::size_t total_count = 0;
+    std::vector<std::pair<int, Sizes>> symbol_sets;
+    std::vector<Entry> entries;
+
+    auto measure_all = [&](const std::string& name, Symbol symbol, Sizes& set_sizes, std::size_t& set_count) {
+        Entry entry{name, {}};
+        int count = 0;
+        for (auto affiliation : AFFILIATIONS) {
+            Sizes sizes;
+            if (measure(symbol.with_affiliation(affiliation), style, sizes)) {
+                entry.sizes += sizes;
+                set_sizes += sizes;
+                count++;
+            }
+        }
+        if (count > 0) {
+            entry.sizes = entry.sizes / count;
+            entries.push_back(entry);
+            set_count += count;
+        }
+    };
+
+    int cycle = 0;
+    for (auto symbol_set_code : Symbol::get_all_symbol_sets()) {
+        auto symbol_set = static_cast<SymbolSet>(symbol_set_code);
+        Sizes set_sizes;
+        std::size_t set_count = 0;
+
+        for (auto entity : Symbol::get_all_entities(symbol_set)) {
+            Symbol symbol = Symbol{}
+                .with_entity(static_cast<Entities>(symbol_set_code * 1000000 + entity))
+                .with_echelon(cycle % 3 == 0 ? Echelon::BATTALION : Echelon::UNDEFINED)
+                .as_headquarters(cycle % 5 == 0)
+                .as_task_force(cycle % 4 == 0);
+            cycle++;
+            measure_all(std::to_string(symbol_set_code) + " entity " + std::to_string(entity), symbol, set_sizes, set_count);
+        }
+
+        for (int index : {1, 2}) {
+            for (auto modifier : (index == 1 ? Symbol::get_all_modifier_1s(symbol_set) : Symbol::get_all_modifier_2s(symbol_set))) {
+                // Modifiers only come through SIDCs
+                char sidc[20];
+                Symbol{}.with_entity(static_cast<Entities>(symbol_set_code * 1000000)).to_sidc(sidc);
+                sidc[16 + 2 * (index - 1)] = static_cast<char>('0' + modifier / 10 % 10);
+                sidc[17 + 2 * (index - 1)] = static_cast<char>('0' + modifier % 10);
+                measure_all(std::to_string(symbol_set_code) + " modifier " + std::to_string(index) + "-" + std::to_string(modifier),
+                            Symbol::from_sidc(std::string_view{sidc, sizeof(sidc)}), set_sizes, set_count);
+            }
+        }
+
+        if (set_count > 0) {
+            total += set_sizes;
+            total_count += set_count;
+            symbol_sets.emplace_back(symbol_set_code, set_sizes / static_cast<double>(set_count));
+        }
+    }
+
+    if (total_count == 0) {
+        std::cerr << "no symbols rendered" << std::endl;
+        return 1;
+    }
+    Sizes average = total / static_cast<double>(total_count);
+
+    heaviest_count = std::min(heaviest_count, entries.size());
+    std::partial_sort(entries.begin(), entries.begin() + heaviest_count, entries.end(), [](const Entry& a, const Entry& b) {
+        return a.sizes.get_total() > b.sizes.get_total();
+    });
+    entries.resize(heaviest_count);
+
+    // Table
+    std::cerr << std::fixed << std::setprecision(0);
+    std::cerr << std::left << std::setw(24) << "bytes/symbol" << std::right << std::setw(9) << "total";
+    for (const char* name : PART_NAMES) {
+        std::cerr << std::setw(11) << name;
+    }
+    for (const char* name : CONTENT_NAMES) {
+        std::cerr << std::setw(11) << name;
+    }
+    std::cerr << std::endl;
+    write_sizes_row(std::cerr, "all (" + std::to_string(total_count) + " symbols)", average);
+    for (const auto& [code, sizes] : symbol_sets) {
+        write_sizes_row(std::cerr, "symbol set " + std::to_string(code), sizes);
+    }
+    std::cerr << "heaviest:" << std::endl;
+    for (const auto& entry : entries) {
+        write_sizes_row(std::cerr, entry.name, entry.sizes);
+    }
+
+    // JSON
+    std::cout << "{\"suite\": \"milsymbol-size-report\", \"symbols\": " << total_count << ", \"bytes_per_symbol\": ";
+    write_sizes_json(std::cout, average);
+    std::cout << ",\n\"symbol_sets\": {";
+    for (std::size_t i = 0; i < symbol_sets.size(); i++) {
+        std::cout << (i == 0 ? "\n" : ",\n") << "  \"" << symbol_sets[i].first << "\": ";
+        write_sizes_json(std::cout, symbol_sets[i].second);
+    }
+    std::cout << "\n},\n\"heaviest\": [";
+    for (std::size_t i = 0; i < entries.size(); i++) {
+        std::cout << (i == 0 ? "\n" : ",\n") << "  {\"name\": ";
+        bench::write_json_string(std::cout, entries[i].name);
+        std::cout << ", \"bytes\": ";
+        write_sizes_json(std::cout, entries[i].sizes);
+        std::cout << "}";
+    }
+    std::cout << "\n]}" << std::endl;
+    return 0;
+}
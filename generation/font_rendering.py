@@ -81,4 +81,26 @@ class Font(object):
 			paths.append(' '.join(ctx[0]))
 			x_offset += self.face.glyph.advance.x
 
-		return paths # ' '.join(paths)
\ No newline at end of file
+		return paths # ' '.join(paths)
+
+	# Returns the advance and outline of a single character in unscaled font units,
+	# with y pointing down and the baseline at 0, as the runtime glyph table stores them.
+	# The outline is the content of an SVG path's "d" attribute.
+	def glyph_outline(self, char) -> tuple:
+		self.face.load_char(char, freetype.FT_LOAD_NO_SCALE | freetype.FT_LOAD_NO_BITMAP)
+
+		def point(a) -> str:
+			return '{:g},{:g}'.format(a.x, -a.y + 0.0)
+
+		commands = []
+		self.face.glyph.outline.decompose(commands,
+			move_to=lambda a, ctx: ctx.append('M' + point(a)),
+			line_to=lambda a, ctx: ctx.append('L' + point(a)),
+			conic_to=lambda a, b, ctx: ctx.append('Q' + point(a) + ' ' + point(b)),
+			cubic_to=lambda a, b, c, ctx: ctx.append('C' + point(a) + ' ' + point(b) + ' ' + point(c)))
+
+		return (self.face.glyph.advance.x, ''.join(commands))
+
+	# Returns the number of font units per em, which is the font size in font units
+	def units_per_em(self) -> int:
+		return self.face.units_per_EM
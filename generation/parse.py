@@ -1,8 +1,11 @@
 import os
+import copy
 import json
 import sys
 import re
 import glob
+import math
+import functools
 import argparse
 
 from font_rendering import Font
@@ -60,6 +63,214 @@ def convert_color(item):
 		print(f"Bad color: {item}", file=sys.stderr)
 		return None
 
+"""
+Tokens of SVG path data: command letters and numbers, which may run together (e.g. "1.5.5" or "1-2")
+"""
+PATH_TOKEN = re.compile(r'[A-Za-z]|[-+]?(?:\d+\.?\d*|\.\d+)(?:[eE][-+]?\d+)?')
+
+"""
+Returns the parameters in [0, 1] at which a cubic or quadratic Bezier curve with the given control
+values along one axis has an extremum
+"""
+def bezier_extrema(values:tuple) -> list:
+	if len(values) == 3:
+		p0, p1, p2 = values
+		denominator = p0 - 2 * p1 + p2
+		return [(p0 - p1) / denominator] if denominator != 0 and 0 < (p0 - p1) / denominator < 1 else []
+
+	# Roots of the derivative, a quadratic at^2 + bt + c
+	p0, p1, p2, p3 = values
+	a = -p0 + 3 * p1 - 3 * p2 + p3
+	b = 2 * (p0 - 2 * p1 + p2)
+	c = p1 - p0
+	if abs(a) < 1e-12:
+		roots = [-c / b] if b != 0 else []
+	else:
+		discriminant = b * b - 4 * a * c
+		if discriminant < 0:
+			return []
+		roots = [(-b + sign * discriminant ** 0.5) / (2 * a) for sign in (1, -1)]
+	return [t for t in roots if 0 < t < 1]
+
+"""
+Returns the point at parameter t of a Bezier curve with the given control points
+"""
+def bezier_point(points:list, t:float) -> tuple:
+	while len(points) > 1:
+		points = [(a[0] + (b[0] - a[0]) * t, a[1] + (b[1] - a[1]) * t) for a, b in zip(points, points[1:])]
+	return points[0]
+
+"""
+Returns the points an elliptical arc from `start` reaches furthest along each axis, following the
+SVG implementation notes for converting arcs from endpoint to center parameterization
+"""
+def arc_extrema(start:tuple, rx:float, ry:float, rotation:float, large_arc:bool, sweep:bool, end:tuple) -> list:
+	if rx == 0 or ry == 0 or start == end:
+		return [end]
+	rx, ry = abs(rx), abs(ry)
+	phi = math.radians(rotation)
+	cos_phi, sin_phi = math.cos(phi), math.sin(phi)
+	dx, dy = (start[0] - end[0]) / 2, (start[1] - end[1]) / 2
+	x1 = cos_phi * dx + sin_phi * dy
+	y1 = -sin_phi * dx + cos_phi * dy
+
+	# Radii too small to reach are scaled up until they do
+	scale = (x1 * x1) / (rx * rx) + (y1 * y1) / (ry * ry)
+	if scale > 1:
+		rx, ry = rx * scale ** 0.5, ry * scale ** 0.5
+	numerator = rx * rx * ry * ry - rx * rx * y1 * y1 - ry * ry * x1 * x1
+	factor = (max(0, numerator) / (rx * rx * y1 * y1 + ry * ry * x1 * x1)) ** 0.5
+	if large_arc == sweep:
+		factor = -factor
+	cx1, cy1 = factor * rx * y1 / ry, -factor * ry * x1 / rx
+	cx = cos_phi * cx1 - sin_phi * cy1 + (start[0] + end[0]) / 2
+	cy = sin_phi * cx1 + cos_phi * cy1 + (start[1] + end[1]) / 2
+
+	start_angle = math.atan2((y1 - cy1) / ry, (x1 - cx1) / rx)
+	sweep_angle = math.atan2((-y1 - cy1) / ry, (-x1 - cx1) / rx) - start_angle
+	if sweep and sweep_angle < 0:
+		sweep_angle += 2 * math.pi
+	elif not sweep and sweep_angle > 0:
+		sweep_angle -= 2 * math.pi
+
+	def point(angle:float) -> tuple:
+		return (cx + rx * math.cos(angle) * cos_phi - ry * math.sin(angle) * sin_phi,
+			cy + rx * math.cos(angle) * sin_phi + ry * math.sin(angle) * cos_phi)
+
+	# Angles where the x and y coordinates are extreme, in every turn the arc might cover
+	candidates = [math.atan2(-ry * sin_phi, rx * cos_phi), math.atan2(ry * cos_phi, rx * sin_phi)]
+	points = [end]
+	for candidate in candidates:
+		for turn in range(-3, 4):
+			angle = candidate + turn * math.pi
+			if 0 < (angle - start_angle) / sweep_angle < 1:
+				points.append(point(angle))
+	return points
+
+"""
+Returns the exact bounding box of SVG path data as (x1, y1, x2, y2), including the extrema of its
+curves rather than just their control points, or None if it draws nothing
+"""
+def get_path_bbox(d:str) -> tuple:
+	tokens = PATH_TOKEN.findall(d)
+	points = []
+	position = (0.0, 0.0)
+	subpath_start = position
+	last_control = None # Reflected by smooth curve commands
+	command = None
+	last_command = None
+	index = 0
+
+	def numbers(count:int) -> list:
+		nonlocal index
+		values = [float(value) for value in tokens[index:index + count]]
+		index += count
+		return values
+
+	while index < len(tokens):
+		if tokens[index].isalpha():
+			command = tokens[index]
+			index += 1
+			if command in 'Zz':
+				position = subpath_start
+				last_control = None
+				continue
+		elif command is None:
+			raise ValueError(f'Path data "{d}" doesn\'t start with a command')
+
+		relative = command.islower()
+		origin = position if relative else (0.0, 0.0)
+		def absolute(x:float, y:float) -> tuple:
+			return (origin[0] + x, origin[1] + y)
+
+		upper = command.upper()
+		control = None
+		if upper == 'M':
+			position = absolute(*numbers(2))
+			subpath_start = position
+			points.append(position)
+			# Further pairs after a move are lines
+			command = 'l' if relative else 'L'
+		elif upper == 'L':
+			position = absolute(*numbers(2))
+			points.append(position)
+		elif upper == 'H':
+			(x,) = numbers(1)
+			position = (x + (position[0] if relative else 0), position[1])
+			points.append(position)
+		elif upper == 'V':
+			(y,) = numbers(1)
+			position = (position[0], y + (position[1] if relative else 0))
+			points.append(position)
+		elif upper in 'CSQT':
+			if upper == 'C':
+				values = numbers(6)
+				curve = [position, absolute(values[0], values[1]), absolute(values[2], values[3]), absolute(values[4], values[5])]
+			elif upper == 'S':
+				values = numbers(4)
+				reflected = (2 * position[0] - last_control[0], 2 * position[1] - last_control[1]) if last_control is not None and last_command in 'CS' else position
+				curve = [position, reflected, absolute(values[0], values[1]), absolute(values[2], values[3])]
+			elif upper == 'Q':
+				values = numbers(4)
+				curve = [position, absolute(values[0], values[1]), absolute(values[2], values[3])]
+			else:
+				values = numbers(2)
+				reflected = (2 * position[0] - last_control[0], 2 * position[1] - last_control[1]) if last_control is not None and last_command in 'QT' else position
+				curve = [position, reflected, absolute(values[0], values[1])]
+
+			for axis in (0, 1):
+				for t in bezier_extrema(tuple(point[axis] for point in curve)):
+					points.append(bezier_point(curve, t))
+			position = curve[-1]
+			control = curve[-2]
+			points.append(position)
+		elif upper == 'A':
+			rx, ry, rotation, large_arc, sweep, x, y = numbers(7)
+			end = absolute(x, y)
+			points += arc_extrema(position, rx, ry, rotation, bool(large_arc), bool(sweep), end)
+			position = end
+		else:
+			raise ValueError(f'Unknown command "{command}" in path data "{d}"')
+
+		last_control = control
+		last_command = upper
+
+	if len(points) == 0:
+		return None
+	return (min(point[0] for point in points), min(point[1] for point in points),
+		max(point[0] for point in points), max(point[1] for point in points))
+
+"""
+Returns the bounding box of SVG path data as get_path_bbox does, or None with a warning if the
+data can't be parsed; such paths are still drawn as is, but left out of their layer's bounds.
+Cached, since the same path is bounded once per layer using it
+"""
+@functools.cache
+def get_checked_path_bbox(d:str) -> tuple:
+	try:
+		return get_path_bbox(d)
+	except ValueError as e:
+		print(f'Warning: {e}', file=sys.stderr)
+		return None
+
+"""
+Returns the union of bounding boxes, ignoring any that are None
+"""
+def merge_bboxes(bboxes) -> tuple:
+	bboxes = [bbox for bbox in bboxes if bbox is not None]
+	if len(bboxes) == 0:
+		return None
+	return (min(bbox[0] for bbox in bboxes), min(bbox[1] for bbox in bboxes),
+		max(bbox[2] for bbox in bboxes), max(bbox[3] for bbox in bboxes))
+
+"""
+Returns C++ for a bounding box, rounded outwards to hundredths so it still contains what it bounds
+"""
+def bbox_to_cpp(bbox:tuple) -> str:
+	return 'BoundingBox{{{:g}, {:g}, {:g}, {:g}}}'.format(
+		math.floor(round(bbox[0] * 100, 6)) / 100, math.floor(round(bbox[1] * 100, 6)) / 100,
+		math.ceil(round(bbox[2] * 100, 6)) / 100, math.ceil(round(bbox[3] * 100, 6)) / 100)
+
 """
 Class for defining an output style for the generated C++ code
 """
@@ -67,6 +278,8 @@ class OutputStyle:
 	def __init__(self, use_text_paths:bool = False):
 		self.use_text_paths = use_text_paths
 		self.text_path_font = DEFAULT_FONT_FILE
+		self.text_characters:set = set() # Every character used in text, for the glyph table
+		self.shared_paths:dict = {} # Constant names for path data written more than once in a file, by path data
 
 """
 A basic symbol element
@@ -89,6 +302,22 @@ class SymbolElement:
 				f' stroke_width="{self.stroke_width}"' if self.stroke_color is not None and self.stroke_color != '' else ''
 			)
 
+		def children(self) -> list:
+			return []
+
+		"""
+		Returns the extents of what this element draws as (x1, y1, x2, y2), or None if they aren't
+		known until it's drawn
+		"""
+		def get_bbox(self) -> tuple:
+			return None
+
+		"""
+		Returns the C++ for this element, or a reference to it if `pool` holds it
+		"""
+		def pooled(self, expression:str, pool) -> str:
+			return pool.reference(self, expression) if pool is not None else expression
+
 		def parse_basics(self, element) -> None:
 			if 'fill' in element:
 				self.fill_color = element['fill']
@@ -116,10 +345,17 @@ class SymbolElement:
 				affil: [] for affil in AFFILIATION_TYPES			
 			}
 
-		def cpp(self, output_style=OutputStyle()):
-			return 'DrawCommand::full_frame({}, {}, {}, {})'.format(
-				*['{}'.format(', '.join([e.cpp() for e in self.elements[affiliation]])) for affiliation in AFFILIATION_TYPES]
-			)
+		def children(self) -> list:
+			return [e for affiliation in AFFILIATION_TYPES for e in self.elements[affiliation]]
+
+		def get_bbox(self) -> tuple:
+			# Drawn along the frame of whichever affiliation the symbol has, so the frame bounds it
+			return None
+
+		def cpp(self, output_style=OutputStyle(), pool=None):
+			return self.pooled('DrawCommand::full_frame({}, {}, {}, {})'.format(
+				*['{}'.format(', '.join([e.cpp(output_style=output_style, pool=pool) for e in self.elements[affiliation]])) for affiliation in AFFILIATION_TYPES]
+			), pool)
 
 	"""
 	Represents a path command
@@ -128,15 +364,22 @@ class SymbolElement:
 		def __init__(self):
 			super().__init__()
 			self.d:str = '' # The SVG path
-			self.bbox:tuple = (100, 100, 100, 100)
+			self.bbox:tuple = None # Bounding box given in the JSON, if any, rather than computed from the path
 			self.fill_color = None # Default to an unfilled path
 			self.stroke_color = "icon" # Default to a filled stroke
 
 		def __repr__(self):
 			return f'<path d="{self.d}" {self.base_params()} />'
 
-		def cpp(self, output_style=OutputStyle()) -> str:
-			ret:str = 'DrawCommand::path(\"{}\")'.format(self.d)
+		def get_bbox(self) -> tuple:
+			if self.bbox is not None:
+				return self.bbox
+			return get_checked_path_bbox(self.d)
+
+		def cpp(self, output_style=OutputStyle(), pool=None) -> str:
+			bbox = self.get_bbox()
+			ret:str = 'DrawCommand::path({}{})'.format(output_style.shared_paths.get(self.d, f'"{self.d}"'),
+				f', {bbox_to_cpp(bbox)}' if bbox is not None else '')
 			if self.fill_color is not None:
 				ret += '.with_fill({})'.format(color_type_to_cpp(self.fill_color))
 			if self.stroke_color is None or self.stroke_color != 'icon':
@@ -144,7 +387,7 @@ class SymbolElement:
 			if self.stroke_width != DEFAULT_STROKE_WIDTH and self.stroke_color is not None:
 				ret += '.with_stroke_width({})'.format(self.stroke_width)
 
-			return ret
+			return self.pooled(ret, pool)
 
 
 
@@ -162,7 +405,10 @@ class SymbolElement:
 		def __repr__(self):
 			return f'<circle cx="{self.pos[0]}" cy="{self.pos[1]}" radius="{self.radius}" {self.base_params()} />'
 
-		def cpp(self, output_style=OutputStyle()) -> str:
+		def get_bbox(self) -> tuple:
+			return (self.pos[0] - self.radius, self.pos[1] - self.radius, self.pos[0] + self.radius, self.pos[1] + self.radius)
+
+		def cpp(self, output_style=OutputStyle(), pool=None) -> str:
 			ret:str = 'DrawCommand::circle(Vector2{{{}, {}}}, {})'.format(self.pos[0], self.pos[1], self.radius)
 			if self.fill_color is not None:
 				ret += '.with_fill({})'.format(color_type_to_cpp(self.fill_color))
@@ -170,7 +416,7 @@ class SymbolElement:
 				ret += '.with_stroke({})'.format(color_type_to_cpp(self.stroke_color))
 			if self.stroke_width != DEFAULT_STROKE_WIDTH and self.stroke_color is not None:
 				ret += '.with_stroke_width({})'.format(self.stroke_width)			
-			return ret
+			return self.pooled(ret, pool)
 
 	"""
 	Represents a text command
@@ -191,66 +437,12 @@ class SymbolElement:
 		def __repr__(self):
 			return f'<text x="{self.pos[0]}" y="{self.pos[1]}" font-size="{self.font_size}" font-anchor="{self.align}" {self.base_params()}>{self.text}</text>'
 
-		def cpp(self, output_style=OutputStyle()) -> str:
-
-			"""
-			If we're supposed to convert text to paths, do so here and
-			then return
-			"""
-			if output_style.use_text_paths:
-				font_face = Font(output_style.text_path_font, size = int(self.font_size))
-
-				pos = self.pos
-				size = self.font_size
-
-				if self.text_type == 'normal':
-					size = 42
-					y = 115
-					if len(self.text) == 1:
-						size = 45
-						y = 115
-					elif len(self.text) == 3:
-						size = 35
-						y = 110
-					elif len(self.text) >= 4:
-						size = 32
-						y = 110
-					pos = (100, y)
-				elif self.text_type == 'm1':
-					pos = (100, 77)
-					size = 30
-					if len(self.text) == 3:
-						size = 25
-					elif len(self.text) >= 4:
-						size = 22
-				elif self.text_type == 'm2':
-					y = 145
-					size = 30
-					if len(self.text) == 3:
-						size = 25
-						y = 140
-					elif len(self.text) >= 4:
-						size = 22
-						y = 135
-					pos = (100, y)
-				else:
-					pos = tuple(self.pos)
-					size = self.font_size
-
-				paths = font_face.render_text(
-					text = self.text, 
-					pos = pos,
-					fontsize = int(size),
-					align = self.align)
-				
-				ret_path = ' '.join(paths)
-				path_el = SymbolElement.Path()
-				path_el.fill_color = self.fill_color
-				path_el.stroke_color = self.stroke_color
-				path_el.d = ret_path
-				return path_el.cpp()
-
-			# Default text-as-text rendition
+		def cpp(self, output_style=OutputStyle(), pool=None) -> str:
+
+			# Text is assembled from the glyph table at runtime, whether it's drawn as text
+			# elements or paths, so only the characters used need to be noted here
+			output_style.text_characters.update(self.text)
+
 			ret:str = ''
 			if self.text_type == 'normal':
 				ret = 'DrawCommand::autotext("{}")'.format(self.text)
@@ -259,16 +451,15 @@ class SymbolElement:
 			elif self.text_type == 'm2':
 				ret = 'DrawCommand::textm2("{}")'.format(self.text)
 			else:
-				ret = 'DrawCommand::text("{}", Vector2{{{}, {}}}, {})'.format(self.text, self.pos[0], self.pos[1], self.font_size)
+				ret = 'DrawCommand::text("{}", Vector2{{{}, {}}}, {})'.format(self.text, self.pos[0], self.pos[1], int(self.font_size))
 
 			if self.fill_color is None or self.fill_color != 'icon':
 				ret += '.with_fill({})'.format(color_type_to_cpp(self.fill_color))
 			if self.stroke_color is not None:
-				ret += '.with_stroke({})'.format(color_type_to_cpp(self.stroke_color))
-			if self.stroke_width != DEFAULT_STROKE_WIDTH and self.stroke_color is not None:
-				ret += '.with_stroke_width({})'.format(self.stroke_width)
+				# Text commands default to a thinner stroke than the generator's, so it's always given
+				ret += '.with_stroke({}).with_stroke_width({})'.format(color_type_to_cpp(self.stroke_color), self.stroke_width)
 
-			return ret
+			return self.pooled(ret, pool)
 
 	"""
 	Base class for transformation
@@ -278,6 +469,13 @@ class SymbolElement:
 			super().__init__()
 			self.items:list = []
 
+		def children(self) -> list:
+			return self.items
+
+		def get_bbox(self) -> tuple:
+			bbox = merge_bboxes(item.get_bbox() for item in self.items)
+			return self.transformed(bbox) if bbox is not None else None
+
 	"""
 	Represents a translation
 	"""
@@ -286,6 +484,9 @@ class SymbolElement:
 			super().__init__()
 			self.delta:tuple = (0, 0)
 
+		def transformed(self, bbox:tuple) -> tuple:
+			return (bbox[0] + self.delta[0], bbox[1] + self.delta[1], bbox[2] + self.delta[0], bbox[3] + self.delta[1])
+
 		def __repr__(self):
 			return '<g transform=\"translate({} {})\">{}</g>'.format(
 				self.delta[0],
@@ -293,11 +494,11 @@ class SymbolElement:
 				' '.join([str(item) for item in self.items])
 			)
 
-		def cpp(self, output_style=OutputStyle()) -> str:
-			return 'DrawCommand::translate(Vector2{{{}, {}}}, {})'.format(
+		def cpp(self, output_style=OutputStyle(), pool=None) -> str:
+			return self.pooled('DrawCommand::translate(Vector2{{{}, {}}}, {})'.format(
 				self.delta[0], self.delta[1],
-				', '.join([x.cpp() for x in self.items])
-			)
+				', '.join([x.cpp(output_style=output_style, pool=pool) for x in self.items])
+			), pool)
 
 	"""
 	Represents a scaling
@@ -307,17 +508,21 @@ class SymbolElement:
 			super().__init__()
 			self.scale:float = 1.0
 
+		def transformed(self, bbox:tuple) -> tuple:
+			# DrawCommand::scale wraps its children in a translation that centers the scale on (100, 100)
+			return tuple(100 + (value - 100) * self.scale for value in bbox)
+
 		def __repr__(self):
 			return '<g transform=\"scale({})\">{}</g>'.format(
 				self.scale,
 				' '.join([str(item) for item in self.items])
 			)
 
-		def cpp(self, output_style=OutputStyle()):
-			return 'DrawCommand::scale({}, {})'.format(
+		def cpp(self, output_style=OutputStyle(), pool=None):
+			return self.pooled('DrawCommand::scale({}, {})'.format(
 				self.scale,
-				', '.join([x.cpp() for x in self.items])
-			)
+				', '.join([x.cpp(output_style=output_style, pool=pool) for x in self.items])
+			), pool)
 
 """
 A full symbol component (e.g. an entity or modifier)
@@ -339,6 +544,78 @@ class SymbolLayer:
 			'.with_civilian_override(true)' if self.civilian else ''
 		)
 
+"""
+Interns the draw commands of a group of symbol layers, such as the entities of a symbol set, into
+a pool that's built once and referred to by index. Each distinct command a layer draws is written
+once however many layers draw it, as are commands nested in more than one other, such as icons
+included by name in several entities; those are written as `commands[index]` where they're nested.
+Layers are counted when the pool is created; commands are added, children before the commands
+containing them, as the layers are written with `add`.
+"""
+class CommandPool:
+	def __init__(self, layers:list, output_style:OutputStyle):
+		self.output_style = output_style
+		self.counts:dict = {}
+		self.elements:dict = {} # The first element with each key
+		self.indices:dict = {}
+		self.commands:list = [] # C++ for each pooled command, in the order they're built
+
+		# Commands are told apart by their C++ with path data written out in full
+		self.key_style = copy.copy(output_style)
+		self.key_style.shared_paths = {}
+
+		for layer in layers:
+			for element in layer.elements:
+				self.count(element)
+
+	def key(self, element) -> str:
+		return element.cpp(output_style=self.key_style)
+
+	"""
+	Counts an element, and its children the first time it's seen; later copies will only refer to it
+	"""
+	def count(self, element) -> None:
+		key = self.key(element)
+		self.counts[key] = self.counts.get(key, 0) + 1
+		if self.counts[key] == 1:
+			self.elements[key] = element
+			for child in element.children():
+				self.count(child)
+
+	"""
+	Adds the path data of each path command to `path_counts`. Every distinct command is written out
+	exactly once, in the pool or nested in the one command containing it, so this counts how often
+	each path data is written.
+	"""
+	def count_paths(self, path_counts:dict) -> None:
+		for element in self.elements.values():
+			if isinstance(element, SymbolElement.Path):
+				path_counts[element.d] = path_counts.get(element.d, 0) + 1
+
+	"""
+	Adds a command a layer draws to the pool if it isn't there yet, returning its index
+	"""
+	def add(self, element) -> int:
+		expression = element.cpp(output_style=self.output_style, pool=self)
+		key = self.key(element)
+		if key not in self.indices:
+			self.indices[key] = len(self.commands)
+			self.commands.append(expression)
+		return self.indices[key]
+
+	"""
+	Returns how a command nested in another is written: a reference into the pool if it's nested
+	in more than one, or `expression` otherwise
+	"""
+	def reference(self, element, expression:str) -> str:
+		key = self.key(element)
+		if self.counts.get(key, 0) < 2:
+			return expression
+		if key not in self.indices:
+			self.indices[key] = len(self.commands)
+			self.commands.append(expression)
+		return f'commands[{self.indices[key]}]'
+
 """
 Parse a specific item from JSON as a symbol element (path, text, etc.)
 `item` is the item to be parsed; `full_items` is the dictionary
@@ -376,7 +653,7 @@ def parse_symbol_element(item:dict, full_items:dict) -> list:
 	elif 'd' in item:
 		# Parse path
 		new_element = SymbolElement.Path()
-		new_element.d = item['d']
+		new_element.d = str(item['d'])
 		if 'bbox' in item:
 			new_element.bbox = tuple(item['bbox'])
 	elif 'r' in item:
@@ -593,19 +870,27 @@ def parse_file(filepath:str) -> dict:
 Generates the C++ headers for the combined symbol sets.
 
 `symbol_sets` is a list of all the SymbolSet objects to construct for.
-`schema_filename` is the path to output the schema (actual drawing elements) to
+`schema_filename` is the path to output the schema header (lookup functions) to
+`schema_source_dir` is the directory to output the schema sources (actual drawing elements) to, one per
+	symbol set, along with a meson.build that compiles the ones chosen by the `symbol_sets` build option
+`included_symbol_sets` lists the symbol sets to output tables for, by their option names (e.g. `land_unit`),
+	or is None for all of them. Symbols in the others are drawn with their frame only.
 `constant_filename` is the path to output the enumerations to
 `use_text_paths` indicates whether to replace all text elements with SVG paths,
 	which may be desirable for some use cases.
+`glyph_filename` is the path to output the glyph table to, with the outline and advance of
+	every printable ASCII character and every other character used in text, from `text_path_font`
 """
-def create_schema(symbol_sets:list, schema_filename:str, constant_filename:str, use_text_paths:bool=False,
-	text_path_font:str=DEFAULT_FONT_FILE, include_enumerator:bool=True, godot_filename:str = '') -> None:
+def create_schema(symbol_sets:list, schema_filename:str, schema_source_dir:str, constant_filename:str, use_text_paths:bool=False,
+	text_path_font:str=DEFAULT_FONT_FILE, include_enumerator:bool=True, godot_filename:str = '',
+	glyph_filename:str = '', included_symbol_sets:list = None) -> None:
 
 	def sanitize_constant(constant:str) -> str:
 		return re.sub('[\s,/\(\)\-\[\]]+', '_', constant).upper()
 
 	output_style = OutputStyle()
 	output_style.use_text_paths = use_text_paths
+	output_style.text_path_font = text_path_font
 
 	# Create constants
 	constants = ''
@@ -644,80 +929,274 @@ def create_schema(symbol_sets:list, schema_filename:str, constant_filename:str,
 		constant_file.write(constants)
 
 	"""
-	Create schema proper
+	Create schema proper. The header only declares the lookup functions; each symbol set's
+	tables are defined in a translation unit of their own, so they compile in parallel and
+	a change to one set only rebuilds that set.
 	"""
+	SYMBOL_TYPE_HEADERS = ['ENTITY', 'MODIFIER_1', 'MODIFIER_2']
+
+	def function_prefix(symbol_set) -> str:
+		return sanitize_constant(symbol_set.name).lower()
+
+	def source_name(symbol_set) -> str:
+		return ''.join(word.capitalize() for word in function_prefix(symbol_set).split('_')) + '.cpp'
+
+	# Constants cover every symbol set, so SIDCs stay valid, but only the included ones get tables
+	if included_symbol_sets is not None:
+		unknown = set(included_symbol_sets) - set(function_prefix(symbol_set) for symbol_set in symbol_sets)
+		if len(unknown) > 0:
+			raise ValueError(f'Unknown symbol sets: {", ".join(sorted(unknown))}')
+	table_sets = [symbol_set for symbol_set in symbol_sets
+		if included_symbol_sets is None or function_prefix(symbol_set) in included_symbol_sets]
+
 	schema = ''
 	schema += '#pragma once\n'
 	schema += '#include "DrawCommands.hpp"\n'
-	schema += '#include "Constants.hpp"\n'
-	schema += '#include "eternal.hpp"\n\n'
+	schema += '#include "Constants.hpp"\n\n'
+	schema += '#include <cstdint>\n'
+	schema += '#include <optional>\n'
+	schema += '#include <span>\n'
+	schema += '#include <vector>\n\n'
 	schema += 'namespace milsymbol::_impl {\n'
 
 	# Create symbol type enum
-	schema += "enum class IconType {\n" + "\tENTITY = 0,\n\tMODIFIER_1,\n\tMODIFIER_2\n\n};\n"
-
-	# Create the master list of symbol sets
-	schema += "static constexpr SymbolLayer get_symbol_layer(SymbolSet symbol_set, int32_t code, IconType symbol_type) {\n"
-
-	for index, symbol_set in enumerate(symbol_sets):
-		schema += '\t{}if (symbol_set == SymbolSet::{}) {{\n'.format('else ' if index > 0 else '', sanitize_constant(symbol_set.name))
-
-		SYMBOL_TYPE_HEADERS = ['ENTITY', 'MODIFIER_1', 'MODIFIER_2']
-
-		for symtype_index, sym_type in enumerate([symbol_set.icons, symbol_set.m1, symbol_set.m2]):
-			schema += '\t\t{}if (symbol_type == IconType::{}) {{\n'.format('else ' if symtype_index > 0 else '', SYMBOL_TYPE_HEADERS[symtype_index])
-
-			map_title:str = f'{SYMBOL_TYPE_HEADERS[symtype_index]}_MAP'
-
-			# Iterate through symbols
-			schema += '\t\t\tconst auto {} = mapbox::eternal::map<int32_t, SymbolLayer>({{\n'.format(map_title)
-			schema += ',\n'.join(['\t\t\t\t{{{}{:02}, {}}} /* {} */'.format(int(symbol_set.id), int(sym.uid), sym.cpp(output_style=output_style), sym.names[0]) for sym_code, sym in sym_type.items()]) + '\n'
-			schema += '\t\t\t});\n'
+	schema += "enum class IconType {\n" + "\tENTITY = 0,\n\tMODIFIER_1,\n\tMODIFIER_2\n\n};\n\n"
+
+	# Tables are generated as data: a pool of draw commands, and each layer's commands as indices into it
+	schema += '/// A generated layer: its code, its draw commands as a range of its table\'s command indices, and their extents\n'
+	schema += 'struct LayerEntry {\n'
+	schema += '\tint32_t code;\n'
+	schema += '\tuint16_t first_command;\n'
+	schema += '\tuint16_t command_count;\n'
+	schema += '\tbool civilian_override;\n'
+	schema += '\tstd::optional<BoundingBox> bbox;\n'
+	schema += '};\n\n'
+	schema += '/// The layers of one icon type of a symbol set, sorted by code\n'
+	schema += 'struct LayerTable {\n'
+	schema += '\tstd::vector<int32_t> codes;\n'
+	schema += '\tstd::vector<SymbolLayer> layers;\n\n'
+	schema += '\t/// Returns the layer with a code, or an empty layer if there isn\'t one\n'
+	schema += '\tSymbolLayer find(int32_t code) const noexcept;\n\n'
+	schema += '\t/// Returns the bounding box of the layer with a code, without copying its commands\n'
+	schema += '\tstd::optional<BoundingBox> find_bbox(int32_t code) const noexcept;\n'
+	schema += '};\n\n'
+	schema += '/// Builds a table from generated entries, sorted by code, copying each layer\'s commands out of the pool\n'
+	schema += 'LayerTable build_layer_table(std::span<const LayerEntry> entries, std::span<const uint16_t> command_indices,\n'
+	schema += '\tconst std::vector<DrawCommand>& commands);\n\n'
+
+	schema += '/// Returns the layer drawn for an entity or modifier code of a symbol set, or an empty layer if there isn\'t one\n'
+	schema += 'SymbolLayer get_symbol_layer(SymbolSet symbol_set, int32_t code, IconType symbol_type) noexcept;\n\n'
+	schema += '/// Returns the bounding box of the layer drawn for an entity or modifier code of a symbol set, as get_symbol_layer\n'
+	schema += '/// would return it, without building the layer\n'
+	schema += 'std::optional<BoundingBox> get_symbol_bbox(SymbolSet symbol_set, int32_t code, IconType symbol_type) noexcept;\n\n'
+	if include_enumerator:
+		schema += '/// Returns every entity or modifier code of a symbol set\n'
+		schema += 'std::vector<int32_t> get_available_symbols(SymbolSet symbol_set, IconType symbol_type) noexcept;\n\n'
 
-			schema += "\t\t\tauto it = {}.find(code);\n".format(map_title) + \
-				f"\t\t\treturn (it != {map_title}.end() ? it->second : SymbolLayer{{}});\n"
+	schema += '// Per-symbol-set tables, each defined in its own file in src/schema\n'
+	for symbol_set in table_sets:
+		schema += f'SymbolLayer get_{function_prefix(symbol_set)}_layer(int32_t code, IconType symbol_type) noexcept;\n'
+		schema += f'std::optional<BoundingBox> get_{function_prefix(symbol_set)}_bbox(int32_t code, IconType symbol_type) noexcept;\n'
+		if include_enumerator:
+			schema += f'std::vector<int32_t> get_{function_prefix(symbol_set)}_symbols(IconType symbol_type) noexcept;\n'
 
-			schema += '\t\t}\n'
+	# Close the namespace
+	schema += '}\n'
 
-		schema += '\t}\n\n'
+	with open(schema_filename, 'w') as schema_file:
+		schema_file.write(schema)
 
-	schema +=  "\n\t// Default to nothing\n\treturn {};\n" + "}\n"
+	# Dispatch from symbol sets to their tables
+	dispatch = ''
+	dispatch += '// Generated by generation/parse.py. Symbol sets the build leaves out, by defining\n'
+	dispatch += '// MILSYMBOL_WITHOUT_<SET>, have no tables, so their symbols are drawn with their frame only\n'
+	dispatch += '#include "Schema.hpp"\n\n'
+	dispatch += '#include <algorithm>\n\n'
+	dispatch += 'namespace milsymbol::_impl {\n\n'
+
+	dispatch += 'SymbolLayer LayerTable::find(int32_t code) const noexcept {\n'
+	dispatch += '\tauto it = std::lower_bound(codes.begin(), codes.end(), code);\n'
+	dispatch += '\tif (it == codes.end() || *it != code) {\n'
+	dispatch += '\t\treturn {};\n'
+	dispatch += '\t}\n'
+	dispatch += '\treturn layers[it - codes.begin()];\n'
+	dispatch += '}\n\n'
+
+	dispatch += 'std::optional<BoundingBox> LayerTable::find_bbox(int32_t code) const noexcept {\n'
+	dispatch += '\tauto it = std::lower_bound(codes.begin(), codes.end(), code);\n'
+	dispatch += '\tif (it == codes.end() || *it != code) {\n'
+	dispatch += '\t\treturn std::nullopt;\n'
+	dispatch += '\t}\n'
+	dispatch += '\treturn layers[it - codes.begin()].bbox;\n'
+	dispatch += '}\n\n'
+
+	dispatch += 'LayerTable build_layer_table(std::span<const LayerEntry> entries, std::span<const uint16_t> command_indices,\n'
+	dispatch += '\tconst std::vector<DrawCommand>& commands) {\n'
+	dispatch += '\tLayerTable table;\n'
+	dispatch += '\ttable.codes.reserve(entries.size());\n'
+	dispatch += '\ttable.layers.reserve(entries.size());\n'
+	dispatch += '\tfor (const LayerEntry& entry : entries) {\n'
+	dispatch += '\t\tSymbolLayer layer;\n'
+	dispatch += '\t\tlayer.draw_items.reserve(entry.command_count);\n'
+	dispatch += '\t\tfor (uint16_t index : command_indices.subspan(entry.first_command, entry.command_count)) {\n'
+	dispatch += '\t\t\tlayer.draw_items.push_back(commands[index]);\n'
+	dispatch += '\t\t}\n'
+	dispatch += '\t\tlayer.civilian_override = entry.civilian_override;\n'
+	dispatch += '\t\tlayer.bbox = entry.bbox;\n'
+	dispatch += '\t\ttable.codes.push_back(entry.code);\n'
+	dispatch += '\t\ttable.layers.push_back(std::move(layer));\n'
+	dispatch += '\t}\n'
+	dispatch += '\treturn table;\n'
+	dispatch += '}\n\n'
+
+	def dispatch_case(symbol_set, call:str) -> str:
+		guard = f'MILSYMBOL_WITHOUT_{function_prefix(symbol_set).upper()}'
+		return f'#ifndef {guard}\n\tcase SymbolSet::{sanitize_constant(symbol_set.name)}: return {call};\n#endif\n'
+
+	dispatch += 'SymbolLayer get_symbol_layer(SymbolSet symbol_set, int32_t code, IconType symbol_type) noexcept {\n'
+	dispatch += '\tswitch (symbol_set) {\n'
+	for symbol_set in table_sets:
+		dispatch += dispatch_case(symbol_set, f'get_{function_prefix(symbol_set)}_layer(code, symbol_type)')
+	dispatch += '\tdefault: return {};\n'
+	dispatch += '\t}\n}\n'
+
+	dispatch += '\nstd::optional<BoundingBox> get_symbol_bbox(SymbolSet symbol_set, int32_t code, IconType symbol_type) noexcept {\n'
+	dispatch += '\tswitch (symbol_set) {\n'
+	for symbol_set in table_sets:
+		dispatch += dispatch_case(symbol_set, f'get_{function_prefix(symbol_set)}_bbox(code, symbol_type)')
+	dispatch += '\tdefault: return std::nullopt;\n'
+	dispatch += '\t}\n}\n'
 
-	# Create the enumerator
 	if include_enumerator:
-		schema += "static constexpr std::vector<int32_t> get_available_symbols(SymbolSet symbol_set, IconType symbol_type) {\n"
-
-		for index, symbol_set in enumerate(symbol_sets):
-			schema += '\t{}if (symbol_set == SymbolSet::{}) {{\n'.format('else ' if index > 0 else '', sanitize_constant(symbol_set.name))
-
-			SYMBOL_TYPE_HEADERS = ['ENTITY', 'MODIFIER_1', 'MODIFIER_2']
-
+		dispatch += '\nstd::vector<int32_t> get_available_symbols(SymbolSet symbol_set, IconType symbol_type) noexcept {\n'
+		dispatch += '\tswitch (symbol_set) {\n'
+		for symbol_set in table_sets:
+			dispatch += dispatch_case(symbol_set, f'get_{function_prefix(symbol_set)}_symbols(symbol_type)')
+		dispatch += '\tdefault: return {};\n'
+		dispatch += '\t}\n}\n'
+
+	dispatch += '\n}\n'
+
+	os.makedirs(schema_source_dir, exist_ok=True)
+	with open(os.path.join(schema_source_dir, 'Schema.cpp'), 'w') as dispatch_file:
+		dispatch_file.write(dispatch)
+
+	# Tables for each symbol set, built once on first use
+	for symbol_set in table_sets:
+		prefix = function_prefix(symbol_set)
+		source = ''
+		source += f'// Generated by generation/parse.py from the "{symbol_set.name}" symbol set\n'
+		source += '#include "Schema.hpp"\n\n'
+		source += 'namespace milsymbol::_impl {\n\n'
+
+		# The tables hold vectors, so they can't be constant; building them in functions that aren't
+		# constexpr keeps compilers from attempting (and abandoning) a very costly constant evaluation
+		source += 'namespace {\n\n'
+
+		# Each table's distinct draw commands are built once into a pool that entries refer to by index,
+		# and path data written more than once in this file is written once as a constant
+		tables = [sorted(sym_type.values(), key=lambda sym: int('{}{:02}'.format(int(symbol_set.id), int(sym.uid))))
+			for sym_type in [symbol_set.icons, symbol_set.m1, symbol_set.m2]]
+		pools = [CommandPool(table, output_style) for table in tables]
+		path_counts = {}
+		for pool in pools:
+			pool.count_paths(path_counts)
+		output_style.shared_paths = {}
+		for d, count in path_counts.items():
+			if count > 1:
+				output_style.shared_paths[d] = f'PATH_{len(output_style.shared_paths)}'
+		if len(output_style.shared_paths) > 0:
+			source += '// Path data used by more than one draw command\n'
+			source += ''.join([f'constexpr const char {name}[] = "{d}";\n' for d, name in output_style.shared_paths.items()]) + '\n'
+
+		for symtype_index, table in enumerate(tables):
+			pool = pools[symtype_index]
+			command_indices = []
+			entries = []
+			for sym in table:
+				first_command = len(command_indices)
+				command_indices += [pool.add(element) for element in sym.elements]
+				bbox = merge_bboxes(element.get_bbox() for element in sym.elements)
+				entries.append('\t\t{{{}{:02}, {}, {}, {}, {}}} /* {} */'.format(int(symbol_set.id), int(sym.uid), first_command,
+					len(sym.elements), 'true' if sym.civilian else 'false', bbox_to_cpp(bbox) if bbox is not None else 'std::nullopt', sym.names[0]))
+
+			source += 'LayerTable build_{}_table() {{\n'.format(SYMBOL_TYPE_HEADERS[symtype_index].lower())
+			source += '\tstd::vector<DrawCommand> commands;\n'
+			if len(pool.commands) > 0:
+				source += f'\tcommands.reserve({len(pool.commands)});\n'
+				source += ''.join([f'\tcommands.push_back({command});\n' for command in pool.commands])
+			source += '\n'
+			source += '\tstatic constexpr uint16_t COMMAND_INDICES[] = {' + ', '.join([str(index) for index in command_indices]) + '};\n'
+			source += '\tstatic constexpr LayerEntry ENTRIES[] = {\n'
+			source += ',\n'.join(entries) + '\n'
+			source += '\t};\n'
+			source += '\treturn build_layer_table(ENTRIES, COMMAND_INDICES, commands);\n'
+			source += '}\n\n'
+		output_style.shared_paths = {}
+
+		source += 'const LayerTable& get_table(IconType symbol_type) noexcept {\n'
+		for symtype_index, sym_type in enumerate([symbol_set.icons, symbol_set.m1, symbol_set.m2]):
+			if symtype_index < 2:
+				source += '\t{}if (symbol_type == IconType::{}) {{\n'.format('} else ' if symtype_index > 0 else '', SYMBOL_TYPE_HEADERS[symtype_index])
+			else:
+				source += '\t}\n\n'
+
+			# Built once, on first use
+			indent = '\t\t' if symtype_index < 2 else '\t'
+			table_title:str = f'{SYMBOL_TYPE_HEADERS[symtype_index]}_TABLE'
+			source += '{}static const LayerTable {} = build_{}_table();\n'.format(indent, table_title, SYMBOL_TYPE_HEADERS[symtype_index].lower())
+			source += f'{indent}return {table_title};\n'
+		source += '}\n\n'
+		source += '}\n\n'
+
+		source += f'SymbolLayer get_{prefix}_layer(int32_t code, IconType symbol_type) noexcept {{\n'
+		source += '\treturn get_table(symbol_type).find(code);\n'
+		source += '}\n\n'
+		source += f'std::optional<BoundingBox> get_{prefix}_bbox(int32_t code, IconType symbol_type) noexcept {{\n'
+		source += '\treturn get_table(symbol_type).find_bbox(code);\n'
+		source += '}\n'
+
+		if include_enumerator:
+			source += f'\nstd::vector<int32_t> get_{prefix}_symbols(IconType symbol_type) noexcept {{\n'
 			for symtype_index, sym_type in enumerate([symbol_set.icons, symbol_set.m1, symbol_set.m2]):
-				schema += '\t\t{}if (symbol_type == IconType::{}) {{\n'.format('else ' if symtype_index > 0 else '', SYMBOL_TYPE_HEADERS[symtype_index])
-
-				# Iterate through symbols
-				schema += 'return {{{}}};'.format(', '.join(
+				source += '\t{}if (symbol_type == IconType::{}) {{\n'.format('else ' if symtype_index > 0 else '', SYMBOL_TYPE_HEADERS[symtype_index])
+				source += '\t\treturn {{{}}};\n'.format(', '.join(
 					[f'{int(sym.uid)} /*{sym.names[0]}*/' for sym in sym_type.values()]
 				))
-
-				# schema += '\t\t\tconst auto {} = mapbox::eternal::map<int32_t, SymbolLayer>({{\n'.format(map_title)
-				# schema += ',\n'.join(['\t\t\t\t{{{}{:02}, {}}} /* {} */'.format(int(symbol_set.id), int(sym.uid), sym.cpp(output_style=output_style), sym.names[0]) for sym_code, sym in sym_type.items()]) + '\n'
-				# schema += '\t\t\t});\n'
-
-				# schema += "\t\t\tauto it = {}.find(code);\n".format(map_title) + \
-				# 	f"\t\t\treturn (it != {map_title}.end() ? it->second : SymbolLayer{{}});\n"
-
-				schema += '\t\t}\n' # Close if block for symbol type
-
-			schema += '\t}\n\n' # Close if block for symbol set
-
-		schema +=  "\n\t// Default to nothing\n\treturn {};\n" + "}\n" # Close function
-
-	# Close the namespace
-	schema += '}'
-
-	with open(schema_filename, 'w') as schema_file:
-		schema_file.write(schema)
+				source += '\t}\n'
+			source += '\n\t// Default to nothing\n\treturn {};\n}\n'
+
+		source += '\n}\n'
+
+		with open(os.path.join(schema_source_dir, source_name(symbol_set)), 'w') as source_file:
+			source_file.write(source)
+
+	# List the generated sources for the build, which compiles the sets chosen by the `symbol_sets` option
+	build = '# Generated by generation/parse.py: the schema tables, one file per symbol set. Sets left out of the\n'
+	build += '# `symbol_sets` option aren\'t compiled and draw their symbols with their frame only; schema_arguments\n'
+	build += '# tells Schema.cpp which ones those are. schema_all_sources has every set, for comparison builds.\n'
+	build += 'schema_set_sources = {\n' + ',\n'.join([f"    '{function_prefix(symbol_set)}': files('{source_name(symbol_set)}')" for symbol_set in table_sets]) + '\n}\n\n'
+	build += "schema_sources = files('Schema.cpp')\n"
+	build += "schema_all_sources = files('Schema.cpp')\n"
+	build += 'schema_arguments = []\n'
+	build += 'foreach name, sources : schema_set_sources\n'
+	build += '    schema_all_sources += sources\n'
+	build += "    if name in get_option('symbol_sets')\n"
+	build += '        schema_sources += sources\n'
+	build += '    else\n'
+	build += "        schema_arguments += '-DMILSYMBOL_WITHOUT_' + name.to_upper()\n"
+	build += '    endif\n'
+	build += 'endforeach\n'
+	build += "foreach name : get_option('symbol_sets')\n"
+	build += '    if name not in schema_set_sources\n'
+	build += "        warning('Symbol set ' + name + ' was left out when the schema was generated, so it will be drawn with its frame only')\n"
+	build += '    endif\n'
+	build += 'endforeach\n'
+	with open(os.path.join(schema_source_dir, 'meson.build'), 'w') as build_file:
+		build_file.write(build)
+
+	if len(glyph_filename) > 0:
+		create_glyph_table(output_style, glyph_filename)
 
 	if len(godot_filename) > 0:
 		symbol_set_name_key:str = "SYMBOL_SET_NAME"
@@ -761,6 +1240,37 @@ def create_schema(symbol_sets:list, schema_filename:str, constant_filename:str,
 		with open(godot_filename, 'w') as godot_file_object:
 			godot_file_object.write(godot_file)
 
+"""
+Generates the C++ glyph table text is assembled from at runtime. Each glyph is defined
+once, in font units, so labels share outlines instead of each carrying its own copy.
+"""
+def create_glyph_table(output_style:OutputStyle, glyph_filename:str) -> None:
+	font_face = Font(output_style.text_path_font, size = 1)
+	characters = sorted(set(chr(code) for code in range(0x20, 0x7F)) | output_style.text_characters)
+
+	glyphs = ''
+	glyphs += '#pragma once\n'
+	glyphs += '#include "DrawCommands.hpp"\n\n'
+	glyphs += 'namespace milsymbol::_impl {\n\n'
+
+	glyphs += '/// Whether text is written to SVGs as paths built from the glyph table, rather than as text elements\n'
+	glyphs += 'inline constexpr bool TEXT_AS_PATHS = {};\n\n'.format('true' if output_style.use_text_paths else 'false')
+	glyphs += '/// Font units per em in the glyph table; a glyph drawn at font size S is scaled by S / GLYPH_UNITS_PER_EM\n'
+	glyphs += 'inline constexpr real_t GLYPH_UNITS_PER_EM = {};\n\n'.format(font_face.units_per_em())
+
+	glyphs += '/// Outlines and advances of every glyph text can use, from {}, sorted by code point\n'.format(os.path.basename(output_style.text_path_font))
+	glyphs += 'inline constexpr Glyph GLYPHS[] = {\n'
+	entries = []
+	for char in characters:
+		advance, d = font_face.glyph_outline(char)
+		entries.append('\t{{0x{:04X}, {:g}, "{}"}}'.format(ord(char), advance, d))
+	glyphs += ',\n'.join(entries) + '\n'
+	glyphs += '};\n\n'
+
+	glyphs += '}\n'
+	with open(glyph_filename, 'w', encoding='utf-8') as glyph_file:
+		glyph_file.write(glyphs)
+
 """
 Main command line interface. The only option is -p or --text-paths for using paths for text.
 This is useful for rendering in some instances (e.g., the rendering library used for the end 
@@ -787,8 +1297,11 @@ if __name__ == '__main__':
 		default=True, help='Use paths for SVGs instead of text elements; this can be useful for rendering in some applications')
 	parser.add_argument('-f', '--text-path-font', dest='text_path_font', action='store',
 		default=DEFAULT_FONT_FILE,
-		help='Font to use when creating a text path; only applicable when -p or --text-paths is passes as well')
+		help='Font to take the glyph table text is drawn from; SVG output uses it when -p or --text-paths is passed as well')
 	parser.add_argument('-g', '--godot_file_name', dest='godot_file_name', action='store', default='')
+	parser.add_argument('-s', '--symbol-sets', dest='symbol_sets', action='store', default=None,
+		help='Comma-separated symbol sets to generate tables for, by their build option names (e.g. land_unit,land_equipment); '
+		'the others are drawn with their frame only. Defaults to all of them')
 	arguments = parser.parse_args()
 
 
@@ -796,10 +1309,14 @@ if __name__ == '__main__':
 	create_schema(
 		symbol_sets=symbol_sets, 
 		use_text_paths=arguments.use_text_paths,
-		text_path_font=arguments.text_path_font,
+		text_path_font=(arguments.text_path_font if os.path.exists(arguments.text_path_font) else
+			os.path.join(cwd, arguments.text_path_font)),
 		constant_filename=os.path.join(cwd, '..', 'include', 'Constants.hpp'),
 		schema_filename=os.path.join(cwd, '..', 'include', 'Schema.hpp'),
-		godot_filename = os.path.join(cwd, '..', 'include', 'SIDCConstants.gd'))
+		schema_source_dir=os.path.join(cwd, '..', 'src', 'schema'),
+		glyph_filename=os.path.join(cwd, '..', 'include', 'Glyphs.hpp'),
+		godot_filename = os.path.join(cwd, '..', 'include', 'SIDCConstants.gd'),
+		included_symbol_sets = (arguments.symbol_sets.split(',') if arguments.symbol_sets is not None else None))
 
 	if False:
 		# Generate examples
@@ -0,0 +1,218 @@
+#pragma once
+
+/*
+ * This file contains a packed atlas layout for many symbols, for building sprite sheets
+ * and texture atlases.
+ */
+
+#include <ostream>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Symbol.hpp"
+#include "SkylinePacker.hpp"
+
+namespace milsymbol {
+
+/**
+ * @brief A packed layout of many symbols rendered with one style.
+ *
+ * Rectangles are in whole pixels at the style's icon size, and are the symbols' SVG bounding
+ * boxes from Symbol::get_svg rounded up, so the atlas can be rasterized directly into a texture.
+ */
+struct Atlas {
+    /**
+     * @brief Where a single symbol is in the atlas
+     */
+    struct Placement {
+        std::string key; /// The key the symbol was added with
+        Symbol symbol; /// The placed symbol
+        BoundingBox rect; /// Rectangle of the symbol in the atlas, in whole pixels
+        BoundingBox svg_bounding_box; /// The symbol's SVG bounding box (viewbox) from Symbol::get_svg
+        BoundingBox frame_bounding_box; /// Bounding box of the symbol frame, relative to the top left of `rect`
+        Vector2 symbol_anchor; /// Symbol anchor, relative to the top left of `rect`
+    };
+
+    int width = 0; /// Width of the atlas in pixels
+    int height = 0; /// Height of the atlas in pixels
+    SymbolStyle style; /// The style every symbol is laid out and rendered with
+    std::vector<Placement> placements; /// Placements, in the order symbols were added
+
+    /**
+     * @brief Returns the placement for the given key, or nullptr if there isn't one
+     */
+    const Placement* find(std::string_view key) const noexcept;
+
+    /**
+     * @brief Streams the atlas as a single SVG document. Each unique frame, amplifier set, entity icon and
+     * modifier is written once as a `<symbol>` and placed symbols reference them with `<use>`. When text is
+     * drawn as paths, each glyph it uses is likewise written once and referenced.
+     */
+    void write_svg(std::ostream& out) const noexcept;
+
+    /**
+     * @brief Streams a standalone SVG of a single placement, whose viewBox is the placement's rectangle
+     * in atlas coordinates. Rendered at the rectangle's size, it matches that region of write_svg.
+     */
+    void write_placement_svg(std::ostream& out, const Placement& placement) const noexcept;
+
+    /**
+     * @brief Streams compact JSON metadata for the atlas, of the form
+     * `{"width":W,"height":H,"sprites":{"key":[x,y,width,height,anchor_x,anchor_y],...}}`
+     */
+    void write_metadata(std::ostream& out) const noexcept;
+
+private:
+    friend struct AtlasBuilder;
+    friend struct IncrementalAtlas;
+
+    /// Serialized definitions shared between placements, in order of first use
+    struct DefinitionPool {
+        std::unordered_map<std::string, std::size_t> indices;
+        std::vector<const std::string*> definitions;
+        std::set<char32_t> glyphs; /// Code points of glyphs referenced by text in the definitions
+    };
+
+    std::unordered_map<std::string, std::size_t> key_indices;
+
+    /// Writes a placement's group, referencing definitions in `pool`, or inline if it's null
+    void write_placement_group(std::ostream& out, const Placement& placement, DefinitionPool* pool) const noexcept;
+};
+
+/**
+ * @brief Lays out symbols into a packed atlas.
+ *
+ * Symbol sizes come from the same layout pass as Symbol::get_svg (see Symbol::get_layout), without
+ * serializing any SVG, and are packed with a skyline bottom-left bin packer, tallest symbols first.
+ */
+struct AtlasBuilder {
+
+    /**
+     * @brief Adds a symbol, keyed by its 20-character SIDC
+     * @return This same object, modified
+     */
+    AtlasBuilder& add(const Symbol& symbol);
+
+    /**
+     * @brief Adds a symbol with the given key. Keys should be unique.
+     * @return This same object, modified
+     */
+    AtlasBuilder& add(std::string key, const Symbol& symbol);
+
+    /**
+     * @brief Sets the style used for every symbol in the atlas
+     * @return This same object, modified
+     */
+    inline AtlasBuilder& with_style(const SymbolStyle& style) noexcept {
+        this->style = style;
+        return *this;
+    }
+
+    /**
+     * @brief Sets the maximum width of the atlas in pixels; its height grows to fit the symbols.
+     * @return This same object, modified
+     */
+    inline AtlasBuilder& with_max_width(int max_width) noexcept {
+        this->max_width = max_width;
+        return *this;
+    }
+
+    /**
+     * @brief Sets the spacing between neighboring symbols in pixels
+     * @return This same object, modified
+     */
+    inline AtlasBuilder& with_spacing(int spacing) noexcept {
+        this->spacing = spacing;
+        return *this;
+    }
+
+    inline std::size_t size() const noexcept {return entries.size();} /// Returns the number of symbols added
+
+    /**
+     * @brief Lays out the atlas. Symbols wider than the atlas are left out.
+     */
+    Atlas build() const noexcept;
+
+private:
+    struct Entry {
+        std::string key;
+        Symbol symbol;
+    };
+
+    std::vector<Entry> entries;
+    SymbolStyle style;
+    int max_width = 2048;
+    int spacing = 2;
+};
+
+/**
+ * @brief An atlas that accepts new symbols at runtime without repacking.
+ *
+ * New symbols go into the free space left by earlier ones, and placed symbols never move, so a
+ * texture made from the atlas can be patched with just the rectangles that changed. The atlas has
+ * a fixed capacity, which can be grown with reserve() to keep spare room.
+ */
+struct IncrementalAtlas {
+    /**
+     * @brief A newly placed region of the atlas
+     */
+    struct DirtyRect {
+        std::string key; /// Key of the symbol placed in this rectangle
+        BoundingBox rect; /// Rectangle in the atlas, in whole pixels
+        std::string svg; /// Standalone SVG of the rectangle, as from Atlas::write_placement_svg
+    };
+
+    /**
+     * @brief Creates an empty atlas with the given capacity in pixels
+     */
+    IncrementalAtlas(const SymbolStyle& style = {}, int width = 2048, int height = 2048, int spacing = 2) noexcept;
+
+    /**
+     * @brief Adds a symbol keyed by its 20-character SIDC. See insert(std::string, const Symbol&).
+     */
+    const Atlas::Placement* insert(const Symbol& symbol) noexcept;
+
+    /**
+     * @brief Adds a symbol with the given key, returning its placement, or nullptr if it doesn't fit in
+     * the remaining capacity. A key that's already placed returns the existing placement. The returned
+     * pointer is valid until the next insertion.
+     */
+    const Atlas::Placement* insert(std::string key, const Symbol& symbol) noexcept;
+
+    /**
+     * @brief Returns the placement for the given key, or nullptr if there isn't one
+     */
+    inline const Atlas::Placement* find(std::string_view key) const noexcept {return atlas.find(key);}
+
+    /**
+     * @brief Grows the atlas's height to at least the given number of pixels. Existing placements are unaffected.
+     */
+    void reserve(int height) noexcept;
+
+    inline int get_width() const noexcept {return atlas.width;} /// Returns the capacity width in pixels
+    inline int get_height() const noexcept {return atlas.height;} /// Returns the capacity height in pixels
+    inline int get_used_height() const noexcept {return used_height;} /// Returns the height of the occupied area
+    inline std::size_t size() const noexcept {return atlas.placements.size();} /// Returns the number of placed symbols
+
+    /**
+     * @brief Returns the whole atlas. Its size is the current capacity.
+     */
+    inline const Atlas& get_atlas() const noexcept {return atlas;}
+
+    /**
+     * @brief Returns the rectangles placed since the last call, with their SVG fragments, and clears them
+     */
+    std::vector<DirtyRect> take_dirty_rects() noexcept;
+
+private:
+    Atlas atlas;
+    _impl::SkylinePacker packer;
+    int spacing = 2;
+    int used_height = 0;
+    std::vector<std::size_t> dirty; /// Indices of placements not yet reported
+};
+
+}
@@ -37,6 +37,9 @@ struct Vector2 {
     inline constexpr Vector2 operator*(const base_t fac) const noexcept {
         return Vector2{x * fac, y * fac};
     }
+
+    /// Componentwise equality
+    inline constexpr bool operator==(const Vector2& other) const noexcept = default;
 };
 
 /**
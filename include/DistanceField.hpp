@@ -0,0 +1,146 @@
+#pragma once
+
+/*
+ * This file contains signed distance field output for symbols and atlases, so a single small
+ * texture can be drawn sharply at any size.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "Symbol.hpp"
+#include "Atlas.hpp"
+#include "Rasterizer.hpp"
+
+namespace milsymbol {
+
+/**
+ * @brief What the channels of a distance field measure
+ */
+enum class DistanceFieldChannels {
+    SILHOUETTE = 1, /// One channel: distance to the outline of everything the symbol draws
+    COLOR_CLASSES = 4 /// Four channels: distance to what's drawn in each color class, in ColorType order - icon, icon fill, white and yellow
+};
+
+/**
+ * @brief A signed distance field image, with channels interleaved per pixel.
+ *
+ * Each value encodes the distance from the pixel's center to the nearest edge of the shape, in pixels
+ * at the style's icon size: 128 is on the edge, 255 is `spread` pixels or more inside it and 0 is `spread`
+ * pixels or more outside it. Sampling with linear filtering and thresholding at 0.5 recovers the shape at
+ * any scale; the COLOR_CLASSES channels are drawn icon fill, white and yellow first, then icon on top.
+ */
+struct DistanceField {
+    int width = 0; /// Width in pixels
+    int height = 0; /// Height in pixels
+    int channels = 1; /// Values per pixel
+    real_t spread = 0; /// Distance in pixels that maps to the full range on either side of the edge
+    std::vector<std::uint8_t> values; /// Rows of interleaved values, packed
+
+    /**
+     * @brief For a symbol's field, its layout as from Symbol::get_layout. Its SVG bounding box starts `padding`
+     * pixels in from the field's top left.
+     */
+    Symbol::RichOutput layout;
+    int padding = 0; /// Empty border around the shape, in pixels
+};
+
+/**
+ * @brief Generates signed distance fields from symbol geometry on the CPU.
+ *
+ * The symbol's flattened paths are rasterized into anti-aliased coverage masks, one per channel, which
+ * seed an exact Euclidean distance transform; partial coverage places edges to within a fraction of a
+ * pixel. Both run at a multiple of the field's resolution, which is then sampled at pixel centers.
+ * Fields are generated small and scaled up when drawn; a silhouette holds up from an icon size of 32,
+ * but color classes need around 64 for the symbols' strokes to be wider than a pixel.
+ * Scratch buffers are kept between calls, so keep one generator per thread and reuse it.
+ */
+struct DistanceFieldGenerator {
+
+    /**
+     * @brief Sets what the field's channels measure
+     * @return This same object, modified
+     */
+    inline DistanceFieldGenerator& with_channels(DistanceFieldChannels channels) noexcept {
+        this->channels = channels;
+        return *this;
+    }
+
+    /**
+     * @brief Sets the distance in pixels encoded on either side of edges. Larger spreads allow wider
+     * outlines and glows and more downscaling, at the cost of precision.
+     * @return This same object, modified
+     */
+    inline DistanceFieldGenerator& with_spread(real_t spread) noexcept {
+        this->spread = spread;
+        return *this;
+    }
+
+    /**
+     * @brief Sets the empty border around a symbol's field, in pixels; it should be at least the spread
+     * @return This same object, modified
+     */
+    inline DistanceFieldGenerator& with_padding(int padding) noexcept {
+        this->padding = padding;
+        return *this;
+    }
+
+    /**
+     * @brief Sets how many times finer than the field the coverage masks and distance transform are, in each
+     * direction. Strokes narrower than about a pixel and a half need at least 2 to stay unbroken.
+     * @return This same object, modified
+     */
+    inline DistanceFieldGenerator& with_oversampling(int oversampling) noexcept {
+        this->oversampling = std::max(1, oversampling);
+        return *this;
+    }
+
+    /**
+     * @brief Sets how far flattened curves may stray from the true curve, in pixels
+     * @return This same object, modified
+     */
+    inline DistanceFieldGenerator& with_tolerance(real_t tolerance) noexcept {
+        rasterizer.with_tolerance(tolerance);
+        return *this;
+    }
+
+    /**
+     * @brief Generates the field of a single symbol, the size of its SVG bounding box plus the padding on each side
+     */
+    DistanceField generate(const Symbol& symbol, const SymbolStyle& style = {}) noexcept;
+
+    /**
+     * @brief Generates the field of a whole atlas, the size of the atlas. Each placement's field is generated on
+     * its own over its rectangle grown by the padding, so atlases should be built with a spacing of at least twice
+     * the padding; otherwise the borders of neighboring placements overwrite each other, in placement order.
+     */
+    DistanceField generate(const Atlas& atlas) noexcept;
+
+private:
+    DistanceFieldChannels channels = DistanceFieldChannels::SILHOUETTE;
+    real_t spread = 4;
+    int padding = 4;
+    int oversampling = 2;
+
+    Rasterizer rasterizer;
+    std::vector<std::uint8_t> masks; /// RGBA coverage masks, one per channel, oversampled
+    std::vector<double> outside; /// Squared distance to the nearest covered point
+    std::vector<double> inside; /// Squared distance to the nearest uncovered point
+    std::vector<double> column; /// Scratch for one row or column of the transform
+    std::vector<int> parabolas; /// Scratch for the transform's lower envelope
+    std::vector<double> boundaries; /// Scratch for the transform's lower envelope
+
+    std::vector<std::uint8_t> field; /// The field of the last symbol generated
+
+    /**
+     * @brief Generates the field of already-built symbol parts into `field`, `width` by `height` pixels, with the
+     * symbol's SVG bounding box `padding` pixels in from its top left
+     */
+    void generate_parts(const _impl::SymbolParts& parts, int width, int height) noexcept;
+
+    /// Runs the squared Euclidean distance transform over one channel of `width` by `height` values in place
+    void transform(std::vector<double>& grid, int width, int height) noexcept;
+};
+
+}
@@ -8,6 +8,7 @@
 #include <iostream>
 #include <variant>
 #include <optional>
+#include <set>
 #include <vector>
 
 #include "Types.hpp"
@@ -24,6 +25,9 @@ enum class StrokeStyle {
     DASHED
 };
 
+/// Length of each dash, and of each gap between dashes, in a dashed stroke
+static constexpr real_t DASH_LENGTH = 8;
+
 /// Font weights - if compiled with the SVG text option, this
 /// doesn't do anything.
 enum FontWeight {
@@ -61,6 +65,45 @@ static constexpr const char* get_font_alignment_string(TextAlignment alignment)
 }
 
 
+/**
+ * @brief A glyph of the text font, from the generated glyph table in Glyphs.hpp
+ */
+struct Glyph {
+    char32_t code = 0; /// Unicode code point
+    real_t advance = 0; /// Distance to the next glyph's origin, in font units
+    const char* d = ""; /// Outline as SVG path data in font units, with y down and the origin on the baseline
+};
+
+/**
+ * @brief Returns the glyph for a code point, or nullptr if the glyph table doesn't have it
+ */
+const Glyph* find_glyph(char32_t code) noexcept;
+
+/**
+ * @brief Reads the UTF-8 encoded code point at `text` and moves past it. Malformed bytes are read as themselves.
+ */
+inline constexpr char32_t read_code_point(const char*& text) noexcept {
+    auto byte = [&](int i) {return static_cast<char32_t>(static_cast<unsigned char>(text[i]));};
+    char32_t lead = byte(0);
+    int length = (lead < 0xC0 ? 1 : (lead < 0xE0 ? 2 : (lead < 0xF0 ? 3 : 4)));
+    for (int i = 1; i < length; i++) {
+        if ((byte(i) & 0xC0) != 0x80) {
+            text++;
+            return lead;
+        }
+    }
+
+    char32_t code = (length == 1 ? lead : lead & (0x3F >> (length - 1)));
+    for (int i = 1; i < length; i++) {
+        code = (code << 6) | (byte(i) & 0x3F);
+    }
+    text += length;
+    return code;
+}
+
+/// Code points of glyphs referenced by text written with Style::glyph_references
+using GlyphUses = std::set<char32_t>;
+
 /**
  * @brief Represents a style with which to draw a symbol element
  */
@@ -74,6 +117,12 @@ struct Style {
     Color color_override = Color{255, 255, 0};
     float stroke_width_override = -1;
 
+    /**
+     * @brief If set, text written to SVG as paths references shared glyph definitions by id, "g" followed by
+     * the decimal code point, instead of repeating each outline, and adds the glyphs it uses here
+     */
+    GlyphUses* glyph_references = nullptr;
+
     inline constexpr Color get_color(ColorType color_type) const noexcept {
         if (use_color_override) {
             if (color_type == ColorType::ICON_FILL) {
@@ -237,6 +286,31 @@ struct DrawInstructionText : public DrawInstructionBase<DrawInstructionText> {
 
     std::string get_svg_string(const Style& context) const noexcept;
 
+    /// Returns the size of a font unit of the glyph table when drawn, in the units the text is positioned in
+    real_t get_glyph_scale() const noexcept;
+
+    /// Returns where the first glyph's origin is drawn, on the baseline at the start of the aligned text
+    Vector2 get_glyph_origin() const noexcept;
+
+    /**
+     * @brief Calls `place(const Glyph& glyph, real_t x)` for each glyph of the text with an outline, where `x` is
+     * its origin's distance along the baseline from the first glyph's, in font units
+     */
+    template<typename Place>
+    inline void for_each_glyph(Place&& place) const noexcept {
+        real_t x = 0;
+        for (const char* c = text; *c != '\0';) {
+            const Glyph* glyph = find_glyph(read_code_point(c));
+            if (glyph == nullptr) {
+                continue;
+            }
+            if (*glyph->d != '\0') {
+                place(*glyph, x);
+            }
+            x += glyph->advance;
+        }
+    }
+
     inline constexpr DrawInstructionText& with_font_weight(FontWeight weight) noexcept {
         this->font_weight = weight;
         return *this;
@@ -434,7 +508,7 @@ struct DrawCommand {
             size = 25;
             y = 140;
         } else if (strview.size() >= 4) {
-            size = 20;
+            size = 22;
             y = 135;
         }
 
@@ -509,6 +583,21 @@ struct DrawCommand {
         }
     }
 
+    /**
+     * @brief Returns the instruction if it's of the given type, or nullptr otherwise
+     */
+    template<typename T>
+    inline constexpr const T* get_instruction() const noexcept {
+        return std::get_if<T>(&variant);
+    }
+
+    /**
+     * @brief Returns the variant of a full frame command drawn for the given affiliation
+     */
+    inline constexpr const DrawCommand& get_affiliation_variant(Affiliation affiliation) const noexcept {
+        return std::get<AffiliationSet>(variant)[static_cast<int>(get_base_affiliation(affiliation))];
+    }
+
     /**
      * @brief Returns whether the command is defined and valid
      */
@@ -634,10 +723,11 @@ private:
  */
 struct SymbolLayer {
     inline constexpr SymbolLayer() noexcept {}; /// Default constructor
-    inline constexpr SymbolLayer(const SymbolLayer& other) noexcept : draw_items{other.draw_items}, civilian_override{other.civilian_override} {}
+    inline constexpr SymbolLayer(const SymbolLayer& other) noexcept : draw_items{other.draw_items}, civilian_override{other.civilian_override}, bbox{other.bbox} {}
     inline constexpr SymbolLayer& operator=(const SymbolLayer& other) noexcept {
         draw_items = other.draw_items;
         civilian_override = other.civilian_override;
+        bbox = other.bbox;
         return *this;
     }
 
@@ -646,6 +736,7 @@ struct SymbolLayer {
 
     std::vector<DrawCommand> draw_items;
     bool civilian_override = false;
+    std::optional<BoundingBox> bbox; /// Precomputed extents of the draw items, except full frame and text commands, if any
 
     inline constexpr SymbolLayer& with_civilian_override(bool override) noexcept {
         civilian_override = override;
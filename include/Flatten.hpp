@@ -0,0 +1,212 @@
+#pragma once
+
+/*
+ * This file contains the flattening of draw commands into polygons, for the outputs
+ * that work with geometry directly instead of going through SVG.
+ */
+
+#include <string_view>
+#include <vector>
+
+#include "DrawCommands.hpp"
+
+namespace milsymbol::_impl {
+
+/**
+ * @brief A uniform scale followed by a translation - the only transforms draw commands use
+ */
+struct Transform {
+    real_t scale = 1; /// Scale factor around the origin
+    Vector2 offset{0, 0}; /// Translation applied after scaling
+
+    /// Transforms a point
+    inline constexpr Vector2 apply(const Vector2& point) const noexcept {
+        return Vector2{point.x * scale + offset.x, point.y * scale + offset.y};
+    }
+
+    /// Returns the transform that applies `inner` first, then this one
+    inline constexpr Transform after(const Transform& inner) const noexcept {
+        return Transform{scale * inner.scale, apply(inner.offset)};
+    }
+};
+
+/**
+ * @brief A set of polylines, stored as runs of points
+ */
+struct Polylines {
+    /// A single polyline; closed polylines have an implied segment from the last point to the first
+    struct Contour {
+        std::size_t begin = 0; /// Index of the first point
+        std::size_t end = 0; /// Index one past the last point
+        bool closed = false; /// Whether the contour is closed
+    };
+
+    std::vector<Vector2> points;
+    std::vector<Contour> contours;
+
+    /// Removes all contours, keeping the allocated memory
+    inline void clear() noexcept {
+        points.clear();
+        contours.clear();
+    }
+
+    /// Returns whether there are no contours
+    inline bool empty() const noexcept {return contours.empty();}
+
+    /// Starts a new contour at the given point
+    inline void move_to(const Vector2& point) noexcept {
+        contours.push_back(Contour{points.size(), points.size() + 1, false});
+        points.push_back(point);
+    }
+
+    /// Adds a point to the current contour
+    inline void line_to(const Vector2& point) noexcept {
+        points.push_back(point);
+        contours.back().end = points.size();
+    }
+
+    /// Closes the current contour
+    inline void close() noexcept {
+        contours.back().closed = true;
+    }
+
+    /// Returns the bounding box of every point
+    BoundingBox get_bbox() const noexcept;
+};
+
+/// Ratio of miter length to stroke width past which miter joins become bevels, as SVG's default
+static constexpr real_t MITER_LIMIT = 4;
+
+/**
+ * @brief Flattens SVG path data into polylines, transforming it and approximating curves and arcs with
+ * line segments no further than `tolerance` from the curve, in transformed units. Parsing stops at the
+ * first error, keeping what was parsed before it, as SVG renderers do.
+ */
+void flatten_path_data(std::string_view d, const Transform& transform, real_t tolerance, Polylines& out) noexcept;
+
+/**
+ * @brief Flattens a circle into a closed polyline starting at its rightmost point, as SVG strokes it
+ */
+void flatten_circle(const Vector2& center, real_t radius, const Transform& transform, real_t tolerance, Polylines& out) noexcept;
+
+/**
+ * @brief Flattens text into the outlines of its glyphs, from the glyph table
+ */
+void flatten_text(const DrawInstructionText& text, const Transform& transform, real_t tolerance, Polylines& out) noexcept;
+
+/**
+ * @brief Splits polylines into dashes of the given length with equal gaps, restarting the pattern for each contour
+ */
+void dash_polylines(const Polylines& in, real_t dash_length, Polylines& out) noexcept;
+
+/**
+ * @brief Converts polylines into closed polygons covering their stroke at the given width, with butt caps and
+ * miter joins. The polygons all wind the same way and overlap, so they should be filled with the nonzero rule.
+ */
+void stroke_polylines(const Polylines& in, real_t width, Polylines& out) noexcept;
+
+/**
+ * @brief Flattens draw commands into filled polygons in painting order.
+ *
+ * Fills and strokes are each handed to a callback as polygons to fill with the nonzero rule,
+ * along with their color. Text is drawn with the outlines of the glyph table. Scratch buffers are
+ * kept between calls.
+ */
+struct ShapeFlattener {
+    real_t tolerance = 0.1; /// Maximum distance from flattened segments to the true curve, in transformed units
+
+    /**
+     * @brief Flattens the commands, calling `paint(const Polylines& polygons, ColorType color_type, const Color& color, bool stroke)`
+     * for each fill and stroke. Stroke polygons are each convex.
+     */
+    template<typename Paint>
+    inline void flatten(const std::vector<DrawCommand>& commands, const Style& style, const Transform& transform, Paint&& paint) noexcept {
+        for (const auto& command : commands) {
+            flatten(command, style, transform, paint);
+        }
+    }
+
+    /// Flattens a single command; see the overload for a list of commands
+    template<typename Paint>
+    inline void flatten(const DrawCommand& command, const Style& style, const Transform& transform, Paint&& paint) noexcept {
+        switch (command.get_type()) {
+        case DrawCommand::Type::PATH: {
+            const auto& path = *command.get_instruction<DrawInstructionPath>();
+            outline.clear();
+            flatten_path_data(path.dynamic_path.empty() ? std::string_view{path.d} : std::string_view{path.dynamic_path},
+                              transform, tolerance, outline);
+            paint_outline(path, path.stroke_width, style, transform, paint);
+            break;
+        }
+        case DrawCommand::Type::CIRCLE: {
+            const auto& circle = *command.get_instruction<DrawInstructionCircle>();
+            outline.clear();
+            flatten_circle(circle.center, circle.radius, transform, tolerance, outline);
+            paint_outline(circle, circle.stroke_width, style, transform, paint);
+            break;
+        }
+        case DrawCommand::Type::TEXT: {
+            const auto& text = *command.get_instruction<DrawInstructionText>();
+            outline.clear();
+            flatten_text(text, transform, tolerance, outline);
+            paint_outline(text, text.stroke_width, style, transform, paint);
+            break;
+        }
+        case DrawCommand::Type::TRANSLATE: {
+            const auto& translate = *command.get_instruction<DrawInstructionTranslate>();
+            flatten(command.children, style, transform.after(Transform{1, translate.delta}), paint);
+            break;
+        }
+        case DrawCommand::Type::SCALE: {
+            const auto& scale = *command.get_instruction<DrawInstructionScale>();
+            flatten(command.children, style, transform.after(Transform{scale.scale, Vector2{0, 0}}), paint);
+            break;
+        }
+        case DrawCommand::Type::FULL_FRAME:
+            flatten(command.get_affiliation_variant(style.affiliation), style, transform, paint);
+            break;
+        default:
+            break;
+        }
+    }
+
+private:
+    Polylines outline; /// Flattened outline of the current command
+    Polylines dashes; /// Dashed outline of the current command
+    Polylines stroke; /// Stroke polygons of the current command
+
+    /// Paints the fill and stroke of the flattened outline
+    template<typename Instruction, typename Paint>
+    inline void paint_outline(const Instruction& instruction, real_t stroke_width, const Style& style,
+                              const Transform& transform, Paint& paint) noexcept {
+        if (outline.empty()) {
+            return;
+        }
+
+        Color fill_color = style.get_color(instruction.fill_color);
+        if (instruction.fill_color != ColorType::NONE && fill_color.r >= 0) {
+            paint(static_cast<const Polylines&>(outline), instruction.fill_color, static_cast<const Color&>(fill_color), false);
+        }
+
+        Color stroke_color = style.get_color(instruction.stroke_color);
+        if (instruction.stroke_color == ColorType::NONE || stroke_color.r < 0) {
+            return;
+        }
+
+        real_t width = (style.stroke_width_override >= 0 ? style.stroke_width_override : stroke_width) * transform.scale;
+        if (width <= 0) {
+            return;
+        }
+
+        const Polylines* centerline = &outline;
+        if (instruction.stroke_style == StrokeStyle::DASHED) {
+            dash_polylines(outline, DASH_LENGTH * transform.scale, dashes);
+            centerline = &dashes;
+        }
+
+        stroke_polylines(*centerline, width, stroke);
+        paint(static_cast<const Polylines&>(stroke), instruction.stroke_color, static_cast<const Color&>(stroke_color), true);
+    }
+};
+
+}
@@ -0,0 +1,113 @@
+#pragma once
+#include "DrawCommands.hpp"
+
+namespace milsymbol::_impl {
+
+/// Whether text is written to SVGs as paths built from the glyph table, rather than as text elements
+inline constexpr bool TEXT_AS_PATHS = true;
+
+/// Font units per em in the glyph table; a glyph drawn at font size S is scaled by S / GLYPH_UNITS_PER_EM
+inline constexpr real_t GLYPH_UNITS_PER_EM = 2048;
+
+/// Outlines and advances of every glyph text can use, from SimplySans-Bold.ttf, sorted by code point
+inline constexpr Glyph GLYPHS[] = {
+	{0x0020, 500, ""},
+	{0x0021, 692, "M346,20Q270,20 218,-34Q166,-88 166,-162Q166,-238 218,-291Q271,-345 346,-345Q421,-345 473.5,-291.5Q526,-238 526,-163Q526,-88 473,-34Q420,20 346,20M256,-1510L436,-1510Q515,-1510 515,-1431L477,-479Q474,-400 396,-400L296,-400Q218,-400 215,-479L177,-1431Q177,-1510 256,-1510"},
+	{0x0022, 736, "M237,-1570Q260,-1570 269,-1540L363,-1240Q366,-1230 366,-1224Q366,-1201 337,-1190L240,-1154Q229,-1150 222,-1150Q199,-1150 186,-1178L56,-1459Q50,-1472 50,-1483Q50,-1506 79,-1516L219,-1566Q230,-1570 237,-1570M557,-1570Q580,-1570 589,-1540L683,-1240Q686,-1230 686,-1224Q686,-1201 657,-1190L560,-1154Q549,-1150 542,-1150Q519,-1150 506,-1178L376,-1459Q370,-1472 370,-1483Q370,-1506 399,-1516L539,-1566Q550,-1570 557,-1570"},
+	{0x0023, 1254, "M407,-1290L507,-1290Q551,-1290 551,-1246L551,-1019L703,-1019L703,-1246Q703,-1290 747,-1290L847,-1290Q893,-1290 893,-1246L893,-1019L1119,-1019Q1164,-1019 1164,-974L1164,-874Q1164,-829 1119,-829L893,-829L893,-678L1119,-678Q1164,-678 1164,-633L1164,-533Q1164,-488 1119,-488L893,-488L893,-262Q893,-216 847,-216L747,-216Q703,-216 703,-262L703,-488L551,-488L551,-262Q551,-216 507,-216L405,-216Q361,-216 361,-262L361,-488L135,-488Q90,-488 90,-533L90,-634Q90,-678 135,-678L361,-678L361,-829L135,-829Q90,-829 90,-874L90,-975Q90,-1019 135,-1019L361,-1019L361,-1246Q361,-1290 407,-1290M551,-678L703,-678L703,-829L551,-829"},
+	{0x0024, 1251, "M702,-300Q746,-316 780,-344Q846,-399 846,-482Q846,-590 716,-644L702,-650M702,-1527Q896,-1508 1012,-1371Q1033,-1346 1033,-1319Q1033,-1287 997,-1260L872,-1166Q845,-1146 819,-1146Q783,-1146 762,-1181Q738,-1220 702,-1238L702,-995L874,-924Q1171,-802 1171,-498Q1171,-311 1032,-158Q907,-21 702,11L702,145Q702,180 667,180L607,180Q572,180 572,145L572,20Q278,20 91,-203Q70,-228 70,-255Q70,-287 106,-314L231,-408Q258,-428 284,-428Q320,-428 341,-393Q409,-282 572,-280L572,-704L484,-740Q190,-862 190,-1124Q190,-1324 351,-1447Q439,-1514 572,-1527L572,-1655Q572,-1690 607,-1690L667,-1690Q702,-1690 702,-1655M572,-1242Q551,-1234 536,-1220Q509,-1194 509,-1158Q509,-1105 572,-1059"},
+	{0x0025, 1786, "M1236.5,-232.5Q1276,-185 1336,-185Q1396,-185 1437,-232.5Q1478,-280 1478,-350.5Q1478,-421 1437,-468.5Q1396,-516 1336,-516Q1276,-516 1236.5,-468.5Q1197,-421 1197,-350.5Q1197,-280 1236.5,-232.5M1337,20Q1182,20 1077,-89Q969,-199 969,-352Q969,-506 1077,-613Q1185,-722 1337,-722Q1492,-722 1598,-613Q1706,-502 1706,-350Q1706,-196 1598,-89Q1489,20 1337,20M549.5,-1277.5Q510,-1325 450,-1325Q390,-1325 349,-1277.5Q308,-1230 308,-1159.5Q308,-1089 349,-1041.5Q390,-994 450,-994Q510,-994 549.5,-1041.5Q589,-1089 589,-1159.5Q589,-1230 549.5,-1277.5M449,-1530Q604,-1530 709,-1421Q817,-1311 817,-1158Q817,-1004 709,-897Q601,-788 449,-788Q294,-788 188,-897Q80,-1008 80,-1160Q80,-1314 188,-1421Q297,-1530 449,-1530M1250,-1550Q1269,-1550 1292,-1537L1390,-1481Q1429,-1459 1429,-1423Q1429,-1401 1417,-1381L593,0Q569,40 538,40Q516,40 493,27L395,-29Q356,-51 356,-87Q356,-107 369,-129L1193,-1510Q1217,-1550 1250,-1550"},
+	{0x0026, 1652, "M1551,0L1332,0Q1254,0 1204,-56L1134,-134Q934,20 656,20Q424,20 258,-119Q90,-261 90,-473Q90,-706 259,-830Q274,-841 289,-851Q181,-955 181,-1109Q181,-1289 320,-1410Q458,-1530 653,-1530Q853,-1530 989,-1407Q1053,-1349 1088,-1281Q1099,-1260 1099,-1242Q1099,-1200 1048,-1176L917,-1116Q894,-1105 871,-1105Q832,-1105 812,-1155Q800,-1185 774,-1208Q724,-1251 654,-1251Q582,-1251 535,-1208Q487,-1165 487,-1102Q487,-1036 537,-997Q591,-955 662,-955L754,-955Q820,-955 856,-915L1139,-600Q1200,-703 1200,-838Q1200,-917 1280,-917L1438,-917Q1518,-917 1518,-838Q1518,-587 1353,-361L1589,-97Q1609,-75 1609,-46Q1609,0 1551,0M936,-355L626,-701Q542,-693 482,-641Q412,-579 412,-488Q412,-396 481,-334Q550,-273 653,-273Q825,-273 936,-355"},
+	{0x0027, 416, "M237,-1570Q260,-1570 269,-1540L363,-1240Q366,-1230 366,-1224Q366,-1201 337,-1190L240,-1154Q229,-1150 222,-1150Q199,-1150 186,-1178L56,-1459Q50,-1472 50,-1483Q50,-1506 79,-1516L219,-1566Q230,-1570 237,-1570"},
+	{0x0028, 749, "M535,250Q467,250 427,186Q140,-273 140,-755Q140,-1237 427,-1696Q467,-1760 535,-1760L674,-1760Q729,-1760 729,-1716Q729,-1698 719,-1681Q440,-1207 440,-755Q440,-303 719,171Q729,188 729,206Q729,250 674,250"},
+	{0x0029, 749, "M214,250Q214,250 75,250Q20,250 20,206Q20,188 30,171Q309,-303 309,-755Q309,-1207 30,-1681Q20,-1698 20,-1716Q20,-1760 75,-1760L214,-1760Q282,-1760 322,-1696Q609,-1237 609,-755Q609,-273 322,186Q282,250 214,250"},
+	{0x002A, 862, "M380,-1510L480,-1510Q526,-1510 526,-1466L526,-1273L693,-1370Q707,-1378 719,-1378Q739,-1378 753,-1353L803,-1267Q812,-1252 812,-1239Q812,-1218 788,-1205L621,-1108L786,-1013Q812,-998 812,-977Q812,-965 803,-950L753,-864Q739,-840 719,-840Q707,-840 691,-848L526,-944L526,-753Q526,-707 480,-707L380,-707Q336,-707 336,-753L336,-944L171,-848Q156,-840 144,-840Q123,-840 108,-865L58,-952Q50,-966 50,-977Q50,-998 76,-1013L241,-1108L74,-1205Q50,-1219 50,-1239Q50,-1251 58,-1265L108,-1352Q122,-1377 144,-1377Q156,-1377 169,-1370L336,-1273L336,-1466Q336,-1510 380,-1510"},
+	{0x002B, 1133, "M506,-1232L626,-1232Q692,-1232 692,-1166L692,-880L978,-880Q1043,-880 1043,-815L1043,-695Q1043,-630 978,-630L692,-630L692,-344Q692,-278 626,-278L506,-278Q442,-278 442,-344L442,-630L155,-630Q90,-630 90,-695L90,-815Q90,-880 155,-880L442,-880L442,-1166Q442,-1232 506,-1232"},
+	{0x002C, 415, "M263,-297Q365,-203 365,-32Q365,157 213,296Q190,317 167,317Q149,317 129,302L72,259Q52,244 52,226Q52,210 67,195Q130,132 130,12Q130,-94 75,-149Q50,-174 50,-195Q50,-221 83,-244L175,-307Q194,-320 216,-320Q238,-320 263,-297"},
+	{0x002D, 1133, "M155,-880L978,-880Q1043,-880 1043,-815L1043,-695Q1043,-630 978,-630L155,-630Q90,-630 90,-695L90,-815Q90,-880 155,-880"},
+	{0x002E, 460, "M230,20Q154,20 102,-34Q50,-88 50,-162Q50,-238 102,-291Q155,-345 230,-345Q305,-345 357.5,-291.5Q410,-238 410,-163Q410,-88 357,-34Q304,20 230,20"},
+	{0x002F, 1194, "M1005,-1662Q1024,-1662 1047,-1649L1145,-1593Q1184,-1571 1184,-1535Q1184,-1514 1172,-1493L247,110Q224,150 192,150Q170,150 147,137L49,81Q10,59 10,23Q10,4 23,-19L948,-1622Q971,-1662 1005,-1662"},
+	{0x0030, 1574, "M788,-280Q961,-280 1063,-404Q1175,-540 1175,-755Q1175,-976 1063,-1106Q957,-1230 786,-1230Q613,-1230 511,-1106Q399,-970 399,-755Q399,-535 511,-404Q617,-280 788,-280M261,-211Q70,-435 70,-755Q70,-1077 261,-1299Q460,-1530 787,-1530Q1116,-1530 1313,-1299Q1504,-1075 1504,-755Q1504,-435 1313,-211Q1115,20 787,20Q459,20 261,-211"},
+	{0x0031, 760, "M490,0L330,0Q250,0 250,-79L250,-1210L100,-1210Q20,-1210 20,-1289L20,-1431Q20,-1510 100,-1510L490,-1510Q570,-1510 570,-1431L570,-79Q570,0 490,0"},
+	{0x0032, 1193, "M1043,0L130,0Q50,0 50,-79L50,-204Q50,-245 84,-273L608,-699Q794,-850 794,-1018Q794,-1108 743,-1160Q675,-1230 555,-1230Q453,-1230 379,-1175Q350,-1153 333,-1126Q305,-1081 274,-1081Q250,-1081 228,-1092L88,-1163Q40,-1187 40,-1224Q40,-1243 55,-1269Q84,-1319 153,-1382Q314,-1530 555,-1530Q813,-1530 969,-1377Q1119,-1230 1119,-1015Q1119,-714 825,-498L556,-300L1043,-300Q1123,-300 1123,-221L1123,-79Q1123,0 1043,0"},
+	{0x0033, 1159, "M535,20Q294,20 133,-128Q64,-191 35,-241Q20,-267 20,-286Q20,-323 68,-347L208,-418Q230,-429 254,-429Q285,-429 313,-384Q330,-357 359,-335Q433,-280 535,-280Q650,-280 723,-350Q779,-403 779,-492Q779,-582 725,-633Q657,-697 535,-697L293,-697Q238,-697 238,-741Q238,-763 253,-783L573,-1210L199,-1210Q119,-1210 119,-1289L119,-1431Q119,-1510 199,-1510L877,-1510Q957,-1510 957,-1431L957,-1289Q957,-1255 934,-1225L737,-970Q851,-935 938,-858Q1099,-716 1099,-495Q1099,-280 949,-133Q793,20 535,20"},
+	{0x0034, 1188, "M808,0Q728,0 728,-79L728,-255L100,-255Q20,-255 20,-334L20,-449Q20,-486 36,-523L430,-1446Q457,-1510 539,-1510L717,-1510Q771,-1510 771,-1466Q771,-1455 761,-1431L389,-555L728,-555L728,-1021Q728,-1100 808,-1100L968,-1100Q1048,-1100 1048,-1021L1048,-79Q1048,0 968,0"},
+	{0x0035, 1199, "M575,20Q334,20 173,-128Q104,-191 75,-241Q60,-267 60,-286Q60,-323 108,-347L248,-418Q270,-429 294,-429Q325,-429 353,-384Q370,-357 399,-335Q473,-280 575,-280Q690,-280 763,-350Q819,-403 819,-492Q819,-582 765,-633Q697,-697 575,-697L263,-697Q183,-697 183,-776L183,-1431Q183,-1510 263,-1510L931,-1510Q1011,-1510 1011,-1431L1011,-1289Q1011,-1210 931,-1210L500,-1210L500,-998L575,-998Q821,-998 978,-858Q1139,-714 1139,-495Q1139,-280 989,-133Q833,20 575,20"},
+	{0x0036, 1271, "M635,20Q402,20 237,-127Q70,-276 70,-495Q70,-675 181,-859L536,-1446Q575,-1510 644,-1510L843,-1510Q898,-1510 898,-1466Q898,-1446 888,-1431L611,-1014Q653,-1026 694,-1026Q895,-1026 1045,-880Q1201,-728 1201,-505Q1201,-278 1035,-129Q869,20 635,20M808,-344Q879,-406 879,-504Q879,-603 807,-665Q734,-729 635,-729Q536,-729 463,-666Q393,-604 393,-504Q393,-406 464,-343Q535,-280 634.5,-280Q734,-280 808,-344"},
+	{0x0037, 1029, "M381,0L203,0Q149,0 149,-44Q149,-55 159,-79L640,-1210L100,-1210Q20,-1210 20,-1289L20,-1431Q20,-1510 100,-1510L929,-1510Q1009,-1510 1009,-1431L1009,-1316Q1009,-1279 993,-1242L490,-64Q463,0 381,0"},
+	{0x0038, 1210, "M604,-1264Q525,-1264 473,-1220Q420,-1175 420,-1110Q420,-1043 473,-1000Q527,-957 604,-957Q683,-957 735,-999Q789,-1045 789,-1111Q789,-1178 736,-1220Q682,-1264 604,-1264M432,-627Q362,-568 362,-480Q362,-391 432,-332Q504,-273 606,-273Q712,-273 778,-331Q848,-391 848,-480Q848,-572 778,-628Q707,-686 605.5,-686Q504,-686 432,-627M605,20Q371,20 207,-120Q40,-262 40,-474Q40,-706 209,-833Q224,-844 239,-853Q131,-957 131,-1111Q131,-1289 270,-1410Q409,-1530 603,-1530Q800,-1530 939,-1411Q1079,-1290 1079,-1111Q1079,-961 971,-855Q988,-843 1003,-831Q1170,-694 1170,-478Q1170,-262 1004,-120Q838,20 605,20"},
+	{0x0039, 1271, "M627,0L428,0Q373,0 373,-44Q373,-64 383,-79L663,-496Q622,-484 577,-484Q376,-484 226,-630Q70,-782 70,-1005Q70,-1232 236,-1381Q402,-1530 636,-1530Q869,-1530 1034,-1383Q1201,-1234 1201,-1015Q1201,-835 1090,-651L735,-64Q696,0 627,0M463,-1166Q392,-1104 392,-1006Q392,-907 464,-845Q537,-781 636,-781Q735,-781 808,-844Q878,-906 878,-1006Q878,-1104 807,-1167Q736,-1230 636.5,-1230Q537,-1230 463,-1166"},
+	{0x003A, 460, "M230,-573Q154,-573 102,-627Q50,-681 50,-755Q50,-831 102,-884Q155,-938 230,-938Q305,-938 357.5,-884.5Q410,-831 410,-756Q410,-681 357,-627Q304,-573 230,-573M230,20Q154,20 102,-34Q50,-88 50,-162Q50,-238 102,-291Q155,-345 230,-345Q305,-345 357.5,-291.5Q410,-238 410,-163Q410,-88 357,-34Q304,20 230,20"},
+	{0x003B, 487, "M335,-297Q437,-203 437,-32Q437,157 285,296Q262,317 239,317Q221,317 201,302L144,259Q124,244 124,226Q124,210 139,195Q202,132 202,12Q202,-94 147,-149Q122,-174 122,-195Q122,-221 155,-244L247,-307Q266,-320 288,-320Q310,-320 335,-297M250,-573Q174,-573 122,-627Q70,-681 70,-755Q70,-831 122,-884Q175,-938 250,-938Q325,-938 377.5,-884.5Q430,-831 430,-756Q430,-681 377,-627Q324,-573 250,-573"},
+	{0x003C, 1150, "M90,-810Q90,-853 140,-880L869,-1277Q886,-1286 898,-1286Q922,-1286 937,-1259L998,-1152Q1008,-1134 1008,-1122Q1008,-1099 980,-1084L372,-764L982,-440Q1010,-425 1010,-402Q1010,-390 1000,-372L937,-260Q922,-233 898,-233Q886,-233 869,-242L140,-639Q90,-666 90,-709"},
+	{0x003D, 1133, "M155,-1080L978,-1080Q1043,-1080 1043,-1015L1043,-895Q1043,-830 978,-830L155,-830Q90,-830 90,-895L90,-1015Q90,-1080 155,-1080M155,-680L978,-680Q1043,-680 1043,-615L1043,-495Q1043,-430 978,-430L155,-430Q90,-430 90,-495L90,-615Q90,-680 155,-680"},
+	{0x003E, 1150, "M1060,-810Q1060,-810 1060,-709Q1060,-666 1010,-639L281,-242Q264,-233 252,-233Q228,-233 213,-260L152,-367Q142,-385 142,-397Q142,-420 170,-435Q170,-435 778,-755L168,-1079Q140,-1094 140,-1117Q140,-1129 150,-1147L213,-1259Q228,-1286 252,-1286Q264,-1286 281,-1277L1010,-880Q1060,-853 1060,-810"},
+	{0x003F, 1200, "M525,20Q449,20 397,-34Q345,-88 345,-162Q345,-238 397,-291Q450,-345 525,-345Q600,-345 652.5,-291.5Q705,-238 705,-163Q705,-88 652,-34Q599,20 525,20M555,-1530Q812,-1530 969,-1366Q1110,-1219 1110,-1034Q1110,-765 833,-609Q691,-529 691,-479Q691,-400 611,-400L451,-400Q371,-400 371,-479Q371,-663 556,-766Q789,-896 789,-1036Q789,-1110 742,-1159Q675,-1230 554,-1230Q436,-1230 356,-1150Q327,-1121 299,-1121Q273,-1121 246,-1141L126,-1231Q90,-1258 90,-1290Q90,-1317 111,-1342Q269,-1530 555,-1530"},
+	{0x0040, 1539, "M1319,0L1179,0Q1102,0 1102,-51Q1042,0 921,0Q745,0 643,-99Q549,-192 549,-323Q549,-463 666,-560Q782,-655 1001,-693L1094,-709Q1083,-752 1051,-780Q1004,-820 932,-820L807,-820Q625,-820 518,-682Q392,-520 392,-315Q392,-77 518,52Q594,130 725,130Q805,130 805,209L805,331Q805,410 725,410Q429,410 281,230Q90,-2 90,-315Q90,-628 281,-860Q480,-1100 807,-1100L932,-1100Q1137,-1100 1267,-990Q1399,-878 1399,-696L1399,-79Q1399,0 1319,0M1099,-487L1025,-475Q933,-460 884,-426Q842,-397 842,-346Q842,-305 868,-276Q903,-237 987,-237Q1046,-237 1099,-261"},
+	{0x0041, 1474, "M241,0L67,0Q10,0 10,-51Q10,-65 14,-77L484,-1445Q506,-1510 574,-1510L900,-1510Q968,-1510 990,-1445L1460,-77Q1464,-65 1464,-52Q1464,0 1407,0L1223,0Q1155,0 1133,-64L978,-515L486,-515L331,-64Q309,0 241,0M589,-815L875,-815L732,-1271"},
+	{0x0042, 1300, "M460,-957L675,-957Q734,-957 775,-987Q830,-1029 830,-1093Q830,-1161 775,-1200Q732,-1230 675,-1230L460,-1230M460,-300L665,-300Q793,-300 860,-363Q910,-411 910,-488Q910,-564 859,-614Q795,-676 665,-676L460,-676M220,0Q140,0 140,-79L140,-1431Q140,-1510 220,-1510L665,-1510Q852,-1510 983,-1413Q1139,-1298 1139,-1112Q1139,-967 1030,-858Q1050,-845 1066,-831Q1230,-688 1230,-484Q1230,-278 1084,-143Q929,0 665,0"},
+	{0x0043, 1426, "M291,-211Q100,-435 100,-755Q100,-1077 291,-1299Q490,-1530 817,-1530Q1146,-1530 1343,-1299Q1366,-1272 1366,-1247Q1366,-1215 1331,-1187L1210,-1089Q1182,-1066 1157,-1066Q1125,-1066 1098,-1100Q995,-1230 816,-1230Q643,-1230 541,-1106Q429,-970 429,-755Q429,-535 541,-404Q647,-280 818,-280Q995,-280 1098,-410Q1125,-444 1157,-444Q1182,-444 1210,-421L1331,-323Q1366,-295 1366,-263Q1366,-238 1343,-211Q1145,20 817,20Q489,20 291,-211"},
+	{0x0044, 1474, "M220,0Q140,0 140,-79L140,-1431Q140,-1510 220,-1510L687,-1510Q1017,-1510 1213,-1280Q1404,-1057 1404,-755Q1404,-452 1213,-230Q1015,0 687,0M460,-300L687,-300Q861,-300 963,-423Q1075,-558 1075,-755Q1075,-953 963,-1087Q860,-1210 687,-1210L460,-1210"},
+	{0x0045, 1158, "M1008,0L220,0Q140,0 140,-79L140,-1431Q140,-1510 220,-1510L978,-1510Q1058,-1510 1058,-1431L1058,-1289Q1058,-1210 978,-1210L460,-1210L460,-905L812,-905Q892,-905 892,-826L892,-684Q892,-605 812,-605L460,-605L460,-300L1008,-300Q1088,-300 1088,-221L1088,-79Q1088,0 1008,0"},
+	{0x0046, 1078, "M380,0L220,0Q140,0 140,-79L140,-1431Q140,-1510 220,-1510L978,-1510Q1058,-1510 1058,-1431L1058,-1289Q1058,-1210 978,-1210L460,-1210L460,-905L812,-905Q892,-905 892,-826L892,-684Q892,-605 812,-605L460,-605L460,-79Q460,0 380,0"},
+	{0x0047, 1524, "M261,-211Q70,-435 70,-755Q70,-1077 261,-1299Q460,-1530 787,-1530Q1116,-1530 1313,-1299Q1336,-1272 1336,-1247Q1336,-1215 1301,-1187L1180,-1089Q1152,-1066 1127,-1066Q1095,-1066 1068,-1100Q965,-1230 786,-1230Q613,-1230 511,-1106Q399,-970 399,-755Q399,-535 511,-404Q617,-280 791,-280Q964,-280 1064,-400L1064,-604L853,-605Q773,-605 773,-684L773,-826Q773,-905 853,-905L1304,-905Q1384,-905 1384,-826L1384,-313Q1346,-250 1313,-211Q1115,20 787,20Q459,20 261,-211"},
+	{0x0048, 1450, "M220,0Q140,0 140,-79L140,-1431Q140,-1510 220,-1510L380,-1510Q460,-1510 460,-1431L460,-905L990,-905L990,-1431Q990,-1510 1070,-1510L1230,-1510Q1310,-1510 1310,-1431L1310,-79Q1310,0 1230,0L1070,0Q990,0 990,-79L990,-605L460,-605L460,-79Q460,0 380,0"},
+	{0x0049, 600, "M220,0Q140,0 140,-79L140,-1431Q140,-1510 220,-1510L380,-1510Q460,-1510 460,-1431L460,-79Q460,0 380,0"},
+	{0x004A, 1165, "M39,-120Q10,-146 10,-177Q10,-203 39,-232L149,-343Q177,-371 207,-371Q236,-371 261,-343Q318,-280 430.5,-280Q543,-280 622,-346Q705,-415 705,-561L705,-1210L203,-1210Q123,-1210 123,-1289L123,-1431Q123,-1510 203,-1510L945,-1510Q1025,-1510 1025,-1431L1025,-544Q1025,-290 841,-120Q688,20 440,20Q192,20 39,-120"},
+	{0x004B, 1315, "M380,0L220,0Q140,0 140,-79L140,-1431Q140,-1510 220,-1510L380,-1510Q460,-1510 460,-1431L460,-868L915,-1446Q965,-1510 1030,-1510L1207,-1510Q1258,-1510 1258,-1468Q1258,-1448 1240,-1425L814,-885L1282,-79Q1295,-57 1295,-42Q1295,0 1237,0L1040,0Q969,0 932,-64L608,-623L460,-435L460,-79Q460,0 380,0"},
+	{0x004C, 1108, "M1008,0Q1008,0 200,0Q140,0 140,-79L140,-1431Q140,-1510 200,-1510L380,-1510Q460,-1510 460,-1431L460,-300L1008,-300Q1088,-300 1088,-221L1088,-79Q1088,0 1008,0"},
+	{0x004D, 1942, "M318,0Q318,0 178,0Q100,0 100,-74Q100,-76 100,-79L190,-1431Q195,-1510 272,-1510L598,-1510Q670,-1510 686,-1446L971,-281L1256,-1446Q1272,-1510 1344,-1510L1670,-1510Q1747,-1510 1752,-1431Q1752,-1431 1842,-79Q1842,-76 1842,-74Q1842,0 1764,0L1614,0Q1537,0 1532,-79L1466,-1138L1194,-64Q1178,0 1107,0L825,0Q753,0 737,-64L467,-1138L400,-79Q395,0 318,0"},
+	{0x004E, 1530, "M370,0Q370,0 220,0Q140,0 140,-79L140,-1431Q140,-1510 220,-1510L552,-1510Q619,-1510 644,-1445L1080,-318L1080,-1431Q1080,-1510 1160,-1510L1310,-1510Q1390,-1510 1390,-1431L1390,-79Q1390,0 1310,0L969,0Q902,0 877,-65L450,-1168L450,-79Q450,0 370,0"},
+	{0x004F, 1574, "M788,-280Q961,-280 1063,-404Q1175,-540 1175,-755Q1175,-976 1063,-1106Q957,-1230 786,-1230Q613,-1230 511,-1106Q399,-970 399,-755Q399,-535 511,-404Q617,-280 788,-280M261,-211Q70,-435 70,-755Q70,-1077 261,-1299Q460,-1530 787,-1530Q1116,-1530 1313,-1299Q1504,-1075 1504,-755Q1504,-435 1313,-211Q1115,20 787,20Q459,20 261,-211"},
+	{0x0050, 1238, "M380,0L220,0Q140,0 140,-79L140,-1431Q140,-1510 220,-1510L623,-1510Q872,-1510 1029,-1351Q1168,-1210 1168,-998Q1168,-785 1029,-644Q872,-485 623,-485L460,-485L460,-79Q460,0 380,0M460,-1210L460,-786L623,-786Q727,-786 781,-844Q838,-905 838,-999Q838,-1094 781,-1152Q724,-1210 623,-1210"},
+	{0x0051, 1574, "M787,20Q459,20 261,-211Q70,-435 70,-755Q70,-1077 261,-1299Q460,-1530 787,-1530Q1116,-1530 1313,-1299Q1504,-1075 1504,-755Q1504,-435 1313,-211Q1259,-147 1194,-101L1294,71Q1304,88 1304,107Q1304,150 1249,150L1073,150Q1002,150 965,86L921,10Q857,20 787,20M1036,-375Q1050,-389 1063,-404Q1175,-540 1175,-755Q1175,-976 1063,-1106Q957,-1230 786,-1230Q613,-1230 511,-1106Q399,-970 399,-755Q399,-535 511,-404Q605,-294 751,-282L620,-509Q610,-526 610,-544Q610,-588 665,-588L841,-588Q912,-588 932,-554"},
+	{0x0052, 1305, "M380,0L220,0Q140,0 140,-79L140,-1431Q140,-1510 220,-1510L623,-1510Q872,-1510 1029,-1351Q1168,-1210 1168,-998Q1168,-783 1029,-644Q1005,-620 980,-600L1282,-79Q1295,-57 1295,-42Q1295,0 1237,0L1040,0Q969,0 932,-64L687,-488Q656,-485 623,-485L460,-485L460,-79Q460,0 380,0M460,-1210L460,-786L623,-786Q727,-786 781,-844Q838,-905 838,-999Q838,-1094 781,-1152Q724,-1210 623,-1210"},
+	{0x0053, 1251, "M570,20Q287,20 91,-203Q70,-228 70,-255Q70,-287 106,-314L231,-408Q258,-428 284,-428Q320,-428 341,-393Q410,-280 577,-280Q704,-280 780,-344Q846,-399 846,-482Q846,-590 716,-644L484,-740Q190,-862 190,-1124Q190,-1324 351,-1447Q460,-1530 636,-1530Q877,-1530 1012,-1371Q1033,-1346 1033,-1319Q1033,-1287 997,-1260L872,-1166Q845,-1146 819,-1146Q783,-1146 762,-1181Q719,-1252 635,-1252Q569,-1252 536,-1220Q509,-1194 509,-1158Q509,-1074 663,-1011L874,-924Q1171,-802 1171,-498Q1171,-311 1032,-158Q869,20 570,20"},
+	{0x0054, 1226, "M533,0Q453,0 453,-79L453,-1210L100,-1210Q20,-1210 20,-1289L20,-1431Q20,-1510 100,-1510L1126,-1510Q1206,-1510 1206,-1431L1206,-1289Q1206,-1210 1126,-1210L773,-1210L773,-79Q773,0 693,0"},
+	{0x0055, 1450, "M324,-120Q140,-290 140,-544L140,-1431Q140,-1510 220,-1510L380,-1510Q460,-1510 460,-1431L460,-561Q460,-417 543,-346Q622,-280 725,-280Q828,-280 907,-346Q990,-415 990,-561L990,-1431Q990,-1510 1070,-1510L1230,-1510Q1310,-1510 1310,-1431L1310,-544Q1310,-290 1126,-120Q973,20 725,20Q477,20 324,-120"},
+	{0x0056, 1474, "M900,0Q900,0 574,0Q506,0 484,-65L14,-1433Q10,-1445 10,-1458Q10,-1510 67,-1510L251,-1510Q319,-1510 341,-1446Q341,-1446 742,-279L1143,-1446Q1165,-1510 1233,-1510L1407,-1510Q1464,-1510 1464,-1459Q1464,-1445 1460,-1433L990,-65Q968,0 900,0"},
+	{0x0057, 1965, "M688,0L388,0Q318,0 302,-79L21,-1431Q20,-1436 20,-1442Q20,-1510 94,-1510L244,-1510Q315,-1510 330,-1431L543,-338L766,-1431Q782,-1510 852,-1510L1122,-1510Q1192,-1510 1208,-1431L1431,-340L1650,-1461Q1660,-1510 1730,-1510L1870,-1510Q1945,-1510 1945,-1442Q1945,-1436 1944,-1431L1662,-79Q1646,0 1576,0L1276,0Q1205,0 1190,-79L982,-1146L774,-79Q759,0 688,0"},
+	{0x0058, 1216, "M248,0L74,0Q20,0 20,-44Q20,-63 30,-79L437,-751L30,-1431Q20,-1448 20,-1466Q20,-1510 74,-1510L258,-1510Q329,-1510 367,-1446L612,-1038L859,-1446Q898,-1510 968,-1510L1142,-1510Q1196,-1510 1196,-1466Q1196,-1447 1186,-1431L779,-759L1186,-79Q1196,-62 1196,-44Q1196,0 1142,0L958,0Q887,0 849,-64L604,-472L357,-64Q318,0 248,0"},
+	{0x0059, 1260, "M550,0Q470,0 470,-79L470,-656L20,-1431Q10,-1448 10,-1466Q10,-1510 65,-1510L241,-1510Q312,-1510 349,-1446L635,-953L920,-1446Q957,-1510 1028,-1510L1195,-1510Q1250,-1510 1250,-1466Q1250,-1448 1240,-1431L790,-656L790,-79Q790,0 710,0"},
+	{0x005A, 1250, "M1100,0L150,0Q70,0 70,-79L70,-221Q70,-253 88,-278L765,-1210L190,-1210Q110,-1210 110,-1289L110,-1431Q110,-1510 190,-1510L1100,-1510Q1180,-1510 1180,-1431L1180,-1289Q1180,-1257 1157,-1225L485,-300L1100,-300Q1180,-300 1180,-221L1180,-79Q1180,0 1100,0"},
+	{0x005B, 805, "M270,-1710Q270,-1710 720,-1710Q785,-1710 785,-1645L785,-1515Q785,-1450 720,-1450L500,-1450L500,-55L720,-55Q785,-55 785,10L785,140Q785,205 720,205L270,205Q200,205 200,135L200,-1640Q200,-1710 270,-1710"},
+	{0x005C, 1194, "M189,-1662Q223,-1662 246,-1622L1171,-19Q1184,4 1184,23Q1184,59 1145,81L1047,137Q1024,150 1002,150Q970,150 947,110L22,-1493Q10,-1514 10,-1535Q10,-1571 49,-1593L147,-1649Q170,-1662 189,-1662"},
+	{0x005D, 805, "M535,-1710Q605,-1710 605,-1640L605,135Q605,205 535,205L85,205Q20,205 20,140L20,10Q20,-55 85,-55L305,-55L305,-1450L85,-1450Q20,-1450 20,-1515L20,-1645Q20,-1710 85,-1710"},
+	{0x005E, 995, "M437,-1530Q437,-1530 558,-1530Q598,-1530 623,-1499L936,-1108Q945,-1097 945,-1079Q945,-1055 918,-1040L797,-972Q785,-965 771,-965Q750,-965 729,-990Q729,-990 498,-1268L267,-990Q246,-965 225,-965Q212,-965 199,-972L77,-1040Q50,-1055 50,-1079Q50,-1097 59,-1108L372,-1499Q397,-1530 437,-1530"},
+	{0x005F, 1233, "M160,87L1073,87Q1143,87 1143,157Q1143,157 1143,250Q1143,320 1073,320L160,320Q90,320 90,250L90,157Q90,87 160,87"},
+	{0x0060, 465, "M204,-1570Q226,-1570 243,-1544L405,-1289Q415,-1273 415,-1256Q415,-1234 387,-1213L335,-1174Q316,-1160 296,-1160Q272,-1160 255,-1181L64,-1411Q50,-1428 50,-1448Q50,-1472 79,-1493L167,-1557Q185,-1570 204,-1570"},
+	{0x0061, 1100, "M880,0L740,0Q663,0 663,-51Q558,20 438,20Q262,20 154,-76Q50,-170 50,-299Q50,-463 167,-559Q286,-657 454,-685L652,-718Q640,-754 612,-780Q570,-820 493,-820L338,-820Q258,-820 258,-899L258,-1021Q258,-1100 338,-1100L493,-1100Q698,-1100 828,-990Q960,-879 960,-696L960,-79Q960,0 880,0M660,-288L660,-496L482,-461Q418,-448 378,-416Q343,-390 343,-348Q343,-303 371,-271Q409,-227 501.5,-227Q594,-227 660,-288"},
+	{0x0062, 1216, "M220,0Q140,0 140,-79L140,-1431Q140,-1510 220,-1510L360,-1510Q440,-1510 440,-1431L440,-1051Q543,-1120 662,-1120Q834,-1120 959,-1009Q1146,-843 1146,-550Q1146,-257 959,-91Q834,20 662,20Q535,20 437,-51Q437,0 360,0M440,-787L440,-314Q502,-260 593.5,-260Q685,-260 755,-326Q833,-400 833,-550Q833,-704 752,-779Q686,-840 594,-840Q502,-840 440,-787"},
+	{0x0063, 1090, "M623,20Q387,20 241,-123Q70,-292 70,-550Q70,-815 241,-976Q394,-1120 623,-1120Q841,-1120 1005,-976Q1030,-954 1030,-925Q1030,-892 999,-864L896,-771Q868,-745 845,-745Q811,-745 784,-776Q729,-840 629,-840Q528,-840 464,-779Q383,-702 383,-550Q383,-398 461,-326Q532,-260 629,-260Q728,-260 784,-324Q811,-355 845,-355Q868,-355 896,-329L999,-236Q1030,-208 1030,-175Q1030,-146 1005,-124Q850,20 623,20"},
+	{0x0064, 1216, "M996,0Q996,0 856,0Q779,0 779,-51Q681,20 554,20Q382,20 257,-91Q70,-257 70,-550Q70,-843 257,-1009Q382,-1120 554,-1120Q673,-1120 776,-1051L776,-1431Q776,-1510 856,-1510L996,-1510Q1076,-1510 1076,-1431L1076,-79Q1076,0 996,0M776,-787Q714,-840 622,-840Q530,-840 464,-779Q383,-704 383,-550Q383,-400 461,-326Q531,-260 622.5,-260Q714,-260 776,-314"},
+	{0x0065, 1178, "M623,20Q385,20 241,-123Q70,-293 70,-550Q70,-816 241,-976Q396,-1120 623,-1120Q872,-1120 1006,-960Q1128,-814 1128,-628Q1128,-567 1062,-547L423,-355Q438,-330 461,-309Q518,-260 629,-260Q728,-260 784,-324Q811,-355 845,-355Q868,-355 896,-329L999,-236Q1030,-208 1030,-175Q1030,-146 1005,-124Q850,20 623,20M374,-572L816,-705Q803,-764 766,-799Q710,-850 622,-850Q519,-850 461,-794Q374,-711 374,-572"},
+	{0x0066, 850, "M360,0Q360,0 220,0Q140,0 140,-79L140,-1076Q140,-1278 271,-1396Q397,-1510 615,-1510L750,-1510Q830,-1510 830,-1431L830,-1309Q830,-1230 750,-1230L615,-1230Q531,-1230 486,-1192Q440,-1153 440,-1085L440,-940L710,-940Q790,-940 790,-861L790,-739Q790,-660 710,-660L440,-660L440,-79Q440,0 360,0"},
+	{0x0067, 1216, "M601,410L363,410Q283,410 283,331L283,229Q283,150 363,150L601,150Q685,150 730,112Q779,70 779,2L779,-51Q681,20 554,20Q382,20 257,-91Q70,-257 70,-550Q70,-843 257,-1009Q382,-1120 554,-1120Q681,-1120 779,-1049Q779,-1100 856,-1100L996,-1100Q1076,-1100 1076,-1021L1076,-24Q1076,178 945,296Q819,410 601,410M776,-787Q714,-840 622,-840Q530,-840 464,-779Q383,-704 383,-550Q383,-400 461,-326Q531,-260 622.5,-260Q714,-260 776,-314"},
+	{0x0068, 1230, "M360,0L220,0Q140,0 140,-79L140,-1431Q140,-1510 220,-1510L360,-1510Q440,-1510 440,-1431L440,-1051Q538,-1120 662,-1120Q834,-1120 959,-1009Q1090,-893 1090,-697L1090,-79Q1090,0 1010,0L870,0Q790,0 790,-79L790,-676Q790,-754 742,-797Q694,-840 601,-840Q508,-840 440,-784L440,-79Q440,0 360,0"},
+	{0x0069, 580, "M290,-1544Q366,-1544 418,-1491Q470,-1438 470,-1363Q470,-1289 417,-1234Q365,-1180 290,-1180Q213,-1180 161.5,-1234Q110,-1288 110,-1362Q110,-1438 162,-1490Q215,-1544 290,-1544M220,0Q140,0 140,-79L140,-1021Q140,-1100 220,-1100L360,-1100Q440,-1100 440,-1021L440,-79Q440,0 360,0"},
+	{0x006A, 580, "M290,-1544Q366,-1544 418,-1491Q470,-1438 470,-1363Q470,-1289 417,-1234Q365,-1180 290,-1180Q213,-1180 161.5,-1234Q110,-1288 110,-1362Q110,-1438 162,-1490Q215,-1544 290,-1544M15,410Q-65,410 -65,331L-65,209Q-65,132 15,130Q54,129 86,100Q140,50 140,-27L140,-1021Q140,-1100 220,-1100L360,-1100Q440,-1100 440,-1021L440,-41Q440,171 309,291Q178,410 15,410"},
+	{0x006B, 1069, "M1038,-79Q1049,-60 1049,-42Q1049,0 993,0L806,0Q735,0 698,-64L511,-387L440,-297L440,-79Q440,0 360,0L220,0Q140,0 140,-79L140,-1431Q140,-1510 220,-1510L360,-1510Q440,-1510 440,-1431L440,-717L691,-1036Q741,-1100 806,-1100L973,-1100Q1024,-1100 1024,-1059Q1024,-1037 1007,-1015L712,-641"},
+	{0x006C, 580, "M220,0Q140,0 140,-79L140,-1431Q140,-1510 220,-1510L360,-1510Q440,-1510 440,-1431L440,-79Q440,0 360,0"},
+	{0x006D, 1880, "M437,-1049Q536,-1120 662,-1120Q827,-1120 952,-1003Q1088,-1120 1273,-1120Q1484,-1120 1609,-1009Q1740,-893 1740,-697L1740,-79Q1740,0 1660,0L1520,0Q1440,0 1440,-79L1440,-676Q1440,-754 1392,-797Q1344,-840 1248,-840Q1147,-840 1080,-772Q1090,-721 1090,-676L1090,-79Q1090,0 1010,0L870,0Q790,0 790,-79L790,-676Q790,-754 742,-797Q694,-840 598,-840Q503,-840 440,-784L440,-79Q440,0 360,0L220,0Q140,0 140,-79L140,-1021Q140,-1100 220,-1100L360,-1100Q437,-1100 437,-1049"},
+	{0x006E, 1230, "M360,0Q360,0 220,0Q140,0 140,-79L140,-1021Q140,-1100 220,-1100L360,-1100Q437,-1100 437,-1049Q535,-1120 662,-1120Q834,-1120 959,-1009Q1090,-893 1090,-697L1090,-79Q1090,0 1010,0L870,0Q790,0 790,-79L790,-676Q790,-754 742,-797Q694,-840 601,-840Q508,-840 440,-784L440,-79Q440,0 360,0"},
+	{0x006F, 1246, "M623,-260Q714,-260 785,-326Q863,-401 863,-550Q863,-702 782,-779Q716,-840 622,-840Q528,-840 464,-779Q383,-702 383,-550Q383,-400 461,-326Q533,-260 623,-260M623,20Q387,20 241,-123Q70,-292 70,-550Q70,-815 241,-976Q396,-1120 623,-1120Q850,-1120 1005,-976Q1176,-816 1176,-550Q1176,-294 1005,-124Q861,20 623,20"},
+	{0x0070, 1216, "M220,-1100Q220,-1100 360,-1100Q437,-1100 437,-1049Q535,-1120 662,-1120Q834,-1120 959,-1009Q1146,-843 1146,-550Q1146,-257 959,-91Q834,20 662,20Q543,20 440,-49L440,331Q440,410 360,410L220,410Q140,410 140,331L140,-1021Q140,-1100 220,-1100M440,-313Q502,-260 594,-260Q686,-260 752,-321Q833,-396 833,-550Q833,-700 755,-774Q685,-840 593.5,-840Q502,-840 440,-786"},
+	{0x0071, 1216, "M996,-1100Q1076,-1100 1076,-1021L1076,331Q1076,410 996,410L856,410Q776,410 776,331L776,-49Q673,20 554,20Q382,20 257,-91Q70,-257 70,-550Q70,-843 257,-1009Q382,-1120 554,-1120Q681,-1120 779,-1049Q779,-1100 856,-1100M776,-313L776,-786Q714,-840 622.5,-840Q531,-840 461,-774Q383,-700 383,-550Q383,-396 464,-321Q530,-260 622,-260Q714,-260 776,-313"},
+	{0x0072, 994, "M360,0L220,0Q140,0 140,-79L140,-1021Q140,-1100 220,-1100L360,-1100Q437,-1100 437,-1049Q535,-1120 662,-1120Q834,-1120 959,-1009Q984,-987 984,-958Q984,-929 953,-897L854,-792Q830,-766 803,-766Q777,-766 742,-797Q694,-840 601,-840Q508,-840 440,-784L440,-79Q440,0 360,0"},
+	{0x0073, 985, "M436,20Q215,20 75,-126Q50,-152 50,-177Q50,-209 81,-238L169,-319Q197,-345 220,-345Q254,-345 281,-314Q357,-229 468,-229Q550,-229 597,-267Q638,-300 638,-339Q638,-403 561,-428L418,-475Q119,-573 119,-808Q119,-947 238,-1042Q336,-1120 492,-1120Q704,-1120 818,-983Q843,-953 843,-932Q843,-899 812,-871L739,-804Q711,-778 688,-778Q654,-778 627,-809Q567,-876 479,-876Q396,-876 396,-821Q396,-768 472,-743L651,-683Q925,-591 925,-358Q925,-209 793,-93Q663,20 436,20"},
+	{0x0074, 894, "M382,0Q302,0 302,-79L302,-820L100,-820Q20,-820 20,-899L20,-1021Q20,-1100 100,-1100L302,-1100L302,-1431Q302,-1510 382,-1510L512,-1510Q592,-1510 592,-1431L592,-1100L794,-1100Q874,-1100 874,-1021L874,-899Q874,-820 794,-820L592,-820L592,-79Q592,0 512,0"},
+	{0x0075, 1230, "M1010,0L870,0Q793,0 793,-51Q688,20 568,20Q396,20 271,-91Q140,-207 140,-403L140,-1021Q140,-1100 220,-1100L360,-1100Q440,-1100 440,-1021L440,-424Q440,-346 488,-303Q536,-260 629,-260Q722,-260 790,-316L790,-1021Q790,-1100 870,-1100L1010,-1100Q1090,-1100 1090,-1021L1090,-79Q1090,0 1010,0"},
+	{0x0076, 1166, "M435,0Q367,0 345,-65L16,-1023Q10,-1040 10,-1055Q10,-1100 69,-1100L233,-1100Q301,-1100 323,-1036L588,-265L853,-1036Q875,-1100 943,-1100L1097,-1100Q1156,-1100 1156,-1055Q1156,-1040 1150,-1023L821,-65Q799,0 731,0"},
+	{0x0077, 1508, "M555,0Q555,0 305,0Q235,0 219,-79L23,-1021Q20,-1035 20,-1044Q20,-1100 97,-1100L227,-1100Q298,-1100 313,-1021L445,-316L587,-1021Q603,-1100 673,-1100L845,-1100Q915,-1100 931,-1021Q931,-1021 1073,-316L1205,-1021Q1220,-1100 1291,-1100L1411,-1100Q1488,-1100 1488,-1044Q1488,-1035 1485,-1021L1289,-79Q1273,0 1203,0L953,0Q882,0 867,-79L754,-692L641,-79Q626,0 555,0"},
+	{0x0078, 955, "M230,0L76,0Q20,0 20,-47Q20,-59 32,-79L316,-548L32,-1021Q20,-1041 20,-1053Q20,-1100 76,-1100L240,-1100Q311,-1100 349,-1036L480,-818L612,-1036Q651,-1100 721,-1100L875,-1100Q931,-1100 931,-1053Q931,-1041 919,-1021L637,-556L923,-79Q935,-59 935,-47Q935,0 879,0L715,0Q645,0 606,-64L473,-285L339,-64Q300,0 230,0"},
+	{0x0079, 1146, "M274,410Q194,410 194,331L194,209Q194,130 272,130Q354,130 403,92Q444,61 467,0L405,0Q367,0 355,-35L16,-1023Q10,-1040 10,-1055Q10,-1100 69,-1100L243,-1100Q311,-1100 333,-1036L578,-323L823,-1036Q845,-1100 913,-1100L1077,-1100Q1136,-1100 1136,-1055Q1136,-1040 1130,-1023L746,95Q703,220 618,296Q493,410 274,410"},
+	{0x007A, 999, "M849,0L150,0Q70,0 70,-79L70,-201Q70,-236 92,-263L538,-820L190,-820Q110,-820 110,-899L110,-1021Q110,-1100 190,-1100L849,-1100Q929,-1100 929,-1021L929,-899Q929,-865 905,-835L460,-280L849,-280Q929,-280 929,-201L929,-79Q929,0 849,0"},
+	{0x007B, 795, "M695,205Q477,205 351,91Q220,-27 220,-229L220,-615L100,-615Q20,-615 20,-694L20,-816Q20,-895 100,-895L220,-895L220,-1276Q220,-1478 351,-1596Q477,-1710 695,-1710Q775,-1710 775,-1631L775,-1509Q775,-1430 695,-1430Q611,-1430 566,-1392Q520,-1353 520,-1285L520,-220Q520,-152 566,-113Q611,-75 695,-75Q775,-75 775,4L775,126Q775,205 695,205"},
+	{0x007C, 675, "M270,-1660L405,-1660Q475,-1660 475,-1590L475,80Q475,150 405,150L270,150Q200,150 200,80L200,-1590Q200,-1660 270,-1660"},
+	{0x007D, 795, "M100,205Q20,205 20,126L20,4Q20,-75 100,-75Q184,-75 229,-113Q275,-152 275,-220L275,-1285Q275,-1353 229,-1392Q184,-1430 100,-1430Q20,-1430 20,-1509L20,-1631Q20,-1710 100,-1710Q318,-1710 444,-1596Q575,-1478 575,-1276L575,-895L695,-895Q775,-895 775,-816L775,-694Q775,-615 695,-615L575,-615L575,-229Q575,-27 444,91Q318,205 100,205"},
+	{0x007E, 1138, "M850,-976L968,-976Q1048,-976 1048,-897Q1048,-515 762,-515Q596,-515 469,-666Q433,-709 424,-718Q413,-729 401,-729Q368,-729 368,-615Q368,-536 288,-536L170,-536Q90,-536 90,-615Q90,-997 376,-997Q542,-997 669,-846Q705,-803 714,-794Q725,-783 737,-783Q770,-783 770,-897Q770,-976 850,-976"},
+	{0x00A3, 1275, "M1105,0L170,0Q90,0 90,-79L90,-221Q90,-300 170,-300L210,-300L210,-550L171,-550Q91,-550 91,-629L91,-771Q91,-850 171,-850L210,-850L210,-1119Q210,-1323 356,-1431Q491,-1530 685,-1530Q885,-1530 1021,-1407Q1085,-1349 1120,-1281Q1131,-1260 1131,-1242Q1131,-1200 1080,-1176L949,-1116Q926,-1105 903,-1105Q864,-1105 844,-1155Q832,-1185 806,-1208Q756,-1251 686,-1251Q613,-1251 573,-1215Q530,-1176 530,-1103L530,-850L835,-850Q915,-850 915,-771L915,-629Q915,-550 835,-550L530,-550L530,-300L1105,-300Q1185,-300 1185,-221L1185,-79Q1185,0 1105,0"},
+	{0x20AC, 1491, "M336,-211Q220,-347 174,-519L95,-519Q50,-519 50,-564L50,-654Q50,-699 95,-699L147,-699Q145,-727 145,-755Q145,-783 146,-811L95,-811Q50,-811 50,-856L50,-946Q50,-991 95,-991L174,-991Q219,-1164 336,-1299Q535,-1530 862,-1530Q1191,-1530 1388,-1299Q1411,-1272 1411,-1247Q1411,-1215 1376,-1187L1255,-1089Q1227,-1066 1202,-1066Q1170,-1066 1143,-1100Q1040,-1230 861,-1230Q688,-1230 586,-1106Q543,-1054 517,-991L959,-991Q1004,-991 1004,-946L1004,-856Q1004,-811 959,-811L476,-811Q474,-784 474,-755Q474,-726 476,-699L959,-699Q1004,-699 1004,-654L1004,-564Q1004,-519 959,-519L516,-519Q543,-455 586,-404Q692,-280 863,-280Q1040,-280 1143,-410Q1170,-444 1202,-444Q1227,-444 1255,-421L1376,-323Q1411,-295 1411,-263Q1411,-238 1388,-211Q1190,20 862,20Q534,20 336,-211"}
+};
+
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+/*
+ * This file contains geometric hit-testing against the drawn shapes of symbols, for picking
+ * symbols under a cursor without rasterizing them or parsing their SVG.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "Symbol.hpp"
+
+namespace milsymbol {
+
+/**
+ * @brief The flattened fills and strokes of a symbol, kept as edges for point-in-shape tests.
+ *
+ * Points are in pixels at the style's icon size, relative to the symbol anchor, as in Tessellator
+ * meshes. A point hits the symbol if it's inside any fill or stroke that would be painted, with the
+ * nonzero rule, so the empty interior of an unfilled frame isn't a hit but its outline is. Text is
+ * tested against the outlines of the glyph table.
+ *
+ * Without a grid, a test walks every edge. With one, cells that no edge crosses are answered from a
+ * precomputed flag, and other cells only walk the edges their row's rightward ray can cross.
+ */
+struct HitShape {
+    static constexpr int DEFAULT_GRID_SIZE = 16; /// Cells across and down in the grid Symbol::hit_test uses
+
+    /**
+     * @brief Flattens a symbol's fills and strokes, with curves no further than `tolerance` pixels from
+     * the true curve. The shape has no grid until with_grid is called.
+     */
+    static HitShape from_symbol(const Symbol& symbol, const SymbolStyle& style = {}, real_t tolerance = 0.25) noexcept;
+
+    /**
+     * @brief Builds an acceleration grid of `size` by `size` cells over the shape's bounding box, or removes it if `size` is 0
+     * @return This same object, modified
+     */
+    HitShape& with_grid(int size) noexcept;
+
+    /**
+     * @brief Returns whether a point, relative to the symbol anchor, hits the symbol's drawn geometry
+     */
+    bool contains(const Vector2& point) const noexcept;
+
+    inline const BoundingBox& get_bbox() const noexcept {return bbox;} /// Returns the bounding box of every edge
+    inline std::size_t get_edge_count() const noexcept {return edges.size();} /// Returns the number of edges
+    inline bool empty() const noexcept {return edges.empty();} /// Returns whether nothing is drawn
+
+    /**
+     * @brief Returns the number of bytes of edges and grid the shape holds
+     */
+    std::size_t get_memory_size() const noexcept;
+
+private:
+    /// A non-horizontal edge, pointing down
+    struct Edge {
+        real_t x; /// X at the top of the edge
+        real_t y_top;
+        real_t y_bottom;
+        real_t slope; /// Change in X per unit of Y
+        std::uint32_t shape; /// Index of the fill or stroke the edge belongs to; edges are grouped by it
+        std::int32_t winding; /// +1 if the edge originally pointed down, -1 if up
+    };
+
+    /// A horizontal edge, which rays never cross but grid cells can
+    struct HorizontalEdge {
+        real_t x1;
+        real_t x2;
+        real_t y;
+    };
+
+    std::vector<Edge> edges;
+    std::vector<HorizontalEdge> horizontal_edges;
+    BoundingBox bbox{0, 0, 0, 0};
+
+    int grid_size = 0; /// Cells across and down, or 0 without a grid
+    real_t cell_width = 0;
+    real_t cell_height = 0;
+    std::vector<std::uint32_t> cell_starts; /// Offset of each cell's edges in `cell_edges`, plus the end
+    std::vector<std::uint32_t> cell_edges; /// Indices of the edges to walk in each cell, in order
+    std::vector<bool> cell_inside; /// For cells with no edges to walk, whether the whole cell is inside
+
+    /// Returns whether a point is inside, walking the given edges, which must be in order
+    template<typename Indices>
+    bool contains_with(const Vector2& point, const Indices& indices) const noexcept;
+};
+
+}
@@ -0,0 +1,163 @@
+#pragma once
+
+/*
+ * This file contains a minimal streaming PNG encoder for exporting raster images and atlases
+ * without any external dependencies.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+namespace milsymbol {
+
+/**
+ * @brief How a PNG's image data is compressed
+ */
+enum class PngCompression {
+    STORED, /// No compression, only framing; fastest, and the size of the raw image
+    FAST /// Greedy LZ77 with fixed Huffman codes; several times smaller for symbol images, and still quick
+};
+
+/**
+ * @brief Which PNG filter is applied to each row before compression
+ */
+enum class PngFilter {
+    NONE = 0, /// Rows are compressed as they are
+    SUB, /// Each byte minus the one a pixel to its left
+    UP, /// Each byte minus the one above it
+    AVERAGE, /// Each byte minus the average of the ones to the left and above
+    PAETH, /// Each byte minus the closest of the ones to the left, above, and above left
+    ADAPTIVE /// Whichever filter gives the smallest sum of absolute values, chosen for each row
+};
+
+/**
+ * @brief Encodes a PNG image row by row, streaming it to an output stream or a file descriptor.
+ *
+ * Only the previous row, a 64 KiB compression window and a 64 KiB output chunk are held, whatever the
+ * size of the image, so images far larger than memory can be written as their rows are produced. Rows
+ * are 8 bits per channel, with 1 (gray), 2 (gray and alpha), 3 (RGB) or 4 (RGBA) channels.
+ */
+struct PngWriter {
+    /**
+     * @brief Creates a writer for an image of the given size, streaming to `out`
+     */
+    PngWriter(std::ostream& out, int width, int height, int channels = 4) noexcept;
+
+    /**
+     * @brief Creates a writer for an image of the given size, streaming to the file descriptor `fd`, which stays open
+     */
+    PngWriter(int fd, int width, int height, int channels = 4) noexcept;
+
+    /**
+     * @brief Sets how image data is compressed. Must be set before the first row.
+     * @return This same object, modified
+     */
+    inline PngWriter& with_compression(PngCompression compression) noexcept {
+        this->compression = compression;
+        return *this;
+    }
+
+    /**
+     * @brief Sets how rows are filtered. Must be set before the first row.
+     * @return This same object, modified
+     */
+    inline PngWriter& with_filter(PngFilter filter) noexcept {
+        this->filter = filter;
+        return *this;
+    }
+
+    /**
+     * @brief Sets whether rows have color premultiplied by alpha, as RasterTarget pixels do; PNG stores
+     * straight alpha, so they're converted as they're written
+     * @return This same object, modified
+     */
+    inline PngWriter& with_premultiplied_alpha(bool premultiplied) noexcept {
+        this->premultiplied = premultiplied;
+        return *this;
+    }
+
+    /**
+     * @brief Writes the next row, of `width * channels` bytes. The header is written with the first row.
+     * @return Whether everything has been written successfully so far
+     */
+    bool write_row(const std::uint8_t* row) noexcept;
+
+    /**
+     * @brief Pulls every row from `source`, called as `source(int y)` in order and returning a pointer to the row,
+     * then finishes the image. A null row stops early.
+     * @return Whether the whole image was written successfully
+     */
+    template<typename Source>
+    inline bool write_image(Source&& source) noexcept {
+        for (int y = rows_written; y < height; y++) {
+            const std::uint8_t* row = source(y);
+            if (row == nullptr || !write_row(row)) {
+                break;
+            }
+        }
+        return finish();
+    }
+
+    /**
+     * @brief Ends the image. Rows that weren't written are filled with zeros so the file is still valid.
+     * @return Whether every row was given and everything was written successfully
+     */
+    bool finish() noexcept;
+
+    /**
+     * @brief Returns the number of bytes of buffers the writer holds, which doesn't grow with the image's height
+     */
+    std::size_t get_buffer_size() const noexcept;
+
+private:
+    std::ostream* out = nullptr;
+    int fd = -1;
+    bool ok = true;
+    bool finished = false;
+
+    int width = 0;
+    int height = 0;
+    int channels = 4;
+    PngCompression compression = PngCompression::FAST;
+    PngFilter filter = PngFilter::ADAPTIVE;
+    bool premultiplied = false;
+    int rows_written = 0;
+
+    std::size_t row_size = 0; /// Bytes in a row, without its filter type
+    std::vector<std::uint8_t> previous; /// The previous unfiltered row
+    std::vector<std::uint8_t> current; /// The current unfiltered row
+    std::vector<std::uint8_t> filtered; /// The current row with the filter chosen so far, led by its filter type
+    std::vector<std::uint8_t> trial; /// The current row with a filter being tried
+
+    std::vector<std::uint8_t> pending; /// Compressed data not yet written in an IDAT chunk
+    std::vector<std::uint8_t> history; /// Uncompressed data in the match window, and stored data not yet in a block
+    std::vector<std::int32_t> hash_heads; /// Latest position in `history` for each hash of three bytes
+    std::uint64_t bit_buffer = 0; /// Bits not yet in `pending`, least significant first
+    int bit_count = 0;
+    std::uint32_t adler_a = 1; /// Adler-32 checksum of the uncompressed data
+    std::uint32_t adler_b = 0;
+
+    void start() noexcept;
+    void write_bytes(const std::uint8_t* data, std::size_t size) noexcept;
+    void write_chunk(const char type[4], const std::uint8_t* data, std::size_t size) noexcept;
+    void flush_pending(bool all) noexcept;
+
+    void filter_row() noexcept;
+    void compress(const std::uint8_t* data, std::size_t size) noexcept;
+    void compress_window(std::size_t begin, std::size_t end) noexcept;
+    void write_stored_block(bool last) noexcept;
+
+    inline void write_bits(std::uint32_t bits, int count) noexcept {
+        bit_buffer |= static_cast<std::uint64_t>(bits) << bit_count;
+        bit_count += count;
+        while (bit_count >= 8) {
+            pending.push_back(static_cast<std::uint8_t>(bit_buffer));
+            bit_buffer >>= 8;
+            bit_count -= 8;
+        }
+    }
+};
+
+}
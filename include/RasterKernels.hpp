@@ -0,0 +1,58 @@
+#pragma once
+
+/*
+ * This file contains the per-row kernels of the CPU rasterizer, with a scalar reference
+ * implementation and SIMD versions selected at runtime.
+ */
+
+#include <cstdint>
+
+namespace milsymbol {
+
+/**
+ * @brief Instruction sets the rasterizer's row kernels can use. Every one produces bit-identical output.
+ */
+enum class RasterInstructionSet {
+    AUTOMATIC = 0, /// The best one the CPU supports
+    SCALAR, /// Portable reference implementation
+    SSE2, /// x86 SSE2
+    AVX2 /// x86 AVX2
+};
+
+}
+
+namespace milsymbol::_impl {
+
+/// Accumulated signed area of a fully covered pixel
+static constexpr std::int32_t COVERAGE_ONE = 1 << 16;
+
+/**
+ * @brief The rasterizer's per-row kernels for one instruction set
+ */
+struct RasterKernels {
+    /**
+     * @brief Turns a row of accumulated signed area into 8-bit coverage with a running sum, clearing the
+     * accumulation as it goes. Coverage is the absolute sum, clamped to one pixel, rounded to 0-255.
+     */
+    void (*accumulate_coverage)(std::int32_t* accumulation, std::uint8_t* coverage, int count) noexcept;
+
+    /**
+     * @brief Composites an RGBA8 color with full alpha over a span of premultiplied RGBA8 pixels, weighted by coverage
+     */
+    void (*composite_span)(std::uint8_t* pixels, const std::uint8_t* coverage, int count, const std::uint8_t color[4]) noexcept;
+
+    RasterInstructionSet instruction_set; /// The instruction set these kernels use
+};
+
+/**
+ * @brief Returns whether the CPU can run kernels using the given instruction set
+ */
+bool is_supported(RasterInstructionSet instruction_set) noexcept;
+
+/**
+ * @brief Returns the kernels for an instruction set, falling back to the best supported one if the CPU can't
+ * run it, and picking the best supported one for RasterInstructionSet::AUTOMATIC
+ */
+const RasterKernels& get_raster_kernels(RasterInstructionSet instruction_set = RasterInstructionSet::AUTOMATIC) noexcept;
+
+}
@@ -0,0 +1,193 @@
+#pragma once
+
+/*
+ * This file contains a CPU rasterizer that draws symbols straight into pixel buffers,
+ * without serializing and parsing SVG, and a multi-threaded one for whole atlases.
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Symbol.hpp"
+#include "Atlas.hpp"
+#include "Flatten.hpp"
+#include "RasterKernels.hpp"
+
+namespace milsymbol {
+
+namespace _impl {
+struct SymbolParts;
+}
+
+/**
+ * @brief A caller-owned RGBA8 image to draw into. Colors are premultiplied by alpha.
+ */
+struct RasterTarget {
+    std::uint8_t* pixels = nullptr; /// The top left pixel
+    int width = 0; /// Width in pixels
+    int height = 0; /// Height in pixels
+    std::ptrdiff_t stride = 0; /// Bytes from the start of one row to the next; 0 means rows are packed
+};
+
+/**
+ * @brief Draws symbols straight into RGBA8 pixel buffers with anti-aliasing.
+ *
+ * Symbols are drawn from their draw commands - paths, circles, text, translations, scales and dashed
+ * strokes - with exact-area coverage and the nonzero fill rule, composited over what's already in
+ * the target. Text is drawn from the outlines in the glyph table. Scratch buffers are kept between
+ * calls, so keep one rasterizer per thread and reuse it.
+ *
+ * Row coverage and compositing use SSE2 or AVX2 where the CPU supports them, chosen at runtime;
+ * every instruction set produces the same pixels as the scalar reference.
+ */
+struct Rasterizer {
+
+    /**
+     * @brief Draws a symbol with the top left of its SVG bounding box at the top left of the target, at the
+     * style's icon size. The whole symbol fits in a target the size of its SVG bounding box rounded up; anything
+     * outside the target is clipped.
+     * @return The symbol's layout, as from Symbol::get_layout
+     */
+    Symbol::RichOutput draw(const Symbol& symbol, const RasterTarget& target, const SymbolStyle& style = {}) noexcept;
+
+    /**
+     * @brief Sets how far flattened curves may stray from the true curve, in pixels
+     * @return This same object, modified
+     */
+    inline Rasterizer& with_tolerance(real_t tolerance) noexcept {
+        flattener.tolerance = tolerance;
+        return *this;
+    }
+
+    /**
+     * @brief Sets the instruction set used for coverage and compositing. Ones the CPU doesn't support fall
+     * back to the best one it does.
+     * @return This same object, modified
+     */
+    inline Rasterizer& with_instruction_set(RasterInstructionSet instruction_set) noexcept {
+        kernels = &_impl::get_raster_kernels(instruction_set);
+        return *this;
+    }
+
+    /// Returns the instruction set in use
+    inline RasterInstructionSet get_instruction_set() const noexcept {return kernels->instruction_set;}
+
+private:
+    friend struct AtlasRasterizer;
+    friend struct DistanceFieldGenerator;
+
+    _impl::ShapeFlattener flattener;
+    const _impl::RasterKernels* kernels = &_impl::get_raster_kernels();
+    std::vector<std::int32_t> accumulation; /// Signed area per pixel, in 1/65536ths, zero between fills
+    std::vector<std::uint8_t> coverage; /// Coverage of the current row
+
+    /**
+     * @brief Draws already-built symbol parts, as draw() does. The target holds the drawing's rows from
+     * `first_row` on, so a symbol can be drawn a band at a time with the same rounding as drawn whole.
+     */
+    void draw_parts(const _impl::SymbolParts& parts, const RasterTarget& target, int first_row = 0) noexcept;
+
+    /**
+     * @brief Draws already-built symbol parts as coverage masks, filling everything of each color class in white
+     * into the target for it, indexed by ColorType, `scale` times the style's icon size. Color classes with a null
+     * target are skipped.
+     */
+    void draw_masks(const _impl::SymbolParts& parts, const RasterTarget* const (&masks)[4], real_t scale) noexcept;
+
+    /// Fills polygons with a color using the nonzero rule, into a target holding rows from `first_row` on
+    void fill(const _impl::Polylines& polygons, const Color& color, const RasterTarget& target, int first_row = 0) noexcept;
+};
+
+/**
+ * @brief Time spent rasterizing an atlas, by stage
+ */
+struct AtlasRasterStats {
+    /**
+     * @brief Work done by a single thread
+     */
+    struct Worker {
+        std::size_t symbols = 0; /// Number of symbols drawn
+        std::chrono::nanoseconds geometry{0}; /// Time building symbol geometry, the same work as Symbol::get_svg's
+        std::chrono::nanoseconds drawing{0}; /// Time flattening, filling and compositing
+    };
+
+    std::chrono::nanoseconds allocation{0}; /// Time allocating and clearing the image, if the rasterizer made it
+    std::chrono::nanoseconds rasterization{0}; /// Wall time from starting the threads until the last one finished
+    std::vector<Worker> workers; /// Work done by each thread, the calling thread first
+};
+
+/**
+ * @brief An atlas drawn into a single image
+ */
+struct AtlasImage {
+    int width = 0; /// Width in pixels, the same as the atlas's
+    int height = 0; /// Height in pixels, the same as the atlas's
+    std::vector<std::uint8_t> pixels; /// Premultiplied RGBA8 pixels, with rows packed
+    AtlasRasterStats stats; /// Time spent drawing the image
+};
+
+/**
+ * @brief Rasterizes every symbol in an atlas on several threads, into one shared image.
+ *
+ * Each placement is a job. Threads take the next job from a shared counter and draw its symbol into its
+ * own rectangle of the image. Rectangles never overlap, so the pixels are written without any locking.
+ */
+struct AtlasRasterizer {
+
+    /**
+     * @brief Sets the number of threads, including the calling one. 0 uses one per hardware thread.
+     * @return This same object, modified
+     */
+    inline AtlasRasterizer& with_threads(unsigned threads) noexcept {
+        this->threads = threads;
+        return *this;
+    }
+
+    /**
+     * @brief Sets how far flattened curves may stray from the true curve, in pixels
+     * @return This same object, modified
+     */
+    inline AtlasRasterizer& with_tolerance(real_t tolerance) noexcept {
+        rasterizer.with_tolerance(tolerance);
+        return *this;
+    }
+
+    /**
+     * @brief Sets the instruction set used for coverage and compositing, as in Rasterizer::with_instruction_set
+     * @return This same object, modified
+     */
+    inline AtlasRasterizer& with_instruction_set(RasterInstructionSet instruction_set) noexcept {
+        rasterizer.with_instruction_set(instruction_set);
+        return *this;
+    }
+
+    /**
+     * @brief Draws the atlas into a new transparent image of the atlas's size
+     */
+    AtlasImage rasterize(const Atlas& atlas) const noexcept;
+
+    /**
+     * @brief Draws the atlas over a caller-owned target, with the atlas's top left at the target's. Parts
+     * of placements outside the target are clipped.
+     * @return Time spent drawing; allocation is left at zero
+     */
+    AtlasRasterStats rasterize(const Atlas& atlas, const RasterTarget& target) const noexcept;
+
+    /**
+     * @brief Draws a band of the atlas's rows over a caller-owned target, with the target's top row being
+     * the atlas's `first_row`. Only placements overlapping the band are drawn, clipped to it, so an atlas
+     * can be drawn and written out a band at a time without ever holding the whole image. Bands come out
+     * identical to the same rows of the whole image; placements straddling two bands have their geometry
+     * built for each.
+     * @return Time spent drawing; allocation is left at zero
+     */
+    AtlasRasterStats rasterize_rows(const Atlas& atlas, int first_row, const RasterTarget& target) const noexcept;
+
+private:
+    Rasterizer rasterizer; /// Settings each thread's rasterizer starts from
+    unsigned threads = 0;
+};
+
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+/*
+ * This file contains a skyline bin packer used to lay out symbol atlases.
+ */
+
+#include <climits>
+#include <vector>
+
+namespace milsymbol::_impl {
+
+/**
+ * @brief Packs rectangles into a fixed-width bin using the skyline bottom-left heuristic.
+ *
+ * The skyline is the upper edge of the packed area, stored as horizontal segments from left
+ * to right. Each rectangle goes where its top edge ends up lowest (ties go to the narrower
+ * fit), and placed rectangles never move, so the packer can keep accepting rectangles.
+ */
+struct SkylinePacker {
+
+    /// Constructs a packer for a bin of the given size; the height may be grown later
+    inline SkylinePacker(int width = 0, int height = INT_MAX) noexcept : width{width}, height{height} {
+        skyline.push_back(Segment{0, 0, width});
+    }
+
+    inline int get_width() const noexcept {return width;} /// Returns the bin width
+    inline int get_height() const noexcept {return height;} /// Returns the bin height
+    inline int get_used_height() const noexcept {return used_height;} /// Returns the height of the packed area
+
+    /// Grows the bin's height. Existing placements are unaffected.
+    inline void set_height(int new_height) noexcept {height = new_height;}
+
+    /**
+     * @brief Places a rectangle of the given size, returning whether it fit. If it did,
+     * its top left corner is written to `x` and `y`.
+     */
+    inline bool insert(int rect_width, int rect_height, int& x, int& y) noexcept {
+        int best_index = -1;
+        int best_top = INT_MAX;
+        int best_width = INT_MAX;
+
+        for (int i = 0; i < static_cast<int>(skyline.size()); i++) {
+            int top = 0;
+            if (!fits(i, rect_width, rect_height, top)) {
+                continue;
+            }
+
+            if (top + rect_height < best_top || (top + rect_height == best_top && skyline[i].width < best_width)) {
+                best_index = i;
+                best_top = top + rect_height;
+                best_width = skyline[i].width;
+                x = skyline[i].x;
+                y = top;
+            }
+        }
+
+        if (best_index < 0) {
+            return false;
+        }
+
+        add_level(best_index, x, y, rect_width, rect_height);
+        if (y + rect_height > used_height) {
+            used_height = y + rect_height;
+        }
+        return true;
+    }
+
+private:
+    /// A horizontal segment of the skyline
+    struct Segment {
+        int x = 0;
+        int y = 0;
+        int width = 0;
+    };
+
+    int width = 0;
+    int height = INT_MAX;
+    int used_height = 0;
+    std::vector<Segment> skyline;
+
+    /// Returns whether a rectangle fits with its left edge at segment `index`, and the Y it would rest at
+    inline bool fits(int index, int rect_width, int rect_height, int& top) const noexcept {
+        int x = skyline[index].x;
+        if (x + rect_width > width) {
+            return false;
+        }
+
+        int remaining = rect_width;
+        top = skyline[index].y;
+        while (remaining > 0) {
+            if (index >= static_cast<int>(skyline.size())) {
+                return false;
+            }
+
+            if (skyline[index].y > top) {
+                top = skyline[index].y;
+            }
+            if (top > height - rect_height) {
+                return false;
+            }
+
+            remaining -= skyline[index].width;
+            index++;
+        }
+        return true;
+    }
+
+    /// Raises the skyline under a newly placed rectangle
+    inline void add_level(int index, int x, int y, int rect_width, int rect_height) noexcept {
+        skyline.insert(skyline.begin() + index, Segment{x, y + rect_height, rect_width});
+
+        // Trim or remove the segments now covered by the new one
+        for (int i = index + 1; i < static_cast<int>(skyline.size()); i++) {
+            int covered_to = skyline[i - 1].x + skyline[i - 1].width;
+            if (skyline[i].x >= covered_to) {
+                break;
+            }
+
+            int shrink = covered_to - skyline[i].x;
+            skyline[i].x += shrink;
+            skyline[i].width -= shrink;
+
+            if (skyline[i].width > 0) {
+                break;
+            }
+            skyline.erase(skyline.begin() + i);
+            i--;
+        }
+
+        // Merge neighbouring segments at the same height
+        for (int i = 0; i + 1 < static_cast<int>(skyline.size()); i++) {
+            if (skyline[i].y == skyline[i + 1].y) {
+                skyline[i].width += skyline[i + 1].width;
+                skyline.erase(skyline.begin() + i + 1);
+                i--;
+            }
+        }
+    }
+};
+
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+/*
+ * This file contains a builder for single-document SVG sprite sheets of many symbols.
+ */
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "Symbol.hpp"
+
+namespace milsymbol {
+
+/**
+ * @brief A rendered sprite sheet: one SVG document containing many symbols, and where each one is.
+ */
+struct SpriteSheet {
+    /**
+     * @brief Placement of a single symbol within the sheet
+     */
+    struct Sprite {
+        std::string id; /// The id of the symbol's group element in the sheet
+
+        /**
+         * @brief Bounding box of the symbol within the sheet. This is the symbol's svg_bounding_box
+         * from Symbol::get_svg, moved into sheet coordinates.
+         */
+        BoundingBox bounding_box;
+
+        /**
+         * @brief Bounding box of the symbol frame, relative to the top left corner of `bounding_box`.
+         */
+        BoundingBox frame_bounding_box;
+
+        /**
+         * @brief Symbol anchor, relative to the top left corner of `bounding_box`.
+         */
+        Vector2 symbol_anchor;
+    };
+
+    std::string svg; /// The sheet as a single SVG document
+    real_t width = 0; /// Width of the sheet
+    real_t height = 0; /// Height of the sheet
+    std::vector<Sprite> sprites; /// One sprite per placed symbol, in the order they were added
+};
+
+/**
+ * @brief Builds an SVG sprite sheet from a set of symbols sharing one style.
+ *
+ * Every unique frame, amplifier set, entity icon and modifier is serialized once as a
+ * `<symbol>` in the sheet's `<defs>`, and each placed symbol is a group of `<use>` references
+ * to them, so repeated geometry costs a few bytes per use instead of a full copy. Symbols are
+ * packed with AtlasBuilder; use it directly for streamed output or a placement table.
+ */
+struct SpriteSheetBuilder {
+
+    /**
+     * @brief Adds a symbol, identified in the sheet by "s" followed by its SIDC. A symbol added more than once has
+     * "_1", "_2" and so on appended to its id from the second time.
+     * @return This same object, modified
+     */
+    SpriteSheetBuilder& add(const Symbol& symbol);
+
+    /**
+     * @brief Adds a symbol with the given element id, which must be a valid XML id. If another symbol already has
+     * the id, or it's one the sheet uses for shared definitions ("d" or "g" followed by digits), it's suffixed as
+     * repeated SIDCs are; the sprites of the built sheet have the ids used.
+     * @return This same object, modified
+     */
+    SpriteSheetBuilder& add(const Symbol& symbol, std::string id);
+
+    /**
+     * @brief Sets the style used for every symbol in the sheet
+     * @return This same object, modified
+     */
+    inline SpriteSheetBuilder& with_style(const SymbolStyle& style) noexcept {
+        this->style = style;
+        return *this;
+    }
+
+    /**
+     * @brief Sets the maximum width of the sheet; symbols are packed to fit within it.
+     * @return This same object, modified
+     */
+    inline SpriteSheetBuilder& with_max_width(real_t max_width) noexcept {
+        this->max_width = max_width;
+        return *this;
+    }
+
+    /**
+     * @brief Sets the spacing between neighboring symbols in the sheet
+     * @return This same object, modified
+     */
+    inline SpriteSheetBuilder& with_spacing(real_t spacing) noexcept {
+        this->spacing = spacing;
+        return *this;
+    }
+
+    inline std::size_t size() const noexcept {return symbols.size();} /// Returns the number of symbols added
+
+    /**
+     * @brief Lays out and renders the sheet.
+     */
+    SpriteSheet build() const noexcept;
+
+private:
+    std::vector<Symbol> symbols;
+    std::vector<std::string> ids;
+    std::unordered_set<std::string> issued_ids; /// Every id given to a symbol so far
+    std::unordered_map<std::string, std::size_t> id_suffixes; /// Last suffix appended to each requested id
+
+    /// Returns `id`, suffixed if needed so it's unique in the sheet, and records it as issued
+    std::string issue_id(std::string id);
+
+    SymbolStyle style;
+    real_t max_width = 2048;
+    real_t spacing = 2;
+};
+
+}
@@ -0,0 +1,220 @@
+#pragma once
+
+/*
+ * This file contains opt-in runtime statistics for the render pipeline: how often each stage runs and how
+ * long it takes, plus cache, output and error counters, cheap enough to leave on in production.
+ */
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+
+namespace milsymbol {
+
+/**
+ * @brief A stage of rendering that RenderStats times
+ */
+enum class RenderStage {
+    PARSE = 0, /// Parsing a SIDC with Symbol::from_sidc at runtime
+    LAYER_LOOKUP, /// Looking up the entity and modifier icons of a symbol
+    AMPLIFIERS, /// Building headquarters, task force, echelon and mobility amplifiers
+    BOUNDING_BOX, /// Computing the bounding boxes and anchor of a symbol's layout
+    SERIALIZATION, /// Writing draw commands out as SVG
+    RENDER, /// A whole Symbol::get_svg call, including the stages above
+    COUNT
+};
+
+/**
+ * @brief A kind of error that RenderStats counts
+ */
+enum class RenderError {
+    INVALID_SIDC = 0, /// A SIDC too short to parse
+    INVALID_SYMBOL, /// A symbol whose frame couldn't be built
+    COUNT
+};
+
+/**
+ * @brief A cache that RenderStats counts hits and misses of
+ */
+enum class RenderCache {
+    HIT_TEST = 0, /// The per-thread shapes of Symbol::hit_test
+    COUNT
+};
+
+/**
+ * @brief Returns the name of a stage, error or cache, as used in exported metrics
+ */
+const char* get_name(RenderStage stage) noexcept;
+const char* get_name(RenderError error) noexcept; /// @copydoc get_name(RenderStage)
+const char* get_name(RenderCache cache) noexcept; /// @copydoc get_name(RenderStage)
+
+/**
+ * @brief Counters and latency histograms for the render pipeline.
+ *
+ * Nothing is recorded until a RenderStats is made active with set_render_stats; until then, each instrumented
+ * stage costs one acquire atomic load, which is a plain load on x86. While active, each stage reads the steady
+ * clock twice and bumps a few relaxed atomics, each stage's on its own cache line, so threads rendering different
+ * stages don't contend.
+ *
+ * Latencies go in power-of-two buckets of nanoseconds: bucket `i` holds samples over 2^i and up to 2^(i+1) ns,
+ * so its top is an inclusive bound as Prometheus expects. The first bucket also holds 0 and 1 ns, and the last
+ * holds everything longer.
+ */
+struct RenderStats {
+    static constexpr int BUCKET_COUNT = 32; /// Latency buckets per stage, up to about 4 seconds
+
+    /**
+     * @brief A consistent-enough copy of the statistics, taken without stopping recording, for export
+     */
+    struct Snapshot {
+        /// Samples of one stage
+        struct Stage {
+            std::uint64_t count = 0; /// Number of samples
+            std::uint64_t total_ns = 0; /// Sum of every sample
+            std::array<std::uint64_t, BUCKET_COUNT> buckets{}; /// Number of samples in each bucket
+
+            /**
+             * @brief Returns an upper bound on the given quantile (0 to 1) in nanoseconds - the top of the bucket it
+             * falls in - or 0 without samples
+             */
+            std::uint64_t get_quantile(double quantile) const noexcept;
+        };
+
+        std::array<Stage, static_cast<std::size_t>(RenderStage::COUNT)> stages;
+        std::array<std::uint64_t, static_cast<std::size_t>(RenderError::COUNT)> errors{};
+        std::array<std::uint64_t, static_cast<std::size_t>(RenderCache::COUNT)> cache_hits{};
+        std::array<std::uint64_t, static_cast<std::size_t>(RenderCache::COUNT)> cache_misses{};
+        std::uint64_t output_bytes = 0; /// Bytes of SVG returned by Symbol::get_svg
+
+        inline const Stage& get(RenderStage stage) const noexcept {return stages[static_cast<std::size_t>(stage)];}
+
+        /**
+         * @brief Writes the snapshot in the Prometheus text exposition format, with metric names starting with `prefix`:
+         * a `<prefix>_stage_duration_seconds` histogram labeled by stage, and `<prefix>_errors_total`,
+         * `<prefix>_cache_hits_total`, `<prefix>_cache_misses_total` and `<prefix>_output_bytes_total` counters
+         */
+        void write_prometheus(std::ostream& out, const char* prefix = "milsymbol") const;
+    };
+
+    /**
+     * @brief Records a sample of a stage's latency
+     */
+    inline void record(RenderStage stage, std::uint64_t ns) noexcept {
+        StageCounters& counters = stages[static_cast<std::size_t>(stage)];
+        int bucket = static_cast<int>(std::bit_width(ns > 0 ? ns - 1 : ns)) - 1;
+        bucket = (bucket < 0 ? 0 : (bucket >= BUCKET_COUNT ? BUCKET_COUNT - 1 : bucket));
+        counters.count.fetch_add(1, std::memory_order_relaxed);
+        counters.total_ns.fetch_add(ns, std::memory_order_relaxed);
+        counters.buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// Counts an error
+    inline void count(RenderError error) noexcept {
+        counters.errors[static_cast<std::size_t>(error)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// Counts a cache hit or miss
+    inline void count(RenderCache cache, bool hit) noexcept {
+        (hit ? counters.cache_hits : counters.cache_misses)[static_cast<std::size_t>(cache)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// Counts bytes of output
+    inline void add_output_bytes(std::uint64_t bytes) noexcept {
+        counters.output_bytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Copies the current statistics
+     */
+    Snapshot get_snapshot() const noexcept;
+
+    /**
+     * @brief Sets everything back to zero. Samples recorded while resetting may be partly kept.
+     */
+    void reset() noexcept;
+
+private:
+    struct alignas(64) StageCounters {
+        std::atomic<std::uint64_t> count{0};
+        std::atomic<std::uint64_t> total_ns{0};
+        std::array<std::atomic<std::uint64_t>, BUCKET_COUNT> buckets{};
+    };
+
+    struct alignas(64) Counters {
+        std::array<std::atomic<std::uint64_t>, static_cast<std::size_t>(RenderError::COUNT)> errors{};
+        std::array<std::atomic<std::uint64_t>, static_cast<std::size_t>(RenderCache::COUNT)> cache_hits{};
+        std::array<std::atomic<std::uint64_t>, static_cast<std::size_t>(RenderCache::COUNT)> cache_misses{};
+        std::atomic<std::uint64_t> output_bytes{0};
+    };
+
+    std::array<StageCounters, static_cast<std::size_t>(RenderStage::COUNT)> stages;
+    Counters counters;
+};
+
+/**
+ * @brief Makes `stats` the statistics the library records into, or stops recording if it's null. The object must
+ * outlive any render that might be recording into it.
+ */
+void set_render_stats(RenderStats* stats) noexcept;
+
+/**
+ * @brief Returns the statistics the library is recording into, or null if it isn't
+ */
+RenderStats* get_render_stats() noexcept;
+
+namespace _impl {
+
+/**
+ * @brief Times a render stage into the active statistics, if there are any, from construction until it's
+ * destroyed or stopped. Time while paused isn't counted.
+ */
+struct StageTimer {
+    using clock = std::chrono::steady_clock;
+
+    inline explicit StageTimer(RenderStage stage) noexcept : stats{get_render_stats()}, stage{stage} {
+        if (stats != nullptr) {
+            start = clock::now();
+        }
+    }
+
+    inline ~StageTimer() noexcept {stop();}
+
+    StageTimer(const StageTimer&) = delete;
+    StageTimer& operator=(const StageTimer&) = delete;
+
+    /// Stops counting time until resume is called
+    inline void pause() noexcept {
+        if (stats != nullptr) {
+            elapsed += clock::now() - start;
+        }
+    }
+
+    /// Starts counting time again after pause
+    inline void resume() noexcept {
+        if (stats != nullptr) {
+            start = clock::now();
+        }
+    }
+
+    /// Records the sample now rather than at destruction
+    inline void stop() noexcept {
+        if (stats != nullptr) {
+            elapsed += clock::now() - start;
+            stats->record(stage, static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+            stats = nullptr;
+        }
+    }
+
+private:
+    RenderStats* stats;
+    RenderStage stage;
+    clock::time_point start{};
+    clock::duration elapsed{0};
+};
+
+}
+
+}
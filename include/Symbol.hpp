@@ -9,6 +9,7 @@
 #include <string>
 #include <numeric>
 #include <string_view>
+#include <type_traits>
 
 #include "BBox.hpp"
 #include "Constants.hpp"
@@ -16,6 +17,34 @@
 
 namespace milsymbol {
 
+struct RenderStats;
+RenderStats* get_render_stats() noexcept;
+
+namespace _impl {
+
+/**
+ * @brief Reports a SIDC that is too short to parse. Only called outside of constant evaluation, so that
+ * the parser itself can stay constexpr.
+ */
+void report_invalid_sidc(std::string_view sidc) noexcept;
+
+/**
+ * @brief Parses up to `len` decimal digits starting at `start`, stopping at the first non-digit
+ * character (mirroring std::from_chars, which isn't constexpr for integers in C++20).
+ */
+inline constexpr int parse_sidc_digits(std::string_view view, std::size_t start, std::size_t len) noexcept {
+    int ret = 0;
+    for (std::size_t i = start; i < start + len && i < view.size(); i++) {
+        if (view[i] < '0' || view[i] > '9') {
+            break;
+        }
+        ret = ret * 10 + (view[i] - '0');
+    }
+    return ret;
+}
+
+}
+
 /**
  * @brief Represents a MILSTD-2525D symbol that can be constructed manually
  * or from a SIDC representation.
@@ -34,8 +63,26 @@ struct Symbol {
      * @brief Creates a new symbol from a SIDC. The SIDC must be convertible to std::string_view and be at least 20 characters
      * in length of all numerals. If a SIDC is less than 20 characters, an empty symbol will be returned. If a SIDC contains
      * non-numeric characters, the behavior will be undefined, but is intended to be exception-safe.
+     *
+     * This is constexpr, so fixed symbols can be parsed at compile time; see also the `_sidc` literal.
      */
-    static Symbol from_sidc(const std::string& sidc) noexcept;
+    static constexpr Symbol from_sidc(std::string_view sidc) noexcept;
+
+    /**
+     * @brief Returns whether the given string is a well-formed SIDC: exactly 20 or 30 characters, all numerals.
+     */
+    static constexpr bool is_valid_sidc(std::string_view sidc) noexcept {
+        if (sidc.length() != 20 && sidc.length() != 30) {
+            return false;
+        }
+
+        for (char c : sidc) {
+            if (c < '0' || c > '9') {
+                return false;
+            }
+        }
+        return true;
+    }
 
     /**
      * @brief Helper function to set an affiliation inline
@@ -182,6 +229,21 @@ struct Symbol {
      */
     RichOutput get_svg(const SymbolStyle& style = {}) const noexcept;
 
+    /**
+     * @brief Returns the layout that get_svg would produce for this symbol - its bounding boxes and
+     * anchor - without building the entity icon or serializing any SVG. The `svg` member is left empty.
+     */
+    RichOutput get_layout(const SymbolStyle& style = {}) const noexcept;
+
+    /**
+     * @brief Returns whether a point hits this symbol's drawn fills and strokes, rather than just its bounding box.
+     * The point is in pixels at the style's icon size, relative to the symbol anchor.
+     *
+     * The flattened geometry of the last few symbols tested is cached on each thread, so repeated tests, as when
+     * picking under a moving cursor, don't rebuild it; see HitShape to keep the geometry yourself.
+     */
+    bool hit_test(const Vector2& point, const SymbolStyle& style = {}) const noexcept;
+
     /**
      * @brief Returns whether this is a joker or faker (a friendly unit acting as a suspect or hostile unit for an exercise)
      */
@@ -193,6 +255,9 @@ struct Symbol {
     inline constexpr void set_affiliation(Affiliation affiliation) noexcept {this->affiliation = affiliation;} /// Setter for affiliation
     inline constexpr Affiliation get_affiliation() const noexcept {return affiliation;} /// Getter for affiliation
 
+    inline constexpr void set_context(Context context) noexcept {this->context = context;} /// Setter for context
+    inline constexpr Context get_context() const noexcept {return context;} /// Getter for context
+
     inline constexpr void set_status(Status status) noexcept {this->status = status;} /// Setter for status
     inline constexpr Status get_status() const noexcept {return status;} /// Getter for status
 
@@ -221,9 +286,37 @@ struct Symbol {
     static std::vector<entity_t> get_all_modifier_2s(SymbolSet symbol_set) noexcept;
     static std::vector<entity_t> get_all_symbol_sets() noexcept;
 
-    inline entity_t get_entity() const noexcept {return entity;}
+    inline constexpr entity_t get_entity() const noexcept {return entity;}
     modifier_t get_modifier(int mod) const noexcept;
 
+    /**
+     * @brief Writes this symbol's SIDC into a caller-provided 20- or 30-character buffer without allocating.
+     * The buffer isn't null-terminated; a 30-character SIDC has its trailing amplifier digits zeroed.
+     *
+     * This inverts from_sidc: `from_sidc(sidc) == symbol` for every SIDC written here. Properties that a SIDC
+     * can't hold at once (an echelon and a mobility, or a present symbol with an equipment status) are written
+     * the way from_sidc reads them back: echelon wins over mobility, and a status implies a planned symbol.
+     * Anticipated and planned symbols share the status digit 1, so an anticipated symbol reads back as planned.
+     */
+    template<std::size_t N>
+    inline constexpr void to_sidc(char (&out)[N]) const noexcept {
+        static_assert(N == 20 || N == 30, "SIDCs are either 20 or 30 characters");
+        write_sidc(out, N);
+    }
+
+    /**
+     * @brief Writes the SIDCs of `count` symbols into `out`, one 20- or 30-character buffer per symbol.
+     */
+    template<std::size_t N>
+    static inline constexpr void to_sidc(const Symbol* symbols, std::size_t count, char (*out)[N]) noexcept {
+        static_assert(N == 20 || N == 30, "SIDCs are either 20 or 30 characters");
+        for (std::size_t i = 0; i < count; i++) {
+            symbols[i].write_sidc(out[i], N);
+        }
+    }
+
+    inline constexpr bool operator==(const Symbol& other) const noexcept = default; /// Memberwise equality
+
 private:
 
     static constexpr entity_t ENTITY_SYMBOL_SET_OFFSET = 1000000;
@@ -232,6 +325,85 @@ private:
     static_assert(std::numeric_limits<entity_t>::max() > 99999999, "Insufficient space for entity storage"); // Check for storing entities as 8-digit integers for speed
     static_assert(std::numeric_limits<modifier_t>::max() > 9999, "Insufficient space for modifier storage"); // Check for storing entities as 4-digit integers for speed
 
+    /// Parses a SIDC; see from_sidc
+    static constexpr Symbol parse_sidc(std::string_view sidc) noexcept;
+
+    /// Parses a SIDC at runtime, timing it into the active RenderStats
+    static Symbol parse_sidc_with_stats(std::string_view sidc) noexcept;
+
+    /// Writes `len` (20 or 30) SIDC characters into `out`; see to_sidc
+    inline constexpr void write_sidc(char* out, std::size_t len) const noexcept {
+        auto write_digits = [&out](std::size_t start, std::size_t count, int value) {
+            for (std::size_t i = 0; i < count; i++) {
+                out[start + count - 1 - i] = static_cast<char>('0' + value % 10);
+                value /= 10;
+            }
+        };
+
+        // Version (2525D) and context
+        out[0] = '1';
+        out[1] = '0';
+        out[2] = static_cast<char>('0' + static_cast<int>(context));
+
+        // Standard identity
+        switch(affiliation) {
+        case Affiliation::PENDING:        out[3] = '0'; break;
+        case Affiliation::UNKNOWN:        out[3] = '1'; break;
+        case Affiliation::ASSUMED_FRIEND: out[3] = '2'; break;
+        case Affiliation::FRIEND:         out[3] = '3'; break;
+        case Affiliation::NEUTRAL:        out[3] = '4'; break;
+        case Affiliation::SUSPECT:        out[3] = '5'; break;
+        case Affiliation::HOSTILE:        out[3] = '6'; break;
+        }
+
+        // Symbol set
+        SymbolSet symbol_set = get_symbol_set();
+        write_digits(4, 2, symbol_set == SymbolSet::UNDEFINED ? 0 : static_cast<int>(symbol_set));
+
+        // Status, which from_sidc reads as planned whenever a status is present
+        if (status != Status::UNDEFINED) {
+            out[6] = static_cast<char>('2' + static_cast<int>(status));
+        } else {
+            out[6] = (presence == Presence::PRESENT ? '0' : '1');
+        }
+
+        // Headquarters/task force/dummy
+        out[7] = static_cast<char>('0' + (feint_dummy ? 1 : 0) + (headquarters ? 2 : 0) + (task_force ? 4 : 0));
+
+        // Echelon/mobility
+        out[8] = '0';
+        out[9] = '0';
+        if (echelon != Echelon::UNDEFINED) {
+            int ech = static_cast<int>(echelon);
+            out[8] = (echelon <= Echelon::BRIGADE ? '1' : '2');
+            out[9] = static_cast<char>('1' + (echelon <= Echelon::BRIGADE ? ech : ech - static_cast<int>(Echelon::DIVISION)));
+        } else if (mobility != Mobility::UNDEFINED) {
+            int mob = static_cast<int>(mobility);
+            if (mobility <= Mobility::PACK_ANIMALS) {
+                out[8] = '3';
+                out[9] = static_cast<char>('0' + mob);
+            } else if (mobility <= Mobility::SLED) {
+                out[8] = '4';
+                out[9] = static_cast<char>('0' + mob - static_cast<int>(Mobility::PACK_ANIMALS));
+            } else if (mobility <= Mobility::AMPHIBIOUS) {
+                out[8] = '5';
+                out[9] = static_cast<char>('0' + mob - static_cast<int>(Mobility::SLED));
+            } else {
+                out[8] = '6';
+                out[9] = static_cast<char>('0' + mob - static_cast<int>(Mobility::AMPHIBIOUS));
+            }
+        }
+
+        // Entity and modifiers
+        write_digits(10, 6, entity % ENTITY_SYMBOL_SET_OFFSET);
+        write_digits(16, 2, modifier_1 % MODIFIER_SYMBOL_SET_OFFSET);
+        write_digits(18, 2, modifier_2 % MODIFIER_SYMBOL_SET_OFFSET);
+
+        for (std::size_t i = 20; i < len; i++) {
+            out[i] = '0';
+        }
+    }
+
     static constexpr SymbolSet symbol_set_from_entity(entity_t ent) noexcept {
         if (ent < ENTITY_SYMBOL_SET_OFFSET) {
             return SymbolSet::UNDEFINED;
@@ -270,5 +442,321 @@ private:
 
 }; // End of class definition
 
+inline constexpr Symbol Symbol::from_sidc(std::string_view sidc) noexcept {
+    if (!std::is_constant_evaluated() && get_render_stats() != nullptr) {
+        return parse_sidc_with_stats(sidc);
+    }
+    return parse_sidc(sidc);
+}
+
+inline constexpr Symbol Symbol::parse_sidc(std::string_view sidc) noexcept {
+
+    if (sidc.length() < 20) {
+        if (!std::is_constant_evaluated()) {
+            _impl::report_invalid_sidc(sidc);
+        }
+        return {};
+    }
+
+    Symbol symbol;
+
+    /*
+     * Parse standard identity
+     */
+    char context_int = sidc[2];
+    switch(context_int) {
+    case '2':
+        symbol.context = Context::SIMULATION;
+        break;
+    case '1':
+        symbol.context = Context::EXERCISE;
+        break;
+    default:
+        symbol.context = Context::REALITY;
+        break;
+    }
+
+    char affil = sidc[3];
+    switch(affil) {
+    case '1':
+        symbol.affiliation = Affiliation::UNKNOWN;
+        break;
+    case '2':
+        symbol.affiliation = Affiliation::ASSUMED_FRIEND;
+        break;
+    case '3':
+        symbol.affiliation = Affiliation::FRIEND;
+        break;
+    case '4':
+        symbol.affiliation = Affiliation::NEUTRAL;
+        break;
+    case '5':
+        symbol.affiliation = Affiliation::SUSPECT;
+        break;
+    case '6':
+        symbol.affiliation = Affiliation::HOSTILE;
+        break;
+    case '0':
+        symbol.affiliation = Affiliation::PENDING;
+        break;
+    }
+
+    // Parse the symbol sets
+    int symbol_set_raw = _impl::parse_sidc_digits(sidc, 4, 2);
+
+    SymbolSet symbol_set;
+    switch (symbol_set_raw) {
+    case 1:
+        symbol_set = SymbolSet::AIR;
+        break;
+    case 2:
+        symbol_set = SymbolSet::AIR_MISSILE;
+        break;
+    case 5:
+        symbol_set = SymbolSet::SPACE;
+        break;
+    case 6:
+        symbol_set = SymbolSet::SPACE_MISSILE;
+        break;
+    case 10:
+        symbol_set = SymbolSet::LAND_UNIT;
+        break;
+    case 11:
+        symbol_set = SymbolSet::LAND_CIVILIAN_UNIT_ORGANIZATION;
+        break;
+    case 15:
+        symbol_set = SymbolSet::LAND_EQUIPMENT;
+        break;
+    case 20:
+        symbol_set = SymbolSet::LAND_INSTALLATION;
+        break;
+    case 30:
+        symbol_set = SymbolSet::SEA_SURFACE;
+        break;
+    case 35:
+        symbol_set = SymbolSet::SEA_SUBSURFACE;
+        break;
+    case 40:
+        symbol_set = SymbolSet::ACTIVITIES;
+        break;
+    default:
+        symbol_set = SymbolSet::UNDEFINED;
+        break;
+    }
+
+    /*
+     * Parse status
+     */
+
+    char status = sidc[6];
+    switch(status) {
+    case '1':
+        symbol.presence = Presence::PLANNED;
+        symbol.status = Status::UNDEFINED;
+        break;
+    case '2':
+        symbol.presence = Presence::PLANNED;
+        symbol.status = Status::FULLY_CAPABLE;
+        break;
+    case '3':
+        symbol.presence = Presence::PLANNED;
+        symbol.status = Status::DAMAGED;
+        break;
+    case '4':
+        symbol.presence = Presence::PLANNED;
+        symbol.status = Status::DESTROYED;
+        break;
+    case '5':
+        symbol.presence = Presence::PLANNED;
+        symbol.status = Status::FULL_TO_CAPACITY;
+        break;
+    default:
+        symbol.presence = Presence::PRESENT;
+        symbol.status = Status::UNDEFINED;
+        break;
+    }
+
+    /*
+     * Parse headquarters/task force/dummy elements
+     */
+
+    char hq = sidc[7];
+    switch(hq) {
+    case '1':
+        symbol.headquarters = false;
+        symbol.task_force = false;
+        symbol.feint_dummy = true;
+        break;
+    case '2':
+        symbol.headquarters = true;
+        symbol.task_force = false;
+        symbol.feint_dummy = false;
+        break;
+    case '3':
+        symbol.headquarters = true;
+        symbol.task_force = false;
+        symbol.feint_dummy = true;
+        break;
+    case '4':
+        symbol.headquarters = false;
+        symbol.task_force = true;
+        symbol.feint_dummy = false;
+        break;
+    case '5':
+        symbol.headquarters = false;
+        symbol.task_force = true;
+        symbol.feint_dummy = true;
+        break;
+    case '6':
+        symbol.headquarters = true;
+        symbol.task_force = true;
+        symbol.feint_dummy = false;
+        break;
+    case '7':
+        symbol.headquarters = true;
+        symbol.task_force = true;
+        symbol.feint_dummy = true;
+        break;
+    default:
+        symbol.headquarters = false;
+        symbol.task_force = false;
+        symbol.feint_dummy = false;
+        break;
+    }
+
+    /*
+     * Parse mobility/echelon
+     */
+
+    char ech1 = sidc[8];
+    char ech2 = sidc[9];
+
+    symbol.echelon = Echelon::UNDEFINED;
+    symbol.mobility = Mobility::UNDEFINED;
+
+    if (ech1 == '1') {
+        // Echelon at brigade and below
+        if (ech2 == '1')
+            symbol.echelon = Echelon::TEAM;
+        else if (ech2 == '2')
+            symbol.echelon = Echelon::SQUAD;
+        else if (ech2 == '3')
+            symbol.echelon = Echelon::SECTION;
+        else if (ech2 == '4')
+            symbol.echelon = Echelon::PLATOON;
+        else if (ech2 == '5')
+            symbol.echelon = Echelon::COMPANY;
+        else if (ech2 == '6')
+            symbol.echelon = Echelon::BATTALION;
+        else if (ech2 == '7')
+            symbol.echelon = Echelon::REGIMENT;
+        else if (ech2 == '8')
+            symbol.echelon = Echelon::BRIGADE;
+    } else if (ech1 == '2') {
+        // Echelon at division and above
+        if (ech2 == '1')
+            symbol.echelon = Echelon::DIVISION;
+        else if (ech2 == '2')
+            symbol.echelon = Echelon::CORPS;
+        else if (ech2 == '3')
+            symbol.echelon = Echelon::ARMY;
+        else if (ech2 == '4')
+            symbol.echelon = Echelon::ARMY_GROUP;
+        else if (ech2 == '5')
+            symbol.echelon = Echelon::REGION;
+        else if (ech2 == '6')
+            symbol.echelon = Echelon::COMMAND;
+    } else if (ech1 == '3') {
+        // Equipment mobility on land
+        if (ech2 == '1')
+            symbol.mobility = Mobility::WHEELED;
+        else if (ech2 == '2')
+            symbol.mobility = Mobility::WHEELED_CROSS_COUNTRY;
+        else if (ech2 == '3')
+            symbol.mobility = Mobility::TRACKED;
+        else if (ech2 == '4')
+            symbol.mobility = Mobility::WHEELED_AND_TRACKED;
+        else if (ech2 == '5')
+            symbol.mobility = Mobility::TOWED;
+        else if (ech2 == '6')
+            symbol.mobility = Mobility::RAIL;
+        else if (ech2 == '7')
+            symbol.mobility = Mobility::PACK_ANIMALS;
+    } else if (ech1 == '4') {
+        // Equipment mobility on snow
+        if (ech2 == '1')
+            symbol.mobility = Mobility::OVER_SNOW;
+        else if (ech2 == '2')
+            symbol.mobility = Mobility::SLED;
+
+    } else if (ech1 == '5') {
+        // Equipment mobility on water
+        if (ech2 == '1')
+            symbol.mobility = Mobility::BARGE;
+        else if (ech2 == '2')
+            symbol.mobility = Mobility::AMPHIBIOUS;
+
+    } else if (ech1 == '6') {
+        // Naval towed array
+        if (ech2 == '1')
+            symbol.mobility = Mobility::SHORT_TOWED_ARRAY;
+        else if (ech2 == '2')
+            symbol.mobility = Mobility::LONG_TOWED_ARRAY;
+    }
+
+    /*
+     * Parse entity
+     * - Characters 10-15 inclusive are the entity type
+     * - Characters 16-17 inclusive are modifier 1
+     * - Characters 18-19 inclusive are modifier 2
+     */
+    entity_t entity_raw = 0;
+    modifier_t modifier_1_raw = 0;
+    modifier_t modifier_2_raw = 0;
+
+    // Codes for unrecognized symbol sets are kept without a symbol set offset, so they stay undefined
+    int symbol_set_offset = (symbol_set == SymbolSet::UNDEFINED ? 0 : static_cast<int>(symbol_set));
+
+    entity_raw = _impl::parse_sidc_digits(sidc, 10, 6);
+    symbol.entity = symbol_set_offset * ENTITY_SYMBOL_SET_OFFSET + entity_raw;
+
+    modifier_1_raw = _impl::parse_sidc_digits(sidc, 16, 2);
+    symbol.modifier_1 = modifier_1_raw == 0 ? 0 : symbol_set_offset * MODIFIER_SYMBOL_SET_OFFSET + modifier_1_raw;
+
+    modifier_2_raw = _impl::parse_sidc_digits(sidc, 18, 2);
+    symbol.modifier_2 = modifier_2_raw == 0 ? 0 : symbol_set_offset * MODIFIER_SYMBOL_SET_OFFSET + modifier_2_raw;
+
+    return symbol;
+}
+
+namespace _impl {
+
+// Called (and thus failing constant evaluation) when a `_sidc` literal is malformed, so the
+// compiler error names the problem.
+void sidc_literal_must_be_20_or_30_characters();
+void sidc_literal_must_contain_only_digits();
+
+}
+
+inline namespace literals {
+
+/**
+ * @brief Creates a symbol from a SIDC at compile time, e.g. `"10031000141211000000"_sidc`.
+ * Malformed SIDCs (not 20 or 30 characters, or containing non-numerals) are a compile error.
+ */
+consteval Symbol operator""_sidc(const char* sidc, std::size_t length) {
+    if (length != 20 && length != 30) {
+        _impl::sidc_literal_must_be_20_or_30_characters();
+    }
+
+    if (!Symbol::is_valid_sidc(std::string_view{sidc, length})) {
+        _impl::sidc_literal_must_contain_only_digits();
+    }
+
+    return Symbol::from_sidc(std::string_view{sidc, length});
+}
+
+}
+
 } // End of the milsymbol namespace
 
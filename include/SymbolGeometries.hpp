@@ -27,7 +27,7 @@ inline static constexpr const _impl::DrawCommand get_space_modifier(Affiliation
         // Unknown
         DrawCommand::path("M 100 22.5 C 85 22.5 70 31.669211 66 50 L 134 50 C 130 31.669204 115 22.5 100 22.5 z").with_fill(ColorType::ICON).with_stroke(ColorType::NONE),
     };
-    return SPACE_MODIFIERS[static_cast<int>(affiliation)];
+    return SPACE_MODIFIERS[static_cast<int>(get_base_affiliation(affiliation))];
 }
 
 inline static constexpr const _impl::DrawCommand get_activity_modifier(Affiliation affiliation) {
@@ -42,7 +42,7 @@ inline static constexpr const _impl::DrawCommand get_activity_modifier(Affiliati
         DrawCommand::path("M 107.96875 31.46875 L 92.03125 31.71875 L 92.03125 46.4375 L 107.71875 46.4375 L 107.96875 31.46875 z M 47.03125 92.5 L 31.09375 92.75 L 31.09375 107.5 L 46.78125 107.5 L 47.03125 92.5 z M 168.4375 92.5 L 152.5 92.75 L 152.5 107.5 L 168.1875 107.5 L 168.4375 92.5 z M 107.96875 153.5625 L 92.03125 153.8125 L 92.03125 168.53125 L 107.71875 168.53125 L 107.96875 153.5625 z").with_fill(ColorType::ICON).with_stroke(ColorType::NONE)
     };
 
-    return ACTIVITY_MODIFIERS[static_cast<int>(affiliation)];
+    return ACTIVITY_MODIFIERS[static_cast<int>(get_base_affiliation(affiliation))];
 }
 
 inline static constexpr Dimension get_base_dimension(Dimension dim) noexcept {
@@ -0,0 +1,64 @@
+#pragma once
+
+/*
+ * This file contains the intermediate form of a rendered symbol - its draw commands
+ * grouped by the part of the symbol they draw, plus its layout - shared by the SVG
+ * and sprite sheet outputs.
+ */
+
+#include <vector>
+
+#include "Symbol.hpp"
+#include "DrawCommands.hpp"
+#include "Flatten.hpp"
+
+namespace milsymbol::_impl {
+
+/**
+ * @brief A symbol's draw commands, split into frame, amplifiers, entity icon and modifiers,
+ * along with the resolved style and layout used to serialize them.
+ *
+ * Draw commands are in the nominal symbol space; `scale` is the icon scale factor that
+ * maps them to the styled icon size, centered on (100, 100).
+ */
+struct SymbolParts {
+    std::vector<DrawCommand> frame; /// Frame (and dashed frame), context letters, and space/activity modifiers
+    std::vector<DrawCommand> amplifiers; /// Headquarters staff, task force, installation, feint/dummy, echelon and mobility
+    std::vector<DrawCommand> entity; /// Entity icon
+    std::vector<DrawCommand> modifier_1; /// Sector 1 modifier
+    std::vector<DrawCommand> modifier_2; /// Sector 2 modifier
+
+    Style style; /// Style to serialize the draw commands with
+    double scale = 1; /// Icon scale factor around (100, 100)
+
+    Symbol::RichOutput layout; /// Bounding boxes and anchor, as in Symbol::get_svg; the SVG string is left empty
+    bool valid = false; /// Whether the symbol could be constructed
+};
+
+/**
+ * @brief Builds the parts of a symbol for the given style, without serializing anything. If `layout_only`
+ * is set, the entity and modifier layers aren't looked up, leaving only what the layout depends on.
+ */
+SymbolParts get_symbol_parts(const Symbol& symbol, const SymbolStyle& style, bool layout_only = false) noexcept;
+
+/**
+ * @brief Adds a symbol's graphical amplifiers - headquarters staff, task force, feint/dummy, installation, echelon
+ * and mobility - around a frame with the given bounding box, setting `staff_base` to the foot of the staff
+ * @return The bounding box of the frame and amplifiers
+ */
+BoundingBox apply_amplifiers(const SymbolStyle& style, const Symbol& symbol, const BoundingBox& base_bbox,
+                             std::vector<DrawCommand>& out, Vector2& staff_base);
+
+/**
+ * @brief Returns the transform from a symbol's nominal space, scaled around (100, 100), to pixels at the
+ * styled icon size, with the top left of its SVG bounding box at the origin
+ */
+inline Transform get_pixel_transform(const SymbolParts& parts) noexcept {
+    const BoundingBox& svg_bbox = parts.layout.svg_bounding_box;
+    return Transform{static_cast<real_t>(parts.scale), Vector2{
+        static_cast<real_t>(100 - 100 * parts.scale) - svg_bbox.x1,
+        static_cast<real_t>(100 - 100 * parts.scale) - svg_bbox.y1
+    }};
+}
+
+}
@@ -104,6 +104,8 @@ public:
         use_stroke_width_override = false;
         return *this;
     }
+
+    inline constexpr bool operator==(const SymbolStyle& other) const noexcept = default; /// Memberwise equality
 };
 
 }
@@ -0,0 +1,106 @@
+#pragma once
+
+/*
+ * This file contains triangle mesh output for drawing symbols on the GPU.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "Symbol.hpp"
+#include "Flatten.hpp"
+
+namespace milsymbol {
+
+/**
+ * @brief Triangles of one or more symbols, as interleaved vertex and index buffers ready to upload.
+ *
+ * Triangles are in painting order and strokes overlap where their segments join, so draw them in index
+ * order over each other, as with the painter's algorithm. Every triangle winds clockwise on screen.
+ */
+struct Mesh {
+    /**
+     * @brief A single vertex, 12 bytes
+     */
+    struct Vertex {
+        float x; /// Position right of the symbol anchor, in pixels at the style's icon size
+        float y; /// Position below the symbol anchor, in pixels at the style's icon size
+        std::uint8_t color_class; /// The color class painted with, as a ColorType: 0 icon, 1 icon fill, 2 white and 3 yellow
+        std::uint8_t r; /// Red component of the color class's color in the style
+        std::uint8_t g; /// Green component of the color class's color in the style
+        std::uint8_t b; /// Blue component of the color class's color in the style
+    };
+
+    std::vector<Vertex> vertices; /// Interleaved vertices
+    std::vector<std::uint32_t> indices; /// Triangles, as three vertex indices each
+
+    /// Removes every triangle, keeping the allocated memory
+    inline void clear() noexcept {
+        vertices.clear();
+        indices.clear();
+    }
+
+    inline std::size_t get_triangle_count() const noexcept {return indices.size() / 3;} /// Returns the number of triangles
+};
+
+/**
+ * @brief Tessellates symbols into triangle meshes from their draw commands.
+ *
+ * Curves are flattened as for the rasterizer. Stroked outlines, dashed frames included, are made of
+ * convex pieces that are triangulated directly; fills are split into non-overlapping trapezoids by a
+ * sweep that follows the nonzero rule, so holes and self-intersecting paths come out as SVG draws them.
+ * Text is tessellated from the outlines in the glyph table. Scratch buffers are kept between calls, so
+ * keep one tessellator per thread and reuse it.
+ */
+struct Tessellator {
+
+    /**
+     * @brief Sets how far flattened curves may stray from the true curve, in pixels
+     * @return This same object, modified
+     */
+    inline Tessellator& with_tolerance(real_t tolerance) noexcept {
+        flattener.tolerance = tolerance;
+        return *this;
+    }
+
+    /**
+     * @brief Tessellates a symbol into a new mesh
+     */
+    Mesh tessellate(const Symbol& symbol, const SymbolStyle& style = {}) noexcept;
+
+    /**
+     * @brief Appends a symbol's triangles to a mesh, so many symbols can share one buffer; its indices are
+     * offset by the vertices already in the mesh
+     * @return The symbol's layout, as from Symbol::get_layout
+     */
+    Symbol::RichOutput append(const Symbol& symbol, const SymbolStyle& style, Mesh& mesh) noexcept;
+
+private:
+    /// A non-horizontal polygon edge, pointing down
+    struct SweepEdge {
+        Vector2 top;
+        Vector2 bottom;
+        int winding; /// +1 if the edge originally pointed down, -1 if up
+    };
+
+    /// An edge crossing the current slab of the sweep
+    struct SweepSpan {
+        real_t x_top;
+        real_t x_bottom;
+        int winding;
+    };
+
+    _impl::ShapeFlattener flattener;
+    std::vector<SweepEdge> edges; /// Edges of the current fill, by top
+    std::vector<real_t> stops; /// Heights where edges start or end
+    std::vector<std::size_t> active; /// Indices of edges spanning the current slab
+    std::vector<SweepSpan> spans; /// The active edges across the current slab
+
+    /// Adds triangles covering polygons with the nonzero rule
+    void add_fill(const _impl::Polylines& polygons, const Mesh::Vertex& paint, Mesh& mesh) noexcept;
+
+    /// Adds triangles covering each of a set of convex polygons
+    void add_convex(const _impl::Polylines& polygons, const Mesh::Vertex& paint, Mesh& mesh) noexcept;
+};
+
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+/*
+ * This file contains the hooks that trace points at the start and end of the stages of rendering a symbol call,
+ * for feeding per-symbol timelines into an external tracer. Trace points are only compiled into the library when
+ * it's built with the `tracing` option; otherwise they compile to nothing.
+ */
+
+#include "Stats.hpp"
+
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+namespace milsymbol {
+
+/**
+ * @brief Returns whether the library was built with trace points. This is a property of the built library, not of
+ * the code including this header, so it's a function rather than a constant.
+ */
+bool is_tracing_compiled_in() noexcept;
+
+/**
+ * @brief Functions called at the start and end of each traced render stage, with the 20-character SIDC of the
+ * symbol being rendered as its key. Traced stages are Symbol::get_svg as a whole (RenderStage::RENDER), icon
+ * lookup, amplifiers and serialization. Hooks may be called from several threads at once.
+ */
+struct TraceHooks {
+    using Hook = void (*)(void* user, RenderStage stage, std::string_view sidc) noexcept;
+
+    Hook begin = nullptr; /// Called when a stage starts
+    Hook end = nullptr; /// Called when a stage ends
+    void* user = nullptr; /// Passed to each hook
+};
+
+/**
+ * @brief Makes `hooks` the hooks trace points call, or stops tracing if it's null. The hooks must outlive any render
+ * that might be calling them. Unless is_tracing_compiled_in, hooks are never called.
+ */
+void set_trace_hooks(const TraceHooks* hooks) noexcept;
+
+/**
+ * @brief Returns the hooks trace points are calling, or null if there aren't any
+ */
+const TraceHooks* get_trace_hooks() noexcept;
+
+/**
+ * @brief Writes trace points to a file in the Chrome trace event format, which chrome://tracing and the Perfetto
+ * UI open, with one track per rendering thread and each event labeled with the symbol's SIDC.
+ */
+class ChromeTraceWriter {
+public:
+    /**
+     * @brief Opens the file at `path` for writing, replacing anything in it
+     */
+    explicit ChromeTraceWriter(const std::string& path);
+
+    /**
+     * @brief Stops tracing into this writer if it's installed, and finishes the file
+     */
+    ~ChromeTraceWriter() noexcept;
+
+    ChromeTraceWriter(const ChromeTraceWriter&) = delete;
+    ChromeTraceWriter& operator=(const ChromeTraceWriter&) = delete;
+
+    /**
+     * @brief Returns whether the file was opened
+     */
+    inline bool is_open() const noexcept {return file.is_open();}
+
+    /**
+     * @brief Makes this writer the active trace hooks
+     */
+    inline void install() const noexcept {set_trace_hooks(&hooks);}
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    static void begin(void* user, RenderStage stage, std::string_view sidc) noexcept;
+    static void end(void* user, RenderStage stage, std::string_view sidc) noexcept;
+
+    /// Writes one event with the given phase ('B' or 'E')
+    void write_event(char phase, RenderStage stage, std::string_view sidc) noexcept;
+
+    std::mutex mutex;
+    std::ofstream file;
+    TraceHooks hooks;
+    clock::time_point start;
+    bool first_event = true;
+};
+
+}
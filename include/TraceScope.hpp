@@ -0,0 +1,62 @@
+#pragma once
+
+/*
+ * This file contains the trace points the library places around the stages of rendering a symbol. It's internal
+ * and not installed: whether trace points are compiled in depends on MILSYMBOL_TRACING, which only the library's
+ * own build defines, so every translation unit that sees TraceScope agrees on it.
+ */
+
+#include "Trace.hpp"
+#include "Symbol.hpp"
+
+namespace milsymbol::_impl {
+
+#ifdef MILSYMBOL_TRACING
+
+/**
+ * @brief Calls the active trace hooks for a render stage of a symbol, from construction until it's destroyed or stopped
+ */
+struct TraceScope {
+    inline TraceScope(RenderStage stage, const Symbol& symbol) noexcept : hooks{get_trace_hooks()}, stage{stage} {
+        if (hooks != nullptr) {
+            symbol.to_sidc(sidc);
+            if (hooks->begin != nullptr) {
+                hooks->begin(hooks->user, stage, std::string_view{sidc, sizeof(sidc)});
+            }
+        }
+    }
+
+    inline ~TraceScope() noexcept {stop();}
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+    /// Ends the stage now rather than at destruction
+    inline void stop() noexcept {
+        if (hooks != nullptr) {
+            if (hooks->end != nullptr) {
+                hooks->end(hooks->user, stage, std::string_view{sidc, sizeof(sidc)});
+            }
+            hooks = nullptr;
+        }
+    }
+
+private:
+    const TraceHooks* hooks;
+    RenderStage stage;
+    char sidc[20];
+};
+
+#else
+
+/**
+ * @brief Trace point compiled out without MILSYMBOL_TRACING
+ */
+struct TraceScope {
+    inline constexpr TraceScope(RenderStage, const Symbol&) noexcept {}
+    inline constexpr void stop() noexcept {}
+};
+
+#endif
+
+}
@@ -147,6 +147,8 @@ struct Color {
 
     /// Constructs a color with the specified RGB components (0-255)
     inline constexpr Color(base_t r, base_t g, base_t b) noexcept : r{r}, g{g}, b{b} {};
+
+    inline constexpr bool operator==(const Color& other) const noexcept = default; /// Memberwise equality
 };
 
 }
@@ -0,0 +1,300 @@
+#include "Atlas.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <sstream>
+
+#include "SymbolParts.hpp"
+
+namespace milsymbol {
+
+namespace {
+
+/**
+ * @brief Writes a string with the characters that can't appear in an XML attribute escaped
+ */
+void write_xml_escaped(std::ostream& out, std::string_view text) noexcept {
+    for (char c : text) {
+        switch (c) {
+            case '&': out << "&amp;"; break;
+            case '<': out << "&lt;"; break;
+            case '>': out << "&gt;"; break;
+            case '"': out << "&quot;"; break;
+            default: out << c; break;
+        }
+    }
+}
+
+/**
+ * @brief Writes a string as a quoted JSON string
+ */
+void write_json_string(std::ostream& out, std::string_view text) noexcept {
+    out << '"';
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            static constexpr char HEX[] = "0123456789abcdef";
+            out << "\\u00" << HEX[(c >> 4) & 0xF] << HEX[c & 0xF];
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+}
+
+}
+
+const Atlas::Placement* Atlas::find(std::string_view key) const noexcept {
+    auto it = key_indices.find(std::string(key));
+    if (it == key_indices.end()) {
+        return nullptr;
+    }
+    return &placements[it->second];
+}
+
+void Atlas::write_svg(std::ostream& out) const noexcept {
+    out << "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"" << width << "\" height=\"" << height <<
+        "\" viewBox=\"0 0 " << width << " " << height << "\">\n";
+
+    // Shared definitions are written after the symbols that use them, so nothing but the
+    // definitions needs to be held in memory
+    DefinitionPool pool;
+    for (const auto& placement : placements) {
+        write_placement_group(out, placement, &pool);
+    }
+
+    out << "<defs>\n";
+    for (std::size_t i = 0; i < pool.definitions.size(); i++) {
+        out << "<symbol id=\"d" << i << "\" overflow=\"visible\">" << *pool.definitions[i] << "</symbol>\n";
+    }
+    for (char32_t code : pool.glyphs) {
+        out << "<path id=\"g" << static_cast<std::uint32_t>(code) << "\" d=\"" << _impl::find_glyph(code)->d << "\"/>\n";
+    }
+    out << "</defs>\n</svg>";
+}
+
+void Atlas::write_placement_svg(std::ostream& out, const Placement& placement) const noexcept {
+    const BoundingBox& rect = placement.rect;
+    out << "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"" << rect.width() << "\" height=\"" << rect.height() <<
+        "\" viewBox=\"" << rect.x1 << " " << rect.y1 << " " << rect.width() << " " << rect.height() << "\">";
+    write_placement_group(out, placement, nullptr);
+    out << "</svg>";
+}
+
+void Atlas::write_placement_group(std::ostream& out, const Placement& placement, DefinitionPool* pool) const noexcept {
+    using namespace _impl;
+
+    SymbolParts parts = get_symbol_parts(placement.symbol, style);
+    if (!parts.valid) {
+        return;
+    }
+    if (pool != nullptr) {
+        parts.style.glyph_references = &pool->glyphs;
+    }
+
+    // Place the symbol's nominal space so its SVG bounding box lands on the placed rectangle,
+    // scaling around (100, 100) for non-default icon sizes
+    const BoundingBox& svg_bbox = placement.svg_bounding_box;
+    real_t offset = 100 - 100 * parts.scale;
+    out << "<g id=\"";
+    write_xml_escaped(out, placement.key);
+    out << "\" transform=\"translate(" << (placement.rect.x1 - svg_bbox.x1 + offset) << " " <<
+        (placement.rect.y1 - svg_bbox.y1 + offset) << ")";
+    if (parts.scale != 1) {
+        out << " scale(" << parts.scale << ")";
+    }
+    out << "\">";
+
+    for (const auto* part : {&parts.frame, &parts.amplifiers, &parts.entity, &parts.modifier_1, &parts.modifier_2}) {
+        if (part->empty()) {
+            continue;
+        }
+
+        std::string contents;
+        for (const auto& cmd : *part) {
+            contents += cmd.get_svg_string(parts.style);
+        }
+
+        if (pool == nullptr) {
+            out << contents;
+            continue;
+        }
+
+        auto [it, inserted] = pool->indices.try_emplace(std::move(contents), pool->definitions.size());
+        if (inserted) {
+            pool->definitions.push_back(&it->first);
+        }
+        out << "<use href=\"#d" << it->second << "\"/>";
+    }
+    out << "</g>\n";
+}
+
+void Atlas::write_metadata(std::ostream& out) const noexcept {
+    out << "{\"width\":" << width << ",\"height\":" << height << ",\"sprites\":{";
+    for (std::size_t i = 0; i < placements.size(); i++) {
+        const Placement& placement = placements[i];
+        if (i > 0) {
+            out << ',';
+        }
+        write_json_string(out, placement.key);
+        out << ":[" << placement.rect.x1 << ',' << placement.rect.y1 << ',' <<
+            placement.rect.width() << ',' << placement.rect.height() << ',' <<
+            placement.symbol_anchor.x << ',' << placement.symbol_anchor.y << ']';
+    }
+    out << "}}";
+}
+
+AtlasBuilder& AtlasBuilder::add(const Symbol& symbol) {
+    char sidc[20];
+    symbol.to_sidc(sidc);
+    return add(std::string(sidc, sizeof(sidc)), symbol);
+}
+
+AtlasBuilder& AtlasBuilder::add(std::string key, const Symbol& symbol) {
+    entries.push_back(Entry{std::move(key), symbol});
+    return *this;
+}
+
+Atlas AtlasBuilder::build() const noexcept {
+    Atlas atlas;
+    atlas.style = style;
+
+    // Lay out every symbol; invalid ones get no size and are left out
+    std::vector<Symbol::RichOutput> layouts;
+    std::vector<int> widths;
+    std::vector<int> heights;
+    layouts.reserve(entries.size());
+    widths.reserve(entries.size());
+    heights.reserve(entries.size());
+
+    for (const auto& entry : entries) {
+        Symbol::RichOutput layout = entry.symbol.get_layout(style);
+        widths.push_back(static_cast<int>(std::ceil(layout.svg_bounding_box.width())));
+        heights.push_back(static_cast<int>(std::ceil(layout.svg_bounding_box.height())));
+        layouts.push_back(std::move(layout));
+    }
+
+    // Pack the tallest symbols first, with spacing to the right of and below each one
+    std::vector<std::size_t> order(entries.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+        return heights[a] != heights[b] ? heights[a] > heights[b] : widths[a] > widths[b];
+    });
+
+    std::vector<BoundingBox> rects(entries.size());
+    std::vector<bool> placed(entries.size(), false);
+    _impl::SkylinePacker packer(max_width + spacing);
+
+    for (std::size_t i : order) {
+        if (widths[i] <= 0 || heights[i] <= 0) {
+            continue;
+        }
+
+        int x = 0;
+        int y = 0;
+        if (!packer.insert(widths[i] + spacing, heights[i] + spacing, x, y)) {
+            continue;
+        }
+
+        rects[i] = BoundingBox{static_cast<real_t>(x), static_cast<real_t>(y),
+                               static_cast<real_t>(x + widths[i]), static_cast<real_t>(y + heights[i])};
+        placed[i] = true;
+        atlas.width = std::max(atlas.width, x + widths[i]);
+        atlas.height = std::max(atlas.height, y + heights[i]);
+    }
+
+    // Record placements in the order the symbols were added
+    for (std::size_t i = 0; i < entries.size(); i++) {
+        if (!placed[i]) {
+            continue;
+        }
+
+        Atlas::Placement placement;
+        placement.key = entries[i].key;
+        placement.symbol = entries[i].symbol;
+        placement.rect = rects[i];
+        placement.svg_bounding_box = layouts[i].svg_bounding_box;
+        placement.frame_bounding_box = layouts[i].frame_bounding_box;
+        placement.symbol_anchor = layouts[i].symbol_anchor;
+
+        atlas.key_indices.try_emplace(placement.key, atlas.placements.size());
+        atlas.placements.push_back(std::move(placement));
+    }
+
+    return atlas;
+}
+
+IncrementalAtlas::IncrementalAtlas(const SymbolStyle& style, int width, int height, int spacing) noexcept :
+    packer{width + spacing, height + spacing}, spacing{spacing} {
+    atlas.style = style;
+    atlas.width = width;
+    atlas.height = height;
+}
+
+const Atlas::Placement* IncrementalAtlas::insert(const Symbol& symbol) noexcept {
+    char sidc[20];
+    symbol.to_sidc(sidc);
+    return insert(std::string(sidc, sizeof(sidc)), symbol);
+}
+
+const Atlas::Placement* IncrementalAtlas::insert(std::string key, const Symbol& symbol) noexcept {
+    if (const Atlas::Placement* existing = atlas.find(key)) {
+        return existing;
+    }
+
+    Symbol::RichOutput layout = symbol.get_layout(atlas.style);
+    int width = static_cast<int>(std::ceil(layout.svg_bounding_box.width()));
+    int height = static_cast<int>(std::ceil(layout.svg_bounding_box.height()));
+    if (width <= 0 || height <= 0) {
+        return nullptr;
+    }
+
+    int x = 0;
+    int y = 0;
+    if (!packer.insert(width + spacing, height + spacing, x, y)) {
+        return nullptr;
+    }
+
+    Atlas::Placement placement;
+    placement.key = std::move(key);
+    placement.symbol = symbol;
+    placement.rect = BoundingBox{static_cast<real_t>(x), static_cast<real_t>(y),
+                                 static_cast<real_t>(x + width), static_cast<real_t>(y + height)};
+    placement.svg_bounding_box = layout.svg_bounding_box;
+    placement.frame_bounding_box = layout.frame_bounding_box;
+    placement.symbol_anchor = layout.symbol_anchor;
+
+    used_height = std::max(used_height, y + height);
+    dirty.push_back(atlas.placements.size());
+    atlas.key_indices.try_emplace(placement.key, atlas.placements.size());
+    atlas.placements.push_back(std::move(placement));
+    return &atlas.placements.back();
+}
+
+void IncrementalAtlas::reserve(int height) noexcept {
+    if (height <= atlas.height) {
+        return;
+    }
+    atlas.height = height;
+    packer.set_height(height + spacing);
+}
+
+std::vector<IncrementalAtlas::DirtyRect> IncrementalAtlas::take_dirty_rects() noexcept {
+    std::vector<DirtyRect> rects;
+    rects.reserve(dirty.size());
+
+    for (std::size_t index : dirty) {
+        const Atlas::Placement& placement = atlas.placements[index];
+
+        std::stringstream ss;
+        atlas.write_placement_svg(ss, placement);
+        rects.push_back(DirtyRect{placement.key, placement.rect, ss.str()});
+    }
+
+    dirty.clear();
+    return rects;
+}
+
+}
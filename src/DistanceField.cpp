@@ -0,0 +1,203 @@
+#include "DistanceField.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "SymbolParts.hpp"
+
+namespace milsymbol {
+
+namespace {
+
+/// Squared distance standing in for infinity
+constexpr double FAR_AWAY = 1e20;
+
+}
+
+DistanceField DistanceFieldGenerator::generate(const Symbol& symbol, const SymbolStyle& style) noexcept {
+    DistanceField out;
+    out.channels = static_cast<int>(channels);
+    out.spread = spread;
+    out.padding = padding;
+
+    _impl::SymbolParts parts = _impl::get_symbol_parts(symbol, style);
+    if (!parts.valid) {
+        return out;
+    }
+
+    out.width = static_cast<int>(std::ceil(parts.layout.svg_bounding_box.width())) + 2 * padding;
+    out.height = static_cast<int>(std::ceil(parts.layout.svg_bounding_box.height())) + 2 * padding;
+    generate_parts(parts, out.width, out.height);
+    out.values.assign(field.begin(), field.begin() + static_cast<std::ptrdiff_t>(out.width) * out.height * out.channels);
+    out.layout = std::move(parts.layout);
+    return out;
+}
+
+DistanceField DistanceFieldGenerator::generate(const Atlas& atlas) noexcept {
+    DistanceField out;
+    out.width = atlas.width;
+    out.height = atlas.height;
+    out.channels = static_cast<int>(channels);
+    out.spread = spread;
+    out.padding = padding;
+    out.values.assign(static_cast<std::size_t>(out.width) * out.height * out.channels, 0);
+
+    for (const auto& placement : atlas.placements) {
+        _impl::SymbolParts parts = _impl::get_symbol_parts(placement.symbol, atlas.style);
+        if (!parts.valid) {
+            continue;
+        }
+
+        // Generate the placement's rectangle grown by the padding, then copy what's inside the atlas
+        int width = static_cast<int>(placement.rect.width()) + 2 * padding;
+        int height = static_cast<int>(placement.rect.height()) + 2 * padding;
+        generate_parts(parts, width, height);
+
+        int x0 = static_cast<int>(placement.rect.x1) - padding;
+        int y0 = static_cast<int>(placement.rect.y1) - padding;
+        int x_start = std::max(0, -x0);
+        int x_end = std::min(width, out.width - x0);
+        if (x_start >= x_end) {
+            continue;
+        }
+        for (int y = std::max(0, -y0); y < std::min(height, out.height - y0); y++) {
+            const std::uint8_t* source = field.data() + (static_cast<std::ptrdiff_t>(y) * width + x_start) * out.channels;
+            std::uint8_t* destination = out.values.data() +
+                ((static_cast<std::ptrdiff_t>(y0 + y) * out.width) + x0 + x_start) * out.channels;
+            std::copy(source, source + (x_end - x_start) * out.channels, destination);
+        }
+    }
+
+    return out;
+}
+
+void DistanceFieldGenerator::generate_parts(const _impl::SymbolParts& parts, int width, int height) noexcept {
+    int channel_count = static_cast<int>(channels);
+    int fine_width = width * oversampling;
+    int fine_height = height * oversampling;
+    std::size_t fine_count = static_cast<std::size_t>(fine_width) * fine_height;
+
+    // Coverage of each channel, drawn with the SVG bounding box `padding` pixels in
+    masks.assign(fine_count * 4 * channel_count, 0);
+    RasterTarget targets[4];
+    int fine_padding = padding * oversampling;
+    for (int channel = 0; channel < channel_count; channel++) {
+        std::uint8_t* pixels = masks.data() + channel * fine_count * 4;
+        targets[channel] = RasterTarget{pixels + (static_cast<std::ptrdiff_t>(fine_padding) * fine_width + fine_padding) * 4,
+                                        fine_width - fine_padding, fine_height - fine_padding,
+                                        static_cast<std::ptrdiff_t>(fine_width) * 4};
+    }
+    real_t scale = static_cast<real_t>(oversampling);
+    if (channels == DistanceFieldChannels::SILHOUETTE) {
+        rasterizer.draw_masks(parts, {&targets[0], &targets[0], &targets[0], &targets[0]}, scale);
+    } else {
+        rasterizer.draw_masks(parts, {&targets[0], &targets[1], &targets[2], &targets[3]}, scale);
+    }
+
+    field.resize(static_cast<std::size_t>(width) * height * channel_count);
+    outside.resize(fine_count);
+    inside.resize(fine_count);
+    for (int channel = 0; channel < channel_count; channel++) {
+        // Fully covered and uncovered pixels are on one side of the edge; partially covered ones are
+        // taken to have an edge through them, as far from the center as coverage is from half
+        const std::uint8_t* alpha = masks.data() + channel * fine_count * 4 + 3;
+        for (std::size_t i = 0; i < fine_count; i++) {
+            std::uint8_t a = alpha[i * 4];
+            if (a == 255) {
+                outside[i] = 0;
+                inside[i] = FAR_AWAY;
+            } else if (a == 0) {
+                outside[i] = FAR_AWAY;
+                inside[i] = 0;
+            } else {
+                double d = 0.5 - a / 255.0;
+                outside[i] = (d > 0 ? d * d : 0);
+                inside[i] = (d < 0 ? d * d : 0);
+            }
+        }
+
+        transform(outside, fine_width, fine_height);
+        transform(inside, fine_width, fine_height);
+
+        // Each pixel's center falls on the middle fine sample, or between the middle two with even oversampling
+        auto signed_distance = [&](int x, int y) {
+            std::size_t i = static_cast<std::size_t>(y) * fine_width + x;
+            return std::sqrt(outside[i]) - std::sqrt(inside[i]);
+        };
+        int low = (oversampling - 1) / 2;
+        int high = oversampling / 2;
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                int fine_x = x * oversampling;
+                int fine_y = y * oversampling;
+                double distance = signed_distance(fine_x + low, fine_y + low);
+                if (low != high) {
+                    distance = 0.25 * (distance + signed_distance(fine_x + high, fine_y + low) +
+                                       signed_distance(fine_x + low, fine_y + high) + signed_distance(fine_x + high, fine_y + high));
+                }
+                distance /= oversampling;
+
+                double value = std::round(255 * (0.5 - distance / (2 * spread)));
+                field[(static_cast<std::size_t>(y) * width + x) * channel_count + channel] =
+                    static_cast<std::uint8_t>(std::clamp(value, 0.0, 255.0));
+            }
+        }
+    }
+}
+
+void DistanceFieldGenerator::transform(std::vector<double>& grid, int width, int height) noexcept {
+    std::size_t length = static_cast<std::size_t>(std::max(width, height));
+    column.resize(length);
+    parabolas.resize(length);
+    boundaries.resize(length + 1);
+
+    // Felzenszwalb and Huttenlocher's 1D transform: the lower envelope of parabolas rooted at each sample
+    auto transform_1d = [&](double* values, std::ptrdiff_t stride, int count) {
+        // Lines that are all zero or all far away are already transformed, and most lines in a field are
+        bool all_zero = true;
+        bool all_far = true;
+        for (int i = 0; i < count; i++) {
+            column[i] = values[i * stride];
+            all_zero = all_zero && column[i] == 0;
+            all_far = all_far && column[i] == FAR_AWAY;
+        }
+        if (all_zero || all_far) {
+            return;
+        }
+
+        int k = 0;
+        parabolas[0] = 0;
+        boundaries[0] = -FAR_AWAY;
+        boundaries[1] = FAR_AWAY;
+        for (int q = 1; q < count; q++) {
+            double s;
+            do {
+                int r = parabolas[k];
+                s = (column[q] - column[r] + static_cast<double>(q) * q - static_cast<double>(r) * r) / (2.0 * (q - r));
+            } while (s <= boundaries[k] && --k >= 0);
+
+            k++;
+            parabolas[k] = q;
+            boundaries[k] = s;
+            boundaries[k + 1] = FAR_AWAY;
+        }
+
+        k = 0;
+        for (int q = 0; q < count; q++) {
+            while (boundaries[k + 1] < q) {
+                k++;
+            }
+            int r = parabolas[k];
+            values[q * stride] = column[r] + static_cast<double>(q - r) * (q - r);
+        }
+    };
+
+    for (int x = 0; x < width; x++) {
+        transform_1d(grid.data() + x, width, height);
+    }
+    for (int y = 0; y < height; y++) {
+        transform_1d(grid.data() + static_cast<std::ptrdiff_t>(y) * width, 1, width);
+    }
+}
+
+}
@@ -1,6 +1,9 @@
 #include "DrawCommands.hpp"
+#include "Glyphs.hpp"
 #include "eternal.hpp"
+#include <algorithm>
 #include <iostream>
+#include <iterator>
 
 namespace milsymbol::_impl {
 
@@ -53,15 +56,86 @@ SVGString DrawInstructionCircle::get_svg_string(const Style& context) const noex
     ss << "stroke-width=\"" << (context.stroke_width_override >= 0 ? context.stroke_width_override : stroke_width) << "\"";
 
     if (stroke_color != ColorType::NONE && stroke_style != StrokeStyle::SOLID) {
-        ss << "stroke-dasharray=\"" << dash_style_to_SVG(stroke_style) << "\" ";
+        ss << " stroke-dasharray=\"" << dash_style_to_SVG(stroke_style) << "\" ";
     }
 
     ss << "/>";
     return ss.str();
 }
 
+const Glyph* find_glyph(char32_t code) noexcept {
+    // Printable ASCII starts the table with no gaps
+    constexpr char32_t FIRST_ASCII = 0x20;
+    if (code >= FIRST_ASCII && code - FIRST_ASCII < std::size(GLYPHS) && GLYPHS[code - FIRST_ASCII].code == code) {
+        return &GLYPHS[code - FIRST_ASCII];
+    }
+
+    const Glyph* it = std::lower_bound(std::begin(GLYPHS), std::end(GLYPHS), code, [](const Glyph& glyph, char32_t code) {
+        return glyph.code < code;
+    });
+    return (it != std::end(GLYPHS) && it->code == code ? it : nullptr);
+}
+
+real_t DrawInstructionText::get_glyph_scale() const noexcept {
+    return font_size / GLYPH_UNITS_PER_EM;
+}
+
+Vector2 DrawInstructionText::get_glyph_origin() const noexcept {
+    if (alignment == TextAlignment::START) {
+        return xy;
+    }
+
+    real_t width = 0;
+    for (const char* c = text; *c != '\0';) {
+        if (const Glyph* glyph = find_glyph(read_code_point(c)); glyph != nullptr) {
+            width += glyph->advance;
+        }
+    }
+    width *= get_glyph_scale();
+    return Vector2{xy.x - (alignment == TextAlignment::END ? width : width / 2), xy.y};
+}
+
 SVGString DrawInstructionText::get_svg_string(const Style& context) const noexcept {
     std::stringstream ss;
+
+    if constexpr (TEXT_AS_PATHS) {
+        // Glyphs are drawn in font units, scaled into place by their group
+        real_t scale = get_glyph_scale();
+        Vector2 origin = get_glyph_origin();
+        ss << "<g transform=\"translate(" << origin.x << " " << origin.y << ") scale(" << scale << ")\" ";
+        ss << "fill=\"" << color_to_string(context.get_color(fill_color)) << "\" ";
+        ss << "stroke=\"" << color_to_string(context.get_color(stroke_color)) << "\" ";
+
+        if (stroke_color != ColorType::NONE) {
+            ss << "stroke-width=\"" << (context.stroke_width_override >= 0 ? context.stroke_width_override : stroke_width) / scale << "\" ";
+
+            if (stroke_style != StrokeStyle::SOLID) {
+                ss << "stroke-dasharray=\"" << DASH_LENGTH / scale << "\" ";
+            }
+        }
+        ss << ">";
+
+        for_each_glyph([&](const Glyph& glyph, real_t x) {
+            if (context.glyph_references != nullptr) {
+                context.glyph_references->insert(glyph.code);
+                ss << "<use href=\"#g" << static_cast<std::uint32_t>(glyph.code) << "\"";
+                if (x != 0) {
+                    ss << " x=\"" << x << "\"";
+                }
+                ss << "/>";
+            } else {
+                ss << "<path ";
+                if (x != 0) {
+                    ss << "transform=\"translate(" << x << ")\" ";
+                }
+                ss << "d=\"" << glyph.d << "\"/>";
+            }
+        });
+
+        ss << "</g>";
+        return ss.str();
+    }
+
     ss << "<text x=\"" << xy.x << "\" y=\"" << xy.y << "\" ";
 
     // Fill and stroke
@@ -127,7 +201,7 @@ SVGString DrawCommand::get_svg_string(const Style& context) const noexcept {
         break;
     case Type::FULL_FRAME: {
         std::stringstream ss;
-        return std::get<AffiliationSet>(variant)[static_cast<int>(context.affiliation)].get_svg_string(context) + SVGString{""};
+        return std::get<AffiliationSet>(variant)[static_cast<int>(get_base_affiliation(context.affiliation))].get_svg_string(context) + SVGString{""};
         break;
     }
     default:
@@ -0,0 +1,555 @@
+#include "Flatten.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace milsymbol::_impl {
+
+namespace {
+
+static constexpr real_t PI = 3.14159265358979323846f;
+static constexpr int MAX_CURVE_SEGMENTS = 256;
+
+/**
+ * @brief Reads numbers, flags and commands out of SVG path data
+ */
+struct PathDataReader {
+    std::string_view d;
+    std::size_t pos = 0;
+
+    /// Skips whitespace and commas
+    inline void skip_separators() noexcept {
+        while (pos < d.size() && (d[pos] == ' ' || d[pos] == ',' || d[pos] == '\t' || d[pos] == '\n' || d[pos] == '\r')) {
+            pos++;
+        }
+    }
+
+    inline bool is_digit(std::size_t i) const noexcept {
+        return i < d.size() && d[i] >= '0' && d[i] <= '9';
+    }
+
+    /// Returns the command letter at the current position, or 0 if there isn't one
+    inline char peek_command() noexcept {
+        skip_separators();
+        if (pos >= d.size()) {
+            return 0;
+        }
+
+        char c = d[pos];
+        bool letter = (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
+        return (letter && c != 'e' && c != 'E') ? c : 0;
+    }
+
+    /// Reads a number, returning whether there was one
+    bool read_number(real_t& out) noexcept {
+        skip_separators();
+        std::size_t start = pos;
+
+        bool negative = false;
+        if (pos < d.size() && (d[pos] == '-' || d[pos] == '+')) {
+            negative = (d[pos] == '-');
+            pos++;
+        }
+
+        double value = 0;
+        bool has_digits = false;
+        while (is_digit(pos)) {
+            value = value * 10 + (d[pos] - '0');
+            has_digits = true;
+            pos++;
+        }
+
+        if (pos < d.size() && d[pos] == '.') {
+            pos++;
+            double place = 0.1;
+            while (is_digit(pos)) {
+                value += (d[pos] - '0') * place;
+                place *= 0.1;
+                has_digits = true;
+                pos++;
+            }
+        }
+
+        if (!has_digits) {
+            pos = start;
+            return false;
+        }
+
+        // Exponent, only if digits follow
+        if (pos < d.size() && (d[pos] == 'e' || d[pos] == 'E')) {
+            std::size_t exponent_start = pos + 1;
+            bool exponent_negative = false;
+            if (exponent_start < d.size() && (d[exponent_start] == '-' || d[exponent_start] == '+')) {
+                exponent_negative = (d[exponent_start] == '-');
+                exponent_start++;
+            }
+
+            if (is_digit(exponent_start)) {
+                pos = exponent_start;
+                int exponent = 0;
+                while (is_digit(pos)) {
+                    exponent = exponent * 10 + (d[pos] - '0');
+                    pos++;
+                }
+                value *= std::pow(10.0, exponent_negative ? -exponent : exponent);
+            }
+        }
+
+        out = static_cast<real_t>(negative ? -value : value);
+        return true;
+    }
+
+    /// Reads a point
+    inline bool read_point(Vector2& out) noexcept {
+        return read_number(out.x) && read_number(out.y);
+    }
+
+    /// Reads an arc flag, which may not be separated from what follows it
+    inline bool read_flag(bool& out) noexcept {
+        skip_separators();
+        if (pos >= d.size() || (d[pos] != '0' && d[pos] != '1')) {
+            return false;
+        }
+        out = (d[pos] == '1');
+        pos++;
+        return true;
+    }
+};
+
+inline real_t length(const Vector2& v) noexcept {
+    return std::sqrt(v.x * v.x + v.y * v.y);
+}
+
+/// Returns how many segments an arc of the given radius and angle needs to stay within the tolerance
+int arc_segments(real_t radius, real_t angle, real_t tolerance) noexcept {
+    if (radius <= tolerance) {
+        return 4;
+    }
+
+    real_t step = 2 * std::acos(1 - tolerance / radius);
+    int segments = static_cast<int>(std::ceil(std::abs(angle) / step));
+    return std::clamp(segments, 1, MAX_CURVE_SEGMENTS);
+}
+
+void flatten_quadratic(const Vector2& p0, const Vector2& p1, const Vector2& p2, real_t tolerance, Polylines& out) noexcept {
+    real_t dd = length(p0 - p1 * 2 + p2);
+    int segments = std::clamp(static_cast<int>(std::ceil(std::sqrt(0.25f * dd / tolerance))), 1, MAX_CURVE_SEGMENTS);
+
+    for (int i = 1; i < segments; i++) {
+        real_t t = static_cast<real_t>(i) / segments;
+        real_t mt = 1 - t;
+        out.line_to(p0 * (mt * mt) + p1 * (2 * mt * t) + p2 * (t * t));
+    }
+    out.line_to(p2);
+}
+
+void flatten_cubic(const Vector2& p0, const Vector2& p1, const Vector2& p2, const Vector2& p3, real_t tolerance, Polylines& out) noexcept {
+    real_t dd = std::max(length(p0 - p1 * 2 + p2), length(p1 - p2 * 2 + p3));
+    int segments = std::clamp(static_cast<int>(std::ceil(std::sqrt(0.75f * dd / tolerance))), 1, MAX_CURVE_SEGMENTS);
+
+    for (int i = 1; i < segments; i++) {
+        real_t t = static_cast<real_t>(i) / segments;
+        real_t mt = 1 - t;
+        out.line_to(p0 * (mt * mt * mt) + p1 * (3 * mt * mt * t) + p2 * (3 * mt * t * t) + p3 * (t * t * t));
+    }
+    out.line_to(p3);
+}
+
+/// Flattens an elliptical arc given in SVG's endpoint form, as in the SVG implementation notes
+void flatten_arc(const Vector2& p0, real_t rx, real_t ry, real_t rotation, bool large_arc, bool sweep,
+                 const Vector2& p1, real_t tolerance, Polylines& out) noexcept {
+    if (p0 == p1) {
+        return;
+    }
+
+    rx = std::abs(rx);
+    ry = std::abs(ry);
+    if (rx == 0 || ry == 0) {
+        out.line_to(p1);
+        return;
+    }
+
+    real_t cos_phi = std::cos(rotation * PI / 180);
+    real_t sin_phi = std::sin(rotation * PI / 180);
+
+    // Endpoints in the ellipse's frame, relative to their midpoint
+    real_t dx = (p0.x - p1.x) / 2;
+    real_t dy = (p0.y - p1.y) / 2;
+    real_t x1 = cos_phi * dx + sin_phi * dy;
+    real_t y1 = -sin_phi * dx + cos_phi * dy;
+
+    // Scale up radii too small to reach
+    real_t lambda = (x1 * x1) / (rx * rx) + (y1 * y1) / (ry * ry);
+    if (lambda > 1) {
+        rx *= std::sqrt(lambda);
+        ry *= std::sqrt(lambda);
+    }
+
+    real_t numerator = rx * rx * ry * ry - rx * rx * y1 * y1 - ry * ry * x1 * x1;
+    real_t denominator = rx * rx * y1 * y1 + ry * ry * x1 * x1;
+    real_t coefficient = std::sqrt(std::max<real_t>(0, numerator / denominator)) * (large_arc == sweep ? -1 : 1);
+    real_t cx1 = coefficient * rx * y1 / ry;
+    real_t cy1 = -coefficient * ry * x1 / rx;
+
+    real_t cx = cos_phi * cx1 - sin_phi * cy1 + (p0.x + p1.x) / 2;
+    real_t cy = sin_phi * cx1 + cos_phi * cy1 + (p0.y + p1.y) / 2;
+
+    real_t start_angle = std::atan2((y1 - cy1) / ry, (x1 - cx1) / rx);
+    real_t end_angle = std::atan2((-y1 - cy1) / ry, (-x1 - cx1) / rx);
+    real_t sweep_angle = end_angle - start_angle;
+    if (!sweep && sweep_angle > 0) {
+        sweep_angle -= 2 * PI;
+    } else if (sweep && sweep_angle < 0) {
+        sweep_angle += 2 * PI;
+    }
+
+    int segments = arc_segments(std::max(rx, ry), sweep_angle, tolerance);
+    for (int i = 1; i < segments; i++) {
+        real_t angle = start_angle + sweep_angle * i / segments;
+        real_t ex = rx * std::cos(angle);
+        real_t ey = ry * std::sin(angle);
+        out.line_to(Vector2{cx + cos_phi * ex - sin_phi * ey, cy + sin_phi * ex + cos_phi * ey});
+    }
+    out.line_to(p1);
+}
+
+/// Adds a closed polygon winding the same way as the stroke segments
+void add_stroke_polygon(const Vector2* points, int count, Polylines& out) noexcept {
+    real_t area = 0;
+    for (int i = 0; i < count; i++) {
+        const Vector2& a = points[i];
+        const Vector2& b = points[(i + 1) % count];
+        area += a.x * b.y - b.x * a.y;
+    }
+
+    if (area > 0) {
+        out.move_to(points[count - 1]);
+        for (int i = count - 2; i >= 0; i--) {
+            out.line_to(points[i]);
+        }
+    } else {
+        out.move_to(points[0]);
+        for (int i = 1; i < count; i++) {
+            out.line_to(points[i]);
+        }
+    }
+    out.close();
+}
+
+/// Adds the rectangle covering a stroked segment with unit direction `u`
+void add_stroke_segment(const Vector2& a, const Vector2& b, const Vector2& u, real_t half_width, Polylines& out) noexcept {
+    Vector2 n{-u.y * half_width, u.x * half_width};
+    out.move_to(a + n);
+    out.line_to(b + n);
+    out.line_to(b - n);
+    out.line_to(a - n);
+    out.close();
+}
+
+/// Adds the join between stroked segments with unit directions `u0` and `u1` meeting at `p`
+void add_stroke_join(const Vector2& p, const Vector2& u0, const Vector2& u1, real_t half_width, Polylines& out) noexcept {
+    real_t cross = u0.x * u1.y - u0.y * u1.x;
+    real_t dot = u0.x * u1.x + u0.y * u1.y;
+    if (std::abs(cross) < 1e-6f) {
+        // Straight on, or doubling back, which butt-capped segments leave without a join
+        return;
+    }
+
+    // The join goes on the outside of the turn
+    real_t side = (cross > 0 ? -half_width : half_width);
+    Vector2 n0{-u0.y * side, u0.x * side};
+    Vector2 n1{-u1.y * side, u1.x * side};
+
+    real_t cos_half = std::sqrt((1 + dot) / 2);
+    if (cos_half * MITER_LIMIT >= 1) {
+        Vector2 bisector = n0 + n1;
+        Vector2 miter = bisector * (half_width / (cos_half * length(bisector)));
+        Vector2 polygon[4] = {p, p + n0, p + miter, p + n1};
+        add_stroke_polygon(polygon, 4, out);
+    } else {
+        Vector2 polygon[3] = {p, p + n0, p + n1};
+        add_stroke_polygon(polygon, 3, out);
+    }
+}
+
+}
+
+BoundingBox Polylines::get_bbox() const noexcept {
+    if (points.empty()) {
+        return BoundingBox{0, 0, 0, 0};
+    }
+
+    BoundingBox bbox{points[0].x, points[0].y, points[0].x, points[0].y};
+    for (const auto& point : points) {
+        bbox.merge(point);
+    }
+    return bbox;
+}
+
+void flatten_path_data(std::string_view d, const Transform& transform, real_t tolerance, Polylines& out) noexcept {
+    PathDataReader reader{d};
+
+    Vector2 current{0, 0}; // Current point, untransformed
+    Vector2 start{0, 0}; // Start of the current subpath, untransformed
+    Vector2 last_control{0, 0}; // Last curve control point, for smooth curves
+    char command = 0;
+    char previous = 0;
+    bool contour_open = false;
+
+    // Drawing after a close continues from the subpath's start
+    auto begin_contour = [&]() {
+        if (!contour_open) {
+            out.move_to(transform.apply(current));
+            contour_open = true;
+        }
+    };
+
+    while (true) {
+        char next = reader.peek_command();
+        if (next != 0) {
+            command = next;
+            reader.pos++;
+        } else {
+            reader.skip_separators();
+            if (reader.pos >= d.size() || command == 0 || command == 'Z' || command == 'z') {
+                break;
+            }
+
+            // Repeated arguments; further pairs after a move are lines
+            if (command == 'M') {
+                command = 'L';
+            } else if (command == 'm') {
+                command = 'l';
+            }
+        }
+
+        bool relative = (command >= 'a' && command <= 'z');
+        Vector2 base = relative ? current : Vector2{0, 0};
+        char upper = relative ? static_cast<char>(command - 'a' + 'A') : command;
+
+        switch (upper) {
+        case 'M': {
+            Vector2 p;
+            if (!reader.read_point(p)) {
+                return;
+            }
+            current = base + p;
+            start = current;
+            out.move_to(transform.apply(current));
+            contour_open = true;
+            break;
+        }
+        case 'L': {
+            Vector2 p;
+            if (!reader.read_point(p)) {
+                return;
+            }
+            begin_contour();
+            current = base + p;
+            out.line_to(transform.apply(current));
+            break;
+        }
+        case 'H': {
+            real_t x;
+            if (!reader.read_number(x)) {
+                return;
+            }
+            begin_contour();
+            current.x = base.x + x;
+            out.line_to(transform.apply(current));
+            break;
+        }
+        case 'V': {
+            real_t y;
+            if (!reader.read_number(y)) {
+                return;
+            }
+            begin_contour();
+            current.y = base.y + y;
+            out.line_to(transform.apply(current));
+            break;
+        }
+        case 'C':
+        case 'S': {
+            Vector2 c1, c2, p;
+            if (upper == 'C') {
+                if (!reader.read_point(c1)) {
+                    return;
+                }
+                c1 = base + c1;
+            } else {
+                c1 = (previous == 'C' || previous == 'S') ? current * 2 - last_control : current;
+            }
+
+            if (!reader.read_point(c2) || !reader.read_point(p)) {
+                return;
+            }
+
+            begin_contour();
+            c2 = base + c2;
+            p = base + p;
+            flatten_cubic(transform.apply(current), transform.apply(c1), transform.apply(c2), transform.apply(p), tolerance, out);
+            last_control = c2;
+            current = p;
+            break;
+        }
+        case 'Q':
+        case 'T': {
+            Vector2 c, p;
+            if (upper == 'Q') {
+                if (!reader.read_point(c)) {
+                    return;
+                }
+                c = base + c;
+            } else {
+                c = (previous == 'Q' || previous == 'T') ? current * 2 - last_control : current;
+            }
+
+            if (!reader.read_point(p)) {
+                return;
+            }
+
+            begin_contour();
+            p = base + p;
+            flatten_quadratic(transform.apply(current), transform.apply(c), transform.apply(p), tolerance, out);
+            last_control = c;
+            current = p;
+            break;
+        }
+        case 'A': {
+            real_t rx, ry, rotation;
+            bool large_arc, sweep;
+            Vector2 p;
+            if (!reader.read_number(rx) || !reader.read_number(ry) || !reader.read_number(rotation) ||
+                !reader.read_flag(large_arc) || !reader.read_flag(sweep) || !reader.read_point(p)) {
+                return;
+            }
+
+            begin_contour();
+            p = base + p;
+            flatten_arc(transform.apply(current), rx * transform.scale, ry * transform.scale, rotation,
+                        large_arc, sweep, transform.apply(p), tolerance, out);
+            current = p;
+            break;
+        }
+        case 'Z':
+            if (contour_open) {
+                out.close();
+                contour_open = false;
+            }
+            current = start;
+            break;
+        default:
+            return;
+        }
+
+        previous = upper;
+    }
+}
+
+void flatten_circle(const Vector2& center, real_t radius, const Transform& transform, real_t tolerance, Polylines& out) noexcept {
+    Vector2 c = transform.apply(center);
+    real_t r = radius * transform.scale;
+    if (r <= 0) {
+        return;
+    }
+
+    int segments = std::max(arc_segments(r, 2 * PI, tolerance), 8);
+    out.move_to(Vector2{c.x + r, c.y});
+    for (int i = 1; i < segments; i++) {
+        real_t angle = 2 * PI * i / segments;
+        out.line_to(Vector2{c.x + r * std::cos(angle), c.y + r * std::sin(angle)});
+    }
+    out.close();
+}
+
+void flatten_text(const DrawInstructionText& text, const Transform& transform, real_t tolerance, Polylines& out) noexcept {
+    real_t scale = text.get_glyph_scale();
+    Vector2 origin = text.get_glyph_origin();
+    text.for_each_glyph([&](const Glyph& glyph, real_t x) {
+        Transform placement{scale, Vector2{origin.x + x * scale, origin.y}};
+        flatten_path_data(glyph.d, transform.after(placement), tolerance, out);
+    });
+}
+
+void dash_polylines(const Polylines& in, real_t dash_length, Polylines& out) noexcept {
+    out.clear();
+    if (dash_length <= 0) {
+        return;
+    }
+
+    for (const auto& contour : in.contours) {
+        bool on = true;
+        real_t remaining = dash_length;
+        out.move_to(in.points[contour.begin]);
+
+        std::size_t segment_count = contour.end - contour.begin - (contour.closed ? 0 : 1);
+        for (std::size_t i = 0; i < segment_count; i++) {
+            const Vector2& a = in.points[contour.begin + i];
+            const Vector2& b = in.points[contour.begin + (i + 1) % (contour.end - contour.begin)];
+
+            real_t segment_length = length(b - a);
+            real_t travelled = 0;
+            while (segment_length - travelled > remaining) {
+                travelled += remaining;
+                Vector2 point = a + (b - a) * (travelled / segment_length);
+                if (on) {
+                    out.line_to(point);
+                } else {
+                    out.move_to(point);
+                }
+                on = !on;
+                remaining = dash_length;
+            }
+
+            remaining -= segment_length - travelled;
+            if (on) {
+                out.line_to(b);
+            }
+        }
+    }
+}
+
+void stroke_polylines(const Polylines& in, real_t width, Polylines& out) noexcept {
+    out.clear();
+    real_t half_width = width / 2;
+
+    for (const auto& contour : in.contours) {
+        const Vector2& first = in.points[contour.begin];
+        Vector2 previous = first;
+        Vector2 previous_direction;
+        Vector2 first_direction;
+        bool has_direction = false;
+
+        auto add_segment = [&](const Vector2& point) {
+            Vector2 delta = point - previous;
+            real_t segment_length = length(delta);
+            if (segment_length < 1e-6f) {
+                return;
+            }
+
+            Vector2 direction = delta * (1 / segment_length);
+            add_stroke_segment(previous, point, direction, half_width, out);
+            if (has_direction) {
+                add_stroke_join(previous, previous_direction, direction, half_width, out);
+            } else {
+                first_direction = direction;
+                has_direction = true;
+            }
+
+            previous_direction = direction;
+            previous = point;
+        };
+
+        for (std::size_t i = contour.begin + 1; i < contour.end; i++) {
+            add_segment(in.points[i]);
+        }
+
+        if (contour.closed && has_direction) {
+            add_segment(first);
+            add_stroke_join(first, previous_direction, first_direction, half_width, out);
+        }
+    }
+}
+
+}
@@ -0,0 +1,239 @@
+#include "HitTest.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <ranges>
+#include <span>
+
+#include "SymbolParts.hpp"
+#include "Stats.hpp"
+
+namespace milsymbol {
+
+namespace {
+
+/// Distance edges are widened by when finding the cells they cross, so rounding can't miss one, in pixels
+constexpr real_t GRID_EPSILON = 1e-3f;
+
+/// Number of symbols each thread keeps the shapes of for Symbol::hit_test
+constexpr std::size_t HIT_CACHE_SIZE = 8;
+
+/// A shape Symbol::hit_test built, with what it was built from
+struct CachedHitShape {
+    Symbol symbol;
+    SymbolStyle style;
+    HitShape shape;
+    bool used = false;
+};
+
+}
+
+template<typename Indices>
+bool HitShape::contains_with(const Vector2& point, const Indices& indices) const noexcept {
+    // Cast a ray to the right, summing the winding of the edges it crosses for each shape in turn
+    std::uint32_t shape = UINT32_MAX;
+    int winding = 0;
+    for (std::uint32_t i : indices) {
+        const Edge& edge = edges[i];
+        if (edge.shape != shape) {
+            if (winding != 0) {
+                return true;
+            }
+            shape = edge.shape;
+            winding = 0;
+        }
+        if (point.y >= edge.y_top && point.y < edge.y_bottom && point.x < edge.x + (point.y - edge.y_top) * edge.slope) {
+            winding += edge.winding;
+        }
+    }
+    return winding != 0;
+}
+
+HitShape HitShape::from_symbol(const Symbol& symbol, const SymbolStyle& style, real_t tolerance) noexcept {
+    HitShape result;
+    _impl::SymbolParts parts = _impl::get_symbol_parts(symbol, style);
+    if (!parts.valid) {
+        return result;
+    }
+
+    // Pixels at the styled icon size, with the symbol anchor at the origin
+    const Vector2& anchor = parts.layout.symbol_anchor;
+    _impl::Transform transform = _impl::Transform{1, Vector2{-anchor.x, -anchor.y}}.after(_impl::get_pixel_transform(parts));
+
+    bool first = true;
+    std::uint32_t shape = 0;
+    auto paint = [&](const _impl::Polylines& polygons, _impl::ColorType, const Color&, bool) {
+        for (const auto& contour : polygons.contours) {
+            std::size_t count = contour.end - contour.begin;
+            if (count < 3) {
+                continue;
+            }
+            for (std::size_t i = 0; i < count; i++) {
+                const Vector2& a = polygons.points[contour.begin + i];
+                const Vector2& b = polygons.points[contour.begin + (i + 1) % count];
+                if (first) {
+                    result.bbox = BoundingBox{a.x, a.y, a.x, a.y};
+                    first = false;
+                }
+                result.bbox.merge(a);
+                result.bbox.merge(b);
+
+                if (a.y == b.y) {
+                    result.horizontal_edges.push_back(HorizontalEdge{std::min(a.x, b.x), std::max(a.x, b.x), a.y});
+                    continue;
+                }
+
+                const Vector2& top = (a.y < b.y ? a : b);
+                const Vector2& bottom = (a.y < b.y ? b : a);
+                result.edges.push_back(Edge{top.x, top.y, bottom.y, (bottom.x - top.x) / (bottom.y - top.y),
+                                            shape, (a.y < b.y ? 1 : -1)});
+            }
+        }
+        shape++;
+    };
+
+    _impl::ShapeFlattener flattener;
+    flattener.tolerance = tolerance;
+    for (const auto* part : {&parts.frame, &parts.amplifiers, &parts.entity, &parts.modifier_1, &parts.modifier_2}) {
+        flattener.flatten(*part, parts.style, transform, paint);
+    }
+
+    return result;
+}
+
+HitShape& HitShape::with_grid(int size) noexcept {
+    cell_starts.clear();
+    cell_edges.clear();
+    cell_inside.clear();
+    grid_size = 0;
+    if (size <= 0 || edges.empty()) {
+        return *this;
+    }
+
+    std::size_t cell_count = static_cast<std::size_t>(size) * size;
+    cell_width = std::max(bbox.width(), GRID_EPSILON) / size;
+    cell_height = std::max(bbox.height(), GRID_EPSILON) / size;
+
+    auto column_of = [&](real_t x) {
+        return std::clamp(static_cast<int>(std::floor((x - bbox.x1) / cell_width)), 0, size - 1);
+    };
+    auto row_of = [&](real_t y) {
+        return std::clamp(static_cast<int>(std::floor((y - bbox.y1) / cell_height)), 0, size - 1);
+    };
+
+    // Find the columns each edge crosses in each row it spans; it can be hit by rays from any cell to
+    // its left in that row, up to its rightmost column
+    struct RowSpan {
+        std::uint32_t edge;
+        int row;
+        int last_column;
+    };
+    std::vector<RowSpan> spans;
+    std::vector<bool> crossed(cell_count, false);
+    for (std::uint32_t i = 0; i < edges.size(); i++) {
+        const Edge& edge = edges[i];
+        int first_row = row_of(edge.y_top - GRID_EPSILON);
+        int last_row = row_of(edge.y_bottom + GRID_EPSILON);
+        for (int row = first_row; row <= last_row; row++) {
+            real_t top = std::max(edge.y_top, bbox.y1 + row * cell_height);
+            real_t bottom = std::min(edge.y_bottom, bbox.y1 + (row + 1) * cell_height);
+            real_t x_top = edge.x + (top - edge.y_top) * edge.slope;
+            real_t x_bottom = edge.x + (bottom - edge.y_top) * edge.slope;
+            int first_column = column_of(std::min(x_top, x_bottom) - GRID_EPSILON);
+            int last_column = column_of(std::max(x_top, x_bottom) + GRID_EPSILON);
+            for (int column = first_column; column <= last_column; column++) {
+                crossed[static_cast<std::size_t>(row) * size + column] = true;
+            }
+            spans.push_back(RowSpan{i, row, last_column});
+        }
+    }
+    for (const auto& edge : horizontal_edges) {
+        for (int row = row_of(edge.y - GRID_EPSILON); row <= row_of(edge.y + GRID_EPSILON); row++) {
+            for (int column = column_of(edge.x1 - GRID_EPSILON); column <= column_of(edge.x2 + GRID_EPSILON); column++) {
+                crossed[static_cast<std::size_t>(row) * size + column] = true;
+            }
+        }
+    }
+    std::stable_sort(spans.begin(), spans.end(), [](const RowSpan& a, const RowSpan& b) {return a.row < b.row;});
+
+    // Crossed cells walk the edges of their row that reach them; the rest are wholly inside or outside
+    cell_starts.reserve(cell_count + 1);
+    cell_inside.resize(cell_count, false);
+    auto row_begin = spans.begin();
+    for (int row = 0; row < size; row++) {
+        auto row_end = std::find_if(row_begin, spans.end(), [row](const RowSpan& span) {return span.row != row;});
+        for (int column = 0; column < size; column++) {
+            std::size_t cell = static_cast<std::size_t>(row) * size + column;
+            cell_starts.push_back(static_cast<std::uint32_t>(cell_edges.size()));
+            if (crossed[cell]) {
+                for (auto span = row_begin; span != row_end; ++span) {
+                    if (span->last_column >= column) {
+                        cell_edges.push_back(span->edge);
+                    }
+                }
+            } else {
+                Vector2 center{bbox.x1 + (column + 0.5f) * cell_width, bbox.y1 + (row + 0.5f) * cell_height};
+                cell_inside[cell] = contains_with(center, std::views::iota(std::uint32_t{0}, static_cast<std::uint32_t>(edges.size())));
+            }
+        }
+        row_begin = row_end;
+    }
+    cell_starts.push_back(static_cast<std::uint32_t>(cell_edges.size()));
+
+    grid_size = size;
+    return *this;
+}
+
+bool HitShape::contains(const Vector2& point) const noexcept {
+    if (!(point.x >= bbox.x1 && point.x <= bbox.x2 && point.y >= bbox.y1 && point.y <= bbox.y2)) {
+        return false;
+    }
+
+    if (grid_size == 0) {
+        return contains_with(point, std::views::iota(std::uint32_t{0}, static_cast<std::uint32_t>(edges.size())));
+    }
+
+    int column = std::min(static_cast<int>((point.x - bbox.x1) / cell_width), grid_size - 1);
+    int row = std::min(static_cast<int>((point.y - bbox.y1) / cell_height), grid_size - 1);
+    std::size_t cell = static_cast<std::size_t>(row) * grid_size + column;
+    std::uint32_t begin = cell_starts[cell];
+    std::uint32_t end = cell_starts[cell + 1];
+    if (begin == end) {
+        return cell_inside[cell];
+    }
+    return contains_with(point, std::span<const std::uint32_t>{cell_edges.data() + begin, end - begin});
+}
+
+std::size_t HitShape::get_memory_size() const noexcept {
+    return edges.size() * sizeof(Edge) + horizontal_edges.size() * sizeof(HorizontalEdge) + (cell_starts.size() + cell_edges.size()) * sizeof(std::uint32_t) + cell_inside.size() / 8;
+}
+
+bool Symbol::hit_test(const Vector2& point, const SymbolStyle& style) const noexcept {
+    thread_local CachedHitShape cache[HIT_CACHE_SIZE];
+    thread_local std::size_t next_slot = 0;
+
+    RenderStats* stats = get_render_stats();
+    for (const auto& entry : cache) {
+        if (entry.used && entry.symbol == *this && entry.style == style) {
+            if (stats != nullptr) {
+                stats->count(RenderCache::HIT_TEST, true);
+            }
+            return entry.shape.contains(point);
+        }
+    }
+    if (stats != nullptr) {
+        stats->count(RenderCache::HIT_TEST, false);
+    }
+
+    // Replace the oldest shape
+    CachedHitShape& entry = cache[next_slot];
+    next_slot = (next_slot + 1) % HIT_CACHE_SIZE;
+    entry.symbol = *this;
+    entry.style = style;
+    entry.shape = HitShape::from_symbol(*this, style);
+    entry.shape.with_grid(HitShape::DEFAULT_GRID_SIZE);
+    entry.used = true;
+    return entry.shape.contains(point);
+}
+
+}
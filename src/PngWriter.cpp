@@ -0,0 +1,465 @@
+#include "PngWriter.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace milsymbol {
+
+namespace {
+
+/// Size of the deflate match window
+constexpr std::size_t WINDOW_SIZE = 32768;
+
+/// Size at which compressed data is written out as an IDAT chunk
+constexpr std::size_t CHUNK_SIZE = 65536;
+
+/// Largest stored deflate block
+constexpr std::size_t STORED_BLOCK_SIZE = 65535;
+
+constexpr int HASH_BITS = 14;
+constexpr int MIN_MATCH = 3;
+constexpr int MAX_MATCH = 258;
+
+constexpr std::uint8_t PNG_SIGNATURE[8] = {137, 'P', 'N', 'G', '\r', '\n', 26, '\n'};
+
+constexpr std::array<std::uint32_t, 256> CRC_TABLE = [] {
+    std::array<std::uint32_t, 256> table{};
+    for (std::uint32_t n = 0; n < 256; n++) {
+        std::uint32_t c = n;
+        for (int k = 0; k < 8; k++) {
+            c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        }
+        table[n] = c;
+    }
+    return table;
+}();
+
+inline std::uint32_t update_crc(std::uint32_t crc, const std::uint8_t* data, std::size_t size) noexcept {
+    for (std::size_t i = 0; i < size; i++) {
+        crc = CRC_TABLE[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+inline void put_u32(std::uint8_t* out, std::uint32_t value) noexcept {
+    out[0] = static_cast<std::uint8_t>(value >> 24);
+    out[1] = static_cast<std::uint8_t>(value >> 16);
+    out[2] = static_cast<std::uint8_t>(value >> 8);
+    out[3] = static_cast<std::uint8_t>(value);
+}
+
+constexpr std::uint32_t reverse_bits(std::uint32_t code, int length) noexcept {
+    std::uint32_t reversed = 0;
+    for (int i = 0; i < length; i++) {
+        reversed = (reversed << 1) | ((code >> i) & 1);
+    }
+    return reversed;
+}
+
+/// A Huffman code, bit-reversed to be written least significant bit first
+struct Code {
+    std::uint16_t bits;
+    std::uint8_t length;
+};
+
+/// The fixed literal/length codes of RFC 1951 section 3.2.6
+constexpr std::array<Code, 288> LITERAL_CODES = [] {
+    std::array<Code, 288> codes{};
+    for (std::uint32_t symbol = 0; symbol < 288; symbol++) {
+        if (symbol < 144) {
+            codes[symbol] = Code{static_cast<std::uint16_t>(reverse_bits(0x30 + symbol, 8)), 8};
+        } else if (symbol < 256) {
+            codes[symbol] = Code{static_cast<std::uint16_t>(reverse_bits(0x190 + symbol - 144, 9)), 9};
+        } else if (symbol < 280) {
+            codes[symbol] = Code{static_cast<std::uint16_t>(reverse_bits(symbol - 256, 7)), 7};
+        } else {
+            codes[symbol] = Code{static_cast<std::uint16_t>(reverse_bits(0xC0 + symbol - 280, 8)), 8};
+        }
+    }
+    return codes;
+}();
+
+constexpr std::uint16_t LENGTH_BASES[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59,
+                                            67, 83, 99, 115, 131, 163, 195, 227, 258};
+constexpr std::uint8_t LENGTH_EXTRA_BITS[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+                                                4, 4, 4, 4, 5, 5, 5, 5, 0};
+constexpr std::uint16_t DISTANCE_BASES[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769,
+                                              1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+constexpr std::uint8_t DISTANCE_EXTRA_BITS[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8,
+                                                  9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+/// Length code index for each match length minus 3
+constexpr std::array<std::uint8_t, 256> LENGTH_CODES = [] {
+    std::array<std::uint8_t, 256> codes{};
+    for (int code = 0, length = 3; code < 29; code++) {
+        int end = (code + 1 < 29 ? LENGTH_BASES[code + 1] : 259);
+        for (; length < end && length <= 258; length++) {
+            codes[length - 3] = static_cast<std::uint8_t>(code);
+        }
+    }
+    codes[255] = 28;
+    return codes;
+}();
+
+/// Distance code for each distance minus 1 below 256, then for each (distance - 1) / 128 from 256 on, as in zlib
+constexpr std::array<std::uint8_t, 512> DISTANCE_CODES = [] {
+    std::array<std::uint8_t, 512> codes{};
+    for (int code = 0; code < 30; code++) {
+        int end = (code + 1 < 30 ? DISTANCE_BASES[code + 1] : 32769);
+        for (int distance = DISTANCE_BASES[code]; distance < end; distance++) {
+            if (distance <= 256) {
+                codes[distance - 1] = static_cast<std::uint8_t>(code);
+            } else {
+                codes[256 + ((distance - 1) >> 7)] = static_cast<std::uint8_t>(code);
+            }
+        }
+    }
+    return codes;
+}();
+
+inline int paeth(int a, int b, int c) noexcept {
+    int p = a + b - c;
+    int pa = std::abs(p - a);
+    int pb = std::abs(p - b);
+    int pc = std::abs(p - c);
+    if (pa <= pb && pa <= pc) {
+        return a;
+    }
+    return (pb <= pc ? b : c);
+}
+
+inline std::uint32_t hash3(const std::uint8_t* data) noexcept {
+    std::uint32_t value = (static_cast<std::uint32_t>(data[0]) << 16) | (static_cast<std::uint32_t>(data[1]) << 8) | data[2];
+    return (value * 2654435761u) >> (32 - HASH_BITS);
+}
+
+}
+
+PngWriter::PngWriter(std::ostream& out, int width, int height, int channels) noexcept :
+    out(&out), width(width), height(height), channels(std::clamp(channels, 1, 4)) {}
+
+PngWriter::PngWriter(int fd, int width, int height, int channels) noexcept :
+    fd(fd), width(width), height(height), channels(std::clamp(channels, 1, 4)) {}
+
+std::size_t PngWriter::get_buffer_size() const noexcept {
+    return previous.capacity() + current.capacity() + filtered.capacity() + trial.capacity() +
+        pending.capacity() + history.capacity() + hash_heads.capacity() * sizeof(std::int32_t);
+}
+
+void PngWriter::write_bytes(const std::uint8_t* data, std::size_t size) noexcept {
+    if (!ok || size == 0) {
+        return;
+    }
+
+    if (out != nullptr) {
+        out->write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size));
+        ok = out->good();
+        return;
+    }
+
+    while (size > 0) {
+#if defined(_WIN32)
+        int written = _write(fd, data, static_cast<unsigned>(std::min<std::size_t>(size, 1 << 30)));
+#else
+        ssize_t written = ::write(fd, data, size);
+#endif
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            ok = false;
+            return;
+        }
+        data += written;
+        size -= static_cast<std::size_t>(written);
+    }
+}
+
+void PngWriter::write_chunk(const char type[4], const std::uint8_t* data, std::size_t size) noexcept {
+    std::uint8_t header[8];
+    put_u32(header, static_cast<std::uint32_t>(size));
+    std::memcpy(header + 4, type, 4);
+
+    std::uint32_t crc = update_crc(0xFFFFFFFFu, header + 4, 4);
+    crc = update_crc(crc, data, size) ^ 0xFFFFFFFFu;
+    std::uint8_t footer[4];
+    put_u32(footer, crc);
+
+    write_bytes(header, 8);
+    write_bytes(data, size);
+    write_bytes(footer, 4);
+}
+
+void PngWriter::flush_pending(bool all) noexcept {
+    if (pending.size() >= CHUNK_SIZE || (all && !pending.empty())) {
+        write_chunk("IDAT", pending.data(), pending.size());
+        pending.clear();
+    }
+}
+
+void PngWriter::start() noexcept {
+    row_size = static_cast<std::size_t>(width) * channels;
+    previous.assign(row_size, 0);
+    current.resize(row_size);
+    filtered.resize(row_size + 1);
+    trial.resize(row_size + 1);
+    pending.reserve(CHUNK_SIZE + 1024);
+    if (compression == PngCompression::FAST) {
+        history.reserve(2 * WINDOW_SIZE);
+        hash_heads.assign(std::size_t{1} << HASH_BITS, -1);
+    } else {
+        history.reserve(STORED_BLOCK_SIZE);
+    }
+
+    write_bytes(PNG_SIGNATURE, sizeof(PNG_SIGNATURE));
+
+    static constexpr std::uint8_t COLOR_TYPES[5] = {0, 0, 4, 2, 6};
+    std::uint8_t header[13];
+    put_u32(header, static_cast<std::uint32_t>(width));
+    put_u32(header + 4, static_cast<std::uint32_t>(height));
+    header[8] = 8; // Bit depth
+    header[9] = COLOR_TYPES[channels];
+    header[10] = 0; // Deflate
+    header[11] = 0; // Adaptive filtering
+    header[12] = 0; // No interlacing
+    write_chunk("IHDR", header, sizeof(header));
+
+    // zlib header for deflate with a 32 KiB window at the fastest level
+    pending.push_back(0x78);
+    pending.push_back(0x01);
+    if (compression == PngCompression::FAST) {
+        // One fixed Huffman block runs until the end
+        write_bits(0, 1);
+        write_bits(1, 2);
+    }
+}
+
+bool PngWriter::write_row(const std::uint8_t* row) noexcept {
+    if (finished || rows_written >= height) {
+        return false;
+    }
+    if (rows_written == 0) {
+        start();
+    }
+
+    std::memcpy(current.data(), row, row_size);
+    if (premultiplied && (channels == 2 || channels == 4)) {
+        for (std::size_t i = 0; i < row_size; i += channels) {
+            int alpha = current[i + channels - 1];
+            for (int c = 0; c < channels - 1; c++) {
+                current[i + c] = (alpha == 0 ? 0 :
+                    static_cast<std::uint8_t>(std::min(255, (current[i + c] * 255 + alpha / 2) / alpha)));
+            }
+        }
+    }
+
+    filter_row();
+    compress(filtered.data(), filtered.size());
+    flush_pending(false);
+
+    std::swap(previous, current);
+    rows_written++;
+    return ok;
+}
+
+void PngWriter::filter_row() noexcept {
+    auto apply = [&](PngFilter type, std::uint8_t* out) {
+        out[0] = static_cast<std::uint8_t>(type);
+        const std::uint8_t* row = current.data();
+        const std::uint8_t* up = previous.data();
+        std::size_t bpp = static_cast<std::size_t>(channels);
+        for (std::size_t i = 0; i < row_size; i++) {
+            int left = (i >= bpp ? row[i - bpp] : 0);
+            int up_left = (i >= bpp ? up[i - bpp] : 0);
+            int predictor = 0;
+            switch (type) {
+            case PngFilter::SUB: predictor = left; break;
+            case PngFilter::UP: predictor = up[i]; break;
+            case PngFilter::AVERAGE: predictor = (left + up[i]) / 2; break;
+            case PngFilter::PAETH: predictor = paeth(left, up[i], up_left); break;
+            default: break;
+            }
+            out[i + 1] = static_cast<std::uint8_t>(row[i] - predictor);
+        }
+    };
+
+    if (filter != PngFilter::ADAPTIVE) {
+        apply(filter, filtered.data());
+        return;
+    }
+
+    // The filter whose output is closest to zero, read as signed bytes, usually compresses best
+    auto cost = [&](const std::uint8_t* out) {
+        std::uint64_t sum = 0;
+        for (std::size_t i = 1; i <= row_size; i++) {
+            sum += static_cast<std::uint64_t>(std::abs(static_cast<int>(static_cast<std::int8_t>(out[i]))));
+        }
+        return sum;
+    };
+
+    apply(PngFilter::NONE, filtered.data());
+    std::uint64_t best = cost(filtered.data());
+    for (auto type : {PngFilter::SUB, PngFilter::UP, PngFilter::AVERAGE, PngFilter::PAETH}) {
+        if (best == 0) {
+            break;
+        }
+        apply(type, trial.data());
+        std::uint64_t trial_cost = cost(trial.data());
+        if (trial_cost < best) {
+            best = trial_cost;
+            std::swap(filtered, trial);
+        }
+    }
+}
+
+void PngWriter::compress(const std::uint8_t* data, std::size_t size) noexcept {
+    // Adler-32 of everything compressed, in runs short enough not to overflow
+    for (std::size_t offset = 0; offset < size;) {
+        std::size_t run = std::min<std::size_t>(size - offset, 5552);
+        for (std::size_t i = 0; i < run; i++) {
+            adler_a += data[offset + i];
+            adler_b += adler_a;
+        }
+        adler_a %= 65521;
+        adler_b %= 65521;
+        offset += run;
+    }
+
+    if (compression == PngCompression::STORED) {
+        while (size > 0) {
+            std::size_t run = std::min(size, STORED_BLOCK_SIZE - history.size());
+            history.insert(history.end(), data, data + run);
+            data += run;
+            size -= run;
+            if (history.size() == STORED_BLOCK_SIZE) {
+                write_stored_block(false);
+            }
+        }
+        return;
+    }
+
+    while (size > 0) {
+        // Keep the last window of data for matches, sliding it to the front when the buffer fills
+        if (history.size() >= 2 * WINDOW_SIZE) {
+            std::size_t shift = history.size() - WINDOW_SIZE;
+            std::memmove(history.data(), history.data() + shift, WINDOW_SIZE);
+            history.resize(WINDOW_SIZE);
+            for (auto& head : hash_heads) {
+                head = (head >= static_cast<std::int32_t>(shift) ? head - static_cast<std::int32_t>(shift) : -1);
+            }
+        }
+
+        std::size_t run = std::min(size, 2 * WINDOW_SIZE - history.size());
+        std::size_t begin = history.size();
+        history.insert(history.end(), data, data + run);
+        compress_window(begin, history.size());
+        data += run;
+        size -= run;
+    }
+}
+
+void PngWriter::compress_window(std::size_t begin, std::size_t end) noexcept {
+    const std::uint8_t* window = history.data();
+
+    std::size_t position = begin;
+    while (position < end) {
+        if (position + MIN_MATCH <= end) {
+            std::uint32_t hash = hash3(window + position);
+            std::int32_t candidate = hash_heads[hash];
+            hash_heads[hash] = static_cast<std::int32_t>(position);
+
+            if (candidate >= 0 && position - candidate <= WINDOW_SIZE &&
+                std::memcmp(window + candidate, window + position, MIN_MATCH) == 0) {
+                std::size_t limit = std::min<std::size_t>(MAX_MATCH, end - position);
+                std::size_t length = MIN_MATCH;
+                while (length < limit && window[candidate + length] == window[position + length]) {
+                    length++;
+                }
+                std::size_t distance = position - candidate;
+
+                int length_code = LENGTH_CODES[length - MIN_MATCH];
+                const Code& code = LITERAL_CODES[257 + length_code];
+                write_bits(code.bits, code.length);
+                write_bits(static_cast<std::uint32_t>(length - LENGTH_BASES[length_code]), LENGTH_EXTRA_BITS[length_code]);
+
+                int distance_code = (distance <= 256 ? DISTANCE_CODES[distance - 1] : DISTANCE_CODES[256 + ((distance - 1) >> 7)]);
+                write_bits(reverse_bits(static_cast<std::uint32_t>(distance_code), 5), 5);
+                write_bits(static_cast<std::uint32_t>(distance - DISTANCE_BASES[distance_code]), DISTANCE_EXTRA_BITS[distance_code]);
+
+                position += length;
+                continue;
+            }
+        }
+
+        const Code& code = LITERAL_CODES[window[position]];
+        write_bits(code.bits, code.length);
+        position++;
+    }
+}
+
+void PngWriter::write_stored_block(bool last) noexcept {
+    std::uint16_t length = static_cast<std::uint16_t>(history.size());
+    pending.push_back(last ? 1 : 0);
+    pending.push_back(static_cast<std::uint8_t>(length));
+    pending.push_back(static_cast<std::uint8_t>(length >> 8));
+    pending.push_back(static_cast<std::uint8_t>(~length));
+    pending.push_back(static_cast<std::uint8_t>(~length >> 8));
+    pending.insert(pending.end(), history.begin(), history.end());
+    history.clear();
+    flush_pending(false);
+}
+
+bool PngWriter::finish() noexcept {
+    if (finished) {
+        return ok;
+    }
+
+    bool complete = (rows_written == height);
+    if (rows_written < height) {
+        std::vector<std::uint8_t> empty(static_cast<std::size_t>(width) * channels, 0);
+        while (rows_written < height) {
+            write_row(empty.data());
+        }
+    }
+    if (height == 0) {
+        start();
+    }
+
+    if (compression == PngCompression::FAST) {
+        // End the block, then an empty final one, padded to a byte
+        const Code& end_of_block = LITERAL_CODES[256];
+        write_bits(end_of_block.bits, end_of_block.length);
+        write_bits(1, 1);
+        write_bits(1, 2);
+        write_bits(end_of_block.bits, end_of_block.length);
+        if (bit_count > 0) {
+            write_bits(0, 8 - bit_count);
+        }
+    } else {
+        write_stored_block(true);
+    }
+
+    std::uint8_t adler[4];
+    put_u32(adler, (adler_b << 16) | adler_a);
+    pending.insert(pending.end(), adler, adler + 4);
+    flush_pending(true);
+    write_chunk("IEND", nullptr, 0);
+
+    if (out != nullptr) {
+        out->flush();
+        ok = ok && out->good();
+    }
+    finished = true;
+    return ok && complete;
+}
+
+}
@@ -0,0 +1,295 @@
+#include "RasterKernels.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define MILSYMBOL_RASTER_X86 1
+#include <immintrin.h>
+#endif
+
+namespace milsymbol::_impl {
+
+namespace {
+
+/*
+ * Scalar reference kernels
+ */
+
+/// Divides by 255 with rounding, for values up to 255 * 255
+inline std::uint32_t div_255(std::uint32_t value) noexcept {
+    value += 128;
+    return (value + (value >> 8)) >> 8;
+}
+
+/// Converts an accumulated sum to 8-bit coverage
+inline std::uint8_t to_coverage(std::int32_t sum) noexcept {
+    std::int32_t area = std::min(std::abs(sum), COVERAGE_ONE);
+    return static_cast<std::uint8_t>((area * 255 + COVERAGE_ONE / 2) >> 16);
+}
+
+void accumulate_coverage_scalar(std::int32_t* accumulation, std::uint8_t* coverage, int count) noexcept {
+    std::int32_t sum = 0;
+    for (int i = 0; i < count; i++) {
+        sum += accumulation[i];
+        accumulation[i] = 0;
+        coverage[i] = to_coverage(sum);
+    }
+}
+
+/// Composites one pixel; zero and full coverage reduce to keeping the pixel and replacing it
+inline void composite_pixel(std::uint8_t* pixel, std::uint32_t alpha, const std::uint8_t color[4]) noexcept {
+    std::uint32_t inverse = 255 - alpha;
+    for (int channel = 0; channel < 4; channel++) {
+        pixel[channel] = static_cast<std::uint8_t>(div_255(color[channel] * alpha + pixel[channel] * inverse));
+    }
+}
+
+void composite_span_scalar(std::uint8_t* pixels, const std::uint8_t* coverage, int count, const std::uint8_t color[4]) noexcept {
+    for (int i = 0; i < count; i++, pixels += 4) {
+        std::uint32_t alpha = coverage[i];
+        if (alpha == 0) {
+            continue;
+        }
+        if (alpha == 255) {
+            std::memcpy(pixels, color, 4);
+            continue;
+        }
+        composite_pixel(pixels, alpha, color);
+    }
+}
+
+#ifdef MILSYMBOL_RASTER_X86
+
+/*
+ * SSE2 kernels, four pixels at a time
+ */
+
+__attribute__((target("sse2")))
+void accumulate_coverage_sse2(std::int32_t* accumulation, std::uint8_t* coverage, int count) noexcept {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi32(COVERAGE_ONE);
+    const __m128i half = _mm_set1_epi32(COVERAGE_ONE / 2);
+    __m128i carry = zero;
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(accumulation + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(accumulation + i), zero);
+
+        // Prefix sum within the vector, plus the sum so far
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+        x = _mm_add_epi32(x, carry);
+        carry = _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3));
+
+        // Absolute value, clamped to one pixel, without SSSE3 or SSE4.1
+        __m128i sign = _mm_srai_epi32(x, 31);
+        __m128i area = _mm_sub_epi32(_mm_xor_si128(x, sign), sign);
+        __m128i over = _mm_cmpgt_epi32(area, one);
+        area = _mm_or_si128(_mm_andnot_si128(over, area), _mm_and_si128(over, one));
+
+        // area * 255, rounded down to 0-255
+        __m128i scaled = _mm_srli_epi32(_mm_add_epi32(_mm_sub_epi32(_mm_slli_epi32(area, 8), area), half), 16);
+        __m128i bytes = _mm_packus_epi16(_mm_packs_epi32(scaled, zero), zero);
+
+        std::int32_t packed = _mm_cvtsi128_si32(bytes);
+        std::memcpy(coverage + i, &packed, 4);
+    }
+
+    std::int32_t sum = _mm_cvtsi128_si32(carry);
+    for (; i < count; i++) {
+        sum += accumulation[i];
+        accumulation[i] = 0;
+        coverage[i] = to_coverage(sum);
+    }
+}
+
+/// Computes (color * alpha + pixel * (255 - alpha)) / 255 on 16-bit lanes, two pixels per register
+__attribute__((target("sse2")))
+inline __m128i blend_16_sse2(__m128i pixels, __m128i alpha, __m128i color) noexcept {
+    const __m128i max = _mm_set1_epi16(255);
+    const __m128i rounding = _mm_set1_epi16(128);
+
+    __m128i value = _mm_add_epi16(_mm_mullo_epi16(color, alpha), _mm_mullo_epi16(pixels, _mm_sub_epi16(max, alpha)));
+    value = _mm_add_epi16(value, rounding);
+    return _mm_srli_epi16(_mm_add_epi16(value, _mm_srli_epi16(value, 8)), 8);
+}
+
+__attribute__((target("sse2")))
+void composite_span_sse2(std::uint8_t* pixels, const std::uint8_t* coverage, int count, const std::uint8_t color[4]) noexcept {
+    const __m128i zero = _mm_setzero_si128();
+    std::int32_t packed_color;
+    std::memcpy(&packed_color, color, 4);
+    const __m128i color_16 = _mm_unpacklo_epi8(_mm_set1_epi32(packed_color), zero);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        std::int32_t packed_coverage;
+        std::memcpy(&packed_coverage, coverage + i, 4);
+        if (packed_coverage == 0) {
+            continue;
+        }
+
+        std::uint8_t* span = pixels + i * 4;
+        if (packed_coverage == -1) {
+            __m128i fill = _mm_set1_epi32(packed_color);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(span), fill);
+            continue;
+        }
+
+        // Spread each pixel's coverage over its four channels
+        __m128i alpha = _mm_cvtsi32_si128(packed_coverage);
+        alpha = _mm_unpacklo_epi8(alpha, alpha);
+        alpha = _mm_unpacklo_epi16(alpha, alpha);
+
+        __m128i destination = _mm_loadu_si128(reinterpret_cast<const __m128i*>(span));
+        __m128i low = blend_16_sse2(_mm_unpacklo_epi8(destination, zero), _mm_unpacklo_epi8(alpha, zero), color_16);
+        __m128i high = blend_16_sse2(_mm_unpackhi_epi8(destination, zero), _mm_unpackhi_epi8(alpha, zero), color_16);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(span), _mm_packus_epi16(low, high));
+    }
+
+    composite_span_scalar(pixels + i * 4, coverage + i, count - i, color);
+}
+
+/*
+ * AVX2 kernels, eight pixels at a time
+ */
+
+__attribute__((target("avx2")))
+void accumulate_coverage_avx2(std::int32_t* accumulation, std::uint8_t* coverage, int count) noexcept {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi32(COVERAGE_ONE);
+    const __m256i half = _mm256_set1_epi32(COVERAGE_ONE / 2);
+    const __m256i last_lane = _mm256_set1_epi32(7);
+    __m256i carry = zero;
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(accumulation + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(accumulation + i), zero);
+
+        // Prefix sum within each 128-bit half, then carry the low half's total into the high half
+        x = _mm256_add_epi32(x, _mm256_slli_si256(x, 4));
+        x = _mm256_add_epi32(x, _mm256_slli_si256(x, 8));
+        __m256i low_total = _mm256_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3));
+        x = _mm256_add_epi32(x, _mm256_permute2x128_si256(low_total, low_total, 0x08));
+        x = _mm256_add_epi32(x, carry);
+        carry = _mm256_permutevar8x32_epi32(x, last_lane);
+
+        __m256i area = _mm256_min_epi32(_mm256_abs_epi32(x), one);
+        __m256i scaled = _mm256_srli_epi32(_mm256_add_epi32(_mm256_sub_epi32(_mm256_slli_epi32(area, 8), area), half), 16);
+
+        __m128i words = _mm_packs_epi32(_mm256_castsi256_si128(scaled), _mm256_extracti128_si256(scaled, 1));
+        __m128i bytes = _mm_packus_epi16(words, words);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(coverage + i), bytes);
+    }
+
+    std::int32_t sum = _mm_cvtsi128_si32(_mm256_castsi256_si128(carry));
+    for (; i < count; i++) {
+        sum += accumulation[i];
+        accumulation[i] = 0;
+        coverage[i] = to_coverage(sum);
+    }
+}
+
+/// Computes (color * alpha + pixel * (255 - alpha)) / 255 on 16-bit lanes, four pixels per register
+__attribute__((target("avx2")))
+inline __m256i blend_16_avx2(__m256i pixels, __m256i alpha, __m256i color) noexcept {
+    const __m256i max = _mm256_set1_epi16(255);
+    const __m256i rounding = _mm256_set1_epi16(128);
+
+    __m256i value = _mm256_add_epi16(_mm256_mullo_epi16(color, alpha), _mm256_mullo_epi16(pixels, _mm256_sub_epi16(max, alpha)));
+    value = _mm256_add_epi16(value, rounding);
+    return _mm256_srli_epi16(_mm256_add_epi16(value, _mm256_srli_epi16(value, 8)), 8);
+}
+
+__attribute__((target("avx2")))
+void composite_span_avx2(std::uint8_t* pixels, const std::uint8_t* coverage, int count, const std::uint8_t color[4]) noexcept {
+    std::int32_t packed_color;
+    std::memcpy(&packed_color, color, 4);
+    const __m256i color_16 = _mm256_cvtepu8_epi16(_mm_set1_epi32(packed_color));
+    const __m128i spread = _mm_setr_epi8(0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3);
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        std::int64_t packed_coverage;
+        std::memcpy(&packed_coverage, coverage + i, 8);
+        if (packed_coverage == 0) {
+            continue;
+        }
+
+        std::uint8_t* span = pixels + i * 4;
+        if (packed_coverage == -1) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(span), _mm256_set1_epi32(packed_color));
+            continue;
+        }
+
+        // Spread each pixel's coverage over its four channels, four pixels per half
+        __m128i alpha_bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(coverage + i));
+        __m256i alpha_low = _mm256_cvtepu8_epi16(_mm_shuffle_epi8(alpha_bytes, spread));
+        __m256i alpha_high = _mm256_cvtepu8_epi16(_mm_shuffle_epi8(_mm_srli_si128(alpha_bytes, 4), spread));
+
+        __m128i destination_low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(span));
+        __m128i destination_high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(span + 16));
+        __m256i low = blend_16_avx2(_mm256_cvtepu8_epi16(destination_low), alpha_low, color_16);
+        __m256i high = blend_16_avx2(_mm256_cvtepu8_epi16(destination_high), alpha_high, color_16);
+
+        // Pack each half back to bytes, undoing the per-lane interleave of packus
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(low, high), _MM_SHUFFLE(3, 1, 2, 0));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(span), packed);
+    }
+
+    composite_span_scalar(pixels + i * 4, coverage + i, count - i, color);
+}
+
+#endif
+
+static constexpr RasterKernels SCALAR_KERNELS{accumulate_coverage_scalar, composite_span_scalar, RasterInstructionSet::SCALAR};
+
+#ifdef MILSYMBOL_RASTER_X86
+static constexpr RasterKernels SSE2_KERNELS{accumulate_coverage_sse2, composite_span_sse2, RasterInstructionSet::SSE2};
+static constexpr RasterKernels AVX2_KERNELS{accumulate_coverage_avx2, composite_span_avx2, RasterInstructionSet::AVX2};
+#endif
+
+}
+
+bool is_supported(RasterInstructionSet instruction_set) noexcept {
+    switch (instruction_set) {
+    case RasterInstructionSet::AUTOMATIC:
+    case RasterInstructionSet::SCALAR:
+        return true;
+#ifdef MILSYMBOL_RASTER_X86
+    case RasterInstructionSet::SSE2:
+        return __builtin_cpu_supports("sse2");
+    case RasterInstructionSet::AVX2:
+        return __builtin_cpu_supports("avx2");
+#endif
+    default:
+        return false;
+    }
+}
+
+const RasterKernels& get_raster_kernels(RasterInstructionSet instruction_set) noexcept {
+#ifdef MILSYMBOL_RASTER_X86
+    static const bool has_avx2 = is_supported(RasterInstructionSet::AVX2);
+    static const bool has_sse2 = is_supported(RasterInstructionSet::SSE2);
+
+    switch (instruction_set) {
+    case RasterInstructionSet::SCALAR:
+        return SCALAR_KERNELS;
+    case RasterInstructionSet::SSE2:
+        return has_sse2 ? SSE2_KERNELS : SCALAR_KERNELS;
+    default:
+        if (has_avx2) {
+            return AVX2_KERNELS;
+        }
+        return has_sse2 ? SSE2_KERNELS : SCALAR_KERNELS;
+    }
+#else
+    return SCALAR_KERNELS;
+#endif
+}
+
+}
@@ -0,0 +1,324 @@
+#include "Rasterizer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <thread>
+
+#include "SymbolParts.hpp"
+
+namespace milsymbol {
+
+namespace {
+
+using _impl::COVERAGE_ONE;
+
+inline std::int32_t to_fixed(float area) noexcept {
+    return static_cast<std::int32_t>(std::lrint(area * COVERAGE_ONE));
+}
+
+/**
+ * @brief Adds the signed area a line covers in each pixel to the accumulation buffer.
+ *
+ * Each pixel gets the area the line covers to its right; the running sum along a row is then the
+ * winding-weighted coverage. Contributions are fixed-point and each row's always sums to exactly the
+ * line's height in that row, so rows sum back to zero. X must be within [0, width]; rows outside
+ * [0, height) are skipped.
+ */
+void accumulate_line(std::int32_t* accumulation, int row_width, int width, int height, Vector2 p0, Vector2 p1) noexcept {
+    if (p0.y == p1.y) {
+        return;
+    }
+
+    float direction = 1;
+    if (p0.y > p1.y) {
+        std::swap(p0, p1);
+        direction = -1;
+    }
+
+    float dxdy = (p1.x - p0.x) / (p1.y - p0.y);
+    float x = p0.x;
+    int y_start = static_cast<int>(std::floor(p0.y));
+    if (y_start < 0) {
+        x -= p0.y * dxdy;
+        y_start = 0;
+    }
+    int y_end = std::min(height, static_cast<int>(std::ceil(p1.y)));
+
+    for (int y = y_start; y < y_end; y++) {
+        std::int32_t* row = accumulation + static_cast<std::ptrdiff_t>(y) * row_width;
+        float dy = std::min(static_cast<float>(y + 1), p1.y) - std::max(static_cast<float>(y), p0.y);
+        float x_next = x + dxdy * dy;
+        float d = dy * direction;
+        std::int32_t total = to_fixed(d);
+
+        float x0 = std::clamp(std::min(x, x_next), 0.0f, static_cast<float>(width));
+        float x1 = std::clamp(std::max(x, x_next), 0.0f, static_cast<float>(width));
+        float x0_floor = std::floor(x0);
+        int x0i = static_cast<int>(x0_floor);
+        float x1_ceil = std::ceil(x1);
+        int x1i = static_cast<int>(x1_ceil);
+
+        if (x1i <= x0i + 1) {
+            // Within one pixel
+            float x_mid = 0.5f * (x0 + x1) - x0_floor;
+            std::int32_t right = to_fixed(d * x_mid);
+            row[x0i] += total - right;
+            row[x0i + 1] += right;
+        } else {
+            // Across several pixels; the area is split by the line's trapezoid in each
+            float s = 1 / (x1 - x0);
+            float x0_fraction = x0 - x0_floor;
+            float a0 = 0.5f * s * (1 - x0_fraction) * (1 - x0_fraction);
+            float x1_fraction = x1 - x1_ceil + 1;
+            float a_last = 0.5f * s * x1_fraction * x1_fraction;
+
+            std::int32_t first = to_fixed(d * a0);
+            std::int32_t last = to_fixed(d * a_last);
+            row[x0i] += first;
+
+            if (x1i == x0i + 2) {
+                row[x0i + 1] += total - first - last;
+            } else {
+                float a1 = s * (1.5f - x0_fraction);
+                std::int32_t second = to_fixed(d * (a1 - a0));
+                std::int32_t step = to_fixed(d * s);
+                row[x0i + 1] += second;
+
+                std::int32_t sum = first + second;
+                for (int xi = x0i + 2; xi < x1i - 1; xi++) {
+                    row[xi] += step;
+                    sum += step;
+                }
+                row[x1i - 1] += total - sum - last;
+            }
+            row[x1i] += last;
+        }
+
+        x = x_next;
+    }
+}
+
+/**
+ * @brief Adds a polygon edge, clipping it to [0, width] horizontally. Parts left of the target are moved
+ * onto its left edge, which keeps their effect on the pixels to their right; parts to the right are moved
+ * onto the right edge, where they can't affect visible pixels.
+ */
+void accumulate_edge(std::int32_t* accumulation, int row_width, int width, int height, Vector2 p0, Vector2 p1) noexcept {
+    if (p0.y == p1.y) {
+        return;
+    }
+
+    float bounds[2] = {0, static_cast<float>(width)};
+    Vector2 pieces[4] = {p0};
+    int piece_count = 1;
+
+    // Split where the edge crosses either side of the target
+    float t_cross[2];
+    int cross_count = 0;
+    for (float bound : bounds) {
+        if ((p0.x < bound) != (p1.x < bound) && p0.x != p1.x) {
+            t_cross[cross_count++] = (bound - p0.x) / (p1.x - p0.x);
+        }
+    }
+    if (cross_count == 2 && t_cross[0] > t_cross[1]) {
+        std::swap(t_cross[0], t_cross[1]);
+    }
+    for (int i = 0; i < cross_count; i++) {
+        pieces[piece_count++] = p0 + (p1 - p0) * t_cross[i];
+    }
+    pieces[piece_count++] = p1;
+
+    for (int i = 0; i + 1 < piece_count; i++) {
+        Vector2 a = pieces[i];
+        Vector2 b = pieces[i + 1];
+        a.x = std::clamp(a.x, bounds[0], bounds[1]);
+        b.x = std::clamp(b.x, bounds[0], bounds[1]);
+        accumulate_line(accumulation, row_width, width, height, a, b);
+    }
+}
+
+}
+
+Symbol::RichOutput Rasterizer::draw(const Symbol& symbol, const RasterTarget& target, const SymbolStyle& style) noexcept {
+    _impl::SymbolParts parts = _impl::get_symbol_parts(symbol, style);
+    if (!parts.valid) {
+        return {};
+    }
+
+    draw_parts(parts, target);
+    return std::move(parts.layout);
+}
+
+void Rasterizer::draw_parts(const _impl::SymbolParts& parts, const RasterTarget& target, int first_row) noexcept {
+    auto paint = [&](const _impl::Polylines& polygons, _impl::ColorType, const Color& color, bool) {
+        fill(polygons, color, target, first_row);
+    };
+
+    _impl::Transform transform = _impl::get_pixel_transform(parts);
+    for (const auto* part : {&parts.frame, &parts.amplifiers, &parts.entity, &parts.modifier_1, &parts.modifier_2}) {
+        flattener.flatten(*part, parts.style, transform, paint);
+    }
+}
+
+void Rasterizer::draw_masks(const _impl::SymbolParts& parts, const RasterTarget* const (&masks)[4], real_t scale) noexcept {
+    auto paint = [&](const _impl::Polylines& polygons, _impl::ColorType color_type, const Color&, bool) {
+        int index = static_cast<int>(color_type);
+        if (index >= 0 && index < 4 && masks[index] != nullptr) {
+            fill(polygons, Color{255, 255, 255}, *masks[index]);
+        }
+    };
+
+    _impl::Transform transform = _impl::Transform{scale, Vector2{0, 0}}.after(_impl::get_pixel_transform(parts));
+    for (const auto* part : {&parts.frame, &parts.amplifiers, &parts.entity, &parts.modifier_1, &parts.modifier_2}) {
+        flattener.flatten(*part, parts.style, transform, paint);
+    }
+}
+
+void Rasterizer::fill(const _impl::Polylines& polygons, const Color& color, const RasterTarget& target, int first_row) noexcept {
+    if (polygons.empty() || target.pixels == nullptr) {
+        return;
+    }
+
+    // Only the pixels the polygons can touch are accumulated and composited. Rows above the target are
+    // accumulated all the same, since edges are walked down from their tops and clipping them there would
+    // round differently.
+    BoundingBox bbox = polygons.get_bbox();
+    int x_start = std::max(0, static_cast<int>(std::floor(bbox.x1)));
+    int y_start = std::max(0, static_cast<int>(std::floor(bbox.y1)));
+    int x_end = std::min(target.width, static_cast<int>(std::ceil(bbox.x2)));
+    int y_end = std::min(first_row + target.height, static_cast<int>(std::ceil(bbox.y2)));
+    if (x_start >= x_end || y_start >= y_end || y_end <= first_row) {
+        return;
+    }
+
+    int width = x_end - x_start;
+    int height = y_end - y_start;
+    int row_width = width + 2;
+
+    std::size_t needed = static_cast<std::size_t>(row_width) * height;
+    if (accumulation.size() < needed) {
+        accumulation.resize(needed, 0);
+    }
+    if (coverage.size() < static_cast<std::size_t>(width)) {
+        coverage.resize(width);
+    }
+
+    Vector2 origin{static_cast<real_t>(x_start), static_cast<real_t>(y_start)};
+    for (const auto& contour : polygons.contours) {
+        std::size_t count = contour.end - contour.begin;
+        for (std::size_t i = 0; i < count; i++) {
+            Vector2 a = polygons.points[contour.begin + i] - origin;
+            Vector2 b = polygons.points[contour.begin + (i + 1) % count] - origin;
+            accumulate_edge(accumulation.data(), row_width, width, height, a, b);
+        }
+    }
+
+    std::uint8_t rgba[4] = {
+        static_cast<std::uint8_t>(color.r),
+        static_cast<std::uint8_t>(color.g),
+        static_cast<std::uint8_t>(color.b),
+        255
+    };
+    std::ptrdiff_t stride = (target.stride != 0 ? target.stride : static_cast<std::ptrdiff_t>(target.width) * 4);
+
+    for (int y = 0; y < height; y++) {
+        std::int32_t* row = accumulation.data() + static_cast<std::ptrdiff_t>(y) * row_width;
+        if (y_start + y < first_row) {
+            std::fill(row, row + row_width, 0);
+            continue;
+        }
+        kernels->accumulate_coverage(row, coverage.data(), width);
+        row[width] = 0;
+        row[width + 1] = 0;
+
+        std::uint8_t* pixels = target.pixels + (y_start + y - first_row) * stride + static_cast<std::ptrdiff_t>(x_start) * 4;
+        kernels->composite_span(pixels, coverage.data(), width, rgba);
+    }
+}
+
+AtlasImage AtlasRasterizer::rasterize(const Atlas& atlas) const noexcept {
+    auto start = std::chrono::steady_clock::now();
+    AtlasImage image;
+    image.width = atlas.width;
+    image.height = atlas.height;
+    image.pixels.assign(static_cast<std::size_t>(atlas.width) * atlas.height * 4, 0);
+    auto allocated = std::chrono::steady_clock::now();
+
+    image.stats = rasterize(atlas, RasterTarget{image.pixels.data(), image.width, image.height, 0});
+    image.stats.allocation = allocated - start;
+    return image;
+}
+
+AtlasRasterStats AtlasRasterizer::rasterize(const Atlas& atlas, const RasterTarget& target) const noexcept {
+    return rasterize_rows(atlas, 0, target);
+}
+
+AtlasRasterStats AtlasRasterizer::rasterize_rows(const Atlas& atlas, int first_row, const RasterTarget& target) const noexcept {
+    using clock = std::chrono::steady_clock;
+
+    // Only placements overlapping the band are jobs
+    int last_row = first_row + target.height;
+    std::vector<std::size_t> jobs;
+    jobs.reserve(atlas.placements.size());
+    for (std::size_t i = 0; i < atlas.placements.size(); i++) {
+        const BoundingBox& rect = atlas.placements[i].rect;
+        if (static_cast<int>(rect.y1) < last_row && static_cast<int>(rect.y2) > first_row) {
+            jobs.push_back(i);
+        }
+    }
+
+    std::size_t thread_count = (threads != 0 ? threads : std::max(1u, std::thread::hardware_concurrency()));
+    thread_count = std::max<std::size_t>(1, std::min(thread_count, jobs.size()));
+
+    AtlasRasterStats stats;
+    stats.workers.resize(thread_count);
+    std::ptrdiff_t stride = (target.stride != 0 ? target.stride : static_cast<std::ptrdiff_t>(target.width) * 4);
+    std::atomic<std::size_t> next_job{0};
+
+    auto work = [&](AtlasRasterStats::Worker& worker) {
+        Rasterizer local = rasterizer;
+        for (std::size_t i = next_job.fetch_add(1, std::memory_order_relaxed); i < jobs.size();
+             i = next_job.fetch_add(1, std::memory_order_relaxed)) {
+            const Atlas::Placement& placement = atlas.placements[jobs[i]];
+
+            // The placement's rectangle within the band as a target of its own, sharing the image's rows
+            int x = static_cast<int>(placement.rect.x1);
+            int top = static_cast<int>(placement.rect.y1) - first_row;
+            int y = std::max(0, top);
+            int width = std::min(static_cast<int>(placement.rect.width()), target.width - x);
+            int height = std::min(top + static_cast<int>(placement.rect.height()), target.height) - y;
+            if (target.pixels == nullptr || x < 0 || width <= 0 || height <= 0) {
+                continue;
+            }
+            RasterTarget tile{target.pixels + y * stride + static_cast<std::ptrdiff_t>(x) * 4, width, height, stride};
+
+            auto job_start = clock::now();
+            _impl::SymbolParts parts = _impl::get_symbol_parts(placement.symbol, atlas.style);
+            auto built = clock::now();
+            if (parts.valid) {
+                local.draw_parts(parts, tile, y - top);
+            }
+            worker.geometry += built - job_start;
+            worker.drawing += clock::now() - built;
+            worker.symbols++;
+        }
+    };
+
+    auto start = clock::now();
+    std::vector<std::thread> helpers;
+    helpers.reserve(thread_count - 1);
+    for (std::size_t i = 1; i < thread_count; i++) {
+        helpers.emplace_back(work, std::ref(stats.workers[i]));
+    }
+    work(stats.workers[0]);
+    for (auto& helper : helpers) {
+        helper.join();
+    }
+    stats.rasterization = clock::now() - start;
+
+    return stats;
+}
+
+}
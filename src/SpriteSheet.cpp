@@ -0,0 +1,81 @@
+#include "SpriteSheet.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+#include "Atlas.hpp"
+
+namespace milsymbol {
+
+namespace {
+
+/// Returns whether an id has the form of the sheet's shared definitions: "d" or "g" followed by digits
+bool is_definition_id(std::string_view id) noexcept {
+    if (id.size() < 2 || (id[0] != 'd' && id[0] != 'g')) {
+        return false;
+    }
+    return std::all_of(id.begin() + 1, id.end(), [](char c) {return c >= '0' && c <= '9';});
+}
+
+}
+
+std::string SpriteSheetBuilder::issue_id(std::string id) {
+    // Automatic and explicit ids share one namespace, so neither can shadow the other
+    if (issued_ids.contains(id) || is_definition_id(id)) {
+        std::size_t& suffix = id_suffixes[id];
+        std::string candidate;
+        do {
+            candidate = id + "_" + std::to_string(++suffix);
+        } while (issued_ids.contains(candidate));
+        id = std::move(candidate);
+    }
+    issued_ids.insert(id);
+    return id;
+}
+
+SpriteSheetBuilder& SpriteSheetBuilder::add(const Symbol& symbol) {
+    char sidc[20];
+    symbol.to_sidc(sidc);
+    return add(symbol, "s" + std::string(sidc, sizeof(sidc)));
+}
+
+SpriteSheetBuilder& SpriteSheetBuilder::add(const Symbol& symbol, std::string id) {
+    symbols.push_back(symbol);
+    ids.push_back(issue_id(std::move(id)));
+    return *this;
+}
+
+SpriteSheet SpriteSheetBuilder::build() const noexcept {
+    AtlasBuilder builder;
+    builder.with_style(style)
+        .with_max_width(static_cast<int>(max_width))
+        .with_spacing(static_cast<int>(std::ceil(spacing)));
+    for (std::size_t i = 0; i < symbols.size(); i++) {
+        builder.add(ids[i], symbols[i]);
+    }
+
+    Atlas atlas = builder.build();
+
+    SpriteSheet sheet;
+    sheet.width = atlas.width;
+    sheet.height = atlas.height;
+    sheet.sprites.reserve(atlas.placements.size());
+    for (const auto& placement : atlas.placements) {
+        SpriteSheet::Sprite sprite;
+        sprite.id = placement.key;
+        sprite.bounding_box = BoundingBox{placement.rect.x1, placement.rect.y1,
+                                          placement.rect.x1 + placement.svg_bounding_box.width(),
+                                          placement.rect.y1 + placement.svg_bounding_box.height()};
+        sprite.frame_bounding_box = placement.frame_bounding_box;
+        sprite.symbol_anchor = placement.symbol_anchor;
+        sheet.sprites.push_back(std::move(sprite));
+    }
+
+    std::stringstream ss;
+    atlas.write_svg(ss);
+    sheet.svg = ss.str();
+    return sheet;
+}
+
+}
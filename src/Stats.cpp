@@ -0,0 +1,169 @@
+#include "Stats.hpp"
+
+#include "Symbol.hpp"
+
+#include <charconv>
+
+namespace milsymbol {
+
+namespace {
+
+std::atomic<RenderStats*> active_render_stats{nullptr};
+
+/**
+ * @brief Writes a duration in nanoseconds as seconds, in the shortest form that parses back to the same double,
+ * so bucket bounds aren't rounded below the samples they hold
+ */
+void write_seconds(std::ostream& out, std::uint64_t ns) {
+    char buffer[32];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), static_cast<double>(ns) / 1e9);
+    out.write(buffer, result.ptr - buffer);
+}
+
+}
+
+const char* get_name(RenderStage stage) noexcept {
+    switch (stage) {
+    case RenderStage::PARSE: return "parse";
+    case RenderStage::LAYER_LOOKUP: return "layer_lookup";
+    case RenderStage::AMPLIFIERS: return "amplifiers";
+    case RenderStage::BOUNDING_BOX: return "bounding_box";
+    case RenderStage::SERIALIZATION: return "serialization";
+    case RenderStage::RENDER: return "render";
+    default: return "unknown";
+    }
+}
+
+const char* get_name(RenderError error) noexcept {
+    switch (error) {
+    case RenderError::INVALID_SIDC: return "invalid_sidc";
+    case RenderError::INVALID_SYMBOL: return "invalid_symbol";
+    default: return "unknown";
+    }
+}
+
+const char* get_name(RenderCache cache) noexcept {
+    switch (cache) {
+    case RenderCache::HIT_TEST: return "hit_test";
+    default: return "unknown";
+    }
+}
+
+void set_render_stats(RenderStats* stats) noexcept {
+    active_render_stats.store(stats, std::memory_order_release);
+}
+
+RenderStats* get_render_stats() noexcept {
+    return active_render_stats.load(std::memory_order_acquire);
+}
+
+std::uint64_t RenderStats::Snapshot::Stage::get_quantile(double quantile) const noexcept {
+    if (count == 0) {
+        return 0;
+    }
+
+    // The sample at the quantile's rank, counting from 1
+    double rank = quantile * count;
+    std::uint64_t seen = 0;
+    for (int i = 0; i < BUCKET_COUNT; i++) {
+        seen += buckets[i];
+        if (seen > 0 && static_cast<double>(seen) >= rank) {
+            return std::uint64_t{2} << i;
+        }
+    }
+    return std::uint64_t{2} << (BUCKET_COUNT - 1);
+}
+
+RenderStats::Snapshot RenderStats::get_snapshot() const noexcept {
+    Snapshot snapshot;
+    for (std::size_t stage = 0; stage < stages.size(); stage++) {
+        const StageCounters& counters = stages[stage];
+        Snapshot::Stage& copy = snapshot.stages[stage];
+        copy.count = counters.count.load(std::memory_order_relaxed);
+        copy.total_ns = counters.total_ns.load(std::memory_order_relaxed);
+        for (int i = 0; i < BUCKET_COUNT; i++) {
+            copy.buckets[i] = counters.buckets[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    for (std::size_t i = 0; i < snapshot.errors.size(); i++) {
+        snapshot.errors[i] = counters.errors[i].load(std::memory_order_relaxed);
+    }
+    for (std::size_t i = 0; i < snapshot.cache_hits.size(); i++) {
+        snapshot.cache_hits[i] = counters.cache_hits[i].load(std::memory_order_relaxed);
+        snapshot.cache_misses[i] = counters.cache_misses[i].load(std::memory_order_relaxed);
+    }
+    snapshot.output_bytes = counters.output_bytes.load(std::memory_order_relaxed);
+    return snapshot;
+}
+
+void RenderStats::reset() noexcept {
+    for (auto& stage : stages) {
+        stage.count.store(0, std::memory_order_relaxed);
+        stage.total_ns.store(0, std::memory_order_relaxed);
+        for (auto& bucket : stage.buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    for (auto& error : counters.errors) {
+        error.store(0, std::memory_order_relaxed);
+    }
+    for (std::size_t i = 0; i < counters.cache_hits.size(); i++) {
+        counters.cache_hits[i].store(0, std::memory_order_relaxed);
+        counters.cache_misses[i].store(0, std::memory_order_relaxed);
+    }
+    counters.output_bytes.store(0, std::memory_order_relaxed);
+}
+
+void RenderStats::Snapshot::write_prometheus(std::ostream& out, const char* prefix) const {
+    out << "# HELP " << prefix << "_stage_duration_seconds Time spent in each stage of rendering symbols" << std::endl;
+    out << "# TYPE " << prefix << "_stage_duration_seconds histogram" << std::endl;
+    for (std::size_t i = 0; i < stages.size(); i++) {
+        const Stage& stage = stages[i];
+        const char* name = get_name(static_cast<RenderStage>(i));
+
+        // Buckets are cumulative, each bounded inclusively by the top of its power-of-two range
+        std::uint64_t cumulative = 0;
+        for (int bucket = 0; bucket < BUCKET_COUNT - 1; bucket++) {
+            cumulative += stage.buckets[bucket];
+            out << prefix << "_stage_duration_seconds_bucket{stage=\"" << name << "\",le=\"";
+            write_seconds(out, std::uint64_t{2} << bucket);
+            out << "\"} " << cumulative << std::endl;
+        }
+        out << prefix << "_stage_duration_seconds_bucket{stage=\"" << name << "\",le=\"+Inf\"} " << stage.count << std::endl;
+        out << prefix << "_stage_duration_seconds_sum{stage=\"" << name << "\"} ";
+        write_seconds(out, stage.total_ns);
+        out << std::endl;
+        out << prefix << "_stage_duration_seconds_count{stage=\"" << name << "\"} " << stage.count << std::endl;
+    }
+
+    out << "# HELP " << prefix << "_errors_total Symbols that couldn't be parsed or rendered" << std::endl;
+    out << "# TYPE " << prefix << "_errors_total counter" << std::endl;
+    for (std::size_t i = 0; i < errors.size(); i++) {
+        out << prefix << "_errors_total{kind=\"" << get_name(static_cast<RenderError>(i)) << "\"} " << errors[i] << std::endl;
+    }
+
+    out << "# HELP " << prefix << "_cache_hits_total Lookups answered from a cache" << std::endl;
+    out << "# TYPE " << prefix << "_cache_hits_total counter" << std::endl;
+    for (std::size_t i = 0; i < cache_hits.size(); i++) {
+        out << prefix << "_cache_hits_total{cache=\"" << get_name(static_cast<RenderCache>(i)) << "\"} " << cache_hits[i] << std::endl;
+    }
+
+    out << "# HELP " << prefix << "_cache_misses_total Lookups a cache couldn't answer" << std::endl;
+    out << "# TYPE " << prefix << "_cache_misses_total counter" << std::endl;
+    for (std::size_t i = 0; i < cache_misses.size(); i++) {
+        out << prefix << "_cache_misses_total{cache=\"" << get_name(static_cast<RenderCache>(i)) << "\"} " << cache_misses[i] << std::endl;
+    }
+
+    out << "# HELP " << prefix << "_output_bytes_total Bytes of SVG returned by Symbol::get_svg" << std::endl;
+    out << "# TYPE " << prefix << "_output_bytes_total counter" << std::endl;
+    out << prefix << "_output_bytes_total " << output_bytes << std::endl;
+}
+
+Symbol Symbol::parse_sidc_with_stats(std::string_view sidc) noexcept {
+    _impl::StageTimer timer{RenderStage::PARSE};
+    return parse_sidc(sidc);
+}
+
+}
@@ -1,8 +1,10 @@
 #include "Symbol.hpp"
-#include <charconv>
 
 #include "Schema.hpp"
 #include "SymbolGeometries.hpp"
+#include "SymbolParts.hpp"
+#include "Stats.hpp"
+#include "TraceScope.hpp"
 
 namespace milsymbol {
 
@@ -332,7 +334,7 @@ static void get_status_modifiers(const Symbol& symbol, const BoundingBox& bbox,
     }
 }
 
-static BoundingBox apply_amplifiers(const SymbolStyle& style, const Symbol& symbol,
+BoundingBox _impl::apply_amplifiers(const SymbolStyle& style, const Symbol& symbol,
                                     const BoundingBox& base_bbox_raw,
                                     std::vector<_impl::DrawCommand>& out,
                                     Vector2& staff_base) {
@@ -477,295 +479,11 @@ static void apply_context(Context context, Affiliation affil, Dimension dim, con
 
 }
 
-static int int_substring(const std::string_view& view, int start, int len) {
-    int ret = 0;
-    std::from_chars(&view[start], &view[start + len], ret);
-    return ret;
-}
-
-Symbol Symbol::from_sidc(const std::string& sidc_raw) noexcept {
-
-    std::string ret = sidc_raw + '\0';
-    std::string_view sidc = ret;
-
-    if (sidc_raw.length() < 20) {
-        std::cerr << "SIDC \"" << sidc << "\" must be at least 20 characters" << std::endl;
-        return {};
-    }
-
-    // Determine version
-    int version = int_substring(sidc, 0, 2);
-    if (version > 10) {
-//        std::cerr << "Warning: SIDC versions higher than 10 may not be dealt with appropriately (version is " <<
-//            version_str << " -> " << version << ")" << std::endl;
-    }
-
-    Symbol symbol;
-
-    /*
-     * Parse standard identity
-     */
-    char context_int = sidc[2];
-    switch(context_int) {
-    case '2':
-        symbol.context = Context::SIMULATION;
-        break;
-    case '1':
-        symbol.context = Context::EXERCISE;
-        break;
-    default:
-        symbol.context = Context::REALITY;
-        break;
-    }
-
-    char affil = sidc[3];
-    switch(affil) {
-    case '1':
-        symbol.affiliation = Affiliation::UNKNOWN;
-        break;
-    case '2':
-        symbol.affiliation = Affiliation::ASSUMED_FRIEND;
-        break;
-    case '3':
-        symbol.affiliation = Affiliation::FRIEND;
-        break;
-    case '4':
-        symbol.affiliation = Affiliation::NEUTRAL;
-        break;
-    case '5':
-        symbol.affiliation = Affiliation::SUSPECT;
-        break;
-    case '6':
-        symbol.affiliation = Affiliation::HOSTILE;
-        break;
-    case '0':
-        symbol.affiliation = Affiliation::PENDING;
-        break;
-    }
-
-    // Parse the symbol sets
-    int symbol_set_raw = int_substring(sidc, 4, 2);
-
-    SymbolSet symbol_set;
-    switch (symbol_set_raw) {
-    case 1:
-        symbol_set = SymbolSet::AIR;
-        break;
-    case 2:
-        symbol_set = SymbolSet::AIR_MISSILE;
-        break;
-    case 5:
-        symbol_set = SymbolSet::SPACE;
-        break;
-    case 6:
-        symbol_set = SymbolSet::SPACE_MISSILE;
-        break;
-    case 10:
-        symbol_set = SymbolSet::LAND_UNIT;
-        break;
-    case 11:
-        symbol_set = SymbolSet::LAND_CIVILIAN_UNIT_ORGANIZATION;
-        break;
-    case 15:
-        symbol_set = SymbolSet::LAND_EQUIPMENT;
-        break;
-    case 20:
-        symbol_set = SymbolSet::LAND_INSTALLATION;
-        break;
-    case 30:
-        symbol_set = SymbolSet::SEA_SURFACE;
-        break;
-    case 35:
-        symbol_set = SymbolSet::SEA_SUBSURFACE;
-        break;
-    case 40:
-        symbol_set = SymbolSet::ACTIVITIES;
-        break;
-    default:
-        symbol_set = SymbolSet::UNDEFINED;
-        break;
-    }
-
-    /*
-     * Parse status
-     */
-
-    char status = sidc[6];
-    switch(status) {
-    case '1':
-        symbol.presence = Presence::PLANNED;
-        symbol.status = Status::UNDEFINED;
-        break;
-    case '2':
-        symbol.presence = Presence::PLANNED;
-        symbol.status = Status::FULLY_CAPABLE;
-        break;
-    case '3':
-        symbol.presence = Presence::PLANNED;
-        symbol.status = Status::DAMAGED;
-        break;
-    case '4':
-        symbol.presence = Presence::PLANNED;
-        symbol.status = Status::DESTROYED;
-        break;
-    case '5':
-        symbol.presence = Presence::PLANNED;
-        symbol.status = Status::FULL_TO_CAPACITY;
-        break;
-    default:
-        symbol.presence = Presence::PRESENT;
-        symbol.status = Status::UNDEFINED;
-        break;
-    }
-
-    /*
-     * Parse headquarters/task force/dummy elements
-     */
-
-    char hq = sidc[7];
-    switch(hq) {
-    case '1':
-        symbol.headquarters = false;
-        symbol.task_force = false;
-        symbol.feint_dummy = true;
-        break;
-    case '2':
-        symbol.headquarters = true;
-        symbol.task_force = false;
-        symbol.feint_dummy = false;
-        break;
-    case '3':
-        symbol.headquarters = true;
-        symbol.task_force = false;
-        symbol.feint_dummy = true;
-        break;
-    case '4':
-        symbol.headquarters = false;
-        symbol.task_force = true;
-        symbol.feint_dummy = false;
-        break;
-    case '5':
-        symbol.headquarters = false;
-        symbol.task_force = true;
-        symbol.feint_dummy = true;
-        break;
-    case '6':
-        symbol.headquarters = true;
-        symbol.task_force = true;
-        symbol.feint_dummy = false;
-        break;
-    case '7':
-        symbol.headquarters = true;
-        symbol.task_force = true;
-        symbol.feint_dummy = true;
-        break;
-    default:
-        symbol.headquarters = false;
-        symbol.task_force = false;
-        symbol.feint_dummy = false;
-        break;
-    }
-
-    /*
-     * Parse mobility/echelon
-     */
-
-    char ech1 = sidc[8];
-    char ech2 = sidc[9];
-
-    symbol.echelon = Echelon::UNDEFINED;
-    symbol.mobility = Mobility::UNDEFINED;
-
-    if (ech1 == '1') {
-        // Echelon at brigade and below
-        if (ech2 == '1')
-            symbol.echelon = Echelon::TEAM;
-        else if (ech2 == '2')
-            symbol.echelon = Echelon::SQUAD;
-        else if (ech2 == '3')
-            symbol.echelon = Echelon::SECTION;
-        else if (ech2 == '4')
-            symbol.echelon = Echelon::PLATOON;
-        else if (ech2 == '5')
-            symbol.echelon = Echelon::COMPANY;
-        else if (ech2 == '6')
-            symbol.echelon = Echelon::BATTALION;
-        else if (ech2 == '7')
-            symbol.echelon = Echelon::REGIMENT;
-        else if (ech2 == '8')
-            symbol.echelon = Echelon::BRIGADE;
-    } else if (ech1 == '2') {
-        // Echelon at division and above
-        if (ech2 == '1')
-            symbol.echelon = Echelon::DIVISION;
-        else if (ech2 == '2')
-            symbol.echelon = Echelon::CORPS;
-        else if (ech2 == '3')
-            symbol.echelon = Echelon::ARMY;
-        else if (ech2 == '4')
-            symbol.echelon = Echelon::ARMY_GROUP;
-        else if (ech2 == '5')
-            symbol.echelon = Echelon::REGION;
-        else if (ech2 == '6')
-            symbol.echelon = Echelon::COMMAND;
-    } else if (ech1 == '3') {
-        // Equipment mobility on land
-        if (ech2 == '1')
-            symbol.mobility = Mobility::WHEELED;
-        else if (ech2 == '2')
-            symbol.mobility = Mobility::WHEELED_CROSS_COUNTRY;
-        else if (ech2 == '3')
-            symbol.mobility = Mobility::TRACKED;
-        else if (ech2 == '4')
-            symbol.mobility = Mobility::WHEELED_AND_TRACKED;
-        else if (ech2 == '5')
-            symbol.mobility = Mobility::TOWED;
-        else if (ech2 == '6')
-            symbol.mobility = Mobility::RAIL;
-        else if (ech2 == '7')
-            symbol.mobility = Mobility::PACK_ANIMALS;
-    } else if (ech1 == '4') {
-        // Equipment mobility on snow
-        if (ech2 == '1')
-            symbol.mobility = Mobility::OVER_SNOW;
-        else if (ech2 == '2')
-            symbol.mobility = Mobility::SLED;
-
-    } else if (ech1 == '5') {
-        // Equipment mobility on water
-        if (ech2 == '1')
-            symbol.mobility = Mobility::BARGE;
-        else if (ech2 == '2')
-            symbol.mobility = Mobility::AMPHIBIOUS;
-
-    } else if (ech1 == '6') {
-        // Naval towed array
-        if (ech2 == '1')
-            symbol.mobility = Mobility::SHORT_TOWED_ARRAY;
-        else if (ech2 == '2')
-            symbol.mobility = Mobility::LONG_TOWED_ARRAY;
+void _impl::report_invalid_sidc(std::string_view sidc) noexcept {
+    if (RenderStats* stats = get_render_stats()) {
+        stats->count(RenderError::INVALID_SIDC);
     }
-
-    /*
-     * Parse entity
-     * - Characters 10-15 inclusive are the entity type
-     * - Characters 16-17 inclusive are modifier 1
-     * - Characters 18-19 inclusive are modifier 2
-     */
-    entity_t entity_raw = 0;
-    modifier_t modifier_1_raw = 0;
-    modifier_t modifier_2_raw = 0;
-
-    entity_raw = int_substring(sidc, 10, 6);
-    symbol.entity = static_cast<int>(symbol_set) * ENTITY_SYMBOL_SET_OFFSET + entity_raw;
-
-    modifier_1_raw = int_substring(sidc, 16, 2);
-    symbol.modifier_1 = modifier_1_raw == 0 ? 0 : static_cast<int>(symbol_set) * MODIFIER_SYMBOL_SET_OFFSET + modifier_1_raw;
-
-    modifier_2_raw = int_substring(sidc, 18, 2);
-    symbol.modifier_2 = modifier_2_raw == 0 ? 0 : static_cast<int>(symbol_set) * MODIFIER_SYMBOL_SET_OFFSET + modifier_2_raw;
-
-    return symbol;
+    std::cerr << "SIDC \"" << sidc << "\" must be at least 20 characters" << std::endl;
 }
 
 Symbol::modifier_t Symbol::get_modifier(int mod) const noexcept {
@@ -781,20 +499,32 @@ inline Vector2 scaled_to_center(const Vector2& vec, float scale) noexcept {
     return Vector2{100 +(vec.x - 100) * scale, 100 + (vec.y - 100) * scale};
 }
 
-Symbol::RichOutput Symbol::get_svg(const SymbolStyle& style) const noexcept {
-    using namespace _impl;
-    static constexpr const char* SVG_NS = "http://w3.org/2000/svg";
+_impl::SymbolParts _impl::get_symbol_parts(const Symbol& symbol, const SymbolStyle& style, bool layout_only) noexcept {
+    SymbolParts parts;
 
     bool position_only = (!style.use_entity_icon && !style.use_frame);
 
-    SymbolSet symbol_set = get_symbol_set();
-
-    _impl::SymbolLayer symbol_layer = _impl::get_symbol_layer(symbol_set, entity, IconType::ENTITY);
-    _impl::SymbolLayer m1_layer = _impl::get_symbol_layer(symbol_set, modifier_1, IconType::MODIFIER_1);
-    _impl::SymbolLayer m2_layer = _impl::get_symbol_layer(symbol_set, modifier_2, IconType::MODIFIER_2);
+    Affiliation affiliation = symbol.get_affiliation();
+    SymbolSet symbol_set = symbol.get_symbol_set();
+
+    SymbolLayer symbol_layer;
+    SymbolLayer m1_layer;
+    SymbolLayer m2_layer;
+    if (!layout_only) {
+        StageTimer timer{RenderStage::LAYER_LOOKUP};
+        TraceScope trace{RenderStage::LAYER_LOOKUP, symbol};
+        symbol_layer = get_symbol_layer(symbol_set, symbol.get_entity(), IconType::ENTITY);
+        m1_layer = get_symbol_layer(symbol_set, symbol.get_modifier(1), IconType::MODIFIER_1);
+        m2_layer = get_symbol_layer(symbol_set, symbol.get_modifier(2), IconType::MODIFIER_2);
+    } else {
+        // Only the precomputed extents are needed to lay out the icons, not their commands
+        symbol_layer.bbox = get_symbol_bbox(symbol_set, symbol.get_entity(), IconType::ENTITY);
+        m1_layer.bbox = get_symbol_bbox(symbol_set, symbol.get_modifier(1), IconType::MODIFIER_1);
+        m2_layer.bbox = get_symbol_bbox(symbol_set, symbol.get_modifier(2), IconType::MODIFIER_2);
+    }
 
     // Add the base geometry
-    std::vector<_impl::DrawCommand> components;
+    std::vector<DrawCommand>& components = parts.frame;
     bool use_civilian_color = false;
     if (symbol_layer.civilian_override || m1_layer.civilian_override || m2_layer.civilian_override) {
         use_civilian_color = true;
@@ -807,7 +537,10 @@ Symbol::RichOutput Symbol::get_svg(const SymbolStyle& style) const noexcept {
                                                 position_only);
     if (!base.is_defined()) {
         std::cerr << "Undefined base" << std::endl;
-        return {};
+        if (RenderStats* stats = get_render_stats()) {
+            stats->count(RenderError::INVALID_SYMBOL);
+        }
+        return parts;
     }
 
     base_bbox = base.get_bbox();
@@ -815,7 +548,7 @@ Symbol::RichOutput Symbol::get_svg(const SymbolStyle& style) const noexcept {
     if (style.use_frame || position_only) {
 
         // Get base symbol
-        _impl::DrawCommand sdc = base.copy_with_stroke_width(style.frame_stroke_width);
+        DrawCommand sdc = base.copy_with_stroke_width(style.frame_stroke_width);
 
         // Handle unfilled icons
         if (style.color_mode == ColorMode::UNFILLED) {
@@ -825,7 +558,7 @@ Symbol::RichOutput Symbol::get_svg(const SymbolStyle& style) const noexcept {
         bool dashed_frame = (affiliation == Affiliation::ASSUMED_FRIEND ||
                              affiliation == Affiliation::PENDING ||
                              affiliation == Affiliation::SUSPECT ||
-                             presence != Presence::PRESENT);
+                             symbol.get_presence() != Presence::PRESENT);
 
         if (dashed_frame) {
             // Apply dashed frame base
@@ -847,7 +580,7 @@ Symbol::RichOutput Symbol::get_svg(const SymbolStyle& style) const noexcept {
     // Handle various graphical modifiers
     if (!position_only) {
         if (style.use_amplifiers) {
-            apply_context(context, affiliation, dimension_from_symbol_set(symbol_set), base_bbox, components);
+            apply_context(symbol.get_context(), affiliation, dimension_from_symbol_set(symbol_set), base_bbox, components);
         }
 
         if (symbol_set == SymbolSet::SPACE || symbol_set == SymbolSet::SPACE_MISSILE) {
@@ -857,11 +590,8 @@ Symbol::RichOutput Symbol::get_svg(const SymbolStyle& style) const noexcept {
         }
     }
 
-    /*
-     * Convert the commands to SVG
-     */
-
     // Initialize the bounding box
+    StageTimer bbox_timer{RenderStage::BOUNDING_BOX};
     bool bbox_initialized = false;
     BoundingBox bbox = style.use_frame ? BoundingBox{} : base_bbox;
     for (const auto& comp : components) {
@@ -880,57 +610,63 @@ Symbol::RichOutput Symbol::get_svg(const SymbolStyle& style) const noexcept {
 
     Vector2 hq_staff_base;
     if (!position_only && style.use_amplifiers) {
-        bbox.merge(apply_amplifiers(style, *this, bbox, components, hq_staff_base));
+        bbox_timer.pause();
+        StageTimer timer{RenderStage::AMPLIFIERS};
+        TraceScope trace{RenderStage::AMPLIFIERS, symbol};
+        bbox.merge(_impl::apply_amplifiers(style, symbol, bbox, parts.amplifiers, hq_staff_base));
+        timer.stop();
+        trace.stop();
+        bbox_timer.resume();
     }
 
-    //    bbox_initialized = false;
     for (const auto& comp : components) {
         bbox.merge(comp.get_bbox());
     }
-
-    // Add entity
-    if (style.use_entity_icon) {
-        for (const auto& cmd : symbol_layer.draw_items) {
-            components.push_back(cmd);
-        }
+    for (const auto& comp : parts.amplifiers) {
+        bbox.merge(comp.get_bbox());
     }
 
-    // Add modifiers
+    // Icons that reach past the frame, using the extents generated with them. Amplifiers are still placed
+    // around the frame, so this comes after them.
+    if (style.use_entity_icon && symbol_layer.bbox) {
+        bbox.merge(*symbol_layer.bbox);
+    }
     if (!position_only && style.use_entity_icon && style.use_modifiers) {
-        for (const auto& cmd : m1_layer.draw_items) {
-            components.push_back(cmd);
-        }
-        for (const auto& cmd : m2_layer.draw_items) {
-            components.push_back(cmd);
+        for (const auto* layer : {&m1_layer, &m2_layer}) {
+            if (layer->bbox) {
+                bbox.merge(*layer->bbox);
+            }
         }
     }
 
-    // Handle non-default sizes
-    if (style.has_non_default_size()) {
-        std::vector<DrawCommand> interior_components = std::move(components);
-        components = std::vector<DrawCommand>();
-        components.push_back(DrawCommand::scale(style.get_icon_internal_scale_factor(), std::move(interior_components)));
-    }
+    bbox_timer.pause();
 
-    // Execute the context
-    _impl::Style context;
-    context.affiliation = affiliation;
-    context.civilian = use_civilian_color && style.use_civilian_color;
-    context.color_mode = style.color_mode;
-    context.use_color_override = style.use_color_override;
-    context.color_override = style.color_override;
-    context.stroke_width_override = (style.uses_stroke_width_override() ? style.get_stroke_width_override() : -1);
+    // Add entity
+    if (style.use_entity_icon) {
+        parts.entity = std::move(symbol_layer.draw_items);
+    }
 
-    std::stringstream ss;
-    for (const auto& comp : components) {
-        ss << comp.get_svg_string(context) << std::endl;
+    // Add modifiers
+    if (!position_only && style.use_entity_icon && style.use_modifiers) {
+        parts.modifier_1 = std::move(m1_layer.draw_items);
+        parts.modifier_2 = std::move(m2_layer.draw_items);
     }
 
-    // ss << "<!-- BBox: " << bbox.x1 << ", " << bbox.y1 << " to " << bbox.x2 << ", " << bbox.y2 << " -->" << std::endl;
+    // Resolve the drawing style
+    parts.style.affiliation = affiliation;
+    parts.style.civilian = use_civilian_color && style.use_civilian_color;
+    parts.style.color_mode = style.color_mode;
+    parts.style.use_color_override = style.use_color_override;
+    parts.style.color_override = style.color_override;
+    parts.style.stroke_width_override = (style.uses_stroke_width_override() ? style.get_stroke_width_override() : -1);
+    parts.scale = style.get_icon_internal_scale_factor();
 
-    // Create the svg
+    /*
+     * Lay out the SVG
+     */
 
-    RichOutput result;
+    bbox_timer.resume();
+    Symbol::RichOutput& result = parts.layout;
     result.svg_bounding_box = BoundingBox{
         bbox.x1 - style.frame_stroke_width - style.padding,
         bbox.y1 - style.frame_stroke_width - style.padding,
@@ -942,19 +678,6 @@ Symbol::RichOutput Symbol::get_svg(const SymbolStyle& style) const noexcept {
         result.svg_bounding_box = result.svg_bounding_box.scaled_to_center(style.get_icon_internal_scale_factor());
     }
 
-    std::stringstream ret_stream;
-    ret_stream << "<svg width=\"" << result.svg_bounding_box.width() << "\" " <<
-        "height=\"" << result.svg_bounding_box.height() << "\" " <<
-        "viewBox=\"" << result.svg_bounding_box.x1 << " " <<
-        result.svg_bounding_box.y1 << " " <<
-        result.svg_bounding_box.width() << " " <<
-        result.svg_bounding_box.height() << "\" " <<
-        ">" << std::endl;
-    ret_stream << ss.str();
-    ret_stream << "</svg>";
-
-    result.svg = ret_stream.str();
-
     // Offset the frame bounding box
     result.frame_bounding_box = base_bbox;
     result.frame_bounding_box.x1 -= result.svg_bounding_box.x1;
@@ -962,7 +685,7 @@ Symbol::RichOutput Symbol::get_svg(const SymbolStyle& style) const noexcept {
     result.frame_bounding_box.y1 -= result.svg_bounding_box.y1;
     result.frame_bounding_box.y2 -= result.svg_bounding_box.y1;
 
-    if (headquarters) {
+    if (symbol.is_headquarters()) {
         // Tip of the staff
         result.symbol_anchor = scaled_to_center(hq_staff_base, style.get_icon_internal_scale_factor()) - result.svg_bounding_box.point_1();
     } else {
@@ -970,9 +693,70 @@ Symbol::RichOutput Symbol::get_svg(const SymbolStyle& style) const noexcept {
         result.symbol_anchor = scaled_to_center(Vector2{100, 100}, style.get_icon_internal_scale_factor()) - result.svg_bounding_box.point_1();
     }
 
+    bbox_timer.stop();
+    parts.valid = true;
+    return parts;
+}
+
+Symbol::RichOutput Symbol::get_svg(const SymbolStyle& style) const noexcept {
+    using namespace _impl;
+
+    StageTimer render_timer{RenderStage::RENDER};
+    TraceScope render_trace{RenderStage::RENDER, *this};
+    SymbolParts parts = get_symbol_parts(*this, style);
+    if (!parts.valid) {
+        return {};
+    }
+
+    StageTimer serialization_timer{RenderStage::SERIALIZATION};
+    TraceScope serialization_trace{RenderStage::SERIALIZATION, *this};
+
+    std::vector<DrawCommand> components = std::move(parts.frame);
+    for (auto* part : {&parts.amplifiers, &parts.entity, &parts.modifier_1, &parts.modifier_2}) {
+        components.insert(components.end(), std::make_move_iterator(part->begin()), std::make_move_iterator(part->end()));
+    }
+
+    // Handle non-default sizes
+    if (style.has_non_default_size()) {
+        std::vector<DrawCommand> interior_components = std::move(components);
+        components = std::vector<DrawCommand>();
+        components.push_back(DrawCommand::scale(parts.scale, std::move(interior_components)));
+    }
+
+    std::stringstream ss;
+    for (const auto& comp : components) {
+        ss << comp.get_svg_string(parts.style) << std::endl;
+    }
+
+    // Create the svg
+    RichOutput result = std::move(parts.layout);
+
+    std::stringstream ret_stream;
+    ret_stream << "<svg width=\"" << result.svg_bounding_box.width() << "\" " <<
+        "height=\"" << result.svg_bounding_box.height() << "\" " <<
+        "viewBox=\"" << result.svg_bounding_box.x1 << " " <<
+        result.svg_bounding_box.y1 << " " <<
+        result.svg_bounding_box.width() << " " <<
+        result.svg_bounding_box.height() << "\" " <<
+        ">" << std::endl;
+    ret_stream << ss.str();
+    ret_stream << "</svg>";
+
+    result.svg = ret_stream.str();
+    serialization_timer.stop();
+    serialization_trace.stop();
+
+    if (RenderStats* stats = get_render_stats()) {
+        stats->add_output_bytes(result.svg.size());
+    }
     return result;
 }
 
+Symbol::RichOutput Symbol::get_layout(const SymbolStyle& style) const noexcept {
+    _impl::SymbolParts parts = _impl::get_symbol_parts(*this, style, true);
+    return parts.valid ? std::move(parts.layout) : RichOutput{};
+}
+
 std::vector<Symbol::entity_t> Symbol::get_all_entities(SymbolSet symbol_set) noexcept {
     return _impl::get_available_symbols(symbol_set, _impl::IconType::ENTITY);
 }
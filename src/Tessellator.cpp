@@ -0,0 +1,289 @@
+#include "Tessellator.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "SymbolParts.hpp"
+
+namespace milsymbol {
+
+namespace {
+
+/// Horizontal distance below which edges are taken to meet, in pixels
+constexpr real_t SWEEP_EPSILON = 1e-4f;
+
+/// Thinnest slab the sweep splits at edge crossings, in pixels
+constexpr real_t MIN_SLAB_HEIGHT = 1e-3f;
+
+/// Returns twice the signed area of a triangle; positive if it winds clockwise on screen, with y down
+inline real_t cross(const Vector2& a, const Vector2& b, const Vector2& c) noexcept {
+    return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+}
+
+/// Adds a vertex with the given paint, returning its index
+inline std::uint32_t add_vertex(Mesh& mesh, const Mesh::Vertex& paint, real_t x, real_t y) noexcept {
+    Mesh::Vertex vertex = paint;
+    vertex.x = x;
+    vertex.y = y;
+    mesh.vertices.push_back(vertex);
+    return static_cast<std::uint32_t>(mesh.vertices.size() - 1);
+}
+
+inline void add_triangle(Mesh& mesh, std::uint32_t a, std::uint32_t b, std::uint32_t c) noexcept {
+    mesh.indices.push_back(a);
+    mesh.indices.push_back(b);
+    mesh.indices.push_back(c);
+}
+
+/**
+ * @brief Returns whether a closed contour is convex: it turns the same way at every corner and goes up
+ * and down only once, which rules out stars
+ */
+bool is_convex(const std::vector<Vector2>& points, std::size_t begin, std::size_t end) noexcept {
+    std::size_t count = end - begin;
+    if (count < 3) {
+        return false;
+    }
+
+    real_t turn = 0;
+    real_t first_dy = 0;
+    real_t previous_dy = 0;
+    int direction_changes = 0;
+    for (std::size_t i = 0; i < count; i++) {
+        const Vector2& a = points[begin + i];
+        const Vector2& b = points[begin + (i + 1) % count];
+        const Vector2& c = points[begin + (i + 2) % count];
+
+        real_t corner = cross(a, b, c);
+        if (std::abs(corner) > SWEEP_EPSILON) {
+            if (turn == 0) {
+                turn = corner;
+            } else if ((turn > 0) != (corner > 0)) {
+                return false;
+            }
+        }
+
+        real_t dy = b.y - a.y;
+        if (dy != 0) {
+            if (first_dy == 0) {
+                first_dy = dy;
+            } else if ((previous_dy > 0) != (dy > 0)) {
+                direction_changes++;
+            }
+            previous_dy = dy;
+        }
+    }
+    if (first_dy != 0 && (previous_dy > 0) != (first_dy > 0)) {
+        direction_changes++;
+    }
+    return direction_changes <= 2;
+}
+
+/// Adds a fan of triangles covering a convex contour, wound clockwise
+void add_fan(const std::vector<Vector2>& points, std::size_t begin, std::size_t end, const Mesh::Vertex& paint, Mesh& mesh) noexcept {
+    std::size_t count = end - begin;
+    if (count < 3) {
+        return;
+    }
+
+    real_t area = 0;
+    for (std::size_t i = 1; i + 1 < count; i++) {
+        area += cross(points[begin], points[begin + i], points[begin + i + 1]);
+    }
+    if (std::abs(area) <= SWEEP_EPSILON * SWEEP_EPSILON) {
+        return;
+    }
+
+    auto first = static_cast<std::uint32_t>(mesh.vertices.size());
+    for (std::size_t i = begin; i < end; i++) {
+        add_vertex(mesh, paint, points[i].x, points[i].y);
+    }
+    for (std::uint32_t i = 1; i + 1 < count; i++) {
+        if (area > 0) {
+            add_triangle(mesh, first, first + i, first + i + 1);
+        } else {
+            add_triangle(mesh, first, first + i + 1, first + i);
+        }
+    }
+}
+
+}
+
+Mesh Tessellator::tessellate(const Symbol& symbol, const SymbolStyle& style) noexcept {
+    Mesh mesh;
+    append(symbol, style, mesh);
+    return mesh;
+}
+
+Symbol::RichOutput Tessellator::append(const Symbol& symbol, const SymbolStyle& style, Mesh& mesh) noexcept {
+    _impl::SymbolParts parts = _impl::get_symbol_parts(symbol, style);
+    if (!parts.valid) {
+        return {};
+    }
+
+    // Pixels at the styled icon size, with the symbol anchor at the origin
+    const Vector2& anchor = parts.layout.symbol_anchor;
+    _impl::Transform transform = _impl::Transform{1, Vector2{-anchor.x, -anchor.y}}.after(_impl::get_pixel_transform(parts));
+
+    auto paint = [&](const _impl::Polylines& polygons, _impl::ColorType color_type, const Color& color, bool stroke) {
+        Mesh::Vertex vertex_paint{0, 0, static_cast<std::uint8_t>(color_type), static_cast<std::uint8_t>(color.r),
+                                  static_cast<std::uint8_t>(color.g), static_cast<std::uint8_t>(color.b)};
+        if (stroke) {
+            add_convex(polygons, vertex_paint, mesh);
+        } else {
+            add_fill(polygons, vertex_paint, mesh);
+        }
+    };
+
+    for (const auto* part : {&parts.frame, &parts.amplifiers, &parts.entity, &parts.modifier_1, &parts.modifier_2}) {
+        flattener.flatten(*part, parts.style, transform, paint);
+    }
+
+    return std::move(parts.layout);
+}
+
+void Tessellator::add_convex(const _impl::Polylines& polygons, const Mesh::Vertex& paint, Mesh& mesh) noexcept {
+    for (const auto& contour : polygons.contours) {
+        add_fan(polygons.points, contour.begin, contour.end, paint, mesh);
+    }
+}
+
+void Tessellator::add_fill(const _impl::Polylines& polygons, const Mesh::Vertex& paint, Mesh& mesh) noexcept {
+    // A single convex contour, like most frames, needs no sweep
+    if (polygons.contours.size() == 1 && is_convex(polygons.points, polygons.contours[0].begin, polygons.contours[0].end)) {
+        add_fan(polygons.points, polygons.contours[0].begin, polygons.contours[0].end, paint, mesh);
+        return;
+    }
+
+    edges.clear();
+    stops.clear();
+    for (const auto& contour : polygons.contours) {
+        std::size_t count = contour.end - contour.begin;
+        if (count < 3) {
+            continue;
+        }
+        for (std::size_t i = 0; i < count; i++) {
+            const Vector2& a = polygons.points[contour.begin + i];
+            const Vector2& b = polygons.points[contour.begin + (i + 1) % count];
+            if (a.y == b.y) {
+                continue;
+            }
+            edges.push_back(a.y < b.y ? SweepEdge{a, b, 1} : SweepEdge{b, a, -1});
+            stops.push_back(a.y);
+        }
+    }
+    if (edges.empty()) {
+        return;
+    }
+
+    std::sort(edges.begin(), edges.end(), [](const SweepEdge& a, const SweepEdge& b) {return a.top.y < b.top.y;});
+    std::sort(stops.begin(), stops.end());
+    stops.erase(std::unique(stops.begin(), stops.end()), stops.end());
+
+    auto x_at = [](const SweepEdge& edge, real_t y) {
+        return edge.top.x + (y - edge.top.y) * (edge.bottom.x - edge.top.x) / (edge.bottom.y - edge.top.y);
+    };
+
+    // Sweep down through slabs between consecutive stops, where the same edges stay active
+    active.clear();
+    std::size_t next_edge = 0;
+    for (std::size_t stop = 0; stop + 1 < stops.size(); stop++) {
+        real_t slab_top = stops[stop];
+        real_t slab_bottom = stops[stop + 1];
+
+        while (next_edge < edges.size() && edges[next_edge].top.y <= slab_top) {
+            active.push_back(next_edge++);
+        }
+        active.erase(std::remove_if(active.begin(), active.end(), [&](std::size_t i) {
+            return edges[i].bottom.y <= slab_top;
+        }), active.end());
+
+        real_t top = slab_top;
+        while (top < slab_bottom) {
+            // Edges can cross inside the slab; split it at the first crossing found until none are left
+            real_t bottom = slab_bottom;
+            bool thin = false;
+            while (true) {
+                spans.clear();
+                for (std::size_t i : active) {
+                    spans.push_back(SweepSpan{x_at(edges[i], top), x_at(edges[i], bottom), edges[i].winding});
+                }
+                if (thin) {
+                    break;
+                }
+
+                std::sort(spans.begin(), spans.end(), [](const SweepSpan& a, const SweepSpan& b) {
+                    return a.x_top < b.x_top || (a.x_top == b.x_top && a.x_bottom < b.x_bottom);
+                });
+                std::size_t crossing = spans.size();
+                for (std::size_t i = 0; i + 1 < spans.size(); i++) {
+                    if (spans[i].x_bottom > spans[i + 1].x_bottom + SWEEP_EPSILON) {
+                        crossing = i;
+                        break;
+                    }
+                }
+                if (crossing == spans.size()) {
+                    break;
+                }
+
+                real_t gap_top = spans[crossing + 1].x_top - spans[crossing].x_top;
+                real_t gap_bottom = spans[crossing + 1].x_bottom - spans[crossing].x_bottom;
+                real_t y = top + (bottom - top) * gap_top / (gap_top - gap_bottom);
+                if (y >= bottom - MIN_SLAB_HEIGHT / 2) {
+                    break;
+                }
+                if (y <= top + MIN_SLAB_HEIGHT) {
+                    // Too close to the top to split; a sliver this thin can't be drawn wrong visibly
+                    bottom = std::min(bottom, top + MIN_SLAB_HEIGHT);
+                    if (!(bottom > top)) {
+                        bottom = slab_bottom;
+                    }
+                    thin = true;
+                } else {
+                    bottom = y;
+                }
+            }
+
+            // Spans are in order across the slab now, bar rounding in slabs too thin to split
+            std::sort(spans.begin(), spans.end(), [](const SweepSpan& a, const SweepSpan& b) {
+                return a.x_top + a.x_bottom < b.x_top + b.x_bottom;
+            });
+
+            int winding = 0;
+            const SweepSpan* left = nullptr;
+            for (const auto& span : spans) {
+                int previous_winding = winding;
+                winding += span.winding;
+                if (previous_winding == 0 && winding != 0) {
+                    left = &span;
+                } else if (previous_winding != 0 && winding == 0 && left != nullptr) {
+                    // A trapezoid between the edges where the winding became nonzero and returned to zero
+                    bool top_open = span.x_top - left->x_top > SWEEP_EPSILON;
+                    bool bottom_open = span.x_bottom - left->x_bottom > SWEEP_EPSILON;
+                    if (top_open && bottom_open) {
+                        std::uint32_t top_left = add_vertex(mesh, paint, left->x_top, top);
+                        std::uint32_t top_right = add_vertex(mesh, paint, span.x_top, top);
+                        std::uint32_t bottom_right = add_vertex(mesh, paint, span.x_bottom, bottom);
+                        std::uint32_t bottom_left = add_vertex(mesh, paint, left->x_bottom, bottom);
+                        add_triangle(mesh, top_left, top_right, bottom_right);
+                        add_triangle(mesh, top_left, bottom_right, bottom_left);
+                    } else if (top_open || bottom_open) {
+                        std::uint32_t top_left = add_vertex(mesh, paint, left->x_top, top);
+                        if (top_open) {
+                            std::uint32_t top_right = add_vertex(mesh, paint, span.x_top, top);
+                            add_triangle(mesh, top_left, top_right, add_vertex(mesh, paint, left->x_bottom, bottom));
+                        } else {
+                            std::uint32_t bottom_right = add_vertex(mesh, paint, span.x_bottom, bottom);
+                            add_triangle(mesh, top_left, bottom_right, add_vertex(mesh, paint, left->x_bottom, bottom));
+                        }
+                    }
+                    left = nullptr;
+                }
+            }
+
+            top = bottom;
+        }
+    }
+}
+
+}
@@ -0,0 +1,80 @@
+#include "Trace.hpp"
+
+#include <atomic>
+#include <iomanip>
+
+namespace milsymbol {
+
+namespace {
+
+std::atomic<const TraceHooks*> active_trace_hooks{nullptr};
+
+/// Numbers threads in the order they first write an event, for readable track IDs
+int get_thread_index() noexcept {
+    static std::atomic<int> next_index{1};
+    thread_local int index = next_index.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+}
+
+bool is_tracing_compiled_in() noexcept {
+#ifdef MILSYMBOL_TRACING
+    return true;
+#else
+    return false;
+#endif
+}
+
+void set_trace_hooks(const TraceHooks* hooks) noexcept {
+    active_trace_hooks.store(hooks, std::memory_order_release);
+}
+
+const TraceHooks* get_trace_hooks() noexcept {
+    return active_trace_hooks.load(std::memory_order_acquire);
+}
+
+ChromeTraceWriter::ChromeTraceWriter(const std::string& path) : file{path}, start{clock::now()} {
+    hooks.begin = &ChromeTraceWriter::begin;
+    hooks.end = &ChromeTraceWriter::end;
+    hooks.user = this;
+
+    if (file) {
+        file << std::fixed << std::setprecision(3) << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    }
+}
+
+ChromeTraceWriter::~ChromeTraceWriter() noexcept {
+    if (get_trace_hooks() == &hooks) {
+        set_trace_hooks(nullptr);
+    }
+
+    std::lock_guard<std::mutex> lock{mutex};
+    if (file) {
+        file << "\n]}" << std::endl;
+    }
+}
+
+void ChromeTraceWriter::begin(void* user, RenderStage stage, std::string_view sidc) noexcept {
+    static_cast<ChromeTraceWriter*>(user)->write_event('B', stage, sidc);
+}
+
+void ChromeTraceWriter::end(void* user, RenderStage stage, std::string_view sidc) noexcept {
+    static_cast<ChromeTraceWriter*>(user)->write_event('E', stage, sidc);
+}
+
+void ChromeTraceWriter::write_event(char phase, RenderStage stage, std::string_view sidc) noexcept {
+    // Timestamps are microseconds since the writer was created
+    double ts = std::chrono::duration<double, std::micro>(clock::now() - start).count();
+    int tid = get_thread_index();
+
+    std::lock_guard<std::mutex> lock{mutex};
+    if (!file) {
+        return;
+    }
+    file << (first_event ? "\n" : ",\n") << "{\"name\":\"" << get_name(stage) << "\",\"cat\":\"milsymbol\",\"ph\":\"" << phase <<
+        "\",\"ts\":" << ts << ",\"pid\":1,\"tid\":" << tid << ",\"args\":{\"sidc\":\"" << sidc << "\"}}";
+    first_event = false;
+}
+
+}
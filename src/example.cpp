@@ -1,8 +1,13 @@
 #include "Symbol.hpp"
+#include "SpriteSheet.hpp"
+#include "Atlas.hpp"
 
 #include <iostream>
 #include <fstream>
 #include <array>
+#include <chrono>
+#include <vector>
+#include <memory>
 
 /**
  * @brief Examples of constructing and saving symbols as SVG.
@@ -99,5 +104,188 @@ int main(int argc, const char** argv) {
     example_4_file << example_4_symbol.get_svg_string(example_4_style);
     example_4_file.close();
 
+    /*
+     * Example 5
+     *
+     * Declare fixed symbols as compile-time constants with the _sidc literal. A malformed
+     * SIDC here (wrong length or non-numerals) fails to compile.
+     */
+
+    using namespace milsymbol::literals;
+    static constexpr milsymbol::Symbol example_5_symbol = "10031000001211000000"_sidc;
+    static_assert(example_5_symbol.get_affiliation() == milsymbol::Affiliation::FRIEND);
+    static_assert(example_5_symbol.get_entity() == milsymbol::Entities::LAND_UNIT_INFANTRY);
+
+    // The SIDC round-trips at compile time, too
+    static_assert([] {
+        char sidc[20] = {};
+        example_5_symbol.to_sidc(sidc);
+        return milsymbol::Symbol::from_sidc(std::string_view{sidc, 20}) == example_5_symbol;
+    }());
+
+    std::ofstream example_5_file;
+    example_5_file.open("example_5.svg", std::ios_base::out);
+    example_5_file << example_5_symbol.get_svg_string();
+    example_5_file.close();
+
+    /*
+     * Example 6
+     *
+     * Build a catalog of every entity and modifier, with a spread of identities, echelons,
+     * mobilities and headquarters/task force flags, and encode it back to SIDCs in one batch.
+     */
+
+    static constexpr std::array<milsymbol::Affiliation, 7> ALL_AFFILIATIONS = {
+        milsymbol::Affiliation::PENDING, milsymbol::Affiliation::UNKNOWN, milsymbol::Affiliation::ASSUMED_FRIEND,
+        milsymbol::Affiliation::FRIEND, milsymbol::Affiliation::NEUTRAL, milsymbol::Affiliation::SUSPECT,
+        milsymbol::Affiliation::HOSTILE
+    };
+
+    std::vector<milsymbol::Symbol> catalog;
+    for (auto symbol_set : milsymbol::Symbol::get_all_symbol_sets()) {
+        auto set = static_cast<milsymbol::SymbolSet>(symbol_set);
+        int index = 0;
+        for (auto entity : milsymbol::Symbol::get_all_entities(set)) {
+            char sidc[30] = {};
+            milsymbol::Symbol{}.with_entity(static_cast<milsymbol::Entities>(symbol_set * 1000000 + entity)).to_sidc(sidc);
+
+            // Vary the remaining fields deterministically over the catalog
+            milsymbol::Symbol symbol = milsymbol::Symbol::from_sidc(std::string_view{sidc, 30})
+                                           .with_affiliation(ALL_AFFILIATIONS[index % ALL_AFFILIATIONS.size()])
+                                           .with_context(static_cast<milsymbol::Context>(index % 3))
+                                           .as_headquarters(index % 2)
+                                           .as_task_force(index % 5 == 0)
+                                           .as_feint_or_dummy(index % 3 == 0);
+            if (index % 4 == 0) {
+                symbol.with_mobility(static_cast<milsymbol::Mobility>(index / 4 % 14));
+            } else {
+                symbol.with_echelon(static_cast<milsymbol::Echelon>(index % 15 - 1));
+            }
+            catalog.push_back(symbol);
+            index++;
+        }
+
+        for (auto m1 : milsymbol::Symbol::get_all_modifier_1s(set)) {
+            char sidc[21] = "10031000000000000000";
+            sidc[4] = '0' + symbol_set / 10;
+            sidc[5] = '0' + symbol_set % 10;
+            sidc[16] = '0' + m1 / 10;
+            sidc[17] = '0' + m1 % 10;
+            catalog.push_back(milsymbol::Symbol::from_sidc(sidc));
+        }
+
+        for (auto m2 : milsymbol::Symbol::get_all_modifier_2s(set)) {
+            char sidc[21] = "10061000000000000000";
+            sidc[4] = '0' + symbol_set / 10;
+            sidc[5] = '0' + symbol_set % 10;
+            sidc[18] = '0' + m2 / 10;
+            sidc[19] = '0' + m2 % 10;
+            catalog.push_back(milsymbol::Symbol::from_sidc(sidc));
+        }
+    }
+
+    auto catalog_sidcs = std::make_unique<char[][20]>(catalog.size());
+    milsymbol::Symbol::to_sidc(catalog.data(), catalog.size(), catalog_sidcs.get());
+
+    std::cout << "Encoded " << catalog.size() << " catalog symbols, starting with " <<
+        std::string_view{catalog_sidcs[0], 20} << std::endl;
+
+    /*
+     * Example 7
+     *
+     * Write every land unit entity, as a friendly and a hostile battalion, to one SVG sprite sheet
+     * that shares frame and icon definitions between symbols.
+     */
+
+    milsymbol::SpriteSheetBuilder sheet_builder;
+    std::size_t standalone_bytes = 0;
+    for (auto entity : milsymbol::Symbol::get_all_entities(milsymbol::SymbolSet::LAND_UNIT)) {
+        for (auto affiliation : {milsymbol::Affiliation::FRIEND, milsymbol::Affiliation::HOSTILE}) {
+            milsymbol::Symbol sheet_symbol = milsymbol::Symbol{}
+                .with_entity(static_cast<milsymbol::Entities>(static_cast<int>(milsymbol::SymbolSet::LAND_UNIT) * 1000000 + entity))
+                .with_affiliation(affiliation)
+                .with_echelon(milsymbol::Echelon::BATTALION);
+            sheet_builder.add(sheet_symbol);
+            standalone_bytes += sheet_symbol.get_svg_string().size();
+        }
+    }
+
+    milsymbol::SpriteSheet sheet = sheet_builder.build();
+    std::cout << "Sprite sheet of " << sheet.sprites.size() << " symbols: " << sheet.svg.size() <<
+        " bytes, versus " << standalone_bytes << " bytes as standalone SVGs" << std::endl;
+
+    std::ofstream example_7_file;
+    example_7_file.open("example_7.svg", std::ios_base::out);
+    example_7_file << sheet.svg;
+    example_7_file.close();
+
+    /*
+     * Example 8
+     *
+     * Pack the whole catalog from example 6 into a texture atlas, then stream it out as an SVG
+     * sheet plus a JSON table of where each symbol is.
+     */
+
+    auto atlas_start = std::chrono::steady_clock::now();
+    milsymbol::AtlasBuilder atlas_builder;
+    for (const auto& catalog_symbol : catalog) {
+        atlas_builder.add(catalog_symbol);
+    }
+    milsymbol::Atlas atlas = atlas_builder.build();
+    auto atlas_end = std::chrono::steady_clock::now();
+
+    std::cout << "Packed " << atlas.placements.size() << " symbols into a " << atlas.width << "x" << atlas.height <<
+        " atlas in " << std::chrono::duration<double, std::milli>(atlas_end - atlas_start).count() << " ms" << std::endl;
+
+    std::ofstream example_8_file;
+    example_8_file.open("example_8.svg", std::ios_base::out);
+    atlas.write_svg(example_8_file);
+    example_8_file.close();
+
+    std::ofstream example_8_metadata;
+    example_8_metadata.open("example_8.json", std::ios_base::out);
+    atlas.write_metadata(example_8_metadata);
+    example_8_metadata.close();
+
+    /*
+     * Example 9
+     *
+     * Feed the catalog into an incremental atlas a few symbols at a time, as a live display would
+     * when new tracks appear, growing its capacity when it fills up. Only the newly placed
+     * rectangles need to be rendered and uploaded each time.
+     */
+
+    milsymbol::IncrementalAtlas live_atlas({}, 1024, 1024);
+    std::size_t dirty_count = 0;
+    std::size_t dirty_bytes = 0;
+    std::size_t growths = 0;
+    auto live_start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < catalog.size(); i++) {
+        if (live_atlas.insert(catalog[i]) == nullptr) {
+            live_atlas.reserve(live_atlas.get_height() * 2);
+            growths++;
+            live_atlas.insert(catalog[i]);
+        }
+
+        // Patch the texture every 16 symbols
+        if (i % 16 == 15 || i + 1 == catalog.size()) {
+            for (const auto& dirty_rect : live_atlas.take_dirty_rects()) {
+                dirty_count++;
+                dirty_bytes += dirty_rect.svg.size();
+            }
+        }
+    }
+    auto live_end = std::chrono::steady_clock::now();
+
+    std::cout << "Incrementally placed " << live_atlas.size() << " symbols in a " << live_atlas.get_width() << "x" <<
+        live_atlas.get_height() << " atlas, " << live_atlas.get_used_height() << " rows used (" << growths << " growths, " << dirty_count << " dirty rectangles, " <<
+        dirty_bytes << " bytes of SVG) in " << std::chrono::duration<double, std::milli>(live_end - live_start).count() <<
+        " ms" << std::endl;
+
+    std::ofstream example_9_file;
+    example_9_file.open("example_9.svg", std::ios_base::out);
+    live_atlas.get_atlas().write_svg(example_9_file);
+    example_9_file.close();
+
     return 0;
 }
@@ -0,0 +1,294 @@
+// Generated by generation/parse.py from the "air" symbol set
+#include "Schema.hpp"
+
+namespace milsymbol::_impl {
+
+namespace {
+
+// Path data used by more than one draw command
+constexpr const char PATH_0[] = "m 75.1,90.3 19.6,0 0,-6.5 10.5,0 0,6.5 19.6,0 0,9.7 -19.6,0 0,16.2 6.5,0 0,3.2 -23.6,0 0,-3.2 6.5,0 0,-16.2 -19.6,0 z m 21.6,-6.5 0,-3.2 6.5,0 0,3.2";
+constexpr const char PATH_1[] = "M60,85 l40,15 40,-15 0,30 -40,-15 -40,15 z";
+constexpr const char PATH_2[] = "m 60,84 40,20 40,-20 0,8 -40,25 -40,-25 z";
+constexpr const char PATH_3[] = "M95,110 l0,10 10,0 0,-10 z";
+constexpr const char PATH_4[] = "m 110,110 10,10 10,0 -5,-15 m 0,-10 5,-15 -10,0 -10,10 m 17.2,10 c 0,6.1 -12.2,11.1 -27.2,11.1 -15,0 -27.2,-5 -27.2,-11.1 0,-6.1 12.2,-11.1 27.2,-11.1 15,0 27.2,5 27.2,11.1 z";
+constexpr const char PATH_5[] = "M 75,110 85,95 m -5,20 c 0,2.8 -2.2,5 -5,5 -2.8,0 -5,-2.2 -5,-5 0,-2.8 2.2,-5 5,-5 2.8,0 5,2.2 5,5 z m 15,-6 0,11 10,0 0,-11 m 10,-14 c 0,8.3 -6.7,15 -15,15 -8.3,0 -15,-6.7 -15,-15 0,-8.3 6.7,-15 15,-15 8.3,0 15,6.7 15,15 z";
+
+LayerTable build_entity_table() {
+	std::vector<DrawCommand> commands;
+	commands.reserve(53);
+	commands.push_back(DrawCommand::autotext("MIL"));
+	commands.push_back(DrawCommand::path(PATH_0, BoundingBox{75, 80.6, 124.8, 119.4}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("M93,83 l14,0 0,10 10,0 0,14 -10,0 0,10 -14,0 0,-10 -10,0 0,-14 10,0 Z", BoundingBox{83, 83, 117, 117}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::autotext("A"));
+	commands.push_back(DrawCommand::autotext("B"));
+	commands.push_back(DrawCommand::autotext("F"));
+	commands.push_back(DrawCommand::autotext("F/B"));
+	commands.push_back(DrawCommand::autotext("C"));
+	commands.push_back(DrawCommand::autotext("J"));
+	commands.push_back(DrawCommand::autotext("K"));
+	commands.push_back(DrawCommand::autotext("P"));
+	commands.push_back(DrawCommand::autotext("R"));
+	commands.push_back(DrawCommand::autotext("T"));
+	commands.push_back(DrawCommand::autotext("U"));
+	commands.push_back(DrawCommand::autotext("V"));
+	commands.push_back(DrawCommand::autotext("ACP"));
+	commands.push_back(DrawCommand::autotext("AEW"));
+	commands.push_back(DrawCommand::autotext("ASUW"));
+	commands.push_back(DrawCommand::autotext("ASW"));
+	commands.push_back(DrawCommand::autotext("COM"));
+	commands.push_back(DrawCommand::autotext("CSAR"));
+	commands.push_back(DrawCommand::autotext("ES"));
+	commands.push_back(DrawCommand::autotext("GOV"));
+	commands.push_back(DrawCommand::autotext("MCM"));
+	commands.push_back(DrawCommand::autotext("PR"));
+	commands.push_back(DrawCommand::autotext("SAR"));
+	commands.push_back(DrawCommand::autotext("SOF"));
+	commands.push_back(DrawCommand::autotext("UL"));
+	commands.push_back(DrawCommand::autotext("PH"));
+	commands.push_back(DrawCommand::autotext("VIP"));
+	commands.push_back(DrawCommand::autotext("SEAD"));
+	commands.push_back(DrawCommand::autotext("PX"));
+	commands.push_back(DrawCommand::autotext("E"));
+	commands.push_back(DrawCommand::autotext("EA"));
+	commands.push_back(DrawCommand::path(PATH_1, BoundingBox{60, 85, 140, 115}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path(PATH_2, BoundingBox{60, 84, 140, 117}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::path("m 70,85 30,10 30,-10 0,-5 -30,5 -30,-5 z m -10,5 40,15 40,-15 0,30 -40,-15 -40,15 z", BoundingBox{60, 80, 140, 120}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::circle(Vector2{100, 95}, 15).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path(PATH_3, BoundingBox{95, 110, 105, 120}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path(PATH_4, BoundingBox{72.8, 80, 130, 120}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path(PATH_5, BoundingBox{70, 80, 115, 120}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::autotext("CIV").with_fill(ColorType::WHITE).with_stroke(ColorType::ICON).with_stroke_width(4.0));
+	commands.push_back(DrawCommand::path(PATH_0, BoundingBox{75, 80.6, 124.8, 119.4}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::path(PATH_1, BoundingBox{60, 85, 140, 115}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::path(PATH_2, BoundingBox{60, 84, 140, 117}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::circle(Vector2{100, 95}, 15).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::path(PATH_3, BoundingBox{95, 110, 105, 120}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::path(PATH_4, BoundingBox{72.8, 80, 130, 120}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::path(PATH_5, BoundingBox{70, 80, 115, 120}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::autotext("WPN"));
+	commands.push_back(DrawCommand::autotext("BOMB"));
+	commands.push_back(DrawCommand::path("M 85 81 L 65 98 L 85 119 L 85 81 z M 110 81 L 90 98 L 110 119 L 110 81 z M 135 81 L 115 98 L 135 119 L 135 81 z", BoundingBox{65, 81, 135, 119}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::autotext("MAN"));
+
+	static constexpr uint16_t COMMAND_INDICES[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52};
+	static constexpr LayerEntry ENTRIES[] = {
+		{1110000, 0, 1, false, std::nullopt} /* military */,
+		{1110100, 1, 1, false, BoundingBox{75, 80.6, 124.8, 119.4}} /* fixed wing */,
+		{1110101, 2, 1, false, BoundingBox{83, 83, 117, 117}} /* medevac */,
+		{1110102, 3, 1, false, std::nullopt} /* attack */,
+		{1110103, 4, 1, false, std::nullopt} /* bomber */,
+		{1110104, 5, 1, false, std::nullopt} /* fighter */,
+		{1110105, 6, 1, false, std::nullopt} /* fighter/bomber */,
+		{1110107, 7, 1, false, std::nullopt} /* cargo */,
+		{1110108, 8, 1, false, std::nullopt} /* electronic combat */,
+		{1110109, 9, 1, false, std::nullopt} /* tanker */,
+		{1110110, 10, 1, false, std::nullopt} /* patrol */,
+		{1110111, 11, 1, false, std::nullopt} /* reconnaissance */,
+		{1110112, 12, 1, false, std::nullopt} /* trainer */,
+		{1110113, 13, 1, false, std::nullopt} /* utility */,
+		{1110114, 14, 1, false, std::nullopt} /* vertical take-off and landing */,
+		{1110115, 15, 1, false, std::nullopt} /* airborne command post */,
+		{1110116, 16, 1, false, std::nullopt} /* airborne early warning */,
+		{1110117, 17, 1, false, std::nullopt} /* anti-surface warfare */,
+		{1110118, 18, 1, false, std::nullopt} /* anti-submarine warfare */,
+		{1110119, 19, 1, false, std::nullopt} /* communications */,
+		{1110120, 20, 1, false, std::nullopt} /* combat search and rescue */,
+		{1110121, 21, 1, false, std::nullopt} /* electronic support */,
+		{1110122, 22, 1, false, std::nullopt} /* government */,
+		{1110123, 23, 1, false, std::nullopt} /* mine countermeasures */,
+		{1110124, 24, 1, false, std::nullopt} /* personnel recovery */,
+		{1110125, 25, 1, false, std::nullopt} /* search and rescue */,
+		{1110126, 26, 1, false, std::nullopt} /* special operations forces */,
+		{1110127, 27, 1, false, std::nullopt} /* ultralight */,
+		{1110128, 28, 1, false, std::nullopt} /* photographic reconnaissance */,
+		{1110129, 29, 1, false, std::nullopt} /* very important person */,
+		{1110130, 30, 1, false, std::nullopt} /* suppression of enemy air defense */,
+		{1110131, 31, 1, false, std::nullopt} /* passenger */,
+		{1110132, 32, 1, false, std::nullopt} /* escort */,
+		{1110133, 33, 1, false, std::nullopt} /* electronic attack */,
+		{1110200, 34, 1, false, BoundingBox{60, 85, 140, 115}} /* rotary wing */,
+		{1110300, 35, 1, false, BoundingBox{60, 84, 140, 117}} /* unmanned aerial vehicle */,
+		{1110400, 36, 1, false, BoundingBox{60, 80, 140, 120}} /* vertical takeoff UAV */,
+		{1110500, 37, 2, false, BoundingBox{85, 80, 115, 120}} /* lighter than air */,
+		{1110600, 39, 1, false, BoundingBox{72.8, 80, 130, 120}} /* airship */,
+		{1110700, 40, 1, false, BoundingBox{70, 80, 115, 120}} /* tethered lighter than air */,
+		{1120000, 41, 1, true, std::nullopt} /* civilian */,
+		{1120100, 42, 1, true, BoundingBox{75, 80.6, 124.8, 119.4}} /* civilian fixed wing */,
+		{1120200, 43, 1, true, BoundingBox{60, 85, 140, 115}} /* civilian rotary wing */,
+		{1120300, 44, 1, true, BoundingBox{60, 84, 140, 117}} /* civilian unmanned aerial vehicle */,
+		{1120400, 45, 2, true, BoundingBox{85, 80, 115, 120}} /* civilian lighter than air */,
+		{1120500, 47, 1, true, BoundingBox{72.8, 80, 130, 120}} /* civilian airship */,
+		{1120600, 48, 1, true, BoundingBox{70, 80, 115, 120}} /* civilian tethered lighter than air */,
+		{1130000, 49, 1, false, std::nullopt} /* weapon */,
+		{1130100, 50, 1, false, std::nullopt} /* bomb */,
+		{1130200, 51, 1, false, BoundingBox{65, 81, 135, 119}} /* decoy */,
+		{1140000, 52, 1, false, std::nullopt} /* manual track */
+	};
+	return build_layer_table(ENTRIES, COMMAND_INDICES, commands);
+}
+
+LayerTable build_modifier_1_table() {
+	std::vector<DrawCommand> commands;
+	commands.reserve(41);
+	commands.push_back(DrawCommand::textm1("A"));
+	commands.push_back(DrawCommand::textm1("B"));
+	commands.push_back(DrawCommand::textm1("C"));
+	commands.push_back(DrawCommand::textm1("D"));
+	commands.push_back(DrawCommand::textm1("I"));
+	commands.push_back(DrawCommand::textm1("K"));
+	commands.push_back(DrawCommand::textm1("U"));
+	commands.push_back(DrawCommand::textm1("V"));
+	commands.push_back(DrawCommand::textm1("PX"));
+	commands.push_back(DrawCommand::textm1("UL"));
+	commands.push_back(DrawCommand::textm1("ACP"));
+	commands.push_back(DrawCommand::textm1("AEW"));
+	commands.push_back(DrawCommand::textm1("GOV"));
+	commands.push_back(DrawCommand::path("M95.5,80 l9,0 0,-9 9,0 0,-9 -9,0 0,-9 -9,0 0,9 -9,0 0,9 9,0 Z", BoundingBox{86.5, 53, 113.5, 80}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::textm1("E"));
+	commands.push_back(DrawCommand::textm1("J"));
+	commands.push_back(DrawCommand::textm1("P"));
+	commands.push_back(DrawCommand::textm1("R"));
+	commands.push_back(DrawCommand::textm1("T"));
+	commands.push_back(DrawCommand::textm1("PH"));
+	commands.push_back(DrawCommand::textm1("PR"));
+	commands.push_back(DrawCommand::textm1("ASW"));
+	commands.push_back(DrawCommand::textm1("COM"));
+	commands.push_back(DrawCommand::textm1("ES"));
+	commands.push_back(DrawCommand::textm1("MCM"));
+	commands.push_back(DrawCommand::textm1("SAR"));
+	commands.push_back(DrawCommand::textm1("SOF"));
+	commands.push_back(DrawCommand::textm1("SUW"));
+	commands.push_back(DrawCommand::textm1("VIP"));
+	commands.push_back(DrawCommand::textm1("CSAR"));
+	commands.push_back(DrawCommand::textm1("SEAD"));
+	commands.push_back(DrawCommand::textm1("ASUW"));
+	commands.push_back(DrawCommand::textm1("F/B"));
+	commands.push_back(DrawCommand::textm1("IC"));
+	commands.push_back(DrawCommand::textm1("EA"));
+	commands.push_back(DrawCommand::textm1("MM"));
+	commands.push_back(DrawCommand::textm1("H"));
+	commands.push_back(DrawCommand::textm1("LP"));
+	commands.push_back(DrawCommand::textm1("60R"));
+	commands.push_back(DrawCommand::textm1("HJ"));
+	commands.push_back(DrawCommand::textm1("CYB"));
+
+	static constexpr uint16_t COMMAND_INDICES[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40};
+	static constexpr LayerEntry ENTRIES[] = {
+		{101, 0, 1, false, std::nullopt} /* attack */,
+		{102, 1, 1, false, std::nullopt} /* bomber */,
+		{103, 2, 1, false, std::nullopt} /* cargo */,
+		{104, 3, 1, false, std::nullopt} /* fighter */,
+		{105, 4, 1, false, std::nullopt} /* interceptor */,
+		{106, 5, 1, false, std::nullopt} /* tanker */,
+		{107, 6, 1, false, std::nullopt} /* utility */,
+		{108, 7, 1, false, std::nullopt} /* VTOL */,
+		{109, 8, 1, false, std::nullopt} /* passenger */,
+		{110, 9, 1, false, std::nullopt} /* ultralight */,
+		{111, 10, 1, false, std::nullopt} /* airborne command post */,
+		{112, 11, 1, false, std::nullopt} /* airborne early warning */,
+		{113, 12, 1, false, std::nullopt} /* government */,
+		{114, 13, 1, false, BoundingBox{86.5, 53, 113.5, 80}} /* medevac */,
+		{115, 14, 1, false, std::nullopt} /* escort */,
+		{116, 15, 1, false, std::nullopt} /* jammer */,
+		{117, 16, 1, false, std::nullopt} /* patrol */,
+		{118, 17, 1, false, std::nullopt} /* reconnaissance */,
+		{119, 18, 1, false, std::nullopt} /* trainer */,
+		{120, 19, 1, false, std::nullopt} /* photographic reconnaissance */,
+		{121, 20, 1, false, std::nullopt} /* personnel recovery */,
+		{122, 21, 1, false, std::nullopt} /* anti-submarine warfare */,
+		{123, 22, 1, false, std::nullopt} /* communications */,
+		{124, 23, 1, false, std::nullopt} /* electronic support */,
+		{125, 24, 1, false, std::nullopt} /* mine countermeasures */,
+		{126, 25, 1, false, std::nullopt} /* search and rescue */,
+		{127, 26, 1, false, std::nullopt} /* special operations forces */,
+		{128, 27, 1, false, std::nullopt} /* surface warfare */,
+		{129, 28, 1, false, std::nullopt} /* VIP transport */,
+		{130, 29, 1, false, std::nullopt} /* combat search and rescue */,
+		{131, 30, 1, false, std::nullopt} /* suppression of enemy air defense */,
+		{132, 31, 1, false, std::nullopt} /* antisurface warfare */,
+		{133, 32, 1, false, std::nullopt} /* fighter/bomber */,
+		{134, 33, 1, false, std::nullopt} /* intensive care */,
+		{135, 34, 1, false, std::nullopt} /* electronic attack */,
+		{136, 35, 1, false, std::nullopt} /* multi-mission */,
+		{137, 36, 1, false, std::nullopt} /* hijacking */,
+		{138, 37, 1, false, std::nullopt} /* ASW helo - LAMPS */,
+		{139, 38, 1, false, std::nullopt} /* ASW helo - SH-60R */,
+		{140, 39, 1, false, std::nullopt} /* hijacker */,
+		{141, 40, 1, false, std::nullopt} /* cyberspace */
+	};
+	return build_layer_table(ENTRIES, COMMAND_INDICES, commands);
+}
+
+LayerTable build_modifier_2_table() {
+	std::vector<DrawCommand> commands;
+	commands.reserve(12);
+	commands.push_back(DrawCommand::textm2("H"));
+	commands.push_back(DrawCommand::textm2("M"));
+	commands.push_back(DrawCommand::textm2("L"));
+	commands.push_back(DrawCommand::textm2("B"));
+	commands.push_back(DrawCommand::textm2("D"));
+	commands.push_back(DrawCommand::textm2("B/D"));
+	commands.push_back(DrawCommand::textm2("CR"));
+	commands.push_back(DrawCommand::textm2("SR"));
+	commands.push_back(DrawCommand::textm2("MR"));
+	commands.push_back(DrawCommand::textm2("LR"));
+	commands.push_back(DrawCommand::textm2("DL"));
+	commands.push_back(DrawCommand::textm2("CYB"));
+
+	static constexpr uint16_t COMMAND_INDICES[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+	static constexpr LayerEntry ENTRIES[] = {
+		{101, 0, 1, false, std::nullopt} /* heavy */,
+		{102, 1, 1, false, std::nullopt} /* medium */,
+		{103, 2, 1, false, std::nullopt} /* light */,
+		{104, 3, 1, false, std::nullopt} /* boom-only */,
+		{105, 4, 1, false, std::nullopt} /* drogue-only */,
+		{106, 5, 1, false, std::nullopt} /* boom and drogue */,
+		{107, 6, 1, false, std::nullopt} /* close range */,
+		{108, 7, 1, false, std::nullopt} /* short range */,
+		{109, 8, 1, false, std::nullopt} /* medium range */,
+		{110, 9, 1, false, std::nullopt} /* long range */,
+		{111, 10, 1, false, std::nullopt} /* downlinked */,
+		{112, 11, 1, false, std::nullopt} /* cyberspace */
+	};
+	return build_layer_table(ENTRIES, COMMAND_INDICES, commands);
+}
+
+const LayerTable& get_table(IconType symbol_type) noexcept {
+	if (symbol_type == IconType::ENTITY) {
+		static const LayerTable ENTITY_TABLE = build_entity_table();
+		return ENTITY_TABLE;
+	} else if (symbol_type == IconType::MODIFIER_1) {
+		static const LayerTable MODIFIER_1_TABLE = build_modifier_1_table();
+		return MODIFIER_1_TABLE;
+	}
+
+	static const LayerTable MODIFIER_2_TABLE = build_modifier_2_table();
+	return MODIFIER_2_TABLE;
+}
+
+}
+
+SymbolLayer get_air_layer(int32_t code, IconType symbol_type) noexcept {
+	return get_table(symbol_type).find(code);
+}
+
+std::optional<BoundingBox> get_air_bbox(int32_t code, IconType symbol_type) noexcept {
+	return get_table(symbol_type).find_bbox(code);
+}
+
+std::vector<int32_t> get_air_symbols(IconType symbol_type) noexcept {
+	if (symbol_type == IconType::ENTITY) {
+		return {110000 /*military*/, 110100 /*fixed wing*/, 110101 /*medevac*/, 110102 /*attack*/, 110103 /*bomber*/, 110104 /*fighter*/, 110105 /*fighter/bomber*/, 110107 /*cargo*/, 110108 /*electronic combat*/, 110109 /*tanker*/, 110110 /*patrol*/, 110111 /*reconnaissance*/, 110112 /*trainer*/, 110113 /*utility*/, 110114 /*vertical take-off and landing*/, 110115 /*airborne command post*/, 110116 /*airborne early warning*/, 110117 /*anti-surface warfare*/, 110118 /*anti-submarine warfare*/, 110119 /*communications*/, 110120 /*combat search and rescue*/, 110121 /*electronic support*/, 110122 /*government*/, 110123 /*mine countermeasures*/, 110124 /*personnel recovery*/, 110125 /*search and rescue*/, 110126 /*special operations forces*/, 110127 /*ultralight*/, 110128 /*photographic reconnaissance*/, 110129 /*very important person*/, 110130 /*suppression of enemy air defense*/, 110131 /*passenger*/, 110132 /*escort*/, 110133 /*electronic attack*/, 110200 /*rotary wing*/, 110300 /*unmanned aerial vehicle*/, 110400 /*vertical takeoff UAV*/, 110500 /*lighter than air*/, 110600 /*airship*/, 110700 /*tethered lighter than air*/, 120000 /*civilian*/, 120100 /*civilian fixed wing*/, 120200 /*civilian rotary wing*/, 120300 /*civilian unmanned aerial vehicle*/, 120400 /*civilian lighter than air*/, 120500 /*civilian airship*/, 120600 /*civilian tethered lighter than air*/, 130000 /*weapon*/, 130100 /*bomb*/, 130200 /*decoy*/, 140000 /*manual track*/};
+	}
+	else if (symbol_type == IconType::MODIFIER_1) {
+		return {1 /*attack*/, 2 /*bomber*/, 3 /*cargo*/, 4 /*fighter*/, 5 /*interceptor*/, 6 /*tanker*/, 7 /*utility*/, 8 /*VTOL*/, 9 /*passenger*/, 10 /*ultralight*/, 11 /*airborne command post*/, 12 /*airborne early warning*/, 13 /*government*/, 14 /*medevac*/, 15 /*escort*/, 16 /*jammer*/, 17 /*patrol*/, 18 /*reconnaissance*/, 19 /*trainer*/, 20 /*photographic reconnaissance*/, 21 /*personnel recovery*/, 22 /*anti-submarine warfare*/, 23 /*communications*/, 24 /*electronic support*/, 25 /*mine countermeasures*/, 26 /*search and rescue*/, 27 /*special operations forces*/, 28 /*surface warfare*/, 29 /*VIP transport*/, 30 /*combat search and rescue*/, 31 /*suppression of enemy air defense*/, 32 /*antisurface warfare*/, 33 /*fighter/bomber*/, 34 /*intensive care*/, 35 /*electronic attack*/, 36 /*multi-mission*/, 37 /*hijacking*/, 38 /*ASW helo - LAMPS*/, 39 /*ASW helo - SH-60R*/, 40 /*hijacker*/, 41 /*cyberspace*/};
+	}
+	else if (symbol_type == IconType::MODIFIER_2) {
+		return {1 /*heavy*/, 2 /*medium*/, 3 /*light*/, 4 /*boom-only*/, 5 /*drogue-only*/, 6 /*boom and drogue*/, 7 /*close range*/, 8 /*short range*/, 9 /*medium range*/, 10 /*long range*/, 11 /*downlinked*/, 12 /*cyberspace*/};
+	}
+
+	// Default to nothing
+	return {};
+}
+
+}
@@ -0,0 +1,128 @@
+// Generated by generation/parse.py from the "air missile" symbol set
+#include "Schema.hpp"
+
+namespace milsymbol::_impl {
+
+namespace {
+
+LayerTable build_entity_table() {
+	std::vector<DrawCommand> commands;
+	commands.reserve(1);
+	commands.push_back(DrawCommand::path("M90,135 l0,-10 5,-5 0,-55 5,-5 5,5 0,55 5,5 0,10 -10,-10 z", BoundingBox{90, 60, 110, 135}).with_fill(ColorType::YELLOW));
+
+	static constexpr uint16_t COMMAND_INDICES[] = {0};
+	static constexpr LayerEntry ENTRIES[] = {
+		{2110000, 0, 1, false, BoundingBox{90, 60, 110, 135}} /* missile */
+	};
+	return build_layer_table(ENTRIES, COMMAND_INDICES, commands);
+}
+
+LayerTable build_modifier_1_table() {
+	std::vector<DrawCommand> commands;
+	commands.reserve(10);
+	commands.push_back(DrawCommand::text("A", Vector2{68, 110}, 30));
+	commands.push_back(DrawCommand::text("S", Vector2{68, 110}, 30));
+	commands.push_back(DrawCommand::text("S", Vector2{68, 95}, 30));
+	commands.push_back(DrawCommand::text("U", Vector2{68, 125}, 30));
+	commands.push_back(DrawCommand::text("P", Vector2{68, 125}, 30));
+	commands.push_back(DrawCommand::text("A", Vector2{68, 95}, 30));
+	commands.push_back(DrawCommand::text("B", Vector2{68, 125}, 30));
+	commands.push_back(DrawCommand::text("B", Vector2{68, 110}, 30));
+	commands.push_back(DrawCommand::text("C", Vector2{68, 110}, 30));
+	commands.push_back(DrawCommand::text("I", Vector2{68, 110}, 30));
+
+	static constexpr uint16_t COMMAND_INDICES[] = {0, 1, 2, 3, 2, 4, 5, 6, 7, 8, 9};
+	static constexpr LayerEntry ENTRIES[] = {
+		{201, 0, 1, false, std::nullopt} /* air */,
+		{202, 1, 1, false, std::nullopt} /* surface */,
+		{203, 2, 2, false, std::nullopt} /* subsurface */,
+		{204, 4, 2, false, std::nullopt} /* space */,
+		{205, 6, 2, false, std::nullopt} /* anti-ballistic */,
+		{206, 8, 1, false, std::nullopt} /* ballistic */,
+		{207, 9, 1, false, std::nullopt} /* cruise */,
+		{208, 10, 1, false, std::nullopt} /* interceptor */
+	};
+	return build_layer_table(ENTRIES, COMMAND_INDICES, commands);
+}
+
+LayerTable build_modifier_2_table() {
+	std::vector<DrawCommand> commands;
+	commands.reserve(16);
+	commands.push_back(DrawCommand::text("A", Vector2{132, 110}, 30));
+	commands.push_back(DrawCommand::text("S", Vector2{132, 110}, 30));
+	commands.push_back(DrawCommand::text("S", Vector2{132, 95}, 30));
+	commands.push_back(DrawCommand::text("U", Vector2{132, 125}, 30));
+	commands.push_back(DrawCommand::text("P", Vector2{132, 125}, 30));
+	commands.push_back(DrawCommand::text("L", Vector2{132, 110}, 30));
+	commands.push_back(DrawCommand::text("M", Vector2{132, 110}, 30));
+	commands.push_back(DrawCommand::text("P", Vector2{132, 110}, 30));
+	commands.push_back(DrawCommand::text("2", Vector2{132, 125}, 30));
+	commands.push_back(DrawCommand::text("6", Vector2{132, 125}, 30));
+	commands.push_back(DrawCommand::text("S", Vector2{132, 125}, 30));
+	commands.push_back(DrawCommand::text("R", Vector2{132, 110}, 30));
+	commands.push_back(DrawCommand::text("R", Vector2{132, 125}, 30));
+	commands.push_back(DrawCommand::text("M", Vector2{132, 95}, 30));
+	commands.push_back(DrawCommand::text("I", Vector2{132, 95}, 30));
+	commands.push_back(DrawCommand::text("C", Vector2{132, 125}, 30));
+
+	static constexpr uint16_t COMMAND_INDICES[] = {0, 1, 2, 3, 2, 4, 5, 6, 7, 2, 8, 2, 9, 2, 10, 11, 2, 12, 13, 12, 14, 12, 2, 12, 14, 15};
+	static constexpr LayerEntry ENTRIES[] = {
+		{201, 0, 1, false, std::nullopt} /* air */,
+		{202, 1, 1, false, std::nullopt} /* surface */,
+		{203, 2, 2, false, std::nullopt} /* subsurface */,
+		{204, 4, 2, false, std::nullopt} /* space */,
+		{205, 6, 1, false, std::nullopt} /* launched */,
+		{206, 7, 1, false, std::nullopt} /* missile */,
+		{207, 8, 1, false, std::nullopt} /* Patriot */,
+		{208, 9, 2, false, std::nullopt} /* Standard Missile-2 */,
+		{209, 11, 2, false, std::nullopt} /* Standard Missile-6 */,
+		{210, 13, 2, false, std::nullopt} /* Evolved Sea Sparrow Missile */,
+		{211, 15, 1, false, std::nullopt} /* Rolling Airframe Missile */,
+		{212, 16, 2, false, std::nullopt} /* short range */,
+		{213, 18, 2, false, std::nullopt} /* medium range */,
+		{214, 20, 2, false, std::nullopt} /* intermediate range */,
+		{215, 22, 2, false, std::nullopt} /* long range */,
+		{216, 24, 2, false, std::nullopt} /* intercontinental */
+	};
+	return build_layer_table(ENTRIES, COMMAND_INDICES, commands);
+}
+
+const LayerTable& get_table(IconType symbol_type) noexcept {
+	if (symbol_type == IconType::ENTITY) {
+		static const LayerTable ENTITY_TABLE = build_entity_table();
+		return ENTITY_TABLE;
+	} else if (symbol_type == IconType::MODIFIER_1) {
+		static const LayerTable MODIFIER_1_TABLE = build_modifier_1_table();
+		return MODIFIER_1_TABLE;
+	}
+
+	static const LayerTable MODIFIER_2_TABLE = build_modifier_2_table();
+	return MODIFIER_2_TABLE;
+}
+
+}
+
+SymbolLayer get_air_missile_layer(int32_t code, IconType symbol_type) noexcept {
+	return get_table(symbol_type).find(code);
+}
+
+std::optional<BoundingBox> get_air_missile_bbox(int32_t code, IconType symbol_type) noexcept {
+	return get_table(symbol_type).find_bbox(code);
+}
+
+std::vector<int32_t> get_air_missile_symbols(IconType symbol_type) noexcept {
+	if (symbol_type == IconType::ENTITY) {
+		return {110000 /*missile*/};
+	}
+	else if (symbol_type == IconType::MODIFIER_1) {
+		return {1 /*air*/, 2 /*surface*/, 3 /*subsurface*/, 4 /*space*/, 5 /*anti-ballistic*/, 6 /*ballistic*/, 7 /*cruise*/, 8 /*interceptor*/};
+	}
+	else if (symbol_type == IconType::MODIFIER_2) {
+		return {1 /*air*/, 2 /*surface*/, 3 /*subsurface*/, 4 /*space*/, 5 /*launched*/, 6 /*missile*/, 7 /*Patriot*/, 8 /*Standard Missile-2*/, 9 /*Standard Missile-6*/, 10 /*Evolved Sea Sparrow Missile*/, 11 /*Rolling Airframe Missile*/, 12 /*short range*/, 13 /*medium range*/, 14 /*intermediate range*/, 15 /*long range*/, 16 /*intercontinental*/};
+	}
+
+	// Default to nothing
+	return {};
+}
+
+}
@@ -0,0 +1,153 @@
+// Generated by generation/parse.py from the "land civilian unit/organization" symbol set
+#include "Schema.hpp"
+
+namespace milsymbol::_impl {
+
+namespace {
+
+LayerTable build_entity_table() {
+	std::vector<DrawCommand> commands;
+	commands.reserve(10);
+	commands.push_back(DrawCommand::autotext("CIV").with_fill(ColorType::WHITE).with_stroke(ColorType::ICON).with_stroke_width(4.0));
+	commands.push_back(DrawCommand::path("m 100,80 -10,15 5,0 -10,10 5,0 -10,10 15,0 0,5 10,0 0,-5 15,0 -10,-10 5,0 -10,-10 5,0 z", BoundingBox{80, 80, 120, 120}));
+	commands.push_back(DrawCommand::autotext("GO"));
+	commands.push_back(DrawCommand::path("m 108,90 c 0,10 -15,10 -15,0 0,-10 15,-10 15,0 z m -8,7.3 0,25 m -10,-20 20,0", BoundingBox{90, 82.5, 110, 122.3}));
+	commands.push_back(DrawCommand::path("m 133,90 c 0,10 -15,10 -15,0 0,-10 15,-10 15,0 z m -8,7.3 0,25 m -10,-20 20,0 m -52,-12.3 c 0,10 -15,10 -15,0 0,-10 15,-10 15,0 z m -8,7.3 0,25 m -10,-20 20,0 m 23,-7.3 c 0,10 -15,10 -15,0 0,-10 15,-10 15,0 z m -8,7.3 0,25 m -10,-20 20,0", BoundingBox{65, 82.5, 135, 127.3}));
+	commands.push_back(DrawCommand::full_frame(DrawCommand::path("M57,70 143,130", BoundingBox{57, 70, 143, 130}), DrawCommand::path("M25,50 175,150", BoundingBox{25, 50, 175, 150}), DrawCommand::path("M45,45 155,155", BoundingBox{45, 45, 155, 155}), DrawCommand::path("M50,65 150,135", BoundingBox{50, 65, 150, 135})));
+	commands.push_back(DrawCommand::path("m 127,127 5,5 m -15,-15 5,5 m -15,-15 5,5 m -15,-15 5,5 m -15,-15 5,5 m -15,-15 5,5 m -15,-15 5,5", BoundingBox{67, 67, 132, 132}));
+	commands.push_back(DrawCommand::autotext("SPY"));
+	commands.push_back(DrawCommand::path("m 100,85 0,30 m -35,-15 45,0 m 20,0 c 0,5.5 -4.5,10 -10,10 -5.5,0 -10,-4.5 -10,-10 0,-5.5 4.5,-10 10,-10 5.5,0 10,4.5 10,10 z", BoundingBox{65, 85, 130, 115}));
+	commands.push_back(DrawCommand::path("m 90,60 0,22.7 -19.7,-11.3 -10,17.3 L 80,100 l -19.7,11.3 10,17.3 L 90,117.3 90,140 l 20,0 0,-22.7 19.7,11.3 10,-17.3 L 120,100 l 19.7,-11.3 -10,-17.3 L 110,82.7 110,60 90,60 z", BoundingBox{60.3, 60, 139.7, 140}).with_fill(ColorType::ICON));
+
+	static constexpr uint16_t COMMAND_INDICES[] = {0, 1, 2, 3, 4, 3, 5, 4, 5, 3, 6, 7, 8, 9};
+	static constexpr LayerEntry ENTRIES[] = {
+		{11110000, 0, 1, true, std::nullopt} /* c */,
+		{11110100, 1, 1, true, BoundingBox{80, 80, 120, 120}} /* environmental protection */,
+		{11110200, 2, 1, true, std::nullopt} /* governmental organization */,
+		{11110300, 3, 1, true, BoundingBox{90, 82.5, 110, 122.3}} /* individual */,
+		{11110400, 4, 1, true, BoundingBox{65, 82.5, 135, 127.3}} /* group */,
+		{11110500, 5, 2, true, BoundingBox{90, 82.5, 110, 122.3}} /* killing victim */,
+		{11110600, 7, 2, true, BoundingBox{65, 82.5, 135, 127.3}} /* killing victims */,
+		{11110700, 9, 2, true, BoundingBox{67, 67, 132, 132}} /* victim of an attempted crime */,
+		{11110800, 11, 1, true, std::nullopt} /* SPY */,
+		{11110900, 12, 1, true, BoundingBox{65, 85, 130, 115}} /* composite loss */,
+		{11111000, 13, 1, true, BoundingBox{60.3, 60, 139.7, 140}} /* emergency medical operation */
+	};
+	return build_layer_table(ENTRIES, COMMAND_INDICES, commands);
+}
+
+LayerTable build_modifier_1_table() {
+	std::vector<DrawCommand> commands;
+	commands.reserve(26);
+	commands.push_back(DrawCommand::textm1("AS"));
+	commands.push_back(DrawCommand::textm1("EX"));
+	commands.push_back(DrawCommand::textm1("MU"));
+	commands.push_back(DrawCommand::textm1("H"));
+	commands.push_back(DrawCommand::textm1("K"));
+	commands.push_back(DrawCommand::textm1("PI"));
+	commands.push_back(DrawCommand::textm1("RA"));
+	commands.push_back(DrawCommand::textm1("CIV"));
+	commands.push_back(DrawCommand::textm1("DPRE"));
+	commands.push_back(DrawCommand::textm1("FF"));
+	commands.push_back(DrawCommand::textm1("GANG"));
+	commands.push_back(DrawCommand::textm1("GO"));
+	commands.push_back(DrawCommand::textm1("LDR"));
+	commands.push_back(DrawCommand::textm1("NGO"));
+	commands.push_back(DrawCommand::textm1("C"));
+	commands.push_back(DrawCommand::textm1("WR"));
+	commands.push_back(DrawCommand::textm1("REL"));
+	commands.push_back(DrawCommand::textm1("TGT"));
+	commands.push_back(DrawCommand::textm1("TER"));
+	commands.push_back(DrawCommand::textm1("SPK"));
+	commands.push_back(DrawCommand::textm1("ACC"));
+	commands.push_back(DrawCommand::textm1("CBT"));
+	commands.push_back(DrawCommand::textm1("OTH"));
+	commands.push_back(DrawCommand::textm1("LOOT"));
+	commands.push_back(DrawCommand::textm1("HJ"));
+	commands.push_back(DrawCommand::textm1("CYB"));
+
+	static constexpr uint16_t COMMAND_INDICES[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25};
+	static constexpr LayerEntry ENTRIES[] = {
+		{1101, 0, 1, false, std::nullopt} /* assassination */,
+		{1102, 1, 1, false, std::nullopt} /* execution (wrongful killing) */,
+		{1103, 2, 1, false, std::nullopt} /* murder victims */,
+		{1104, 3, 1, false, std::nullopt} /* hijacking */,
+		{1105, 4, 1, false, std::nullopt} /* kidnapping */,
+		{1106, 5, 1, false, std::nullopt} /* piracy */,
+		{1107, 6, 1, false, std::nullopt} /* rape */,
+		{1108, 7, 1, false, std::nullopt} /* civilian */,
+		{1109, 8, 1, false, std::nullopt} /* displaced persons */,
+		{1110, 9, 1, false, std::nullopt} /* foreigh fighters */,
+		{1111, 10, 1, false, std::nullopt} /* gang member */,
+		{1112, 11, 1, false, std::nullopt} /* government organization */,
+		{1113, 12, 1, false, std::nullopt} /* leader */,
+		{1114, 13, 1, false, std::nullopt} /* nongovernmental organization */,
+		{1115, 14, 1, false, std::nullopt} /* unwilling recruit */,
+		{1116, 15, 1, false, std::nullopt} /* willing recruit */,
+		{1117, 16, 1, false, std::nullopt} /* religious */,
+		{1118, 17, 1, false, std::nullopt} /* targeted individual */,
+		{1119, 18, 1, false, std::nullopt} /* terrorist */,
+		{1120, 19, 1, false, std::nullopt} /* speaker */,
+		{1121, 20, 1, false, std::nullopt} /* accident */,
+		{1122, 21, 1, false, std::nullopt} /* combat */,
+		{1123, 22, 1, false, std::nullopt} /* other */,
+		{1124, 23, 1, false, std::nullopt} /* loot */,
+		{1125, 24, 1, false, std::nullopt} /* hijacker */,
+		{1126, 25, 1, false, std::nullopt} /* cyberspace */
+	};
+	return build_layer_table(ENTRIES, COMMAND_INDICES, commands);
+}
+
+LayerTable build_modifier_2_table() {
+	std::vector<DrawCommand> commands;
+	commands.reserve(2);
+	commands.push_back(DrawCommand::textm2("LDR"));
+	commands.push_back(DrawCommand::textm2("CYB"));
+
+	static constexpr uint16_t COMMAND_INDICES[] = {0, 1};
+	static constexpr LayerEntry ENTRIES[] = {
+		{1101, 0, 1, false, std::nullopt} /* leader */,
+		{1102, 1, 1, false, std::nullopt} /* cyberspace */
+	};
+	return build_layer_table(ENTRIES, COMMAND_INDICES, commands);
+}
+
+const LayerTable& get_table(IconType symbol_type) noexcept {
+	if (symbol_type == IconType::ENTITY) {
+		static const LayerTable ENTITY_TABLE = build_entity_table();
+		return ENTITY_TABLE;
+	} else if (symbol_type == IconType::MODIFIER_1) {
+		static const LayerTable MODIFIER_1_TABLE = build_modifier_1_table();
+		return MODIFIER_1_TABLE;
+	}
+
+	static const LayerTable MODIFIER_2_TABLE = build_modifier_2_table();
+	return MODIFIER_2_TABLE;
+}
+
+}
+
+SymbolLayer get_land_civilian_unit_organization_layer(int32_t code, IconType symbol_type) noexcept {
+	return get_table(symbol_type).find(code);
+}
+
+std::optional<BoundingBox> get_land_civilian_unit_organization_bbox(int32_t code, IconType symbol_type) noexcept {
+	return get_table(symbol_type).find_bbox(code);
+}
+
+std::vector<int32_t> get_land_civilian_unit_organization_symbols(IconType symbol_type) noexcept {
+	if (symbol_type == IconType::ENTITY) {
+		return {110000 /*c*/, 110100 /*environmental protection*/, 110200 /*governmental organization*/, 110300 /*individual*/, 110400 /*group*/, 110500 /*killing victim*/, 110600 /*killing victims*/, 110700 /*victim of an attempted crime*/, 110800 /*SPY*/, 110900 /*composite loss*/, 111000 /*emergency medical operation*/};
+	}
+	else if (symbol_type == IconType::MODIFIER_1) {
+		return {1 /*assassination*/, 2 /*execution (wrongful killing)*/, 3 /*murder victims*/, 4 /*hijacking*/, 5 /*kidnapping*/, 6 /*piracy*/, 7 /*rape*/, 8 /*civilian*/, 9 /*displaced persons*/, 10 /*foreigh fighters*/, 11 /*gang member*/, 12 /*government organization*/, 13 /*leader*/, 14 /*nongovernmental organization*/, 15 /*unwilling recruit*/, 16 /*willing recruit*/, 17 /*religious*/, 18 /*targeted individual*/, 19 /*terrorist*/, 20 /*speaker*/, 21 /*accident*/, 22 /*combat*/, 23 /*other*/, 24 /*loot*/, 25 /*hijacker*/, 26 /*cyberspace*/};
+	}
+	else if (symbol_type == IconType::MODIFIER_2) {
+		return {1 /*leader*/, 2 /*cyberspace*/};
+	}
+
+	// Default to nothing
+	return {};
+}
+
+}
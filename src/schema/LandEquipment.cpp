@@ -0,0 +1,545 @@
+// Generated by generation/parse.py from the "land equipment" symbol set
+#include "Schema.hpp"
+
+namespace milsymbol::_impl {
+
+namespace {
+
+// Path data used by more than one draw command
+constexpr const char PATH_0[] = "m 75,120 10,-30 15,-10 15,10 10,30 z";
+constexpr const char PATH_1[] = "M95.5,80 l9,0 0,-9 9,0 0,-9 -9,0 0,-9 -9,0 0,9 -9,0 0,9 9,0 Z";
+
+LayerTable build_entity_table() {
+	std::vector<DrawCommand> commands;
+	commands.reserve(173);
+	commands.push_back(DrawCommand::path("m 100,60 0,80", BoundingBox{100, 60, 100, 140}));
+	commands.push_back(DrawCommand::path("m 100,60 0,80 M 85,75 100,60 115,75", BoundingBox{85, 60, 115, 140}));
+	commands.push_back(DrawCommand::path("m 85,100 30,0", BoundingBox{85, 100, 115, 100}));
+	commands.push_back(DrawCommand::path("m 85,105 30,0 m -30,-10 30,0", BoundingBox{85, 95, 115, 105}));
+	commands.push_back(DrawCommand::path("m 85,110 30,0 m -30,-20 30,0 m -30,10 30,0", BoundingBox{85, 90, 115, 110}));
+	commands.push_back(DrawCommand::path("m 100,60 0,80 M 85,75 100,60 115,75 M 80,140 120,140", BoundingBox{80, 60, 120, 140}));
+	commands.push_back(DrawCommand::circle(Vector2{100, 90}, 15));
+	commands.push_back(DrawCommand::translate(Vector2{0, 20}, commands[2]));
+	commands.push_back(DrawCommand::translate(Vector2{0, 20}, commands[3]));
+	commands.push_back(DrawCommand::translate(Vector2{0, 20}, commands[4]));
+	commands.push_back(DrawCommand::path("m 90,135 0,-70 c 0,-15 20,-15 20,0", BoundingBox{90, 53.75, 110, 135}));
+	commands.push_back(DrawCommand::path("m 85,140 30,0 c 0,-20 -30,-20 -30,0 z m 15,-80 0,65 m 15,-45 0,40 m -30,-40 0,40", BoundingBox{85, 60, 115, 140}));
+	commands.push_back(DrawCommand::path("m 85,140 15,-15 15,15 m -15,-80 0,65 m -15,-45 0,40 m 30,-40 0,40", BoundingBox{85, 60, 115, 140}));
+	commands.push_back(DrawCommand::path("m 100,60 0,80 m 15,-60 0,40 m -30,-40 0,40", BoundingBox{85, 60, 115, 140}));
+	commands.push_back(DrawCommand::path("m 85,75 15,-15 15,15 m 0,5 0,40 m -30,-40 0,40 m 15,-60 0,80", BoundingBox{85, 60, 115, 140}));
+	commands.push_back(DrawCommand::circle(Vector2{100, 130}, 10));
+	commands.push_back(DrawCommand::path("m 115,80 0,40 m -30,-40 0,40 m 15,-60 0,60", BoundingBox{85, 60, 115, 120}));
+	commands.push_back(DrawCommand::path("m 100,140 0,-80 m -15,80 0,-65 c 0,-20 30,-20 30,0 l 0,65", BoundingBox{85, 60, 115, 140}));
+	commands.push_back(DrawCommand::path("m 85,140 30,0 c 0,-20 -30,-20 -30,0 z m 15,-15 0,-65 m -15,80 0,-65 c 0,-20 30,-20 30,0 l 0,65", BoundingBox{85, 60, 115, 140}));
+	commands.push_back(DrawCommand::text("R", Vector2{132, 110}, 25));
+	commands.push_back(DrawCommand::text("E", Vector2{68, 110}, 25));
+	commands.push_back(DrawCommand::path("m 85,140 15,-15 15,15 M 85,120 85,75 c 0,-20 30,-20 30,0 l 0,45 m -15,5 0,-65", BoundingBox{85, 60, 115, 140}));
+	commands.push_back(DrawCommand::path("m 100,140 0,-80 m -15,80 0,-65 c 0,-20 30,-20 30,0 l 0,65 m 85,140 l 30,0", BoundingBox{85, 60, 230, 280}));
+	commands.push_back(DrawCommand::path("m 100,60 0,60 M 85,75 100,60 115,75", BoundingBox{85, 60, 115, 120}));
+	commands.push_back(DrawCommand::path("m 85,75 15,-15 15,15 m -15,-5 0,70 M 85,85 100,70 115,85", BoundingBox{85, 60, 115, 140}));
+	commands.push_back(DrawCommand::path("m 115,90 0,40 m -30,-40 0,40 m 0,-55 15,-15 15,15 m -15,-5 0,70 M 85,85 100,70 115,85", BoundingBox{85, 60, 115, 140}));
+	commands.push_back(DrawCommand::path("m 85,140 15,-15 15,15 M 85,85 100,70 115,85 m -15,-15 0,55 M 85,75 100,60 115,75", BoundingBox{85, 60, 115, 140}));
+	commands.push_back(DrawCommand::path("m 100,60 0,80 M 80,60 l40,0", BoundingBox{80, 60, 120, 140}));
+	commands.push_back(DrawCommand::autotext("Z"));
+	commands.push_back(DrawCommand::autotext("W"));
+	commands.push_back(DrawCommand::path("m 60,120 80,0 M 120,80 c 25,0.2 25,40 0,40 l -40,0 C 55,120 55,80 80,80 Z", BoundingBox{60, 80, 140, 120}));
+	commands.push_back(DrawCommand::path("m 70,130 60,0", BoundingBox{70, 130, 130, 130}));
+	commands.push_back(DrawCommand::circle(Vector2{70, 125}, 5));
+	commands.push_back(DrawCommand::circle(Vector2{130, 125}, 5));
+	commands.push_back(DrawCommand::autotext("A"));
+	commands.push_back(DrawCommand::path("m 70,100 30,-30 30,30 -30,30 z m 60,-30 0,60 m -60,-60 0,60 0,0", BoundingBox{70, 70, 130, 130}));
+	commands.push_back(DrawCommand::text("C2", Vector2{100, 110}, 30));
+	commands.push_back(DrawCommand::path("m 70,80 30,-10 30,10 m -60,-10 0,60 60,0 0,-60", BoundingBox{70, 70, 130, 130}));
+	commands.push_back(DrawCommand::path("m 95,85 10,0 0,10 10,0 0,10 -10,0 0,10 -10,0 0,-10 -10,0 0,-10 10,0 z", BoundingBox{85, 85, 115, 115}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::path("M125,80 C150,80 150,120 125,120 L75,120 C50,120 50,80 75,80 Z", BoundingBox{56.25, 80, 143.75, 120}));
+	commands.push_back(DrawCommand::path("m 85,100 30,0 m 10,-10 c -13.1,0 -12.4,20 0,20 M 75,90 c 12.7,0.3 12.7,20.3 0,20", BoundingBox{75, 90, 125, 110.01}));
+	commands.push_back(DrawCommand::path("M 70,120 130,120", BoundingBox{70, 120, 130, 120}));
+	commands.push_back(DrawCommand::path("m 70,130 l 60,0", BoundingBox{70, 130, 130, 130}));
+	commands.push_back(DrawCommand::circle(Vector2{70, 135}, 5));
+	commands.push_back(DrawCommand::circle(Vector2{100, 135}, 5));
+	commands.push_back(DrawCommand::circle(Vector2{130, 135}, 5));
+	commands.push_back(DrawCommand::full_frame(DrawCommand::path("M60,130L140,70", BoundingBox{60, 70, 140, 130}), DrawCommand::path("M 50.6 132.9 L 149.3 67", BoundingBox{50.6, 67, 149.3, 132.9}), DrawCommand::path("M45,155L155,45", BoundingBox{45, 45, 155, 155}), DrawCommand::path("M50,135L150,65", BoundingBox{50, 65, 150, 135})));
+	commands.push_back(DrawCommand::path("m 70,80 60,0 m -60,40 60,0 m -60,-50 0,60 0,0 m 60,-60 0,60", BoundingBox{70, 70, 130, 130}));
+	commands.push_back(DrawCommand::path("m 100,80 0,40", BoundingBox{100, 80, 100, 120}));
+	commands.push_back(DrawCommand::path("m 105,80 0,40 m -10,-40 0,40", BoundingBox{95, 80, 105, 120}));
+	commands.push_back(DrawCommand::path("m 110,80 0,40 m -20,-40 0,40 m 10,-40 0,40", BoundingBox{90, 80, 110, 120}));
+	commands.push_back(DrawCommand::path("M60,120 L60,80 140,80 140,120 M100,80 L100,110", BoundingBox{60, 80, 140, 120}));
+	commands.push_back(DrawCommand::scale(0.7, commands[51]));
+	commands.push_back(DrawCommand::path("m 70,115 10,-10 40,0 10,10 m -60,-30 10,10 40,0 10,-10", BoundingBox{70, 85, 130, 115}));
+	commands.push_back(DrawCommand::path("m 70,65 c 0,15 60,15 60,0 l 0,65 -60,0 z", BoundingBox{70, 65, 130, 130}));
+	commands.push_back(DrawCommand::scale(0.8, commands[53]));
+	commands.push_back(DrawCommand::path("M 100,70 100,130", BoundingBox{100, 70, 100, 130}));
+	commands.push_back(DrawCommand::path("m 80,125 c 0,10 40,10 40,0 z", BoundingBox{80, 125, 120, 132.5}));
+	commands.push_back(DrawCommand::path("M 110, 80 90,80 90,120 110,120", BoundingBox{90, 80, 110, 120}));
+	commands.push_back(DrawCommand::path("M 110, 80 90,80 90,120 110,120 z", BoundingBox{90, 80, 110, 120}));
+	commands.push_back(DrawCommand::path("m 85,80 5,40 20,0 5,-40 z", BoundingBox{85, 80, 115, 120}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::scale(0.8, commands[60]));
+	commands.push_back(DrawCommand::path("m 100,60 0,20 m -25,-15 5,-5 40,0 5,5 m -55,15 60,0 m -60,40 60,0 m 0,-50 0,60 m -60,-60 0,60 0,0", BoundingBox{70, 60, 130, 130}));
+	commands.push_back(DrawCommand::autotext("MF"));
+	commands.push_back(DrawCommand::path("m 100,80 0,15 -30,25 60,0 -30,-25", BoundingBox{70, 80, 130, 120}));
+	commands.push_back(DrawCommand::translate(Vector2{0, -10}, commands[31], commands[32], commands[33]));
+	commands.push_back(DrawCommand::path("m 100,95 30,25 m -30,-60 0,35 -30,25 m 10,-60 40,0 m -50,20 60,0 m -60,40 60,0 m -60,-50 0,60 0,0 m 60,-60 0,60", BoundingBox{70, 60, 130, 130}));
+	commands.push_back(DrawCommand::textm1("RRC"));
+	commands.push_back(DrawCommand::path("m 100,100 0,10 m -15,5 0,-15 30,0 0,15 M 70,80 c 0,15 60,15 60,0 l 0,40 -60,0 z", BoundingBox{70, 80, 130, 120}));
+	commands.push_back(DrawCommand::textm2("M"));
+	commands.push_back(DrawCommand::textm2("H"));
+	commands.push_back(DrawCommand::path("m 120,100 c 0,5.5 -9,10 -20,10 -11,0 -20,-4.5 -20,-10 0,-5.5 9,-10 20,-10 11,0 20,4.5 20,10 z m -5,-20 -30,40 m 0,-40 30,40 m -15,-40 0,40", BoundingBox{80, 80, 120, 120}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::path("m 80,65 0,10 40,0 0,-10 z", BoundingBox{80, 65, 120, 75}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::translate(Vector2{0, 10}, DrawCommand::scale(0.7, commands[71], commands[72])));
+	commands.push_back(DrawCommand::autotext("V"));
+	commands.push_back(DrawCommand::path("m 90,60 20,0 m -10,0 0,20 m -30,0 60,0 m -60,-10 0,60 0,0 m 60,-60 0,60 m -60,-10 60,0", BoundingBox{70, 60, 130, 130}));
+	commands.push_back(DrawCommand::path("m 70,130 60,0 m -30,-70 0,10 m -30,10 30,-10 30,10 m 0,-10 0,60 m -60,-60 0,60 0,0 m 20,-70 20,0", BoundingBox{70, 60, 130, 130}));
+	commands.push_back(DrawCommand::scale(0.6, commands[51]));
+	commands.push_back(DrawCommand::path("M 130,80 70,130", BoundingBox{70, 80, 130, 130}));
+	commands.push_back(DrawCommand::path("M 130,130 100,80 75,95 75,95", BoundingBox{75, 80, 130, 130}));
+	commands.push_back(DrawCommand::path("M 75,105 85,95 75,95 z", BoundingBox{75, 95, 85, 105}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("m 75,100 c 15,15 35,15 50,0 z", BoundingBox{75, 100, 125, 111.25}));
+	commands.push_back(DrawCommand::path("m 70,100 l 60,0 M 100,78.3 100,130", BoundingBox{70, 78.3, 130, 130}));
+	commands.push_back(DrawCommand::path("m 70,100 l 60,0 M 100,78.3 100,130 M 85,85 115,85", BoundingBox{70, 78.3, 130, 130}));
+	commands.push_back(DrawCommand::autotext("B"));
+	commands.push_back(DrawCommand::path("m 140,90 0,20 m -10,-10 10,0", BoundingBox{130, 90, 140, 110}));
+	commands.push_back(DrawCommand::circle(Vector2{75, 135}, 5));
+	commands.push_back(DrawCommand::circle(Vector2{85, 135}, 5));
+	commands.push_back(DrawCommand::circle(Vector2{125, 135}, 5));
+	commands.push_back(DrawCommand::path("M 100,78.3 100,130", BoundingBox{100, 78.3, 100, 130}));
+	commands.push_back(DrawCommand::path("m 105,130 0,-52 M 95,130 l0,-52", BoundingBox{95, 78, 105, 130}));
+	commands.push_back(DrawCommand::path("m 110,130 0,-53 m -20,50 0,-53 m 10,1.3 0,52", BoundingBox{90, 74, 110, 130}));
+	commands.push_back(DrawCommand::scale(0.8, DrawCommand::path("m 100,120 0,-20 -15,-20 30,0 -15,20 ", BoundingBox{85, 80, 115, 120})));
+	commands.push_back(DrawCommand::scale(0.7, DrawCommand::path("m 65,90 50,0 c 10,0 20,10 20,20 m -40,-30 20,0 m -10,0 0,10", BoundingBox{65, 80, 135, 110})));
+	commands.push_back(DrawCommand::path("m 70,95 c 10,0 0,10 10,10 10,0 0,-10 10,-10 10,0 0,10 10,10 10,0 0,-10 10,-10 10,0 0,10 10,10 10,0 0,-10 10,-10", BoundingBox{70, 95, 130, 105}));
+	commands.push_back(DrawCommand::path("m 130,130 -40,-40 0,25 c 0,5 -10,5 -10,0", BoundingBox{80, 90, 130, 130}));
+	commands.push_back(DrawCommand::path("m 105,115 10,-10", BoundingBox{105, 105, 115, 115}));
+	commands.push_back(DrawCommand::path("m 120,110 -10,10 m -10,-10 10,-10 m -5,15 10,-10", BoundingBox{100, 100, 120, 120}));
+	commands.push_back(DrawCommand::path("m 70,70 0,60 60,0 0,-30 -30,0 0,-30 z", BoundingBox{70, 70, 130, 130}));
+	commands.push_back(DrawCommand::circle(Vector2{115, 135}, 5));
+	commands.push_back(DrawCommand::path("m 90,125 20,0 m -20,0 c 0,-4.1 -3.4,-7.5 -7.5,-7.5 -4.1,0 -7.5,3.4 -7.5,7.5 0,4.1 3.4,7.5 7.5,7.5 4.1,0 7.5,-3.4 7.5,-7.5 z m 35,0 5,0 0,-20 -20,0 0,-20 -20,0 0,20 -20,0 0,20 5,0 m 50,0 c 0,-4.1 -3.4,-7.5 -7.5,-7.5 -4.1,0 -7.5,3.4 -7.5,7.5 0,4.1 3.4,7.5 7.5,7.5 4.1,0 7.5,-3.4 7.5,-7.5 z", BoundingBox{70, 85, 130, 132.5}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::path("m 95,90 0,15 10,0 0,-15 z", BoundingBox{95, 90, 105, 105}).with_stroke_width(2.0));
+	commands.push_back(DrawCommand::path("m 100,125 0,-20", BoundingBox{100, 105, 100, 125}));
+	commands.push_back(DrawCommand::path("m 103,105 0,20 m -6,-20 0,20", BoundingBox{97, 105, 103, 125}));
+	commands.push_back(DrawCommand::path("m 106,105 0,20 m -12,-20 0,20 m 6,-20 0,20", BoundingBox{94, 105, 106, 125}));
+	commands.push_back(DrawCommand::path("m 90,125 20,0 m -20,0 c 0,-4.1 -3.4,-7.5 -7.5,-7.5 -4.1,0 -7.5,3.4 -7.5,7.5 0,4.1 3.4,7.5 7.5,7.5 4.1,0 7.5,-3.4 7.5,-7.5 z m 35,0 c 0,-4.1 -3.4,-7.5 -7.5,-7.5 -4.1,0 -7.5,3.4 -7.5,7.5 0,4.1 3.4,7.5 7.5,7.5 4.1,0 7.5,-3.4 7.5,-7.5 z m 0,0 5,0 0,-20 -20,0 -20,0 0,-20 -20,0 0,20 0,20 5,0", BoundingBox{70, 85, 130, 132.5}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::path("m 75,90 0,15 10,0 0,-15 z", BoundingBox{75, 90, 85, 105}).with_stroke_width(2.0));
+	commands.push_back(DrawCommand::path("m 90,125 20,0 m -20,0 c 0,-4.1 -3.4,-7.5 -7.5,-7.5 -4.1,0 -7.5,3.4 -7.5,7.5 0,4.1 3.4,7.5 7.5,7.5 4.1,0 7.5,-3.4 7.5,-7.5 z m 35,0 c 0,-4.1 -3.4,-7.5 -7.5,-7.5 -4.1,0 -7.5,3.4 -7.5,7.5 0,4.1 3.4,7.5 7.5,7.5 4.1,0 7.5,-3.4 7.5,-7.5 z m 0,0 5,0 0,-20 0,-20 -20,0 -20,0 -20,0 0,20 0,20 5,0", BoundingBox{70, 85, 130, 132.5}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::path("m 115,90 0,15 10,0 0,-15 z m -20,0 0,15 10,0 0,-15 z m -20,0 0,15 10,0 0,-15 z", BoundingBox{75, 90, 125, 105}).with_stroke_width(2.0));
+	commands.push_back(DrawCommand::path("m 90,125 c 0,-4.1 -3.4,-7.5 -7.5,-7.5 -4.1,0 -7.5,3.4 -7.5,7.5 0,4.1 3.4,7.5 7.5,7.5 4.1,0 7.5,-3.4 7.5,-7.5 z m 35,0 c 0,-4.1 -3.4,-7.5 -7.5,-7.5 -4.1,0 -7.5,3.4 -7.5,7.5 0,4.1 3.4,7.5 7.5,7.5 4.1,0 7.5,-3.4 7.5,-7.5 z m -35,0 20,0 m 15,0 5,0 0,-20 0,-20 -20,0 -20,0 0,20 -20,0 0,20 5,0", BoundingBox{70, 85, 130, 132.5}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::path("m 90,125 20,0 m -20,0 c 0,-4.1 -3.4,-7.5 -7.5,-7.5 -4.1,0 -7.5,3.4 -7.5,7.5 0,4.1 3.4,7.5 7.5,7.5 4.1,0 7.5,-3.4 7.5,-7.5 z m 35,0 c 0,-4.1 -3.4,-7.5 -7.5,-7.5 -4.1,0 -7.5,3.4 -7.5,7.5 0,4.1 3.4,7.5 7.5,7.5 4.1,0 7.5,-3.4 7.5,-7.5 z m 0,0 5,0 0,-20 -60,0 0,20 5,0 m 15,-20 5,-15", BoundingBox{70, 90, 130, 132.5}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::path("m 140,105 0,20 m -10,-10 10,0", BoundingBox{130, 105, 140, 125}));
+	commands.push_back(DrawCommand::path("m 65,95 70,0 m 0,10 c 0,5.5 -4.5,10 -10,10 -5.5,0 -10,-4.5 -10,-10 0,-5.5 4.5,-10 10,-10 5.5,0 10,4.5 10,10 z m -50,0 c 0,5.5 -4.5,10 -10,10 -5.5,0 -10,-4.5 -10,-10 0,-5.5 4.5,-10 10,-10 5.5,0 10,4.5 10,10 z", BoundingBox{65, 95, 135, 115}));
+	commands.push_back(DrawCommand::textm1("DRUG"));
+	commands.push_back(DrawCommand::path("m 99.6,51 c -2.8,0 -5,2.3 -5,5.3 0,2.1 1.2,3.9 2.8,4.7 L 87.8,78.3 69.5,78.4 c -0.1,-2.8 -2.3,-5.1 -5,-5.1 -2.8,0 -5,2.3 -5,5.3 0,2.9 2.2,5.3 5,5.3 0.7,0 1.4,-0.2 2,-0.4 l 9.2,16.8 -9.4,17.2 c -0.6,-0.2 -1.2,-0.4 -1.8,-0.4 -2.8,0 -5,2.4 -5,5.3 0,2.9 2.2,5.3 5,5.3 2.8,0 5,-2.3 5,-5.3 0,-0.1 -0,-0.2 -0,-0.3 l 18.3,0.1 9.5,17.1 c -1.6,0.9 -2.7,2.6 -2.7,4.6 0,2.9 2.3,5.3 5,5.3 2.8,0 5,-2.3 5,-5.3 0,-1.9 -0.9,-3.5 -2.3,-4.4 l 9.6,-17.3 18.7,-0.1 c -0,0.1 -0,0.2 -0,0.3 0,2.9 2.3,5.3 5,5.3 2.8,0 5,-2.3 5,-5.3 0,-2.9 -2.2,-5.3 -5,-5.3 -0.8,0 -1.5,0.2 -2.1,0.5 l -9.5,-17.4 9.5,-17.4 c 0.6,0.3 1.4,0.5 2.1,0.5 2.8,0 5,-2.4 5,-5.3 0,-2.9 -2.2,-5.3 -5,-5.3 -2.8,0 -5,2.3 -5,5.3 0,0.1 0,0.2 0,0.3 L 111.8,78.3 102.1,60.8 c 1.5,-0.9 2.5,-2.6 2.5,-4.5 0,-2.9 -2.2,-5.3 -5,-5.3 z", BoundingBox{59.5, 51, 140.6, 149.2}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::autotext("ATF"));
+	commands.push_back(DrawCommand::path("M 122.8 66.8 C 119.9 66.8 117.4 68.6 117.4 71.6 L 117.4 73.1 L 128.7 73.1 L 128.7 72.4 C 128.7 68.8 126.5 66.8 122.8 66.8 z M 108.6 74.8 L 108.6 76 L 117.6 76 L 117.5 77.5 L 118 80.8 C 119.1 81.5 118.9 82.5 120.8 83.5 C 122.1 84.1 124 84 125.2 83.4 C 127.5 82.4 129 79.2 128.3 76 L 137.5 76 L 137.5 74.8 L 108.6 74.8 z M 94.8 82.1 C 93.3 82.1 92 83.5 92 85 L 92 85.2 C 92 86.6 96 91.3 97 92.6 C 98.2 94.3 100.8 98.8 103.2 98.8 C 104.5 98.8 111.1 93.7 112.6 92.8 L 112.6 106.2 L 126.4 85.6 C 123 85.6 114.9 85.2 112.2 85.9 C 110.2 86.4 105 91.6 103.6 91.7 C 103.4 91 100.6 87.5 100 86.5 C 99.2 85.4 97.2 82.1 95.6 82.1 L 94.8 82.1 z M 130.4 85.6 C 129.6 85.6 117.5 104.1 116.3 106.2 L 128.1 106.2 L 128.1 110.6 L 112.5 110.6 L 112.5 133.2 L 120.7 133.2 L 122 117.5 L 124.3 117.5 L 125.6 133.2 L 133.5 133.2 L 133.5 87.9 C 133.5 87.2 131.2 85.6 130.4 85.6 z M 66.9 90.7 C 66.5 91.4 62.5 96.9 62.5 96.9 C 62.5 97.8 76.7 107.2 78.5 108.3 C 81.4 110.2 83.9 112.1 86.7 114 C 88.2 115 89.4 115.9 90.8 116.8 C 92.1 117.7 94.1 118.5 94.1 120.4 L 94.1 133.2 L 105.5 133.2 L 105.5 121.7 C 105.5 120.6 107.2 119 107.2 118.8 C 107.2 117.6 106.1 118.6 105.6 116.9 C 105.2 115.4 105.4 115.6 104.5 114.5 C 103.5 113.1 101.9 112 99.8 112 C 96.8 112 97.6 111.8 95.3 110.3 C 93.9 109.3 92.5 108.4 91.2 107.4 C 88.7 105.5 85.8 103.5 83.2 101.8 C 80.9 100.3 68.2 91 66.9 90.7 z M 67.9 92.6 L 72.7 95.7 L 72.8 103 L 67.9 99.9 L 67.9 92.6 z M 77.8 99.3 L 82.6 102.6 L 82.6 110 L 77.8 106.6 L 77.8 99.3 z M 87.4 106.2 L 92.5 109.5 L 92.4 116.9 L 87.4 113.5 L 87.4 106.2 z", BoundingBox{62.5, 66.8, 137.5, 133.2}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::path("M 117.4 73.1 L 117.4 74.8 L 128.7 74.8 L 128.7 73.1 L 117.4 73.1 z M 126.4 85.6 L 112.6 106.2 L 112.6 110.6 L 128.1 110.6 L 128.1 106.2 L 116.4 106.2 C 117.5 104.1 129.6 85.6 130.4 85.6 L 126.4 85.6 z M 67.9 92.6 L 67.9 99.9 L 72.8 103 L 72.7 95.7 L 67.9 92.6 z M 77.8 99.3 L 77.8 106.6 L 82.6 110 L 82.6 102.6 L 77.8 99.3 z M 87.4 106.2 L 87.4 113.5 L 92.4 116.9 L 92.5 109.5 L 87.4 106.2 z ", BoundingBox{67.9, 73.1, 130.4, 116.9}).with_fill(ColorType::WHITE).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::path("M 115.5 69.8 C 115.8 70.4 116.9 72.9 117.5 72.9 L 128.3 72.9 L 128.3 69.8 L 115.5 69.8 z M 117.3 74.7 C 116.8 74.7 116 75.7 115.8 76.1 L 117.2 76.1 L 117.2 76.8 C 117.2 79.6 119.8 81.8 122.8 81.8 C 126.5 81.8 128.3 78.6 128.3 74.7 L 117.3 74.7 z M 111.3 83.6 C 110.5 83.6 99.4 91.8 97.8 92.9 C 95.6 94.4 93 96.1 91 97.7 C 89.1 99.2 85.4 100.5 85.4 103.6 L 85.4 104 C 85.4 104.7 87.1 106.7 88.2 106.7 L 88.8 106.7 C 90.2 106.7 108 93.4 111.3 91.7 L 111.3 105.3 L 126 83.6 L 111.3 83.6 z M 75.3 83.6 C 74.5 83.6 73.4 84.4 73.4 85 L 73.4 108.9 C 73.4 109.8 73.9 110.2 74.4 110.5 L 78.5 110.5 L 78.5 83.6 L 75.3 83.6 z M 78.5 110.5 L 78.5 135.2 L 105.6 135.2 L 105.6 110.5 L 78.5 110.5 z M 130.5 83.6 C 129.6 83.6 123.8 92.9 122.9 94.2 C 121.9 95.7 115.7 104.5 115.5 105.3 L 127.6 105.3 L 127.6 110.3 L 111.5 110.3 L 111.5 134.8 L 119.6 134.8 C 120.6 134.8 121.1 127.9 121.3 126.6 C 121.7 123.9 122.4 120.4 122.6 117.8 L 122.9 117.8 L 125.4 134.8 L 133.9 134.8 L 133.9 86.7 C 133.9 85.6 131.9 83.6 130.7 83.6 L 130.5 83.6", BoundingBox{73.4, 69.8, 133.9, 135.2}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::path("M 117.5 72.9 L 117.3 74.7 L 128.3 74.7 L 128.3 72.9 L 117.5 72.9 z M 126 83.7 L 111.3 105.3 L 111.5 110.3 L 127.7 110.3 L 127.7 105.3 L 115.5 105.3 C 115.7 104.5 121.9 95.7 122.9 94.3 C 123.8 92.9 129.6 83.7 130.5 83.7 L 126 83.7 z ", BoundingBox{111.3, 72.9, 130.5, 110.3}).with_fill(ColorType::WHITE).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::autotext("DEA"));
+	commands.push_back(DrawCommand::path("M 100.2 62.3 C 100.1 63.2 99 66.3 98.7 67.4 C 97.8 69.9 99.4 70 99.4 72.3 L 99.4 73 C 99.4 73.7 98.9 73.5 98.3 73.8 C 96.6 72.4 94.2 71 91.3 71 L 90 71 C 84.2 71 80 75.5 74.6 75.5 L 73.9 75.5 C 72.3 75.5 71.5 74.1 71.3 75.8 L 74.3 77.2 C 71.8 82.4 69.9 89.7 67.5 95.5 C 66.3 98.6 65.3 101.6 64.1 104.7 C 63.5 106.3 63.1 107.7 62.5 109.3 C 62 110.5 61.8 113.1 60.2 113.2 C 62.4 116.4 68 120.5 73.3 120.5 L 76 120.5 C 81.6 120.5 87.3 116.6 89.5 113.2 L 88.2 113.2 L 75.4 77.2 L 74.5 77.2 L 74.5 77 L 75.4 77.2 L 78.6 77.7 L 79.3 77.7 L 89.3 76.2 L 90.4 76.3 C 93.7 76.3 93.8 80.2 94.7 80.2 L 97.7 80.2 L 97.7 129.2 L 86.1 129.2 L 86.1 131.5 L 81.4 131.5 L 81.4 134.1 L 77.5 134.1 L 77.5 138.2 L 123.3 138.2 L 123.3 133.9 L 119.3 133.9 L 119.3 131.6 L 114.5 131.6 L 114.5 129.2 L 102.6 129.2 L 102.6 80.2 L 106 80.2 C 107 80.2 106.6 76.4 110.7 76.4 L 111.3 76.4 L 121.2 77.7 L 122.2 77.7 L 125.4 77.3 C 124.3 79.7 123.1 83.8 122.1 86.4 C 120.9 89.6 119.9 92.6 118.7 95.8 C 117.5 98.9 116.6 101.9 115.4 105 C 114.9 106.4 114.2 108.1 113.7 109.6 C 113.4 110.4 113.1 111.1 112.9 111.9 C 112.5 113.2 112.8 113.2 111.2 113.2 C 113.3 116.4 119.2 120.5 124.6 120.5 L 127.2 120.5 C 132.6 120.5 138.8 116.4 140.9 113.2 L 139.8 113.2 L 126.4 77.1 C 127.4 76.9 129.3 76.2 129.3 75.3 C 129.3 74.5 127.8 75.5 126.7 75.5 L 126.3 75.5 C 120.8 75.5 116.6 71 110.9 71 L 109.6 71 C 106.7 71 104.2 72.4 102.6 73.8 C 101.8 73.4 101.3 73.6 101.3 72.3 C 101.3 71.9 102.4 68.8 102.5 68.5 L 100.6 62.3 L 100.2 62.3 z M 126.1 80.8 L 137.8 113.2 L 114.1 113.2 L 126.1 80.8 z M 74.8 80.8 L 86.5 113.2 L 63.1 113.1 L 74.8 80.8 z", BoundingBox{60.2, 62.3, 140.9, 138.2}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::autotext("FBI"));
+	commands.push_back(DrawCommand::path("M 100,140 C 53.7465,122.654 71.0916,95.6737 65.3099,70.6197 c 11.5634,13.4906 23.1267,13.4906 34.6901,0 11.564,13.4906 23.126,13.4906 34.69,0 C 128.908,95.6737 146.254,122.654 100,140 Z", BoundingBox{65.3, 70.61, 134.69, 140}));
+	commands.push_back(DrawCommand::autotext("USSS"));
+	commands.push_back(DrawCommand::autotext("TSA"));
+	commands.push_back(DrawCommand::path("m 75,100 0,-35 50,0 0,35 20,0 -15,35 -60,0 -15,-35 z", BoundingBox{55, 65, 145, 135}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::path("m 135,100 -15,35 -10,0 15,-35 z", BoundingBox{110, 100, 135, 135}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("m 100,70 7.1,20.3 21.5,0.4 -17.1,13 6.2,20.6 L 100,112 82.4,124.3 88.6,103.7 71.5,90.7 92.9,90.3 z m 0,-5 c -19.3,0 -35,15.7 -35,35 0,19.3 15.7,35 35,35 19.3,0 35,-15.7 35,-35 0,-19.3 -15.7,-35 -35,-35 z m 0,5 c 16.6,0 30,13.4 30,30 0,16.6 -13.4,30 -30,30 -16.6,0 -30,-13.4 -30,-30 0,-16.6 13.4,-30 30,-30 z", BoundingBox{65, 65, 135, 135}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::path("m 70,125 15,-50 15,50 15,-50 15,50 ", BoundingBox{70, 75, 130, 125}));
+	commands.push_back(DrawCommand::text("MSL", Vector2{100, 100}, 20));
+	commands.push_back(DrawCommand::text("SPT", Vector2{100, 115}, 20));
+	commands.push_back(DrawCommand::text("MSL", Vector2{100, 110}, 30));
+	commands.push_back(DrawCommand::path("m 75,70 50,0 m -25,10 c 0,-5 0,-10 0,-10", BoundingBox{75, 70, 125, 80}));
+	commands.push_back(DrawCommand::path("m 55,85 90,0", BoundingBox{55, 85, 145, 85}));
+	commands.push_back(DrawCommand::path("m 75,80 25,-20 c 0,0 0,15 0,15 l 5,0 0,-5", BoundingBox{75, 60, 105, 80}));
+	commands.push_back(DrawCommand::text("MSL", Vector2{90, 110}, 20));
+	commands.push_back(DrawCommand::path("m 120,115 0,-15 -10,-10 20,0 -10,10", BoundingBox{110, 90, 130, 115}));
+	commands.push_back(DrawCommand::text("WHD", Vector2{100, 115}, 20));
+	commands.push_back(DrawCommand::path("m 80,60 20,20 20,-20 m -20,0 0,80", BoundingBox{80, 60, 120, 140}));
+	commands.push_back(DrawCommand::autotext("BOMB"));
+	commands.push_back(DrawCommand::path("m 85,105 15,-25 15,25 m -35,5 c 0,-10 40,-10 40,0 0,10 -40,10 -40,0 z", BoundingBox{80, 80, 120, 117.5}));
+	commands.push_back(DrawCommand::path("M80,140 c0,-20 10,-60 50,-63 m-10,63 c0,-20 -10,-60 -50,-63 ", BoundingBox{70, 77, 130, 140}));
+	commands.push_back(DrawCommand::circle(Vector2{70, 85}, 8).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::circle(Vector2{130, 85}, 8).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("m 100,132 0,-10 -35,0 0,-50 70,0 0,50 -35,0 m -25,10 50,0", BoundingBox{65, 72, 135, 132}));
+	commands.push_back(DrawCommand::autotext("CLE"));
+	commands.push_back(DrawCommand::autotext("G"));
+	commands.push_back(DrawCommand::autotext("GFC"));
+	commands.push_back(DrawCommand::path("m 80,82.4 45,-2 -4,37 m -6,-1 0,-35 -34,9 m 12,21 0,8 M 80,82.4 c 0,25 16,35 41,35", BoundingBox{80, 80.4, 125, 119.4}));
+	commands.push_back(DrawCommand::path("m 100,55 0,25 10,5 -20,5 20,5 -20,5 10,5 0,15 10,5 -20,5 20,5 -20,5 20,5 M 90,65 100,55 110,65", BoundingBox{90, 55, 110, 145}));
+	commands.push_back(DrawCommand::path("m 110,95 10,0 m -10,10 10,0 m -10,10 10,0 m -10,-30 10,0 m -10,-5 -10,10 -30,0 0,20 30,0 10,10 z", BoundingBox{70, 80, 120, 120}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::autotext("SUST"));
+	commands.push_back(DrawCommand::path("m 65,124.4 10,-37 25,-10 25,10 10,37 z", BoundingBox{65, 77.4, 135, 124.4}));
+	commands.push_back(DrawCommand::path(PATH_0, BoundingBox{75, 80, 125, 120}));
+	commands.push_back(DrawCommand::path(PATH_0, BoundingBox{75, 80, 125, 120}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::autotext("DPLY"));
+	commands.push_back(DrawCommand::path("m 90,60 0,22.7 -19.7,-11.3 -10,17.3 L 80,100 l -19.7,11.3 10,17.3 L 90,117.3 90,140 l 20,0 0,-22.7 19.7,11.3 10,-17.3 L 120,100 l 19.7,-11.3 -10,-17.3 L 110,82.7 110,60 90,60 z", BoundingBox{60.3, 60, 139.7, 140}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("M60,85 l40,15 40,-15 0,30 -40,-15 -40,15 z M95.5,80 l9,0 0,-9 9,0 0,-9 -9,0 0,-9 -9,0 0,9 -9,0 0,9 9,0 Z", BoundingBox{60, 53, 140, 115}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::circle(Vector2{100, 100}, 22));
+	commands.push_back(DrawCommand::circle(Vector2{100, 100}, 22).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("M117,82 l20,-18 -18,25z M83,82 l-20,-18 18,25z", BoundingBox{63, 64, 137, 89}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::autotext("IED"));
+	commands.push_back(DrawCommand::path("m 100,60 c 0,15 25,40 40,40 -15,0 -40,25 -40,40 0,-15 -25,-40 -40,-40 15,0 40,-25 40,-40 z", BoundingBox{60, 60, 140, 140}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::scale(0.75, commands[163]));
+	commands.push_back(DrawCommand::path("m 70,75 10,-15 10,15 10,-15 10,15 10,-15 10,15", BoundingBox{70, 60, 130, 75}));
+	commands.push_back(DrawCommand::path("M72,95 l30,-25 0,25 30,-25 M70,70 c0,35 15,50 50,50", BoundingBox{70, 70, 132, 120}));
+	commands.push_back(DrawCommand::path("M 100 65 L 115.2 91.3 L 130.3 117.5 C 133.3 112.4 135 106.4 135 100 C 135 80.7 119.3 65 100 65 z M 100 65 C 80.7 65 65 80.7 65 100 C 65 106.4 66.7 112.4 69.7 117.5 L 84.8 91.3 L 100 65 z M 69.7 117.5 C 75.7 128 87 135 100 135 C 113 135 124.3 128 130.3 117.5 L 100 117.5 L 69.7 117.5 z", BoundingBox{65, 65, 135, 135}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("M 69.7,117.5 100,65 l 30.3,52.5 z", BoundingBox{69.7, 65, 130.3, 117.5}).with_fill(ColorType::WHITE).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::path(PATH_1, BoundingBox{86.5, 53, 113.5, 80}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::path("m 120,90 -5,5 -10,-10 5,-5 -20,0 5,5 -10,10 -5,-5 0,20 5,-5 10,10 -5,5 20,0 -5,-5 10,-10 5,5 z", BoundingBox{80, 80, 120, 120}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::autotext("MAN"));
+	commands.push_back(DrawCommand::path("M60,85 l40,15 40,-15 0,30 -40,-15 -40,15 z", BoundingBox{60, 85, 140, 115}).with_fill(ColorType::ICON));
+
+	static constexpr uint16_t COMMAND_INDICES[] = {0, 1, 1, 2, 1, 3, 1, 4, 5, 5, 2, 5, 3, 5, 4, 1, 6, 1, 6, 7, 1, 6, 8, 1, 6, 9, 10, 11, 11, 4, 12, 12, 2, 12, 3, 12, 4, 13, 13, 2, 13, 3, 13, 4, 14, 14, 2, 14, 3, 14, 4, 15, 16, 15, 16, 2, 15, 16, 3, 15, 16, 4, 17, 17, 2, 17, 3, 17, 4, 18, 18, 2, 18, 2, 19, 18, 2, 19, 20, 18, 3, 18, 3, 19, 18, 3, 19, 20, 18, 4, 18, 4, 19, 18, 4, 19, 20, 21, 21, 2, 21, 3, 21, 4, 22, 22, 2, 22, 3, 22, 4, 23, 15, 23, 15, 2, 23, 15, 3, 23, 15, 4, 24, 24, 2, 24, 3, 24, 4, 25, 25, 2, 25, 3, 25, 4, 26, 26, 2, 26, 3, 26, 4, 27, 27, 28, 27, 29, 30, 31, 32, 33, 30, 31, 32, 33, 34, 35, 35, 36, 37, 37, 38, 39, 39, 40, 39, 38, 37, 40, 37, 41, 35, 42, 43, 44, 45, 35, 42, 43, 44, 45, 46, 47, 47, 48, 47, 49, 47, 50, 47, 40, 47, 40, 48, 47, 40, 49, 47, 40, 50, 39, 52, 53, 54, 55, 53, 56, 53, 57, 53, 58, 53, 59, 60, 54, 61, 62, 62, 63, 64, 64, 65, 47, 49, 64, 66, 67, 68, 69, 67, 68, 70, 71, 72, 54, 73, 37, 74, 54, 31, 32, 33, 74, 75, 76, 37, 77, 37, 77, 78, 54, 31, 32, 33, 79, 80, 54, 31, 32, 33, 77, 54, 42, 43, 44, 45, 81, 54, 54, 82, 54, 38, 54, 82, 83, 54, 84, 54, 85, 86, 87, 88, 54, 85, 86, 87, 88, 89, 54, 85, 86, 87, 88, 90, 54, 85, 86, 87, 88, 91, 54, 31, 32, 33, 54, 42, 43, 44, 45, 54, 92, 54, 93, 54, 94, 86, 88, 54, 95, 54, 95, 96, 54, 95, 97, 98, 54, 86, 87, 99, 88, 100, 101, 100, 101, 102, 100, 101, 103, 100, 101, 104, 105, 106, 105, 106, 102, 105, 106, 103, 105, 106, 104, 107, 108, 107, 108, 102, 107, 108, 103, 107, 108, 104, 109, 101, 109, 101, 102, 109, 101, 103, 109, 101, 104, 110, 110, 102, 110, 103, 110, 104, 109, 101, 111, 109, 101, 111, 102, 109, 101, 111, 103, 109, 101, 111, 104, 105, 106, 111, 105, 106, 111, 102, 105, 106, 111, 103, 105, 106, 111, 104, 112, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 30, 31, 32, 33, 130, 131, 30, 31, 32, 33, 132, 133, 30, 31, 32, 33, 132, 134, 30, 31, 32, 33, 132, 135, 30, 31, 32, 33, 136, 137, 30, 31, 32, 33, 130, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 160, 162, 159, 161, 163, 164, 165, 166, 167, 168, 109, 101, 169, 170, 171, 172};
+	static constexpr LayerEntry ENTRIES[] = {
+		{15110000, 0, 1, false, BoundingBox{100, 60, 100, 140}} /* weapon */,
+		{15110100, 1, 1, false, BoundingBox{85, 60, 115, 140}} /* rifle */,
+		{15110101, 2, 2, false, BoundingBox{85, 60, 115, 140}} /* single shot rifle */,
+		{15110102, 4, 2, false, BoundingBox{85, 60, 115, 140}} /* semiautomatic rifle */,
+		{15110103, 6, 2, false, BoundingBox{85, 60, 115, 140}} /* automatic rifle */,
+		{15110200, 8, 1, false, BoundingBox{80, 60, 120, 140}} /* machine gun */,
+		{15110201, 9, 2, false, BoundingBox{80, 60, 120, 140}} /* light machine gun */,
+		{15110202, 11, 2, false, BoundingBox{80, 60, 120, 140}} /* medium machine gun */,
+		{15110203, 13, 2, false, BoundingBox{80, 60, 120, 140}} /* heavy machine gun */,
+		{15110300, 15, 2, false, BoundingBox{85, 60, 115, 140}} /* grenade launcher */,
+		{15110301, 17, 3, false, BoundingBox{85, 60, 115, 140}} /* light grenade launcher */,
+		{15110302, 20, 3, false, BoundingBox{85, 60, 115, 140}} /* medium grenade launcher */,
+		{15110303, 23, 3, false, BoundingBox{85, 60, 115, 140}} /* heavy grenade launcher */,
+		{15110400, 26, 1, false, BoundingBox{90, 53.75, 110, 135}} /* flame thrower */,
+		{15110500, 27, 1, false, BoundingBox{85, 60, 115, 140}} /* air defense gun */,
+		{15110501, 28, 2, false, BoundingBox{85, 60, 115, 140}} /* heavy air defense gun */,
+		{15110600, 30, 1, false, BoundingBox{85, 60, 115, 140}} /* anti-tank gun */,
+		{15110601, 31, 2, false, BoundingBox{85, 60, 115, 140}} /* light anti-tank gun */,
+		{15110602, 33, 2, false, BoundingBox{85, 60, 115, 140}} /* medium anti-tank gun */,
+		{15110603, 35, 2, false, BoundingBox{85, 60, 115, 140}} /* heavy anti-tank gun */,
+		{15110700, 37, 1, false, BoundingBox{85, 60, 115, 140}} /* direct fire gun */,
+		{15110701, 38, 2, false, BoundingBox{85, 60, 115, 140}} /* light direct fire gun */,
+		{15110702, 40, 2, false, BoundingBox{85, 60, 115, 140}} /* medium direct fire gun */,
+		{15110703, 42, 2, false, BoundingBox{85, 60, 115, 140}} /* heavy direct fire gun */,
+		{15110800, 44, 1, false, BoundingBox{85, 60, 115, 140}} /* recoilless gun */,
+		{15110801, 45, 2, false, BoundingBox{85, 60, 115, 140}} /* light recoilless gun */,
+		{15110802, 47, 2, false, BoundingBox{85, 60, 115, 140}} /* medium recoilless gun */,
+		{15110803, 49, 2, false, BoundingBox{85, 60, 115, 140}} /* heavy recoilless gun */,
+		{15110900, 51, 2, false, BoundingBox{85, 60, 115, 140}} /* howitzer */,
+		{15110901, 53, 3, false, BoundingBox{85, 60, 115, 140}} /* light howitzer */,
+		{15110902, 56, 3, false, BoundingBox{85, 60, 115, 140}} /* medium howitzer */,
+		{15110903, 59, 3, false, BoundingBox{85, 60, 115, 140}} /* heavy howitzer */,
+		{15111000, 62, 1, false, BoundingBox{85, 60, 115, 140}} /* missile launcher */,
+		{15111001, 63, 2, false, BoundingBox{85, 60, 115, 140}} /* light missile launcher */,
+		{15111002, 65, 2, false, BoundingBox{85, 60, 115, 140}} /* medium missile launcher */,
+		{15111003, 67, 2, false, BoundingBox{85, 60, 115, 140}} /* heavy missile launcher */,
+		{15111100, 69, 1, false, BoundingBox{85, 60, 115, 140}} /* air defense missile launcher */,
+		{15111101, 70, 2, false, BoundingBox{85, 60, 115, 140}} /* light air defense missile launcher */,
+		{15111102, 72, 3, false, BoundingBox{85, 60, 115, 140}} /* light air defense missile launcher TLAR */,
+		{15111103, 75, 4, false, BoundingBox{85, 60, 115, 140}} /* light air defense missile launcher TELAR */,
+		{15111104, 79, 2, false, BoundingBox{85, 60, 115, 140}} /* medium air defense missile launcher */,
+		{15111105, 81, 3, false, BoundingBox{85, 60, 115, 140}} /* medium air defense missile launcher TLAR */,
+		{15111106, 84, 4, false, BoundingBox{85, 60, 115, 140}} /* medium air defense missile launcher TELAR */,
+		{15111107, 88, 2, false, BoundingBox{85, 60, 115, 140}} /* heavy air defense missile launcher */,
+		{15111108, 90, 3, false, BoundingBox{85, 60, 115, 140}} /* heavy air defense missile launcher TLAR */,
+		{15111109, 93, 4, false, BoundingBox{85, 60, 115, 140}} /* heavy air defense missile launcher TELAR */,
+		{15111200, 97, 1, false, BoundingBox{85, 60, 115, 140}} /* anti-tank missile launcher */,
+		{15111201, 98, 2, false, BoundingBox{85, 60, 115, 140}} /* light anti-tank missile launcher */,
+		{15111202, 100, 2, false, BoundingBox{85, 60, 115, 140}} /* medium anti-tank missile launcher */,
+		{15111203, 102, 2, false, BoundingBox{85, 60, 115, 140}} /* heavy anti-tank missile launcher */,
+		{15111300, 104, 1, false, BoundingBox{85, 60, 230, 280}} /* surface-to-surface missile launcher */,
+		{15111301, 105, 2, false, BoundingBox{85, 60, 230, 280}} /* light surface-to-surface missile launcher */,
+		{15111302, 107, 2, false, BoundingBox{85, 60, 230, 280}} /* medium surface-to-surface missile launcher */,
+		{15111303, 109, 2, false, BoundingBox{85, 60, 230, 280}} /* heavy surface-to-surface missile launcher */,
+		{15111400, 111, 2, false, BoundingBox{85, 60, 115, 140}} /* mortar */,
+		{15111401, 113, 3, false, BoundingBox{85, 60, 115, 140}} /* light mortar */,
+		{15111402, 116, 3, false, BoundingBox{85, 60, 115, 140}} /* medium mortar */,
+		{15111403, 119, 3, false, BoundingBox{85, 60, 115, 140}} /* heavy mortar */,
+		{15111500, 122, 1, false, BoundingBox{85, 60, 115, 140}} /* single rocket launcher */,
+		{15111501, 123, 2, false, BoundingBox{85, 60, 115, 140}} /* light single rocket launcher */,
+		{15111502, 125, 2, false, BoundingBox{85, 60, 115, 140}} /* medium single rocket launcher */,
+		{15111503, 127, 2, false, BoundingBox{85, 60, 115, 140}} /* heavy single rocket launcher */,
+		{15111600, 129, 1, false, BoundingBox{85, 60, 115, 140}} /* multiple rocket launcher */,
+		{15111601, 130, 2, false, BoundingBox{85, 60, 115, 140}} /* light multiple rocket launcher */,
+		{15111602, 132, 2, false, BoundingBox{85, 60, 115, 140}} /* medium multiple rocket launcher */,
+		{15111603, 134, 2, false, BoundingBox{85, 60, 115, 140}} /* heavy multiple rocket launcher */,
+		{15111700, 136, 1, false, BoundingBox{85, 60, 115, 140}} /* anti-tank rocket launcher */,
+		{15111701, 137, 2, false, BoundingBox{85, 60, 115, 140}} /* light anti-tank rocket launcher */,
+		{15111702, 139, 2, false, BoundingBox{85, 60, 115, 140}} /* medium anti-tank rocket launcher */,
+		{15111703, 141, 2, false, BoundingBox{85, 60, 115, 140}} /* heavy anti-tank rocket launcher */,
+		{15111800, 143, 1, false, BoundingBox{80, 60, 120, 140}} /* nonlethal weapon */,
+		{15111900, 144, 2, false, BoundingBox{80, 60, 120, 140}} /* taser */,
+		{15112000, 146, 2, false, BoundingBox{80, 60, 120, 140}} /* water cannon */,
+		{15120000, 148, 4, false, BoundingBox{60, 80, 140, 130}} /* military vehicle */,
+		{15120100, 152, 5, false, BoundingBox{60, 80, 140, 130}} /* armored vehicle */,
+		{15120101, 157, 1, false, BoundingBox{70, 70, 130, 130}} /* armored fighting vehicle */,
+		{15120102, 158, 2, false, BoundingBox{70, 70, 130, 130}} /* armored fighting vehicle command and control */,
+		{15120103, 160, 1, false, BoundingBox{70, 70, 130, 130}} /* armored personnel carrier */,
+		{15120104, 161, 2, false, BoundingBox{70, 70, 130, 130}} /* armored personnel carrier ambulance */,
+		{15120105, 163, 1, false, BoundingBox{56.25, 80, 143.75, 120}} /* armored protected vehicle */,
+		{15120106, 164, 2, false, BoundingBox{56.25, 80, 143.75, 120}} /* armored protected vehicle recovery */,
+		{15120107, 166, 2, false, BoundingBox{56.25, 80, 143.75, 120}} /* armored protected vehicle medical evacuation */,
+		{15120108, 168, 2, false, BoundingBox{70, 70, 130, 130}} /* armored personnel carrier recovery */,
+		{15120109, 170, 2, false, BoundingBox{70, 70, 130, 130}} /* combat service support vehicle */,
+		{15120110, 172, 5, false, BoundingBox{65, 70, 135, 140}} /* light armored wheeled vehicle */,
+		{15120111, 177, 6, false, BoundingBox{65, 70, 135, 140}} /* light armored reconnaissance */,
+		{15120200, 183, 1, false, BoundingBox{70, 70, 130, 130}} /* tank */,
+		{15120201, 184, 2, false, BoundingBox{70, 70, 130, 130}} /* light tank */,
+		{15120202, 186, 2, false, BoundingBox{70, 70, 130, 130}} /* medium tank */,
+		{15120203, 188, 2, false, BoundingBox{70, 70, 130, 130}} /* heavy tank */,
+		{15120300, 190, 2, false, BoundingBox{70, 70, 130, 130}} /* tank recovery vehicle */,
+		{15120301, 192, 3, false, BoundingBox{70, 70, 130, 130}} /* light tank recovery vehicle */,
+		{15120302, 195, 3, false, BoundingBox{70, 70, 130, 130}} /* medium tank recovery vehicle */,
+		{15120303, 198, 3, false, BoundingBox{70, 70, 130, 130}} /* heavy tank recovery vehicle */,
+		{15130000, 201, 2, false, BoundingBox{56.25, 80, 143.75, 120}} /* engineer vehicle and equipment */,
+		{15130100, 203, 1, false, BoundingBox{70, 85, 130, 115}} /* bridge */,
+		{15130200, 204, 2, false, BoundingBox{70, 65, 130, 130}} /* bridge mounted on utility vehicle */,
+		{15130300, 206, 2, false, BoundingBox{70, 70, 130, 130}} /* fixed bridge */,
+		{15130400, 208, 2, false, BoundingBox{70, 85, 130, 132.5}} /* floating bridge */,
+		{15130500, 210, 2, false, BoundingBox{70, 80, 130, 120}} /* folding girder bridge */,
+		{15130600, 212, 2, false, BoundingBox{70, 80, 130, 120}} /* hollow deck bridge */,
+		{15130700, 214, 1, false, BoundingBox{85, 80, 115, 120}} /* drill */,
+		{15130701, 215, 2, false, BoundingBox{70, 65, 130, 130}} /* drill mounted on utility vehicle */,
+		{15130800, 217, 1, false, BoundingBox{70, 60, 130, 130}} /* earthmover */,
+		{15130801, 218, 2, false, BoundingBox{70, 60, 130, 130}} /* multifunctional earthmover/digger */,
+		{15130900, 220, 1, false, BoundingBox{70, 80, 130, 120}} /* mine clearing equipment */,
+		{15130901, 221, 2, false, BoundingBox{65, 80, 135, 120}} /* trailer-mounted mine clearing equipment */,
+		{15130902, 223, 3, false, BoundingBox{70, 70, 130, 130}} /* mine clearing equipment on tank chassis */,
+		{15130903, 226, 1, false, BoundingBox{70, 60, 130, 130}} /* assault breacher vehicle with combat dozer blade */,
+		{15130904, 227, 3, false, BoundingBox{70, 80, 130, 120}} /* medium capability equipment */,
+		{15130905, 230, 3, false, BoundingBox{70, 80, 130, 120}} /* heavy capability equipment */,
+		{15131000, 233, 2, false, BoundingBox{80, 65, 120, 120}} /* mine laying equipment */,
+		{15131001, 235, 2, false, BoundingBox{70, 65, 130, 130}} /* mine laying equipment on utility vehicle */,
+		{15131002, 237, 2, false, BoundingBox{70, 70, 130, 130}} /* armored carrier with Volcano */,
+		{15131003, 239, 5, false, BoundingBox{65, 65, 135, 130}} /* truck mounted with Volcano */,
+		{15131100, 244, 1, false, BoundingBox{70, 60, 130, 130}} /* dozer */,
+		{15131101, 245, 1, false, BoundingBox{70, 60, 130, 130}} /* armored dozer */,
+		{15131200, 246, 2, false, BoundingBox{70, 70, 130, 130}} /* armored assault */,
+		{15131300, 248, 3, false, BoundingBox{70, 70, 130, 130}} /* armored engineer recon vehicle */,
+		{15131400, 251, 6, false, BoundingBox{65, 65, 135, 130}} /* backhoe */,
+		{15131500, 257, 5, false, BoundingBox{65, 65, 135, 130}} /* construction vehicle */,
+		{15131600, 262, 6, false, BoundingBox{65, 65, 135, 140}} /* ferry transporter */,
+		{15140000, 268, 0, false, std::nullopt} /* utility vehicle */,
+		{15140100, 268, 1, false, BoundingBox{70, 65, 130, 130}} /* vehicle */,
+		{15140200, 269, 2, false, BoundingBox{70, 65, 130, 130}} /* medical vehicle */,
+		{15140300, 271, 2, false, BoundingBox{70, 65, 130, 130}} /* medical evacuation vehicle */,
+		{15140400, 273, 3, false, BoundingBox{70, 65, 130, 130}} /* mobile emergency physician */,
+		{15140500, 276, 2, false, BoundingBox{70, 65, 130, 130}} /* bus */,
+		{15140600, 278, 5, false, BoundingBox{70, 65, 140, 140}} /* semi trailer and truck */,
+		{15140601, 283, 6, false, BoundingBox{70, 65, 140, 140}} /* light semi-trailer and truck */,
+		{15140602, 289, 6, false, BoundingBox{70, 65, 140, 140}} /* medium semi-trailer and truck */,
+		{15140603, 295, 6, false, BoundingBox{70, 65, 140, 140}} /* heavy semi-trailer and truck */,
+		{15140700, 301, 4, false, BoundingBox{65, 65, 135, 130}} /* limited cross-country truck */,
+		{15140800, 305, 5, false, BoundingBox{65, 65, 135, 140}} /* cross-country truck */,
+		{15140900, 310, 2, false, BoundingBox{70, 65, 130, 130}} /* petroleum, oil, and lubricant vehicle */,
+		{15141000, 312, 2, false, BoundingBox{70, 65, 130, 130}} /* water vehicle */,
+		{15141100, 314, 4, false, BoundingBox{70, 65, 130, 140}} /* amphibious utility wheeled vehicle */,
+		{15141200, 318, 2, false, BoundingBox{70, 65, 130, 130}} /* tow truck */,
+		{15141201, 320, 3, false, BoundingBox{70, 65, 130, 130}} /* light tow truck */,
+		{15141202, 323, 3, false, BoundingBox{70, 65, 130, 130}} /* heavy tow truck */,
+		{15150000, 326, 0, false, std::nullopt} /* train */,
+		{15150100, 326, 1, false, BoundingBox{70, 70, 130, 130}} /* locomotive */,
+		{15150200, 327, 5, false, BoundingBox{70, 65, 130, 140}} /* railcar */,
+		{15160000, 332, 0, true, std::nullopt} /* civilian vehicle */,
+		{15160100, 332, 2, true, BoundingBox{70, 85, 130, 132.5}} /* automobile */,
+		{15160101, 334, 3, true, BoundingBox{70, 85, 130, 132.5}} /* compact car */,
+		{15160102, 337, 3, true, BoundingBox{70, 85, 130, 132.5}} /* midsize car */,
+		{15160103, 340, 3, true, BoundingBox{70, 85, 130, 132.5}} /* sedan */,
+		{15160200, 343, 2, true, BoundingBox{70, 85, 130, 132.5}} /* open-bed truck */,
+		{15160201, 345, 3, true, BoundingBox{70, 85, 130, 132.5}} /* pickup truck */,
+		{15160202, 348, 3, true, BoundingBox{70, 85, 130, 132.5}} /* small truck */,
+		{15160203, 351, 3, true, BoundingBox{70, 85, 130, 132.5}} /* large truck */,
+		{15160300, 354, 2, true, BoundingBox{70, 85, 130, 132.5}} /* multiple passenger vehicle */,
+		{15160301, 356, 3, true, BoundingBox{70, 85, 130, 132.5}} /* van */,
+		{15160302, 359, 3, true, BoundingBox{70, 85, 130, 132.5}} /* small bus */,
+		{15160303, 362, 3, true, BoundingBox{70, 85, 130, 132.5}} /* large bus */,
+		{15160400, 365, 2, true, BoundingBox{70, 85, 130, 132.5}} /* civilian utility vehicle */,
+		{15160401, 367, 3, true, BoundingBox{70, 85, 130, 132.5}} /* sport utility vehicle */,
+		{15160402, 370, 3, true, BoundingBox{70, 85, 130, 132.5}} /* small box truck */,
+		{15160403, 373, 3, true, BoundingBox{70, 85, 130, 132.5}} /* large box truck */,
+		{15160500, 376, 1, true, BoundingBox{70, 90, 130, 132.5}} /* jeep type vehicle */,
+		{15160501, 377, 2, true, BoundingBox{70, 90, 130, 132.5}} /* light jeep type vehicle */,
+		{15160502, 379, 2, true, BoundingBox{70, 90, 130, 132.5}} /* medium jeep type vehicle */,
+		{15160503, 381, 2, true, BoundingBox{70, 90, 130, 132.5}} /* heavy jeep type vehicle */,
+		{15160600, 383, 3, true, BoundingBox{70, 85, 140, 132.5}} /* tractor trailer truck with box */,
+		{15160601, 386, 4, true, BoundingBox{70, 85, 140, 132.5}} /* light tractor trailer truck with box */,
+		{15160602, 390, 4, true, BoundingBox{70, 85, 140, 132.5}} /* medium tractor trailer truck with box */,
+		{15160603, 394, 4, true, BoundingBox{70, 85, 140, 132.5}} /* heavy tractor trailer truck with box */,
+		{15160700, 398, 3, true, BoundingBox{70, 85, 140, 132.5}} /* tractor trailer truck with flatbed */,
+		{15160701, 401, 4, true, BoundingBox{70, 85, 140, 132.5}} /* light tractor trailer truck with flatbed */,
+		{15160702, 405, 4, true, BoundingBox{70, 85, 140, 132.5}} /* medium tractor trailer truck with flatbed */,
+		{15160703, 409, 4, true, BoundingBox{70, 85, 140, 132.5}} /* heavy tractor trailer truck with flatbed */,
+		{15160800, 413, 1, true, BoundingBox{65, 95, 135, 115}} /* known insurgent vehicle */,
+		{15160900, 414, 2, true, BoundingBox{65, 95, 135, 115}} /* drug vehicle */,
+		{15170000, 416, 1, false, BoundingBox{59.5, 51, 140.6, 149.2}} /* law enforcement */,
+		{15170100, 417, 1, false, std::nullopt} /* Bureau of Alcohol, Tobacco, Firearms and Explosives */,
+		{15170200, 418, 2, false, BoundingBox{62.5, 66.8, 137.5, 133.2}} /* border patrol */,
+		{15170300, 420, 2, false, BoundingBox{73.4, 69.8, 133.9, 135.2}} /* customs service */,
+		{15170400, 422, 1, false, std::nullopt} /* drug enforcement administration */,
+		{15170500, 423, 1, false, BoundingBox{60.2, 62.3, 140.9, 138.2}} /* Department of Justice */,
+		{15170600, 424, 1, false, std::nullopt} /* Federal Bureau of Investigation */,
+		{15170700, 425, 1, false, BoundingBox{65.3, 70.61, 134.69, 140}} /* police */,
+		{15170800, 426, 1, false, std::nullopt} /* United States Secret Service */,
+		{15170900, 427, 1, false, std::nullopt} /* Transportation Security Administration */,
+		{15171000, 428, 2, false, BoundingBox{55, 65, 145, 135}} /* coast guard */,
+		{15171100, 430, 1, false, BoundingBox{65, 65, 135, 135}} /* US Marshals Service */,
+		{15180000, 431, 1, false, BoundingBox{70, 75, 130, 125}} /* pack animals */,
+		{15190000, 432, 6, false, BoundingBox{60, 80, 140, 130}} /* missile support */,
+		{15190100, 438, 6, false, BoundingBox{60, 70, 140, 130}} /* transloader */,
+		{15190200, 444, 6, false, BoundingBox{55, 80, 145, 130}} /* transporter */,
+		{15190300, 450, 6, false, BoundingBox{60, 60, 140, 130}} /* crane */,
+		{15190400, 456, 6, false, BoundingBox{60, 80, 140, 130}} /* propellant transporter */,
+		{15190500, 462, 6, false, BoundingBox{60, 80, 140, 130}} /* warhead transporter */,
+		{15200000, 468, 0, false, std::nullopt} /* other equipment */,
+		{15200100, 468, 1, false, BoundingBox{80, 60, 120, 140}} /* antennae */,
+		{15200200, 469, 1, false, std::nullopt} /* bomb */,
+		{15200300, 470, 1, false, BoundingBox{80, 80, 120, 117.5}} /* booby trap */,
+		{15200400, 471, 3, false, BoundingBox{62, 77, 138, 140}} /* CBRN equipment */,
+		{15200500, 474, 1, false, BoundingBox{65, 72, 135, 132}} /* computer system */,
+		{15200600, 475, 1, false, std::nullopt} /* command launch equipment */,
+		{15200700, 476, 1, false, std::nullopt} /* generator set */,
+		{15200800, 477, 1, false, std::nullopt} /* ground-based midcourse defense fire control center */,
+		{15200900, 478, 1, false, BoundingBox{80, 80.4, 125, 119.4}} /* in-flight interceptor communications system data terminal */,
+		{15201000, 479, 1, false, BoundingBox{90, 55, 110, 145}} /* laser */,
+		{15201100, 480, 1, false, BoundingBox{70, 80, 120, 120}} /* military information support operations */,
+		{15201200, 481, 1, false, std::nullopt} /* sustainment shipments */,
+		{15201300, 482, 1, false, BoundingBox{65, 77.4, 135, 124.4}} /* tent */,
+		{15201301, 483, 1, false, BoundingBox{75, 80, 125, 120}} /* civilian tent */,
+		{15201302, 484, 1, false, BoundingBox{75, 80, 125, 120}} /* military tent */,
+		{15201400, 485, 1, false, std::nullopt} /* unit deployment shipments */,
+		{15201500, 486, 1, false, BoundingBox{60.3, 60, 139.7, 140}} /* emergency medical operation */,
+		{15201501, 487, 1, false, BoundingBox{60, 53, 140, 115}} /* medical evacuation helicopter */,
+		{15210000, 488, 0, false, std::nullopt} /* land mines */,
+		{15210100, 488, 1, false, BoundingBox{78, 78, 122, 122}} /* land mine */,
+		{15210200, 489, 2, false, BoundingBox{63, 64, 137, 122}} /* anti-personnel land mine */,
+		{15210300, 491, 1, false, BoundingBox{78, 78, 122, 122}} /* anti-tank mine */,
+		{15210400, 492, 1, false, std::nullopt} /* improvised explosive device */,
+		{15210500, 493, 2, false, BoundingBox{63, 64, 137, 122}} /* less than lethal mine */,
+		{15220000, 495, 0, false, std::nullopt} /* sensors */,
+		{15220100, 495, 1, false, BoundingBox{60, 60, 140, 140}} /* sensor */,
+		{15220200, 496, 2, false, BoundingBox{70, 60, 130, 130}} /* sensor emplaced */,
+		{15220300, 498, 1, false, BoundingBox{70, 70, 132, 120}} /* radar */,
+		{15230000, 499, 2, false, BoundingBox{65, 65, 135, 135}} /* emergency operation */,
+		{15230100, 501, 3, false, BoundingBox{70, 53, 130, 132.5}} /* ambulance */,
+		{15230200, 504, 1, false, BoundingBox{80, 80, 120, 120}} /* fire fighting */,
+		{15240000, 505, 1, false, std::nullopt} /* manual track */,
+		{15250000, 506, 1, false, BoundingBox{60, 85, 140, 115}} /* rotary wing */
+	};
+	return build_layer_table(ENTRIES, COMMAND_INDICES, commands);
+}
+
+LayerTable build_modifier_1_table() {
+	std::vector<DrawCommand> commands;
+	commands.reserve(22);
+	commands.push_back(DrawCommand::textm1("B"));
+	commands.push_back(DrawCommand::textm1("C"));
+	commands.push_back(DrawCommand::textm1("EWR"));
+	commands.push_back(DrawCommand::textm1("I"));
+	commands.push_back(DrawCommand::textm1("N"));
+	commands.push_back(DrawCommand::textm1("RAD"));
+	commands.push_back(DrawCommand::textm1("UEW"));
+	commands.push_back(DrawCommand::textm1("H"));
+	commands.push_back(DrawCommand::textm1("CIV"));
+	commands.push_back(DrawCommand::textm1("TR"));
+	commands.push_back(DrawCommand::path("m 80,65 20,-10 20,10 m -20,15 0,-25", BoundingBox{80, 55, 120, 80}));
+	commands.push_back(DrawCommand::path("m 80,65 5,-2.5 m 5,-2.5 5,-2.5 m 10,0 5,2.5 m 5,2.5 5,2.5 m -20,15 0,-20", BoundingBox{80, 57.5, 120, 80}));
+	commands.push_back(DrawCommand::path("m 80,80 5,-5 30,0 5,5 m -40,-20 5,5 30,0 5,-5", BoundingBox{80, 60, 120, 80}));
+	commands.push_back(DrawCommand::textm1("CYB"));
+	commands.push_back(DrawCommand::path("m 90,60 20,0 c 10,0 10,15 0,15 L 90,75 C 80,75 80,60 90,60", BoundingBox{82.5, 60, 117.5, 75}));
+	commands.push_back(DrawCommand::textm1("A"));
+	commands.push_back(DrawCommand::path("m 100,60 0,15 -15,0 0,-15 30,0 0,15 -15,0", BoundingBox{85, 60, 115, 75}));
+	commands.push_back(DrawCommand::path("m 84,70 32,0 m 4,-5 c -5,0 -5,10 0,10 M 80,65 c 5,0 5,10 0,10", BoundingBox{80, 65, 120, 75}));
+	commands.push_back(DrawCommand::path(PATH_1, BoundingBox{86.5, 53, 113.5, 80}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::path("m 100,75 0,-10 -6,-10 12,0 -6,10", BoundingBox{94, 55, 106, 75}));
+	commands.push_back(DrawCommand::textm1("U"));
+	commands.push_back(DrawCommand::path("m 100,52.7 14.9,14.8 c 0.4,-0.3 0.9,-0.4 1.4,-0.4 1.5,0 2.7,1.2 2.7,2.7 0,1.4 -1.2,2.7 -2.7,2.7 -1.5,0 -2.7,-1.3 -2.7,-2.7 0,-0.4 0.1,-0.7 0.2,-1 l -10.4,-5.2 -2.5,8.6 c 0.2,0.1 0.4,0.2 0.6,0.3 0.7,0.5 1.2,1.3 1.2,2.3 0,1.5 -1.2,2.7 -2.7,2.7 -0.55,0 -1.06,-0.2 -1.49,-0.5 -0.73,-0.4 -1.22,-1.3 -1.22,-2.2 0,-1.2 0.77,-2.2 1.85,-2.6 l -2.53,-8.6 -10.42,5.2 c 0.12,0.3 0.18,0.6 0.18,1 0,1.5 -1.21,2.7 -2.7,2.7 -1.49,0 -2.7,-1.2 -2.7,-2.7 0,-1.5 1.21,-2.7 2.7,-2.7 0.52,0 1.01,0.1 1.42,0.4 l 14.9,-14.8 0,0 0,0 z", BoundingBox{80.97, 52.7, 119, 77.5}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+
+	static constexpr uint16_t COMMAND_INDICES[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21};
+	static constexpr LayerEntry ENTRIES[] = {
+		{1501, 0, 1, false, std::nullopt} /* biological */,
+		{1502, 1, 1, false, std::nullopt} /* chemical */,
+		{1503, 2, 1, false, std::nullopt} /* early warning radar */,
+		{1504, 3, 1, false, std::nullopt} /* intrusion */,
+		{1505, 4, 1, false, std::nullopt} /* nuclear */,
+		{1506, 5, 1, false, std::nullopt} /* radiological */,
+		{1507, 6, 1, false, std::nullopt} /* upgraded early warning radar */,
+		{1508, 7, 1, false, std::nullopt} /* hijacking/hijacked */,
+		{1509, 8, 1, true, std::nullopt} /* civilian */,
+		{1510, 9, 1, false, std::nullopt} /* tilt-rotor */,
+		{1511, 10, 0, false, std::nullopt} /* [reserved] */,
+		{1512, 10, 1, false, BoundingBox{80, 55, 120, 80}} /* multi-purpose blade */,
+		{1513, 11, 1, false, BoundingBox{80, 57.5, 120, 80}} /* tank-width mine plow */,
+		{1514, 12, 1, false, BoundingBox{80, 60, 120, 80}} /* bridge */,
+		{1515, 13, 1, false, std::nullopt} /* cyberspace */,
+		{1516, 14, 1, false, BoundingBox{82.5, 60, 117.5, 75}} /* armored */,
+		{1517, 15, 1, false, std::nullopt} /* attack */,
+		{1518, 16, 1, false, BoundingBox{85, 60, 115, 75}} /* cargo */,
+		{1519, 17, 1, false, BoundingBox{80, 65, 120, 75}} /* maintenance */,
+		{1520, 18, 1, false, BoundingBox{86.5, 53, 113.5, 80}} /* medevac */,
+		{1521, 19, 1, false, BoundingBox{94, 55, 106, 75}} /* petroleum, oil, and lubricants */,
+		{1522, 20, 1, false, std::nullopt} /* utility */,
+		{1523, 21, 1, false, BoundingBox{80.97, 52.7, 119, 77.5}} /* robotic */
+	};
+	return build_layer_table(ENTRIES, COMMAND_INDICES, commands);
+}
+
+LayerTable build_modifier_2_table() {
+	std::vector<DrawCommand> commands;
+	commands.reserve(11);
+	commands.push_back(DrawCommand::textm2("CYB"));
+	commands.push_back(DrawCommand::textm2("L"));
+	commands.push_back(DrawCommand::textm2("M"));
+	commands.push_back(DrawCommand::path("M60,120 l80,0", BoundingBox{60, 120, 140, 120}));
+	commands.push_back(DrawCommand::circle(Vector2{65, 125}, 5));
+	commands.push_back(DrawCommand::circle(Vector2{75, 125}, 5));
+	commands.push_back(DrawCommand::circle(Vector2{125, 125}, 5));
+	commands.push_back(DrawCommand::circle(Vector2{135, 125}, 5));
+	commands.push_back(DrawCommand::path("M 70,120 l 60,0 c10,0 10,10 0,10 l -60,0 c-10,0 -10,-10 0,-10", BoundingBox{62.5, 120, 137.5, 130}));
+	commands.push_back(DrawCommand::circle(Vector2{100, 125}, 5));
+	commands.push_back(DrawCommand::path("M100,121.68L114.895,136.459C115.309,136.201 115.798,136.052 116.321,136.052C117.812,136.052 119.022,137.262 119.022,138.753C119.022,140.243 117.812,141.454 116.321,141.454C114.831,141.454 113.62,140.243 113.62,138.753C113.62,138.407 113.686,138.076 113.805,137.772L103.378,132.6L100.851,141.224C101.072,141.298 101.28,141.4 101.471,141.526C102.211,142.008 102.701,142.843 102.701,143.791C102.701,145.281 101.491,146.492 100,146.492C99.451,146.492 98.939,146.327 98.512,146.045C97.776,145.562 97.29,144.73 97.29,143.785C97.29,142.592 98.064,141.579 99.138,141.222L96.613,132.606L86.186,137.778C86.305,138.082 86.37,138.413 86.37,138.759C86.37,140.25 85.16,141.46 83.669,141.46C82.179,141.46 80.969,140.25 80.969,138.759C80.969,137.268 82.179,136.058 83.669,136.058C84.193,136.058 84.681,136.207 85.095,136.465L99.991,121.671L100,121.662L100,121.68Z", BoundingBox{80.96, 121.66, 119.03, 146.5}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+
+	static constexpr uint16_t COMMAND_INDICES[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 3, 4, 5, 7, 4, 7, 4, 9, 7, 10};
+	static constexpr LayerEntry ENTRIES[] = {
+		{1501, 0, 1, false, std::nullopt} /* cyberspace */,
+		{1502, 1, 1, false, std::nullopt} /* light */,
+		{1503, 2, 1, false, std::nullopt} /* medium */,
+		{1504, 3, 5, false, BoundingBox{60, 120, 140, 130}} /* railway */,
+		{1505, 8, 1, false, BoundingBox{62.5, 120, 137.5, 130}} /* tracked */,
+		{1506, 9, 4, false, BoundingBox{60, 120, 140, 130}} /* tractor trailer */,
+		{1507, 13, 2, false, BoundingBox{60, 120, 140, 130}} /* wheeled LTD */,
+		{1508, 15, 3, false, BoundingBox{60, 120, 140, 130}} /* wheeled X */,
+		{1509, 18, 1, false, BoundingBox{80.96, 121.66, 119.03, 146.5}} /* robotic */
+	};
+	return build_layer_table(ENTRIES, COMMAND_INDICES, commands);
+}
+
+const LayerTable& get_table(IconType symbol_type) noexcept {
+	if (symbol_type == IconType::ENTITY) {
+		static const LayerTable ENTITY_TABLE = build_entity_table();
+		return ENTITY_TABLE;
+	} else if (symbol_type == IconType::MODIFIER_1) {
+		static const LayerTable MODIFIER_1_TABLE = build_modifier_1_table();
+		return MODIFIER_1_TABLE;
+	}
+
+	static const LayerTable MODIFIER_2_TABLE = build_modifier_2_table();
+	return MODIFIER_2_TABLE;
+}
+
+}
+
+SymbolLayer get_land_equipment_layer(int32_t code, IconType symbol_type) noexcept {
+	return get_table(symbol_type).find(code);
+}
+
+std::optional<BoundingBox> get_land_equipment_bbox(int32_t code, IconType symbol_type) noexcept {
+	return get_table(symbol_type).find_bbox(code);
+}
+
+std::vector<int32_t> get_land_equipment_symbols(IconType symbol_type) noexcept {
+	if (symbol_type == IconType::ENTITY) {
+		return {110000 /*weapon*/, 110100 /*rifle*/, 110101 /*single shot rifle*/, 110102 /*semiautomatic rifle*/, 110103 /*automatic rifle*/, 110200 /*machine gun*/, 110201 /*light machine gun*/, 110202 /*medium machine gun*/, 110203 /*heavy machine gun*/, 110300 /*grenade launcher*/, 110301 /*light grenade launcher*/, 110302 /*medium grenade launcher*/, 110303 /*heavy grenade launcher*/, 110400 /*flame thrower*/, 110500 /*air defense gun*/, 110501 /*heavy air defense gun*/, 110600 /*anti-tank gun*/, 110601 /*light anti-tank gun*/, 110602 /*medium anti-tank gun*/, 110603 /*heavy anti-tank gun*/, 110700 /*direct fire gun*/, 110701 /*light direct fire gun*/, 110702 /*medium direct fire gun*/, 110703 /*heavy direct fire gun*/, 110800 /*recoilless gun*/, 110801 /*light recoilless gun*/, 110802 /*medium recoilless gun*/, 110803 /*heavy recoilless gun*/, 110900 /*howitzer*/, 110901 /*light howitzer*/, 110902 /*medium howitzer*/, 110903 /*heavy howitzer*/, 111000 /*missile launcher*/, 111001 /*light missile launcher*/, 111002 /*medium missile launcher*/, 111003 /*heavy missile launcher*/, 111100 /*air defense missile launcher*/, 111101 /*light air defense missile launcher*/, 111102 /*light air defense missile launcher TLAR*/, 111103 /*light air defense missile launcher TELAR*/, 111104 /*medium air defense missile launcher*/, 111105 /*medium air defense missile launcher TLAR*/, 111106 /*medium air defense missile launcher TELAR*/, 111107 /*heavy air defense missile launcher*/, 111108 /*heavy air defense missile launcher TLAR*/, 111109 /*heavy air defense missile launcher TELAR*/, 111200 /*anti-tank missile launcher*/, 111201 /*light anti-tank missile launcher*/, 111202 /*medium anti-tank missile launcher*/, 111203 /*heavy anti-tank missile launcher*/, 111300 /*surface-to-surface missile launcher*/, 111301 /*light surface-to-surface missile launcher*/, 111302 /*medium surface-to-surface missile launcher*/, 111303 /*heavy surface-to-surface missile launcher*/, 111400 /*mortar*/, 111401 /*light mortar*/, 111402 /*medium mortar*/, 111403 /*heavy mortar*/, 111500 /*single rocket launcher*/, 111501 /*light single rocket launcher*/, 111502 /*medium single rocket launcher*/, 111503 /*heavy single rocket launcher*/, 111600 /*multiple rocket launcher*/, 111601 /*light multiple rocket launcher*/, 111602 /*medium multiple rocket launcher*/, 111603 /*heavy multiple rocket launcher*/, 111700 /*anti-tank rocket launcher*/, 111701 /*light anti-tank rocket launcher*/, 111702 /*medium anti-tank rocket launcher*/, 111703 /*heavy anti-tank rocket launcher*/, 111800 /*nonlethal weapon*/, 111900 /*taser*/, 112000 /*water cannon*/, 120000 /*military vehicle*/, 120100 /*armored vehicle*/, 120101 /*armored fighting vehicle*/, 120102 /*armored fighting vehicle command and control*/, 120103 /*armored personnel carrier*/, 120104 /*armored personnel carrier ambulance*/, 120105 /*armored protected vehicle*/, 120106 /*armored protected vehicle recovery*/, 120107 /*armored protected vehicle medical evacuation*/, 120108 /*armored personnel carrier recovery*/, 120109 /*combat service support vehicle*/, 120110 /*light armored wheeled vehicle*/, 120111 /*light armored reconnaissance*/, 120200 /*tank*/, 120201 /*light tank*/, 120202 /*medium tank*/, 120203 /*heavy tank*/, 120300 /*tank recovery vehicle*/, 120301 /*light tank recovery vehicle*/, 120302 /*medium tank recovery vehicle*/, 120303 /*heavy tank recovery vehicle*/, 130000 /*engineer vehicle and equipment*/, 130100 /*bridge*/, 130200 /*bridge mounted on utility vehicle*/, 130300 /*fixed bridge*/, 130400 /*floating bridge*/, 130500 /*folding girder bridge*/, 130600 /*hollow deck bridge*/, 130700 /*drill*/, 130701 /*drill mounted on utility vehicle*/, 130800 /*earthmover*/, 130801 /*multifunctional earthmover/digger*/, 130900 /*mine clearing equipment*/, 130901 /*trailer-mounted mine clearing equipment*/, 130902 /*mine clearing equipment on tank chassis*/, 130903 /*assault breacher vehicle with combat dozer blade*/, 130904 /*medium capability equipment*/, 130905 /*heavy capability equipment*/, 131000 /*mine laying equipment*/, 131001 /*mine laying equipment on utility vehicle*/, 131002 /*armored carrier with Volcano*/, 131003 /*truck mounted with Volcano*/, 131100 /*dozer*/, 131101 /*armored dozer*/, 131200 /*armored assault*/, 131300 /*armored engineer recon vehicle*/, 131400 /*backhoe*/, 131500 /*construction vehicle*/, 131600 /*ferry transporter*/, 140000 /*utility vehicle*/, 140100 /*vehicle*/, 140200 /*medical vehicle*/, 140300 /*medical evacuation vehicle*/, 140400 /*mobile emergency physician*/, 140500 /*bus*/, 140600 /*semi trailer and truck*/, 140601 /*light semi-trailer and truck*/, 140602 /*medium semi-trailer and truck*/, 140603 /*heavy semi-trailer and truck*/, 140700 /*limited cross-country truck*/, 140800 /*cross-country truck*/, 140900 /*petroleum, oil, and lubricant vehicle*/, 141000 /*water vehicle*/, 141100 /*amphibious utility wheeled vehicle*/, 141200 /*tow truck*/, 141201 /*light tow truck*/, 141202 /*heavy tow truck*/, 150000 /*train*/, 150100 /*locomotive*/, 150200 /*railcar*/, 160000 /*civilian vehicle*/, 160100 /*automobile*/, 160101 /*compact car*/, 160102 /*midsize car*/, 160103 /*sedan*/, 160200 /*open-bed truck*/, 160201 /*pickup truck*/, 160202 /*small truck*/, 160203 /*large truck*/, 160300 /*multiple passenger vehicle*/, 160301 /*van*/, 160302 /*small bus*/, 160303 /*large bus*/, 160400 /*civilian utility vehicle*/, 160401 /*sport utility vehicle*/, 160402 /*small box truck*/, 160403 /*large box truck*/, 160500 /*jeep type vehicle*/, 160501 /*light jeep type vehicle*/, 160502 /*medium jeep type vehicle*/, 160503 /*heavy jeep type vehicle*/, 160600 /*tractor trailer truck with box*/, 160601 /*light tractor trailer truck with box*/, 160602 /*medium tractor trailer truck with box*/, 160603 /*heavy tractor trailer truck with box*/, 160700 /*tractor trailer truck with flatbed*/, 160701 /*light tractor trailer truck with flatbed*/, 160702 /*medium tractor trailer truck with flatbed*/, 160703 /*heavy tractor trailer truck with flatbed*/, 160800 /*known insurgent vehicle*/, 160900 /*drug vehicle*/, 170000 /*law enforcement*/, 170100 /*Bureau of Alcohol, Tobacco, Firearms and Explosives*/, 170200 /*border patrol*/, 170300 /*customs service*/, 170400 /*drug enforcement administration*/, 170500 /*Department of Justice*/, 170600 /*Federal Bureau of Investigation*/, 170700 /*police*/, 170800 /*United States Secret Service*/, 170900 /*Transportation Security Administration*/, 171000 /*coast guard*/, 171100 /*US Marshals Service*/, 180000 /*pack animals*/, 190000 /*missile support*/, 190100 /*transloader*/, 190200 /*transporter*/, 190300 /*crane*/, 190400 /*propellant transporter*/, 190500 /*warhead transporter*/, 200000 /*other equipment*/, 200100 /*antennae*/, 200200 /*bomb*/, 200300 /*booby trap*/, 200400 /*CBRN equipment*/, 200500 /*computer system*/, 200600 /*command launch equipment*/, 200700 /*generator set*/, 200800 /*ground-based midcourse defense fire control center*/, 200900 /*in-flight interceptor communications system data terminal*/, 201000 /*laser*/, 201100 /*military information support operations*/, 201200 /*sustainment shipments*/, 201300 /*tent*/, 201301 /*civilian tent*/, 201302 /*military tent*/, 201400 /*unit deployment shipments*/, 201500 /*emergency medical operation*/, 201501 /*medical evacuation helicopter*/, 210000 /*land mines*/, 210100 /*land mine*/, 210200 /*anti-personnel land mine*/, 210300 /*anti-tank mine*/, 210400 /*improvised explosive device*/, 210500 /*less than lethal mine*/, 220000 /*sensors*/, 220100 /*sensor*/, 220200 /*sensor emplaced*/, 220300 /*radar*/, 230000 /*emergency operation*/, 230100 /*ambulance*/, 230200 /*fire fighting*/, 240000 /*manual track*/, 250000 /*rotary wing*/};
+	}
+	else if (symbol_type == IconType::MODIFIER_1) {
+		return {1 /*biological*/, 2 /*chemical*/, 3 /*early warning radar*/, 4 /*intrusion*/, 5 /*nuclear*/, 6 /*radiological*/, 7 /*upgraded early warning radar*/, 8 /*hijacking/hijacked*/, 9 /*civilian*/, 10 /*tilt-rotor*/, 11 /*[reserved]*/, 12 /*multi-purpose blade*/, 13 /*tank-width mine plow*/, 14 /*bridge*/, 15 /*cyberspace*/, 16 /*armored*/, 17 /*attack*/, 18 /*cargo*/, 19 /*maintenance*/, 20 /*medevac*/, 21 /*petroleum, oil, and lubricants*/, 22 /*utility*/, 23 /*robotic*/};
+	}
+	else if (symbol_type == IconType::MODIFIER_2) {
+		return {1 /*cyberspace*/, 2 /*light*/, 3 /*medium*/, 4 /*railway*/, 5 /*tracked*/, 6 /*tractor trailer*/, 7 /*wheeled LTD*/, 8 /*wheeled X*/, 9 /*robotic*/};
+	}
+
+	// Default to nothing
+	return {};
+}
+
+}
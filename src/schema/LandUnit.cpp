@@ -0,0 +1,852 @@
+// Generated by generation/parse.py from the "land unit" symbol set
+#include "Schema.hpp"
+
+namespace milsymbol::_impl {
+
+namespace {
+
+// Path data used by more than one draw command
+constexpr const char PATH_0[] = "m 100,80 -25,40 50,0 z";
+constexpr const char PATH_1[] = "m 105,85 c 0,2.8 -2.2,5 -5,5 -2.8,0 -5,-2.2 -5,-5 0,-2.8 2.2,-5 5,-5 2.8,0 5,2.2 5,5 z m -20,5 30,0 m -15,0 0,30";
+constexpr const char PATH_2[] = "M 82.3 102.6 C 82.3 113.9 84.2 115.9 84.2 115.9 L 86.5 114.1 C 90.2 117.8 94.8 120.8 99.9 120.9 L 100.5 120.9 L 101 120.9 C 106.2 120.8 110.8 117.8 114.4 114.1 L 116.7 115.9 C 116.7 115.9 118.6 113.9 118.7 102.6 C 113.9 106.8 108.9 109 108.9 109 L 110.9 110.7 C 110.9 110.7 106.8 115.2 100.5 115.2 L 100.5 115.2 C 100.5 115.2 100.4 115.2 100.4 115.2 C 94.2 115.2 90 110.7 90 110.7 L 92 109 C 92 109 87 106.8 82.3 102.6 z";
+constexpr const char PATH_3[] = "M 70,120 l 60,0 c10,0 10,10 0,10 l -60,0 c-10,0 -10,-10 0,-10";
+constexpr const char PATH_4[] = "M60,120 l80,0";
+constexpr const char PATH_5[] = "M70,120 l60,0";
+constexpr const char PATH_6[] = "M50,120 l100,0 ";
+constexpr const char PATH_7[] = "M25,120 l150,0";
+constexpr const char PATH_8[] = "M45,120 l110,0";
+constexpr const char PATH_9[] = "M35,120 l130,0 ";
+
+LayerTable build_entity_table() {
+	std::vector<DrawCommand> commands;
+	commands.reserve(188);
+	commands.push_back(DrawCommand::autotext("C2"));
+	commands.push_back(DrawCommand::path("m 80,60 20,20 20,-20 m -20,0 0,80", BoundingBox{80, 60, 120, 140}));
+	commands.push_back(DrawCommand::autotext("CA"));
+	commands.push_back(DrawCommand::path("m 60,80 80,0 0,20 c 0,25 -80,25 -80,0 z", BoundingBox{60, 80, 140, 118.75}));
+	commands.push_back(DrawCommand::autotext("IO"));
+	commands.push_back(DrawCommand::autotext("LO"));
+	commands.push_back(DrawCommand::full_frame(DrawCommand::path("M60,130L140,70", BoundingBox{60, 70, 140, 130}), DrawCommand::path("M25,150L175,50", BoundingBox{25, 50, 175, 150}), DrawCommand::path("M45,155L155,45", BoundingBox{45, 45, 155, 155}), DrawCommand::path("M50,135L150,65", BoundingBox{50, 65, 150, 135})));
+	commands.push_back(DrawCommand::path("M70,85 l40,0 10,-10 0,50 -10,-10 -40,0 z M120,85 l10,0 M120,95 l10,0 M120,105 l10,0 M120,115 l10,0", BoundingBox{70, 75, 130, 125}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::circle(Vector2{100, 130}, 10));
+	commands.push_back(DrawCommand::path("M100,120 l0,-60 M70,70 l10,-10 10,10 10,-10 10,10 10,-10 10,10", BoundingBox{70, 60, 130, 120}));
+	commands.push_back(DrawCommand::path("M100,120 l-15,-40 15,0 0,-20 M70,60 l60,0", BoundingBox{70, 60, 130, 120}));
+	commands.push_back(DrawCommand::text("C", Vector2{100, 135}, 30));
+	commands.push_back(DrawCommand::path("M100,140 l0,-80  M70,60 l60,0 M80,70 l40,0", BoundingBox{70, 60, 130, 140}));
+	commands.push_back(DrawCommand::full_frame(DrawCommand::path("M57,70 100,110 100,90 143,130", BoundingBox{57, 70, 143, 130}), DrawCommand::path("M25,50 100,110 100,90 175,150", BoundingBox{25, 50, 175, 150}), DrawCommand::path("M45,45 100,110 100,90 155,155", BoundingBox{45, 45, 155, 155}), DrawCommand::path("M50,65 100,110 100,90 150,135", BoundingBox{50, 65, 150, 135})));
+	commands.push_back(DrawCommand::path("m 115,70 20,0 0,55 -20,0 z m -25,5 20,0 0,45 -20,0 z m -25,-5 20,0 0,55 -20,0 z", BoundingBox{65, 70, 135, 125}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::path("m 140,110 -26,0 m 7,-20 19,0 m -15,-10 -65,0 0,40 50,0 z m 15,5 0,30", BoundingBox{60, 80, 140, 120}));
+	commands.push_back(DrawCommand::path("m 100,80 -1.25,16.5 -4.2,-3.3 2.5,4.9 -5.5,1.7 -0.4,-0 0.2,0 -0.2,0 0.4,-0 5.4,2.3 -1.8,4.6 3.6,-3.5 1.3,16.5 1.3,-16.5 4.2,3.3 -2.5,-4.9 5.5,-1.7 0.4,0 -0.2,-0 0.2,0 -0.4,0 -5.3,-1.7 2.5,-4.6 -4,3.2 z", BoundingBox{91.15, 80, 108.95, 119.7}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::autotext("ST"));
+	commands.push_back(DrawCommand::full_frame(DrawCommand::path("M50,120 L 90,120 l10,10 10,-10 L150,120", BoundingBox{50, 120, 150, 130}), DrawCommand::path("M25,120 L 90,120 l10,10 10,-10 L175,120", BoundingBox{25, 120, 175, 130}), DrawCommand::path("M45,120 L 90,120 l10,10 10,-10 L155,120", BoundingBox{45, 120, 155, 130}), DrawCommand::path("M35,120 L 90,120 l10,10 10,-10 L165,120", BoundingBox{35, 120, 165, 130})));
+	commands.push_back(DrawCommand::path("m 100,95 0,25 m 7.5,-32.5 c 0,4.1 -3.4,7.5 -7.5,7.5 -4.1,0 -7.5,-3.4 -7.5,-7.5 0,-4.1 3.4,-7.5 7.5,-7.5 4.1,0 7.5,3.4 7.5,7.5 z M 60,85 l 40,15 40,-15 0,30 -40,-15 -40,15 z", BoundingBox{60, 80, 140, 120}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::full_frame(DrawCommand::path("m 32,95 c 10,0 0,15 11.5,15 18.8,0 0,-20 18.8,-20 18.8,0 0,20 18.8,20 18.8,0 0,-20 18.8,-20 18.8,0 0,20 18.8,20 18.8,0 0,-20 18.8,-20 18.8,0 0,20 18.8,20 11.5,0 1.5,-15 11.5,-15", BoundingBox{32, 90, 167.8, 110}), DrawCommand::path("m 25,90 c 18.8,0 0,20 18.8,20 18.8,0 0,-20 18.8,-20 18.8,0 0,20 18.8,20 18.8,0 0,-20 18.8,-20 18.8,0 0,20 18.8,20 18.8,0 0,-20 18.8,-20 18.8,0 0,20 18.8,20 18.8,0 0,-20 20,-20", BoundingBox{25, 90, 176.6, 110}), DrawCommand::path("m 45,110 c 18.8,0 0,-20 18,-20 18.8,0 0,20 18.8,20 18.8,0 0,-20 18.8,-20 18.8,0 0,20 18.8,20 18.8,0 0,-20 18.8,-20 18.8,0 0,20 18,20", BoundingBox{45, 90, 156.2, 110}), DrawCommand::path("m 30,95 c 10,0 0,15 13.5,15 18.8,0 0,-20 18.8,-20 18.8,0 0,20 18.8,20 18.8,0 0,-20 18.8,-20 18.8,0 0,20 18.8,20 18.8,0 0,-20 18.8,-20 18.8,0 0,20 18.8,20 13.5,0 3.5,-15 13.5,-15", BoundingBox{30, 90, 169.8, 110})));
+	commands.push_back(DrawCommand::full_frame(DrawCommand::path("M60,132 L100,30 140,132", BoundingBox{60, 30, 140, 132}), DrawCommand::path("M25,150 L100,52 175,150", BoundingBox{25, 52, 175, 150}), DrawCommand::path("M45,150 L100,47 155,150", BoundingBox{45, 47, 155, 150}), DrawCommand::path("M55,135 L100,33 145,135", BoundingBox{55, 33, 145, 135})));
+	commands.push_back(DrawCommand::path("M125,80 C150,80 150,120 125,120 L75,120 C50,120 50,80 75,80 Z", BoundingBox{56.25, 80, 143.75, 120}));
+	commands.push_back(DrawCommand::full_frame(DrawCommand::path("M 100,28 V 100,172", BoundingBox{100, 28, 100, 172}), DrawCommand::path("M 100,50 L 100,150", BoundingBox{100, 50, 100, 150}), DrawCommand::path("M 100,45 L 100,155", BoundingBox{100, 45, 100, 155}), DrawCommand::path("M 100,168.845 L 100,30.75", BoundingBox{100, 30.75, 100, 168.85})));
+	commands.push_back(DrawCommand::path("M60,85 l40,15 40,-15 0,30 -40,-15 -40,15 z", BoundingBox{60, 85, 140, 115}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("m 100,100 15.7,7.9 c 11.8,0 11.8,-15.7 0,-15.7 z m 0,0 -15.7,-7.9 c -11.8,0 -11.8,15.7 0,15.7 z m -10,-20 10,20 -10,20 20,0 -10,-20 10,-20 z", BoundingBox{75.45, 80, 124.55, 120}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("M100,100 L130,88 c15,0 15,24 0,24 L100,100 70,112 c-15,0 -15,-24 0,-24 Z", BoundingBox{58.75, 88, 141.25, 112}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::autotext("CBT"));
+	commands.push_back(DrawCommand::path("m 70,80 60,40 m 0,-40 -60,40 m 55,-40 c 25,0 25,40 0,40 l -50,0 C 50,120 50,80 75,80 z", BoundingBox{56.25, 80, 143.75, 120}));
+	commands.push_back(DrawCommand::full_frame(DrawCommand::path("M60,70L140,130M60,130L140,70", BoundingBox{60, 70, 140, 130}), DrawCommand::path("M25,50 L175,150 M25,150 L175,50", BoundingBox{25, 50, 175, 150}), DrawCommand::path("M45,45L155,155M45,155L155,45", BoundingBox{45, 45, 155, 155}), DrawCommand::path("M50,65L150,135M50,135L150,65", BoundingBox{50, 65, 150, 135})));
+	commands.push_back(DrawCommand::full_frame(DrawCommand::path("M55,72L55,128", BoundingBox{55, 72, 55, 128}), DrawCommand::path("M55,50L55,150", BoundingBox{55, 50, 55, 150}), DrawCommand::path("M55,45L55,155", BoundingBox{55, 45, 55, 155}), DrawCommand::path("M55,65L55,135", BoundingBox{55, 65, 55, 135})));
+	commands.push_back(DrawCommand::path(PATH_0, BoundingBox{75, 80, 125, 120}));
+	commands.push_back(DrawCommand::path(PATH_0, BoundingBox{75, 80, 125, 120}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::autotext("SEAL"));
+	commands.push_back(DrawCommand::path("M 60 85 L 90 85 L 60 85 z M 110 85 L 140 85 L 110 85 z M 100 90 L 100 115 L 100 90 z", BoundingBox{60, 85, 140, 115}));
+	commands.push_back(DrawCommand::autotext("SF"));
+	commands.push_back(DrawCommand::autotext("SOF"));
+	commands.push_back(DrawCommand::path("M 78.8 61.5 C 68.1 61.5 68.1 78.5 78.8 78.5 L 100 70 L 78.8 61.5 z M 100 70 L 121.3 78.5 C 131.9 78.5 131.9 61.5 121.3 61.5 L 100 70 z", BoundingBox{70.77, 61.5, 129.25, 78.5}));
+	commands.push_back(DrawCommand::path("m 86.9,110 c -3.6,2 -7.2,3.9 -10.8,5.9 2.1,2.9 6.7,3.9 10,2.1 2.6,-0.9 4.7,-3.8 3.1,-6.1 -0.8,-0.6 -1.5,-1.3 -2.3,-1.9 z m 26.3,0.1 c 3.6,2 7.2,3.9 10.8,5.9 -2.1,2.9 -6.7,3.9 -10,2.1 -2.6,-0.9 -4.7,-3.8 -3.1,-6.1 0.8,-0.6 1.5,-1.3 2.3,-1.9 z", BoundingBox{76.1, 110, 124, 119.01}));
+	commands.push_back(DrawCommand::path("m 112.9,110 c -5.6,-4 -11.3,-7.9 -16.1,-12.5 -4.2,-4.5 -7,-9.8 -9.2,-15.1 -0.8,4.4 -0.9,9.3 2.4,13.2 3.6,4.5 8.6,8.1 13.5,11.8 2.3,1.7 4.7,3.3 7.1,4.8 0.8,-0.7 1.5,-1.5 2.3,-2.2 m -25.7,0 c 5.6,-4 11.3,-7.9 16.1,-12.5 4.2,-4.5 7,-9.8 9.2,-15.1 0.8,4.4 0.9,9.3 -2.4,13.2 -3.6,4.5 -8.6,8.1 -13.5,11.8 -2.3,1.7 -4.7,3.3 -7.1,4.8 -0.8,-0.7 -1.5,-1.5 -2.3,-2.2", BoundingBox{87.13, 82.4, 112.97, 112.2}).with_fill(ColorType::WHITE).with_stroke_width(2.0));
+	commands.push_back(DrawCommand::textm1("SOF"));
+	commands.push_back(DrawCommand::path("m 75,110 -10,-10 10,-10 0,-10 50,0 0,10 10,10 -10,10 z", BoundingBox{65, 80, 135, 110}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::autotext("UDT"));
+	commands.push_back(DrawCommand::path("m 60,84 40,20 40,-20 0,8 -40,25 -40,-25 z", BoundingBox{60, 84, 140, 117}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::autotext("RGR"));
+	commands.push_back(DrawCommand::full_frame(DrawCommand::path("M70,140 C70,115 130,115 130,140", BoundingBox{70, 121.25, 130, 140}), DrawCommand::path("M25,150 C25,110 175,110 175,150", BoundingBox{25, 120, 175, 150}), DrawCommand::path("M45,150 C45,110 155,110 155,150", BoundingBox{45, 120, 155, 150}), DrawCommand::path("m 55,135 c 10,-20 80,-20 90,0", BoundingBox{55, 120, 145, 135})));
+	commands.push_back(DrawCommand::path("M90,120 L90,90 C90,80 110,80 110,90 L110,120", BoundingBox{90, 82.5, 110, 120}));
+	commands.push_back(DrawCommand::autotext("MD"));
+	commands.push_back(DrawCommand::circle(Vector2{100, 100}, 15).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path(PATH_1, BoundingBox{85, 80, 115, 120}));
+	commands.push_back(DrawCommand::path(PATH_2, BoundingBox{82.3, 102.6, 118.7, 120.9}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::translate(Vector2{0, -35}, DrawCommand::scale(0.6, commands[49], commands[50])));
+	commands.push_back(DrawCommand::scale(0.8, commands[48]));
+	commands.push_back(DrawCommand::circle(Vector2{100, 108}, 5).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("m 80,120 30,-20 m -30,20 20,-40 20,40 z", BoundingBox{80, 80, 120, 120}));
+	commands.push_back(DrawCommand::autotext("JFS"));
+	commands.push_back(DrawCommand::autotext("MET"));
+	commands.push_back(DrawCommand::path("M90,120 L90,90 C90,80 110,80 110,90 L110,120 M100,120 L100,80", BoundingBox{90, 80, 110, 120}));
+	commands.push_back(DrawCommand::circle(Vector2{100, 115}, 5));
+	commands.push_back(DrawCommand::path("M100,111 l0,-30 M90,90 l10,-10 10,10", BoundingBox{90, 80, 110, 111}));
+	commands.push_back(DrawCommand::path(PATH_3, BoundingBox{62.5, 120, 137.5, 130}));
+	commands.push_back(DrawCommand::path(PATH_4, BoundingBox{60, 120, 140, 120}));
+	commands.push_back(DrawCommand::circle(Vector2{65, 125}, 5));
+	commands.push_back(DrawCommand::circle(Vector2{135, 125}, 5));
+	commands.push_back(DrawCommand::path(PATH_5, BoundingBox{70, 120, 130, 120}));
+	commands.push_back(DrawCommand::circle(Vector2{65, 120}, 5));
+	commands.push_back(DrawCommand::circle(Vector2{135, 120}, 5));
+	commands.push_back(DrawCommand::path("M85,120 l15,-15 15,15 ", BoundingBox{85, 105, 115, 120}));
+	commands.push_back(DrawCommand::path("M100,105 l0,-25 20,12.5 z", BoundingBox{100, 80, 120, 105}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::path("m 80,120 c 0,-20 10,-32 50,-35 m -10,35 C 120,100 110,88 70,85", BoundingBox{70, 85, 130, 120}));
+	commands.push_back(DrawCommand::circle(Vector2{75, 90}, 6).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::circle(Vector2{125, 90}, 6).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("m 90,80 20,0 10,20 -10,20 -20,0 -10,-20 z", BoundingBox{80, 80, 120, 120}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::autotext("E"));
+	commands.push_back(DrawCommand::path("m 85,80 0,25 15,15 15,-15 0,-25 z", BoundingBox{85, 80, 115, 120}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("M100,140 l0,-80 M80,80 l20,-20 20,20", BoundingBox{80, 60, 120, 140}));
+	commands.push_back(DrawCommand::path("M 114.3,94 C 114.3,102.3 107.9,109 100,109 c -7.9,0 -14.2,-6.7 -14.2,-15 0,-8.3 6.4,-15 14.2,-15 7.9,0 14.3,6.7 14.3,15 z m 0,27 14.3,15 -57,0 14.3,-15 M 125.7,79 l 14.3,0 0,30 -14.3,0 m -51.3,0 -14.3,0 0,-30 14.3,0 m 54.2,15 c 0,16.6 -12.8,30 -28.5,30 -15.7,0 -28.5,-13.4 -28.5,-30 C 71.5,77.4 84.3,64 100,64 115.7,64 128.5,77.4 128.5,94 z", BoundingBox{60.1, 64, 140, 136}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::autotext("DOG"));
+	commands.push_back(DrawCommand::path("m 85,80 5,40 20,0 5,-40 z", BoundingBox{85, 80, 115, 120}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("M60,120 L60,80 140,80 140,120 M100,80 L100,110", BoundingBox{60, 80, 140, 120}));
+	commands.push_back(DrawCommand::path("m 100,90 0,15 m -25,5 0,-20 50,0 0,20 m 0,-30 c 25,0 25,40 0,40 l -50,0 C 50,120 50,80 75,80 Z", BoundingBox{56.25, 80, 143.75, 120}));
+	commands.push_back(DrawCommand::autotext("EOD"));
+	commands.push_back(DrawCommand::text("CAMP", Vector2{100, 77}, 25));
+	commands.push_back(DrawCommand::path("m 120,90 -5,5 -10,-10 5,-5 -20,0 5,5 -10,10 -5,-5 0,20 5,-5 10,10 -5,5 20,0 -5,-5 10,-10 5,5 z", BoundingBox{80, 80, 120, 120}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::autotext("GEO"));
+	commands.push_back(DrawCommand::autotext("MP"));
+	commands.push_back(DrawCommand::path("m 120,100 c 0,5.5 -9,10 -20,10 -11,0 -20,-4.5 -20,-10 0,-5.5 9,-10 20,-10 11,0 20,4.5 20,10 z m -5,-20 -30,40 m 0,-40 30,40 m -15,-40 0,40", BoundingBox{80, 80, 120, 120}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::text("CLR", Vector2{100, 77}, 25));
+	commands.push_back(DrawCommand::path("m 80,125 0,10 40,0 0,-10 z", BoundingBox{80, 125, 120, 135}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("m 80,65 0,10 40,0 0,-10 z", BoundingBox{80, 65, 120, 75}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::autotext("SEC"));
+	commands.push_back(DrawCommand::autotext("SAR"));
+	commands.push_back(DrawCommand::autotext("SP"));
+	commands.push_back(DrawCommand::path("M 78.8 121.5 C 68.1 121.5 68.1 138.5 78.8 138.5 L 100 130 L 78.8 121.5 z M 100 130 L 121.3 138.5 C 131.9 138.5 131.9 121.5 121.3 121.5 L 100 130 z", BoundingBox{70.77, 121.5, 129.25, 138.5}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("m 85,105 c 10,5 20,5 30,0 m -15,-15 15,30 m -30,0 15,-30 0,-10", BoundingBox{85, 80, 115, 120}));
+	commands.push_back(DrawCommand::path("m 100,120 0,-65 m 0,90 -30,-25 60,0 z", BoundingBox{70, 55, 130, 145}));
+	commands.push_back(DrawCommand::autotext("CI"));
+	commands.push_back(DrawCommand::path("M120,130 c-40,20 -80,-45 -40,-70 z M100,95 L140,75", BoundingBox{63.43, 60, 140, 133.77}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::autotext("EW"));
+	commands.push_back(DrawCommand::path("M100,120 l0,-60 M80,120 l20,20 20,-20", BoundingBox{80, 60, 120, 140}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::full_frame(DrawCommand::path("M67,60 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 13,10   M52,75 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 7,-10", BoundingBox{52, 60, 149, 85}), DrawCommand::path("M25,60 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 M25,75 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10", BoundingBox{25, 60, 175, 85}), DrawCommand::path("M45,60 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10  M45,75 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10", BoundingBox{45, 60, 155, 85}), DrawCommand::path("M63,60 c10,0 0,10 7,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 7,-10 M40,75 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10 c10,0 0,10 10,10 c10,0 0,-10 10,-10", BoundingBox{40, 60, 160, 85})));
+	commands.push_back(DrawCommand::path("m 100,145 0,-90 m 30,65 -30,25 -30,-25", BoundingBox{70, 55, 130, 145}));
+	commands.push_back(DrawCommand::autotext("IPW"));
+	commands.push_back(DrawCommand::autotext("JIC"));
+	commands.push_back(DrawCommand::autotext("MI"));
+	commands.push_back(DrawCommand::path("m 100,80 c 0,7.5 12.5,20 20,20 -7.5,0 -20,12.5 -20,20 0,-7.5 -12.5,-20 -20,-20 7.5,0 20,-12.5 20,-20 z", BoundingBox{80, 80, 120, 120}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::autotext("MH"));
+	commands.push_back(DrawCommand::autotext("SUST"));
+	commands.push_back(DrawCommand::autotext("ADM"));
+	commands.push_back(DrawCommand::full_frame(DrawCommand::path(PATH_6, BoundingBox{50, 120, 150, 120}), DrawCommand::path(PATH_7, BoundingBox{25, 120, 175, 120}), DrawCommand::path(PATH_8, BoundingBox{45, 120, 155, 120}), DrawCommand::path(PATH_9, BoundingBox{35, 120, 165, 120})));
+	commands.push_back(DrawCommand::text("ALL", Vector2{100, 110}, 30));
+	commands.push_back(DrawCommand::path("M80,70 l40,0 M80,80 l25,-25 M100,80 l0,40 M81,90.5 l38,19 M81,109.5 l38,-19", BoundingBox{80, 55, 120, 120}));
+	commands.push_back(DrawCommand::circle(Vector2{100, 100}, 20));
+	commands.push_back(DrawCommand::path("m 90,117 0,-25 c 0,-15 20,-15 20,0 l 0,25 m -25,0 30,0", BoundingBox{85, 80.75, 115, 117}));
+	commands.push_back(DrawCommand::autotext("BAND"));
+	commands.push_back(DrawCommand::path("m 99.6,110.5 c -4.8,-1.4 -10.9,2.2 -10.4,7.7 1,2.5 6.2,2.4 9.6,-0.2 1.9,-1.5 2.7,-3.8 2.3,-6.9 l -0.1,-21.3 c 12.7,5.8 7.6,14.8 5.6,20.7 4.7,-4.9 5.8,-13.2 1.5,-17.9 -4.4,-4.6 -5,-7 -8.4,-13 z", BoundingBox{89.17, 79.6, 110.8, 120.02}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::autotext("CSS"));
+	commands.push_back(DrawCommand::path("m 80,95 10,-10 20,0 10,10 m -40,0 0,20 40,0 0,-20 z", BoundingBox{80, 85, 120, 115}));
+	commands.push_back(DrawCommand::autotext("JAG"));
+	commands.push_back(DrawCommand::path("m 90,85 20,0 m -10,0 0,25 -10,0 10,10 10,-10 -10,0", BoundingBox{90, 85, 110, 120}));
+	commands.push_back(DrawCommand::path("m 95,80 10,10 0,30 m 0,-30 -10,0 m 10,0 -10,10", BoundingBox{95, 80, 105, 120}));
+	commands.push_back(DrawCommand::path("M70,90 c10,0 10,20 0,20 m10,-10 l40,0 m10,-10 c-10,0 -10,20 0,20", BoundingBox{70, 90, 130, 110}));
+	commands.push_back(DrawCommand::autotext("MAT"));
+	commands.push_back(DrawCommand::full_frame(DrawCommand::path("M 28,100 H 172,100 M 100,28 V 100,172", BoundingBox{28, 28, 172, 172}), DrawCommand::path("M 100,50 L 100,150 M 25,100 L 175,100", BoundingBox{25, 50, 175, 150}), DrawCommand::path("M 45,100 L 155,100 M 100,45 L 100,155", BoundingBox{45, 45, 155, 155}), DrawCommand::path("M 30.75,100 L 169.25,100 M 100,168.845 L 100,30.75", BoundingBox{30.75, 30.75, 169.25, 168.85})));
+	commands.push_back(DrawCommand::path("M70,90 l0,20  M130,90 l0,20", BoundingBox{70, 90, 130, 110}));
+	commands.push_back(DrawCommand::text("MWR", Vector2{100, 110}, 30));
+	commands.push_back(DrawCommand::path("m 90,95 20,0 m -10,-10 0,30 m -15,-35 30,0 0,40 -30,0 z", BoundingBox{85, 80, 115, 120}));
+	commands.push_back(DrawCommand::text("MULT", Vector2{100, 110}, 30));
+	commands.push_back(DrawCommand::autotext("I"));
+	commands.push_back(DrawCommand::autotext("II"));
+	commands.push_back(DrawCommand::path("m 100,120 0,-20 -15,-20 30,0 -15,20 ", BoundingBox{85, 80, 115, 120}));
+	commands.push_back(DrawCommand::autotext("IV"));
+	commands.push_back(DrawCommand::path("m 90,115 0,-25 c 0,-10 20,-10 20,0 l 0,25 m -25,0 30,0", BoundingBox{85, 82.5, 115, 115}));
+	commands.push_back(DrawCommand::path("M 90,97 83,83 m 27,14 7,-14 M 95,95 90,81 m 15,14 5,-14 m 10,26.5 c 0,6.9 -9,12.5 -20,12.5 -11,0 -20,-5.6 -20,-12.5 0,-6.9 9,-12.5 20,-12.5 11,0 20,5.6 20,12.5 z", BoundingBox{80, 81, 120, 120}));
+	commands.push_back(DrawCommand::autotext("PS"));
+	commands.push_back(DrawCommand::path("m 100,119 0,-24 m 0,0 C 99,95 85,81 85,81 l 30,0 z", BoundingBox{85, 81, 115, 119}));
+	commands.push_back(DrawCommand::path("m 115,110 15,0 m -15,-15 15,0 m -45,15 -15,0 M 85,95 70,95 m 30,-15 0,10 -15,0 0,25 30,0 0,-25 -15,0 m -10,-10 20,0", BoundingBox{70, 80, 130, 115}));
+	commands.push_back(DrawCommand::path("m 80,80 30,0 c -1.4,15.5 0,25 10,35 -20,0 -40,-20 -40,-35 z", BoundingBox{80, 80, 120, 115}));
+	commands.push_back(DrawCommand::autotext("PA"));
+	commands.push_back(DrawCommand::path("m 115,95 c 0,15 15,15 15,0 0,-15 -15,-15 -15,0 z m 0,0 -45,0 0,10 10,0 0,-10", BoundingBox{70, 83.75, 130, 106.25}));
+	commands.push_back(DrawCommand::path("M100,80 l0,40 M81,90.5 l38,19 M81,109.5 l38,-19", BoundingBox{81, 80, 119, 120}));
+	commands.push_back(DrawCommand::translate(Vector2{0, -50}, commands[61], commands[62], DrawCommand::circle(Vector2{75, 125}, 5), DrawCommand::circle(Vector2{125, 125}, 5), commands[63]));
+	commands.push_back(DrawCommand::autotext("REL"));
+	commands.push_back(DrawCommand::autotext("RHU"));
+	commands.push_back(DrawCommand::autotext("JIB"));
+	commands.push_back(DrawCommand::path("m 90,75 20,0 0,-10 -5,0 0,-10 -10,0 0,10 -5,0 z", BoundingBox{90, 55, 110, 75}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("m 105,85 c -5,10 -5,20 0,30 m 0,-30 c -20,0 -20,30 0,30", BoundingBox{90, 85, 105, 115}));
+	commands.push_back(DrawCommand::circle(Vector2{100, 85}, 5));
+	commands.push_back(DrawCommand::path("m 85,95 30,0 m -15,15 0,-20 m -10,30 10,-10 10,10", BoundingBox{85, 90, 115, 120}));
+	commands.push_back(DrawCommand::circle(Vector2{75, 100}, 7).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::circle(Vector2{125, 100}, 7).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("M75,100 c0,-20 50,-20 50,0", BoundingBox{75, 85, 125, 100}));
+	commands.push_back(DrawCommand::full_frame(DrawCommand::path("M50,120 l100,0 M100,120 l0,-92 M153,80 l-106,0", BoundingBox{47, 28, 153, 120}), DrawCommand::path("M25,120 l150,0 M100,120 l0,-70 M175,80 l-150,0", BoundingBox{25, 50, 175, 120}), DrawCommand::path("M45,120 l110,0 M100,120 l0,-75 M155,80 l-110,0", BoundingBox{45, 45, 155, 120}), DrawCommand::path("M35,120 l130,0 M100,120 l0,-90 M165,80 l-130,0", BoundingBox{35, 30, 165, 120})));
+	commands.push_back(DrawCommand::circle(Vector2{100, 100}, 10));
+	commands.push_back(DrawCommand::path("m 100,110 0,10 m 0,-30 0,-10 m 8.7,14.2 8.4,-4.8 m -8.4,15.9 8,5.4 m -25.4,-5.4 -8.2,5.4 m 8.2,-16.3 -8,-5.4", BoundingBox{83.1, 80, 117.1, 120}));
+	commands.push_back(DrawCommand::text("CA", Vector2{100, 110}, 30));
+	commands.push_back(DrawCommand::path("m 65,90 50,0 c 10,0 20,10 20,20 m -40,-30 20,0 m -10,0 0,10", BoundingBox{65, 80, 135, 110}));
+	commands.push_back(DrawCommand::text("PURE", Vector2{90, 110}, 20));
+	commands.push_back(DrawCommand::autotext("BPAD"));
+	commands.push_back(DrawCommand::path("m 65,90 15,0 0,-10 20,20 -20,20 0,-10 -15,0 z", BoundingBox{65, 80, 100, 120}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::path("m 135,90 -15,0 0,-10 -20,20 20,20 0,-10 15,0 z", BoundingBox{100, 80, 135, 120}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::autotext("SPT"));
+	commands.push_back(DrawCommand::autotext("AFS"));
+	commands.push_back(DrawCommand::autotext("KS"));
+	commands.push_back(DrawCommand::path("m 120,100 -20,20 -20,-20 m 0,0 c 0,-25 40,-25 40,0 l -40,0", BoundingBox{80, 81.25, 120, 120}));
+	commands.push_back(DrawCommand::autotext("ARRC"));
+	commands.push_back(DrawCommand::autotext("ACO"));
+	commands.push_back(DrawCommand::autotext("ISAF"));
+	commands.push_back(DrawCommand::autotext("MN"));
+	commands.push_back(DrawCommand::path("M 100 65 L 115.2 91.3 L 130.3 117.5 C 133.3 112.4 135 106.4 135 100 C 135 80.7 119.3 65 100 65 z M 100 65 C 80.7 65 65 80.7 65 100 C 65 106.4 66.7 112.4 69.7 117.5 L 84.8 91.3 L 100 65 z M 69.7 117.5 C 75.7 128 87 135 100 135 C 113 135 124.3 128 130.3 117.5 L 100 117.5 L 69.7 117.5 z", BoundingBox{65, 65, 135, 135}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("M 69.7,117.5 100,65 l 30.3,52.5 z", BoundingBox{69.7, 65, 130.3, 117.5}).with_fill(ColorType::WHITE).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::path("m 99.6,51 c -2.8,0 -5,2.3 -5,5.3 0,2.1 1.2,3.9 2.8,4.7 L 87.8,78.3 69.5,78.4 c -0.1,-2.8 -2.3,-5.1 -5,-5.1 -2.8,0 -5,2.3 -5,5.3 0,2.9 2.2,5.3 5,5.3 0.7,0 1.4,-0.2 2,-0.4 l 9.2,16.8 -9.4,17.2 c -0.6,-0.2 -1.2,-0.4 -1.8,-0.4 -2.8,0 -5,2.4 -5,5.3 0,2.9 2.2,5.3 5,5.3 2.8,0 5,-2.3 5,-5.3 0,-0.1 -0,-0.2 -0,-0.3 l 18.3,0.1 9.5,17.1 c -1.6,0.9 -2.7,2.6 -2.7,4.6 0,2.9 2.3,5.3 5,5.3 2.8,0 5,-2.3 5,-5.3 0,-1.9 -0.9,-3.5 -2.3,-4.4 l 9.6,-17.3 18.7,-0.1 c -0,0.1 -0,0.2 -0,0.3 0,2.9 2.3,5.3 5,5.3 2.8,0 5,-2.3 5,-5.3 0,-2.9 -2.2,-5.3 -5,-5.3 -0.8,0 -1.5,0.2 -2.1,0.5 l -9.5,-17.4 9.5,-17.4 c 0.6,0.3 1.4,0.5 2.1,0.5 2.8,0 5,-2.4 5,-5.3 0,-2.9 -2.2,-5.3 -5,-5.3 -2.8,0 -5,2.3 -5,5.3 0,0.1 0,0.2 0,0.3 L 111.8,78.3 102.1,60.8 c 1.5,-0.9 2.5,-2.6 2.5,-4.5 0,-2.9 -2.2,-5.3 -5,-5.3 z", BoundingBox{59.5, 51, 140.6, 149.2}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::autotext("ATF"));
+	commands.push_back(DrawCommand::path("M 122.8 66.8 C 119.9 66.8 117.4 68.6 117.4 71.6 L 117.4 73.1 L 128.7 73.1 L 128.7 72.4 C 128.7 68.8 126.5 66.8 122.8 66.8 z M 108.6 74.8 L 108.6 76 L 117.6 76 L 117.5 77.5 L 118 80.8 C 119.1 81.5 118.9 82.5 120.8 83.5 C 122.1 84.1 124 84 125.2 83.4 C 127.5 82.4 129 79.2 128.3 76 L 137.5 76 L 137.5 74.8 L 108.6 74.8 z M 94.8 82.1 C 93.3 82.1 92 83.5 92 85 L 92 85.2 C 92 86.6 96 91.3 97 92.6 C 98.2 94.3 100.8 98.8 103.2 98.8 C 104.5 98.8 111.1 93.7 112.6 92.8 L 112.6 106.2 L 126.4 85.6 C 123 85.6 114.9 85.2 112.2 85.9 C 110.2 86.4 105 91.6 103.6 91.7 C 103.4 91 100.6 87.5 100 86.5 C 99.2 85.4 97.2 82.1 95.6 82.1 L 94.8 82.1 z M 130.4 85.6 C 129.6 85.6 117.5 104.1 116.3 106.2 L 128.1 106.2 L 128.1 110.6 L 112.5 110.6 L 112.5 133.2 L 120.7 133.2 L 122 117.5 L 124.3 117.5 L 125.6 133.2 L 133.5 133.2 L 133.5 87.9 C 133.5 87.2 131.2 85.6 130.4 85.6 z M 66.9 90.7 C 66.5 91.4 62.5 96.9 62.5 96.9 C 62.5 97.8 76.7 107.2 78.5 108.3 C 81.4 110.2 83.9 112.1 86.7 114 C 88.2 115 89.4 115.9 90.8 116.8 C 92.1 117.7 94.1 118.5 94.1 120.4 L 94.1 133.2 L 105.5 133.2 L 105.5 121.7 C 105.5 120.6 107.2 119 107.2 118.8 C 107.2 117.6 106.1 118.6 105.6 116.9 C 105.2 115.4 105.4 115.6 104.5 114.5 C 103.5 113.1 101.9 112 99.8 112 C 96.8 112 97.6 111.8 95.3 110.3 C 93.9 109.3 92.5 108.4 91.2 107.4 C 88.7 105.5 85.8 103.5 83.2 101.8 C 80.9 100.3 68.2 91 66.9 90.7 z M 67.9 92.6 L 72.7 95.7 L 72.8 103 L 67.9 99.9 L 67.9 92.6 z M 77.8 99.3 L 82.6 102.6 L 82.6 110 L 77.8 106.6 L 77.8 99.3 z M 87.4 106.2 L 92.5 109.5 L 92.4 116.9 L 87.4 113.5 L 87.4 106.2 z", BoundingBox{62.5, 66.8, 137.5, 133.2}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::path("M 117.4 73.1 L 117.4 74.8 L 128.7 74.8 L 128.7 73.1 L 117.4 73.1 z M 126.4 85.6 L 112.6 106.2 L 112.6 110.6 L 128.1 110.6 L 128.1 106.2 L 116.4 106.2 C 117.5 104.1 129.6 85.6 130.4 85.6 L 126.4 85.6 z M 67.9 92.6 L 67.9 99.9 L 72.8 103 L 72.7 95.7 L 67.9 92.6 z M 77.8 99.3 L 77.8 106.6 L 82.6 110 L 82.6 102.6 L 77.8 99.3 z M 87.4 106.2 L 87.4 113.5 L 92.4 116.9 L 92.5 109.5 L 87.4 106.2 z ", BoundingBox{67.9, 73.1, 130.4, 116.9}).with_fill(ColorType::WHITE).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::path("M 115.5 69.8 C 115.8 70.4 116.9 72.9 117.5 72.9 L 128.3 72.9 L 128.3 69.8 L 115.5 69.8 z M 117.3 74.7 C 116.8 74.7 116 75.7 115.8 76.1 L 117.2 76.1 L 117.2 76.8 C 117.2 79.6 119.8 81.8 122.8 81.8 C 126.5 81.8 128.3 78.6 128.3 74.7 L 117.3 74.7 z M 111.3 83.6 C 110.5 83.6 99.4 91.8 97.8 92.9 C 95.6 94.4 93 96.1 91 97.7 C 89.1 99.2 85.4 100.5 85.4 103.6 L 85.4 104 C 85.4 104.7 87.1 106.7 88.2 106.7 L 88.8 106.7 C 90.2 106.7 108 93.4 111.3 91.7 L 111.3 105.3 L 126 83.6 L 111.3 83.6 z M 75.3 83.6 C 74.5 83.6 73.4 84.4 73.4 85 L 73.4 108.9 C 73.4 109.8 73.9 110.2 74.4 110.5 L 78.5 110.5 L 78.5 83.6 L 75.3 83.6 z M 78.5 110.5 L 78.5 135.2 L 105.6 135.2 L 105.6 110.5 L 78.5 110.5 z M 130.5 83.6 C 129.6 83.6 123.8 92.9 122.9 94.2 C 121.9 95.7 115.7 104.5 115.5 105.3 L 127.6 105.3 L 127.6 110.3 L 111.5 110.3 L 111.5 134.8 L 119.6 134.8 C 120.6 134.8 121.1 127.9 121.3 126.6 C 121.7 123.9 122.4 120.4 122.6 117.8 L 122.9 117.8 L 125.4 134.8 L 133.9 134.8 L 133.9 86.7 C 133.9 85.6 131.9 83.6 130.7 83.6 L 130.5 83.6", BoundingBox{73.4, 69.8, 133.9, 135.2}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::path("M 117.5 72.9 L 117.3 74.7 L 128.3 74.7 L 128.3 72.9 L 117.5 72.9 z M 126 83.7 L 111.3 105.3 L 111.5 110.3 L 127.7 110.3 L 127.7 105.3 L 115.5 105.3 C 115.7 104.5 121.9 95.7 122.9 94.3 C 123.8 92.9 129.6 83.7 130.5 83.7 L 126 83.7 z ", BoundingBox{111.3, 72.9, 130.5, 110.3}).with_fill(ColorType::WHITE).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::autotext("DEA"));
+	commands.push_back(DrawCommand::path("M 100.2 62.3 C 100.1 63.2 99 66.3 98.7 67.4 C 97.8 69.9 99.4 70 99.4 72.3 L 99.4 73 C 99.4 73.7 98.9 73.5 98.3 73.8 C 96.6 72.4 94.2 71 91.3 71 L 90 71 C 84.2 71 80 75.5 74.6 75.5 L 73.9 75.5 C 72.3 75.5 71.5 74.1 71.3 75.8 L 74.3 77.2 C 71.8 82.4 69.9 89.7 67.5 95.5 C 66.3 98.6 65.3 101.6 64.1 104.7 C 63.5 106.3 63.1 107.7 62.5 109.3 C 62 110.5 61.8 113.1 60.2 113.2 C 62.4 116.4 68 120.5 73.3 120.5 L 76 120.5 C 81.6 120.5 87.3 116.6 89.5 113.2 L 88.2 113.2 L 75.4 77.2 L 74.5 77.2 L 74.5 77 L 75.4 77.2 L 78.6 77.7 L 79.3 77.7 L 89.3 76.2 L 90.4 76.3 C 93.7 76.3 93.8 80.2 94.7 80.2 L 97.7 80.2 L 97.7 129.2 L 86.1 129.2 L 86.1 131.5 L 81.4 131.5 L 81.4 134.1 L 77.5 134.1 L 77.5 138.2 L 123.3 138.2 L 123.3 133.9 L 119.3 133.9 L 119.3 131.6 L 114.5 131.6 L 114.5 129.2 L 102.6 129.2 L 102.6 80.2 L 106 80.2 C 107 80.2 106.6 76.4 110.7 76.4 L 111.3 76.4 L 121.2 77.7 L 122.2 77.7 L 125.4 77.3 C 124.3 79.7 123.1 83.8 122.1 86.4 C 120.9 89.6 119.9 92.6 118.7 95.8 C 117.5 98.9 116.6 101.9 115.4 105 C 114.9 106.4 114.2 108.1 113.7 109.6 C 113.4 110.4 113.1 111.1 112.9 111.9 C 112.5 113.2 112.8 113.2 111.2 113.2 C 113.3 116.4 119.2 120.5 124.6 120.5 L 127.2 120.5 C 132.6 120.5 138.8 116.4 140.9 113.2 L 139.8 113.2 L 126.4 77.1 C 127.4 76.9 129.3 76.2 129.3 75.3 C 129.3 74.5 127.8 75.5 126.7 75.5 L 126.3 75.5 C 120.8 75.5 116.6 71 110.9 71 L 109.6 71 C 106.7 71 104.2 72.4 102.6 73.8 C 101.8 73.4 101.3 73.6 101.3 72.3 C 101.3 71.9 102.4 68.8 102.5 68.5 L 100.6 62.3 L 100.2 62.3 z M 126.1 80.8 L 137.8 113.2 L 114.1 113.2 L 126.1 80.8 z M 74.8 80.8 L 86.5 113.2 L 63.1 113.1 L 74.8 80.8 z", BoundingBox{60.2, 62.3, 140.9, 138.2}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::autotext("FBI"));
+	commands.push_back(DrawCommand::path("M 100,140 C 53.7465,122.654 71.0916,95.6737 65.3099,70.6197 c 11.5634,13.4906 23.1267,13.4906 34.6901,0 11.564,13.4906 23.126,13.4906 34.69,0 C 128.908,95.6737 146.254,122.654 100,140 Z", BoundingBox{65.3, 70.61, 134.69, 140}));
+	commands.push_back(DrawCommand::path("M 62.5 67.9 L 62.5 73.4 L 69.9 73.4 L 69.9 106 C 66.8 106.7 64.4 109.6 64.4 113.4 C 64.4 116 65.8 116.9 65.9 118.4 C 66 120.4 65.6 122.5 65.6 124.7 L 65.6 126.6 L 62.5 126.6 L 62.5 132.1 L 137.5 132.1 L 137.5 126.6 L 136 126.6 L 135.6 117.5 C 138.3 113.4 135.8 107 131.5 106 L 131.5 73.4 L 137.5 73.4 L 137.5 67.9 L 62.5 67.9 z M 74.5 73.4 L 87.2 73.4 L 87.2 108.4 C 87.2 109.2 84.8 109.7 83.9 110.6 C 83.1 111.3 82.2 112.7 81.6 113.6 C 80.5 115.2 78.6 118.7 78.6 121.1 L 76.1 117 C 76.5 116.4 76.9 114.6 76.9 113.7 L 76.9 112.2 C 76.9 109.5 74.5 107.9 74.5 106.5 L 74.5 73.4 z M 91.5 73.4 L 110.2 73.4 L 110.2 90.9 C 109 89.6 108.8 87.8 106.8 85.7 C 105.4 84.3 103.5 83 100.8 83 L 100.3 83 C 98.2 83 96.1 83.6 94.9 84.5 C 94.3 85 93.6 85.4 93.1 86 C 92.4 86.6 92.2 87.3 91.5 87.8 L 91.5 73.4 z M 114.3 73.4 L 127.2 73.4 L 127.2 106.5 C 127.2 106.9 124.8 109.2 124.4 111.1 C 123.7 114.2 124.5 114.6 125 117 L 123.3 120.2 C 122.7 118.3 120.7 115 119.7 113.5 C 118.3 111.4 117.3 109.1 114.3 108.9 L 114.3 73.4 z M 99.7 84.9 L 100.6 84.9 C 104.8 84.9 108.5 90.4 108.5 94.7 L 108.5 96.4 C 108.5 100.4 105 106.2 101.3 106.2 L 99.4 106.2 C 94.9 106.2 91.4 100.2 91.6 95.5 C 91.8 90.7 94.9 84.9 99.7 84.9 z M 110.3 100.5 L 110.2 106.9 L 106.7 106.3 L 110.3 100.5 z M 91.5 103.6 L 94.3 106.8 L 91.5 107.4 L 91.5 103.6 z M 70.7 107.9 C 72.9 107.9 74.7 110.4 74.7 112.7 L 74.7 113.4 C 74.7 117.9 70 120.2 67.6 116.7 C 65.7 113.8 66.9 107.9 70.7 107.9 z M 130.6 107.9 C 132.8 107.9 134.4 110.8 134.4 113.2 L 134.4 113.4 C 134.4 116.7 133 116.7 132 118.2 L 128.9 118.3 L 126.7 115.4 L 126.5 113.2 C 126.1 111 128.2 107.9 130.6 107.9 z M 105.9 108.2 C 107.2 108.2 108.9 109 110.2 109.3 L 110.2 126.6 L 91.5 126.6 L 91.5 110.1 C 91.5 108.6 96.6 108.9 98.4 108.9 C 101.1 108.9 104 108.2 105.9 108.2 z M 114.3 110.8 C 117.2 112.3 117.4 113.4 119 116.4 C 120.1 118.5 121.7 120.9 121.7 124 C 121.9 124.2 122.3 124.9 122.7 124.9 C 124 124.9 125.5 119.8 126.7 118.9 L 126.7 119.4 L 127.2 119.4 L 127.2 126.6 L 114.3 126.6 L 114.3 110.8 z M 87.2 111.3 L 87.2 126.6 L 74.5 126.6 L 74.5 118.9 C 75.8 119.4 77.4 125.4 78.6 125.4 C 80.6 125.4 80.7 119.6 81.9 117.5 C 83.2 115.3 84.4 111.9 87.2 111.3 z M 133.6 119.7 L 133.9 126.6 L 131.5 126.6 L 131.5 120.4 L 133.6 119.7 z M 68.1 119.9 C 68.6 120.1 69.9 120.3 69.9 121.1 L 69.9 126.6 L 67.7 126.6 L 68.1 119.9 z", BoundingBox{62.5, 67.9, 137.5, 132.1}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::autotext("USSS"));
+	commands.push_back(DrawCommand::autotext("TSA"));
+	commands.push_back(DrawCommand::path("m 75,100 0,-35 50,0 0,35 20,0 -15,35 -60,0 -15,-35 z", BoundingBox{55, 65, 145, 135}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::path("m 135,100 -15,35 -10,0 15,-35 z", BoundingBox{110, 100, 135, 135}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("m 100,70 7.1,20.3 21.5,0.4 -17.1,13 6.2,20.6 L 100,112 82.4,124.3 88.6,103.7 71.5,90.7 92.9,90.3 z m 0,-5 c -19.3,0 -35,15.7 -35,35 0,19.3 15.7,35 35,35 19.3,0 35,-15.7 35,-35 0,-19.3 -15.7,-35 -35,-35 z m 0,5 c 16.6,0 30,13.4 30,30 0,16.6 -13.4,30 -30,30 -16.6,0 -30,-13.4 -30,-30 0,-16.6 13.4,-30 30,-30 z", BoundingBox{65, 65, 135, 135}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::autotext("ISF"));
+
+	static constexpr uint16_t COMMAND_INDICES[] = {0, 1, 2, 3, 4, 5, 6, 5, 7, 1, 7, 8, 9, 8, 10, 11, 12, 13, 8, 9, 13, 13, 8, 10, 13, 11, 12, 13, 14, 13, 15, 14, 15, 16, 17, 18, 19, 20, 21, 21, 22, 21, 23, 22, 22, 6, 22, 20, 24, 24, 6, 25, 26, 26, 6, 27, 28, 29, 29, 20, 29, 22, 29, 30, 29, 23, 29, 22, 30, 30, 31, 6, 6, 32, 6, 20, 6, 23, 33, 34, 32, 35, 36, 7, 37, 29, 36, 38, 39, 40, 41, 40, 42, 43, 44, 45, 45, 30, 45, 46, 45, 47, 48, 24, 6, 51, 48, 52, 22, 52, 22, 6, 52, 6, 53, 54, 55, 56, 57, 58, 59, 58, 59, 60, 58, 59, 61, 62, 63, 58, 59, 64, 65, 66, 67, 68, 69, 70, 71, 69, 70, 71, 22, 69, 70, 71, 23, 69, 70, 71, 6, 69, 70, 71, 6, 22, 69, 70, 71, 6, 23, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 79, 23, 79, 6, 81, 79, 82, 83, 84, 85, 86, 86, 87, 86, 88, 86, 89, 90, 90, 22, 90, 23, 91, 92, 93, 92, 94, 47, 95, 96, 97, 98, 98, 95, 98, 75, 98, 99, 98, 100, 98, 101, 99, 102, 100, 103, 104, 101, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 109, 122, 123, 123, 124, 125, 126, 109, 127, 109, 128, 109, 129, 109, 130, 109, 131, 109, 132, 133, 134, 135, 136, 137, 138, 139, 140, 112, 141, 142, 143, 140, 112, 51, 109, 144, 140, 112, 140, 112, 145, 109, 146, 109, 139, 109, 130, 109, 79, 109, 132, 109, 147, 148, 109, 149, 150, 151, 152, 109, 153, 154, 109, 155, 156, 156, 157, 158, 109, 110, 159, 160, 161, 162, 163, 164, 49, 50, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187};
+	static constexpr LayerEntry ENTRIES[] = {
+		{1000, 0, 0, false, std::nullopt} /* unspecified command and control */,
+		{10110000, 0, 1, false, std::nullopt} /* command and control */,
+		{10110100, 1, 1, false, BoundingBox{80, 60, 120, 140}} /* broadcast transmitter antenna */,
+		{10110200, 2, 1, false, std::nullopt} /* civil affairs */,
+		{10110300, 3, 1, false, BoundingBox{60, 80, 140, 118.75}} /* civil-military cooperation */,
+		{10110400, 4, 1, false, std::nullopt} /* information operations */,
+		{10110500, 5, 1, false, std::nullopt} /* liaison */,
+		{10110501, 6, 2, false, std::nullopt} /* reconnaissance liaison */,
+		{10110600, 8, 1, false, BoundingBox{70, 75, 130, 125}} /* PSYOP */,
+		{10110601, 9, 2, false, BoundingBox{70, 60, 130, 140}} /* PSYOP transmitter antenna */,
+		{10110700, 11, 2, false, BoundingBox{70, 60, 130, 140}} /* radio */,
+		{10110800, 13, 2, false, BoundingBox{70, 60, 130, 140}} /* radio relay */,
+		{10110900, 15, 2, false, BoundingBox{70, 60, 130, 140}} /* radio teletype center */,
+		{10111000, 17, 1, false, std::nullopt} /* signal */,
+		{10111001, 18, 3, false, BoundingBox{70, 60, 130, 140}} /* radio signal */,
+		{10111002, 21, 3, false, BoundingBox{70, 60, 130, 140}} /* radio relay signal */,
+		{10111003, 24, 3, false, BoundingBox{70, 60, 130, 140}} /* teletype signal */,
+		{10111004, 27, 2, false, BoundingBox{65, 70, 135, 125}} /* satellite signal */,
+		{10111005, 29, 2, false, BoundingBox{60, 80, 140, 120}} /* video imagery signal */,
+		{10111100, 31, 1, false, BoundingBox{65, 70, 135, 125}} /* satellite */,
+		{10111200, 32, 1, false, BoundingBox{60, 80, 140, 120}} /* video imagery */,
+		{10111300, 33, 1, false, BoundingBox{91.15, 80, 108.95, 119.7}} /* space */,
+		{10111400, 34, 1, false, std::nullopt} /* special troops */,
+		{10120000, 35, 0, false, std::nullopt} /* movement and maneuver */,
+		{10120100, 35, 1, false, std::nullopt} /* air assault */,
+		{10120200, 36, 1, false, BoundingBox{60, 80, 140, 120}} /* air traffic services */,
+		{10120300, 37, 1, false, std::nullopt} /* amphibious */,
+		{10120400, 38, 1, false, std::nullopt} /* antitank */,
+		{10120401, 39, 2, false, BoundingBox{56.25, 80, 143.75, 120}} /* armored anti-tank/anti-armor */,
+		{10120402, 41, 2, false, std::nullopt} /* motorized anti-tank/anti-armor */,
+		{10120500, 43, 1, false, BoundingBox{56.25, 80, 143.75, 120}} /* armor */,
+		{10120501, 44, 2, false, BoundingBox{56.25, 80, 143.75, 120}} /* armored reconnaissance */,
+		{10120502, 46, 2, false, BoundingBox{56.25, 80, 143.75, 120}} /* amphibious armor */,
+		{10120600, 48, 1, false, BoundingBox{60, 85, 140, 115}} /* aviation rotary wing */,
+		{10120601, 49, 2, false, BoundingBox{60, 85, 140, 115}} /* rotary wing reconnaissance */,
+		{10120700, 51, 1, false, BoundingBox{75.45, 80, 124.55, 120}} /* aviation composite */,
+		{10120800, 52, 1, false, BoundingBox{58.75, 88, 141.25, 112}} /* aviation fixed wing */,
+		{10120801, 53, 2, false, BoundingBox{58.75, 88, 141.25, 112}} /* fixed wing reconnaissance */,
+		{10120900, 55, 1, false, std::nullopt} /* combat */,
+		{10121000, 56, 1, false, BoundingBox{56.25, 80, 143.75, 120}} /* combined arms */,
+		{10121100, 57, 1, false, std::nullopt} /* infantry */,
+		{10121101, 58, 2, false, std::nullopt} /* amphibious infantry */,
+		{10121102, 60, 2, false, BoundingBox{56.25, 80, 143.75, 120}} /* armored infantry */,
+		{10121103, 62, 2, false, std::nullopt} /* infantry main gun system */,
+		{10121104, 64, 2, false, std::nullopt} /* motorized infantry */,
+		{10121105, 66, 3, false, BoundingBox{56.25, 80, 143.75, 120}} /* armored infantry main gun system */,
+		{10121106, 69, 1, false, std::nullopt} /* main gun system */,
+		{10121200, 70, 1, false, BoundingBox{75, 80, 125, 120}} /* observer */,
+		{10121300, 71, 1, false, std::nullopt} /* reconnaissance */,
+		{10121301, 72, 2, false, BoundingBox{75, 80, 125, 120}} /* reconnaissance surveillance */,
+		{10121302, 74, 2, false, std::nullopt} /* amphibious reconnaissance */,
+		{10121303, 76, 2, false, std::nullopt} /* motorized reconnaissance */,
+		{10121400, 78, 1, false, std::nullopt} /* sea-air-land */,
+		{10121500, 79, 1, false, BoundingBox{60, 85, 140, 115}} /* sniper */,
+		{10121600, 80, 1, false, BoundingBox{75, 80, 125, 120}} /* surveillance */,
+		{10121700, 81, 1, false, std::nullopt} /* special forces */,
+		{10121800, 82, 1, false, std::nullopt} /* special operations forces */,
+		{10121801, 83, 2, false, BoundingBox{70, 61.5, 130, 125}} /* fixed wing MISO */,
+		{10121802, 85, 2, false, std::nullopt} /* ground SOF */,
+		{10121803, 87, 3, false, BoundingBox{76.1, 82.4, 124, 119.01}} /* combatant SOF */,
+		{10121804, 90, 2, false, BoundingBox{65, 80, 135, 110}} /* submarine SOF */,
+		{10121805, 92, 1, false, std::nullopt} /* underwater demolition team */,
+		{10121900, 93, 1, false, BoundingBox{60, 84, 140, 117}} /* unmanned systems */,
+		{10122000, 94, 1, false, std::nullopt} /* ranger */,
+		{10130000, 95, 0, false, std::nullopt} /* fires */,
+		{10130100, 95, 1, false, std::nullopt} /* air defense */,
+		{10130101, 96, 2, false, std::nullopt} /* gun air defense */,
+		{10130102, 98, 2, false, BoundingBox{90, 82.5, 110, 120}} /* missile air defense */,
+		{10130103, 100, 2, false, std::nullopt} /* air and missile defense */,
+		{10130200, 102, 4, false, BoundingBox{60, 53, 140, 115}} /* air/land naval gunfire liaison */,
+		{10130300, 106, 1, false, BoundingBox{85, 85, 115, 115}} /* field artillery */,
+		{10130301, 107, 2, false, BoundingBox{56.25, 80, 143.75, 120}} /* self-propelled artillery */,
+		{10130302, 109, 3, false, BoundingBox{56.25, 80, 143.75, 120}} /* self-propelled artillery reconnaissance */,
+		{10130303, 112, 2, false, BoundingBox{88, 88, 112, 112}} /* artillery reconnaissance */,
+		{10130400, 114, 2, false, BoundingBox{80, 80, 120, 120}} /* field artillery observer */,
+		{10130500, 116, 1, false, std::nullopt} /* joint fire support */,
+		{10130600, 117, 1, false, std::nullopt} /* meteorological */,
+		{10130700, 118, 1, false, BoundingBox{90, 80, 110, 120}} /* missile */,
+		{10130800, 119, 2, false, BoundingBox{90, 80, 110, 120}} /* mortar */,
+		{10130801, 121, 3, false, BoundingBox{62.5, 80, 137.5, 130}} /* tracked mortar */,
+		{10130802, 124, 5, false, BoundingBox{60, 80, 140, 130}} /* truck mortar */,
+		{10130803, 129, 5, false, BoundingBox{60, 80, 140, 125}} /* towed mortar */,
+		{10130900, 134, 2, false, BoundingBox{85, 80, 120, 120}} /* survey */,
+		{10140000, 136, 0, false, std::nullopt} /* protection */,
+		{10140100, 136, 3, false, BoundingBox{69, 84, 131, 120}} /* CBRN */,
+		{10140101, 139, 4, false, BoundingBox{56.25, 80, 143.75, 120}} /* mechanized CBRN */,
+		{10140102, 143, 4, false, BoundingBox{69, 84, 131, 120}} /* motorized CBRN */,
+		{10140103, 147, 4, false, BoundingBox{69, 84, 131, 120}} /* CBRN reconnaissance */,
+		{10140104, 151, 5, false, BoundingBox{56.25, 80, 143.75, 120}} /* mechanized CBRN reconnaissance */,
+		{10140105, 156, 5, false, BoundingBox{69, 84, 131, 120}} /* motorized CBRN reconnaissance */,
+		{10140106, 161, 5, false, BoundingBox{69, 80, 131, 120}} /* CBRN and high-yield explosives */,
+		{10140200, 166, 1, false, BoundingBox{85, 80, 115, 120}} /* combat support (maneuver enhancement) */,
+		{10140300, 167, 1, false, BoundingBox{80, 60, 120, 140}} /* direction finding */,
+		{10140400, 168, 1, false, BoundingBox{60.1, 64, 140, 136}} /* diver */,
+		{10140500, 169, 1, false, std::nullopt} /* dog */,
+		{10140600, 170, 1, false, BoundingBox{85, 80, 115, 120}} /* drilling */,
+		{10140700, 171, 1, false, BoundingBox{60, 80, 140, 120}} /* engineer */,
+		{10140701, 172, 1, false, BoundingBox{56.25, 80, 143.75, 120}} /* mechanized engineer */,
+		{10140702, 173, 2, false, BoundingBox{60, 80, 140, 120}} /* motorized engineer */,
+		{10140703, 175, 2, false, BoundingBox{60, 80, 140, 120}} /* engineer reconnaissance */,
+		{10140800, 177, 1, false, std::nullopt} /* explosive ordnance disposal */,
+		{10140900, 178, 2, false, BoundingBox{60, 80, 140, 120}} /* field camp construction */,
+		{10141000, 180, 1, false, BoundingBox{80, 80, 120, 120}} /* fire protection */,
+		{10141100, 181, 1, false, std::nullopt} /* geospatial support */,
+		{10141200, 182, 1, false, std::nullopt} /* military police */,
+		{10141300, 183, 1, false, BoundingBox{80, 80, 120, 120}} /* mine */,
+		{10141400, 184, 2, false, BoundingBox{80, 80, 120, 120}} /* mine clearing */,
+		{10141500, 186, 2, false, BoundingBox{80, 80, 120, 135}} /* mine launching */,
+		{10141600, 188, 2, false, BoundingBox{80, 65, 120, 120}} /* mine laying */,
+		{10141700, 190, 1, false, std::nullopt} /* security */,
+		{10141701, 191, 2, false, BoundingBox{56.25, 80, 143.75, 120}} /* mechanized security */,
+		{10141702, 193, 2, false, std::nullopt} /* motorized security */,
+		{10141800, 195, 1, false, std::nullopt} /* search and rescue */,
+		{10141900, 196, 2, false, BoundingBox{70.77, 121.5, 129.25, 138.5}} /* security police (air) */,
+		{10142000, 198, 1, false, std::nullopt} /* shore patrol */,
+		{10142100, 199, 1, false, BoundingBox{85, 80, 115, 120}} /* topographic */,
+		{10142200, 200, 1, false, std::nullopt} /* m */,
+		{10150000, 201, 0, false, std::nullopt} /* intelligence */,
+		{10150100, 201, 1, false, BoundingBox{70, 55, 130, 145}} /* analysis */,
+		{10150200, 202, 1, false, std::nullopt} /* counterintelligence */,
+		{10150300, 203, 1, false, BoundingBox{63.43, 60, 140, 133.77}} /* electronic ranging */,
+		{10150500, 204, 1, false, std::nullopt} /* electronic warfare */,
+		{10150501, 205, 2, false, BoundingBox{70, 55, 130, 145}} /* electronic warfare analysis */,
+		{10150502, 207, 2, false, BoundingBox{80, 60, 120, 140}} /* direction finding electronic warfare */,
+		{10150503, 209, 2, false, BoundingBox{80, 60, 120, 140}} /* electronic warfare intercept */,
+		{10150504, 211, 2, false, std::nullopt} /* electronic warfare jamming */,
+		{10150505, 213, 2, false, BoundingBox{70, 55, 130, 145}} /* electronic warfare search */,
+		{10150600, 215, 1, false, BoundingBox{80, 60, 120, 140}} /* intercept */,
+		{10150700, 216, 1, false, std::nullopt} /* interrogation */,
+		{10150800, 217, 1, false, std::nullopt} /* jamming */,
+		{10150900, 218, 1, false, std::nullopt} /* joint intelligence center */,
+		{10151000, 219, 1, false, std::nullopt} /* military intelligence */,
+		{10151100, 220, 1, false, BoundingBox{70, 55, 130, 145}} /* search */,
+		{10151200, 221, 1, false, BoundingBox{80, 80, 120, 120}} /* sensor */,
+		{10151300, 222, 1, false, std::nullopt} /* military history */,
+		{10160000, 223, 1, false, std::nullopt} /* sustainment */,
+		{10160100, 224, 1, false, std::nullopt} /* administrative */,
+		{10160200, 225, 2, false, std::nullopt} /* all classes of supply */,
+		{10160300, 227, 2, false, BoundingBox{80, 55, 120, 120}} /* airport of debarkation */,
+		{10160400, 229, 1, false, BoundingBox{85, 80.75, 115, 117}} /* ammunition */,
+		{10160500, 230, 1, false, std::nullopt} /* band */,
+		{10160501, 231, 1, false, BoundingBox{89.17, 79.6, 110.8, 120.02}} /* army music */,
+		{10160600, 232, 1, false, std::nullopt} /* combat service support */,
+		{10160700, 233, 1, false, BoundingBox{80, 85, 120, 115}} /* finance */,
+		{10160800, 234, 1, false, std::nullopt} /* judge advocate general */,
+		{10160900, 235, 1, false, BoundingBox{90, 85, 110, 120}} /* labor */,
+		{10161000, 236, 1, false, BoundingBox{95, 80, 105, 120}} /* laundry */,
+		{10161100, 237, 1, false, BoundingBox{70, 90, 130, 110}} /* maintenance */,
+		{10161200, 238, 2, false, std::nullopt} /* material */,
+		{10161300, 240, 1, false, std::nullopt} /* medical */,
+		{10161400, 241, 2, false, BoundingBox{70, 90, 130, 110}} /* medical treatment facility */,
+		{10161500, 243, 1, false, std::nullopt} /* morale, welfare, and recreation */,
+		{10161600, 244, 1, false, BoundingBox{85, 80, 115, 120}} /* mortuary affairs */,
+		{10161700, 245, 2, false, std::nullopt} /* multiple classes of supply */,
+		{10161800, 247, 2, false, std::nullopt} /* NATO supply class I */,
+		{10161900, 249, 2, false, std::nullopt} /* NATO supply class II */,
+		{10162000, 251, 2, false, BoundingBox{85, 80, 115, 120}} /* NATO supply class III */,
+		{10162100, 253, 2, false, std::nullopt} /* NATO supply class IV */,
+		{10162200, 255, 2, false, BoundingBox{85, 82.5, 115, 115}} /* NATO supply class V */,
+		{10162300, 257, 1, false, BoundingBox{80, 81, 120, 120}} /* ordnance */,
+		{10162400, 258, 1, false, std::nullopt} /* personnel services */,
+		{10162500, 259, 1, false, BoundingBox{85, 81, 115, 119}} /* petroleum, oil, and lubricants */,
+		{10162600, 260, 1, false, BoundingBox{70, 80, 130, 115}} /* pipeline */,
+		{10162700, 261, 1, false, BoundingBox{80, 80, 120, 115}} /* postal */,
+		{10162800, 262, 1, false, std::nullopt} /* public affairs */,
+		{10162900, 263, 1, false, BoundingBox{70, 83.75, 130, 106.25}} /* quartermaster */,
+		{10163000, 264, 3, false, BoundingBox{60, 70, 140, 120}} /* railhead */,
+		{10163100, 267, 1, false, std::nullopt} /* religious support */,
+		{10163200, 268, 1, false, std::nullopt} /* replacement holding unit */,
+		{10163300, 269, 3, false, BoundingBox{80, 53, 120, 120}} /* seaport of debarkation */,
+		{10163400, 272, 1, false, std::nullopt} /* supply */,
+		{10163500, 273, 1, false, std::nullopt} /* joint information bureau */,
+		{10163600, 274, 2, false, BoundingBox{80, 80, 120, 120}} /* transportation */,
+		{10163601, 276, 3, false, BoundingBox{80, 55, 120, 120}} /* floating craft */,
+		{10163700, 279, 2, false, BoundingBox{90, 85, 105, 115}} /* US Supply Class I */,
+		{10163800, 281, 2, false, BoundingBox{70, 83.75, 130, 106.25}} /* US Supply Class II */,
+		{10163900, 283, 2, false, BoundingBox{85, 80, 115, 120}} /* US Supply Class III */,
+		{10164000, 285, 2, false, BoundingBox{60, 80, 140, 120}} /* US Supply Class IV */,
+		{10164100, 287, 2, false, BoundingBox{85, 82.5, 115, 115}} /* US Supply Class V */,
+		{10164200, 289, 3, false, BoundingBox{85, 80, 115, 120}} /* US Supply Class VI */,
+		{10164300, 292, 4, false, BoundingBox{68, 85, 132, 107}} /* US Supply Clas VII */,
+		{10164400, 296, 1, false, std::nullopt} /* US Supply Class VIII */,
+		{10164500, 297, 3, false, BoundingBox{83.1, 80, 117.1, 120}} /* US Supply Class IX */,
+		{10164600, 300, 2, false, std::nullopt} /* US Supply Class X */,
+		{10164700, 302, 1, false, BoundingBox{65, 80, 135, 110}} /* water */,
+		{10164800, 303, 2, false, BoundingBox{65, 80, 135, 110}} /* water purification */,
+		{10164900, 305, 1, false, std::nullopt} /* broadcast */,
+		{10165000, 306, 2, false, std::nullopt} /* NATO supply class all */,
+		{10165100, 308, 2, false, BoundingBox{65, 80, 135, 120}} /* interpreter */,
+		{10165200, 310, 1, false, std::nullopt} /* support */,
+		{10165300, 311, 1, false, std::nullopt} /* army field support */,
+		{10165400, 312, 1, false, std::nullopt} /* contracting services */,
+		{10165500, 313, 1, false, BoundingBox{80, 81.25, 120, 120}} /* parachute rigger */,
+		{10170000, 314, 0, false, std::nullopt} /* naval all */,
+		{10170100, 314, 2, false, BoundingBox{82.3, 80, 118.7, 120.9}} /* naval */,
+		{10180000, 316, 0, false, std::nullopt} /* named headquarters */,
+		{10180100, 316, 1, false, std::nullopt} /* Allied Command Europe Rapid Reaction Corps */,
+		{10180200, 317, 1, false, std::nullopt} /* Allied Command Operations */,
+		{10180300, 318, 1, false, std::nullopt} /* International Security Assistance Force */,
+		{10180400, 319, 1, false, std::nullopt} /* multinational */,
+		{10190000, 320, 2, false, BoundingBox{65, 65, 135, 135}} /* emergency operation */,
+		{10200000, 322, 1, false, BoundingBox{59.5, 51, 140.6, 149.2}} /* law enforcement */,
+		{10200100, 323, 1, false, std::nullopt} /* Bureau of Alcohol, Tobacco, Firearms and Explosives */,
+		{10200200, 324, 2, false, BoundingBox{62.5, 66.8, 137.5, 133.2}} /* border patrol */,
+		{10200300, 326, 2, false, BoundingBox{73.4, 69.8, 133.9, 135.2}} /* customs service */,
+		{10200400, 328, 1, false, std::nullopt} /* drug enforcement administration */,
+		{10200500, 329, 1, false, BoundingBox{60.2, 62.3, 140.9, 138.2}} /* Department of Justice */,
+		{10200600, 330, 1, false, std::nullopt} /* Federal Bureau of Investigation */,
+		{10200700, 331, 1, false, BoundingBox{65.3, 70.61, 134.69, 140}} /* police */,
+		{10200800, 332, 1, false, BoundingBox{62.5, 67.9, 137.5, 132.1}} /* prison */,
+		{10200900, 333, 1, false, std::nullopt} /* United States Secret Service */,
+		{10201000, 334, 1, false, std::nullopt} /* Transportation Security Administration */,
+		{10201100, 335, 2, false, BoundingBox{55, 65, 145, 135}} /* coast guard */,
+		{10201200, 337, 1, false, BoundingBox{65, 65, 135, 135}} /* US Marshals Service */,
+		{10201300, 338, 1, false, std::nullopt} /* internal security force */
+	};
+	return build_layer_table(ENTRIES, COMMAND_INDICES, commands);
+}
+
+LayerTable build_modifier_1_table() {
+	std::vector<DrawCommand> commands;
+	commands.reserve(99);
+	commands.push_back(DrawCommand::path("m 105,65 10,0 m -30,0 10,0 M 85,77 c 10,-7 20,-7 30,0", BoundingBox{85, 65, 115, 77}));
+	commands.push_back(DrawCommand::path("m 75.4,60.9 0,9.1 13.1,0 0,-9.1 z m 36,0 0,9.1 13.1,0 0,-9.1 z m -18,0 0,9.1 13.1,0 0,-9.1 z", BoundingBox{75.4, 60.9, 124.5, 70}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::textm1("AREA"));
+	commands.push_back(DrawCommand::textm1("A"));
+	commands.push_back(DrawCommand::textm1("B"));
+	commands.push_back(DrawCommand::textm1("BOR"));
+	commands.push_back(DrawCommand::path("m 80,80 5,-5 30,0 5,5 m -40,-20 5,5 30,0 5,-5", BoundingBox{80, 60, 120, 80}));
+	commands.push_back(DrawCommand::textm1("C"));
+	commands.push_back(DrawCommand::textm1("CLP"));
+	commands.push_back(DrawCommand::textm1("CBT"));
+	commands.push_back(DrawCommand::textm1("C2"));
+	commands.push_back(DrawCommand::textm1("CCP"));
+	commands.push_back(DrawCommand::textm1("CONST"));
+	commands.push_back(DrawCommand::textm1("CCC"));
+	commands.push_back(DrawCommand::textm1("CRC"));
+	commands.push_back(DrawCommand::textm1("D"));
+	commands.push_back(DrawCommand::textm1("DET"));
+	commands.push_back(DrawCommand::path("{'d': 'm 95,65 -5,5 5,5 m 10,-10 5,5 -5,5 M 90,70 c 20,0 20,0 20,0 m 15,0 c 0,2.8 -2.2,5 -5,5 -2.8,0 -5,-2.2 -5,-5 0,-2.8 2.2,-5 5,-5 2.8,0 5,2.2 5,5 z m -40,0 c 0,2.8 -2.2,5 -5,5 -2.8,0 -5,-2.2 -5,-5 0,-2.8 2.2,-5 5,-5 2.8,0 5,2.2 5,5 z'}"));
+	commands.push_back(DrawCommand::path("m 104.6,64.8 c 0,2.7 -2.1,4.8 -4.6,4.8 -2.5,0 -4.6,-2.2 -4.6,-4.8 0,-2.7 2.1,-4.8 4.6,-4.8 2.5,0 4.6,2.2 4.6,4.8 z m 0,8.7 4.6,4.8 -18.3,0 4.6,-4.8 M 108.3,60 l 4.6,0 0,9.6 -4.6,0 m -16.5,0 -4.6,0 0,-9.6 4.6,0 m 17.4,4.8 c 0,5.3 -4.1,9.6 -9.2,9.6 -5.1,0 -9.2,-4.3 -9.2,-9.6 0,-5.3 4.1,-9.6 9.2,-9.6 5.1,0 9.2,4.3 9.2,9.6 z", BoundingBox{87.2, 55.2, 112.9, 78.3}));
+	commands.push_back(DrawCommand::textm1("XX"));
+	commands.push_back(DrawCommand::textm1("DOG"));
+	commands.push_back(DrawCommand::path("m 90,60 5,15 10,0 5,-15 z", BoundingBox{90, 60, 110, 75}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::textm1("EO"));
+	commands.push_back(DrawCommand::textm1("ENH"));
+	commands.push_back(DrawCommand::textm1("EOD"));
+	commands.push_back(DrawCommand::textm1("FDC"));
+	commands.push_back(DrawCommand::textm1("F"));
+	commands.push_back(DrawCommand::textm1("FWD"));
+	commands.push_back(DrawCommand::textm1("GSM"));
+	commands.push_back(DrawCommand::textm1("LS"));
+	commands.push_back(DrawCommand::textm1("LEN"));
+	commands.push_back(DrawCommand::path("m 84,70 32,0 m 4,-5 c -5,0 -5,10 0,10 M 80,65 c 5,0 5,10 0,10", BoundingBox{80, 65, 120, 75}));
+	commands.push_back(DrawCommand::textm1("MET"));
+	commands.push_back(DrawCommand::textm1("MCM"));
+	commands.push_back(DrawCommand::path("M95,80 L95,60 C95,55 105,55 105,60 L105,80 M100,80 L100,55", BoundingBox{95, 55, 105, 80}));
+	commands.push_back(DrawCommand::path("m 105,65 5,5 -5,5 M 90,70 c 20,0 20,0 20,0 m 15,0 c 0,2.8 -2.2,5 -5,5 -2.8,0 -5,-2.2 -5,-5 0,-2.8 2.2,-5 5,-5 2.8,0 5,2.2 5,5 z m -40,0 c 0,2.8 -2.2,5 -5,5 -2.8,0 -5,-2.2 -5,-5 0,-2.8 2.2,-5 5,-5 2.8,0 5,2.2 5,5 z", BoundingBox{75, 65, 125, 75}));
+	commands.push_back(DrawCommand::textm1("MSE"));
+	commands.push_back(DrawCommand::textm1("MS"));
+	commands.push_back(DrawCommand::textm1("MCC"));
+	commands.push_back(DrawCommand::textm1("MN"));
+	commands.push_back(DrawCommand::textm1("MSU"));
+	commands.push_back(DrawCommand::path("M85,75 l15,-15 15,15 M85,67 l15,-15 15,15", BoundingBox{85, 52, 115, 75}));
+	commands.push_back(DrawCommand::text("1", Vector2{120, 77}, 25));
+	commands.push_back(DrawCommand::text("2", Vector2{120, 77}, 25));
+	commands.push_back(DrawCommand::text("3", Vector2{120, 77}, 25));
+	commands.push_back(DrawCommand::text("4", Vector2{120, 77}, 25));
+	commands.push_back(DrawCommand::translate(Vector2{0, -35}, DrawCommand::scale(0.6, DrawCommand::path(PATH_1, BoundingBox{85, 80, 115, 120}), DrawCommand::path(PATH_2, BoundingBox{82.3, 102.6, 118.7, 120.9}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE))));
+	commands.push_back(DrawCommand::path("m 80,65 20,13 20,-13 0,-5 -20,10 -20,-10 z", BoundingBox{80, 60, 120, 78}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::textm1("N"));
+	commands.push_back(DrawCommand::textm1("OPS"));
+	commands.push_back(DrawCommand::path("m 85,55 c 0.1,21.4 11.7,24.6 25,25 M 116,55 101,67.5 101,55 86.6,66.9", BoundingBox{85, 55, 116, 80}));
+	commands.push_back(DrawCommand::textm1("RF"));
+	commands.push_back(DrawCommand::textm1("RAD"));
+	commands.push_back(DrawCommand::textm1("SAR"));
+	commands.push_back(DrawCommand::textm1("SEC"));
+	commands.push_back(DrawCommand::path("m 100,55 c -2,5 -5,8 -10,10 5,2 8,5 10,10 2,-5 5,-8 10,-10 -5,-2 -8,-5 -10,-10 z", BoundingBox{90, 55, 110, 75}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::textm1("WPN"));
+	commands.push_back(DrawCommand::path("m 100,55 0,23 m -15,-18 5,-5 5,5 5,-5 5,5 5,-5 5,5", BoundingBox{85, 55, 115, 78}));
+	commands.push_back(DrawCommand::path("m 90,60 20,0 c 10,0 10,15 0,15 L 90,75 C 80,75 80,60 90,60", BoundingBox{82.5, 60, 117.5, 75}));
+	commands.push_back(DrawCommand::path("M85,75 l15,-15 15,15", BoundingBox{85, 60, 115, 75}));
+	commands.push_back(DrawCommand::textm1("S"));
+	commands.push_back(DrawCommand::textm1("M75,60 l20,0 M100,76 l0,-18 M125,60 l-20,0"));
+	commands.push_back(DrawCommand::textm1("SDR"));
+	commands.push_back(DrawCommand::textm1("SOF"));
+	commands.push_back(DrawCommand::textm1("SWAT"));
+	commands.push_back(DrawCommand::path("m 108,78 -8,-8 m 0,0 -8,8 m 8,-8 0,-15 15,8 z", BoundingBox{92, 55, 115, 78}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::textm1("TE"));
+	commands.push_back(DrawCommand::textm1("TA"));
+	commands.push_back(DrawCommand::path("m 92,65 c 6,3 10,3 16,0 m -18,13 10,-23 10,23", BoundingBox{90, 55, 110, 78}));
+	commands.push_back(DrawCommand::textm1("U"));
+	commands.push_back(DrawCommand::path("m 120,65 -11,0 m 11,10 -14,0 m 4,-14 -30,0 0,18 25,0 z m 10,2 0,14", BoundingBox{80, 61, 120, 79}));
+	commands.push_back(DrawCommand::textm1("MA"));
+	commands.push_back(DrawCommand::path("M 113,75 100,75 90,64.3 95,65 l 0,-8 10,0 0,8 5.5,-0.6 L 100,75", BoundingBox{90, 57, 113, 75}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::textm1("LHS"));
+	commands.push_back(DrawCommand::textm1("PLS"));
+	commands.push_back(DrawCommand::path("M95.5,80 l9,0 0,-9 9,0 0,-9 -9,0 0,-9 -9,0 0,9 -9,0 0,9 9,0 Z", BoundingBox{86.5, 53, 113.5, 80}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::textm1("CYB"));
+	commands.push_back(DrawCommand::textm1("SPT"));
+	commands.push_back(DrawCommand::path("m 75,60 0,15 50,-15 0,15 z", BoundingBox{75, 60, 125, 75}));
+	commands.push_back(DrawCommand::textm1("RRC"));
+	commands.push_back(DrawCommand::textm1("TR"));
+	commands.push_back(DrawCommand::textm1("CPN"));
+	commands.push_back(DrawCommand::textm1("JNN"));
+	commands.push_back(DrawCommand::textm1("RTNS"));
+	commands.push_back(DrawCommand::textm1("ASLT"));
+	commands.push_back(DrawCommand::textm1("W"));
+	commands.push_back(DrawCommand::textm1("CID"));
+	commands.push_back(DrawCommand::textm1("DIG"));
+	commands.push_back(DrawCommand::textm1("NET"));
+	commands.push_back(DrawCommand::path("m 80,70 40,0 M 80,80 111,55", BoundingBox{80, 55, 120, 80}));
+	commands.push_back(DrawCommand::path("m 92,66 -12,0 m 12,8 -12,0 m 28,0 12,0 m -12,-8 12,0 m -20,-11 0,7 m -5,-7 10,0 m -13,7 0,16 16,0 0,-16 -16,0", BoundingBox{80, 55, 120, 78}));
+	commands.push_back(DrawCommand::path("m 90,60 15,0 c 0,5 0,10 10,15 -15,0 -20,0 -25,-15", BoundingBox{90, 60, 115, 75}));
+	commands.push_back(DrawCommand::path("m 90,55 20,0 m -10,10 0,-10 m -25,10 40,0 c 10,0 15,5 15,10", BoundingBox{75, 55, 130, 75}));
+	commands.push_back(DrawCommand::path("m 111.8,59.2 0,15.8 m -7.9,-7.9 15.8,0 m -31.6,-7.9 0,15.8 m 7.9,-7.9 -15.8,0", BoundingBox{80.2, 59.2, 119.7, 75}));
+	commands.push_back(DrawCommand::textm1("XXXXX"));
+	commands.push_back(DrawCommand::textm1("XXXX"));
+	commands.push_back(DrawCommand::textm1("XXX"));
+	commands.push_back(DrawCommand::textm1("X"));
+	commands.push_back(DrawCommand::full_frame(DrawCommand::path("M50,80 l100,0 ", BoundingBox{50, 80, 150, 80}), DrawCommand::path("M25,80 l150,0 ", BoundingBox{25, 80, 175, 80}), DrawCommand::path("M45,80 l110,0 ", BoundingBox{45, 80, 155, 80}), DrawCommand::path("M35,80 l130,0 ", BoundingBox{35, 80, 165, 80})));
+
+	static constexpr uint16_t COMMAND_INDICES[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98};
+	static constexpr LayerEntry ENTRIES[] = {
+		{1001, 0, 2, false, BoundingBox{75.4, 60.9, 124.5, 77}} /* tactical satellite communications */,
+		{1002, 2, 1, false, std::nullopt} /* area */,
+		{1003, 3, 1, false, std::nullopt} /* attack */,
+		{1004, 4, 1, false, std::nullopt} /* biological */,
+		{1005, 5, 1, false, std::nullopt} /* border */,
+		{1006, 6, 1, false, BoundingBox{80, 60, 120, 80}} /* bridging */,
+		{1007, 7, 1, false, std::nullopt} /* chemical */,
+		{1008, 8, 1, false, std::nullopt} /* close protection */,
+		{1009, 9, 1, false, std::nullopt} /* combat */,
+		{1010, 10, 1, false, std::nullopt} /* command and control */,
+		{1011, 11, 1, false, std::nullopt} /* communications contingency package */,
+		{1012, 12, 1, false, std::nullopt} /* construction */,
+		{1013, 13, 1, false, std::nullopt} /* cross cultural communication */,
+		{1014, 14, 1, false, std::nullopt} /* crowd and riot control */,
+		{1015, 15, 1, false, std::nullopt} /* decontamination */,
+		{1016, 16, 1, false, std::nullopt} /* detention */,
+		{1017, 17, 1, false, std::nullopt} /* direct communications */,
+		{1018, 18, 1, false, BoundingBox{87.2, 55.2, 112.9, 78.3}} /* diving */,
+		{1019, 19, 1, false, std::nullopt} /* division */,
+		{1020, 20, 1, false, std::nullopt} /* dog */,
+		{1021, 21, 1, false, BoundingBox{90, 60, 110, 75}} /* drilling */,
+		{1022, 22, 1, false, std::nullopt} /* electro-optical */,
+		{1023, 23, 1, false, std::nullopt} /* enhanced */,
+		{1024, 24, 1, false, std::nullopt} /* explosive ordnance disposal */,
+		{1025, 25, 1, false, std::nullopt} /* fire direction center */,
+		{1026, 26, 1, false, std::nullopt} /* force */,
+		{1027, 27, 1, false, std::nullopt} /* forward */,
+		{1028, 28, 1, false, std::nullopt} /* ground station module */,
+		{1029, 29, 1, false, std::nullopt} /* landing support */,
+		{1030, 30, 1, false, std::nullopt} /* large extension node */,
+		{1031, 31, 1, false, BoundingBox{80, 65, 120, 75}} /* maintenance */,
+		{1032, 32, 1, false, std::nullopt} /* meteorological */,
+		{1033, 33, 1, false, std::nullopt} /* mine countermeasure */,
+		{1034, 34, 1, false, BoundingBox{95, 55, 105, 80}} /* missile */,
+		{1035, 35, 1, false, BoundingBox{75, 65, 125, 75}} /* mobile advisor and support */,
+		{1036, 36, 1, false, std::nullopt} /* mobile subscriber equipment */,
+		{1037, 37, 1, false, std::nullopt} /* mobility support */,
+		{1038, 38, 1, false, std::nullopt} /* MCC */,
+		{1039, 39, 1, false, std::nullopt} /* multinational */,
+		{1040, 40, 1, false, std::nullopt} /* multinational specialized unit */,
+		{1041, 41, 1, false, BoundingBox{85, 52, 115, 75}} /* multiple rocket launcher */,
+		{1042, 42, 1, false, std::nullopt} /* medical role 1 NATO */,
+		{1043, 43, 1, false, std::nullopt} /* medical role 2 NATO */,
+		{1044, 44, 1, false, std::nullopt} /* medical role 3 NATO */,
+		{1045, 45, 1, false, std::nullopt} /* medical role 4 NATO */,
+		{1046, 46, 1, false, BoundingBox{89.38, 53, 111.22, 77.54}} /* naval */,
+		{1047, 47, 1, false, BoundingBox{80, 60, 120, 78}} /* unmanned aerial systems */,
+		{1048, 48, 1, false, std::nullopt} /* nuclear */,
+		{1049, 49, 1, false, std::nullopt} /* operations */,
+		{1050, 50, 1, false, BoundingBox{85, 55, 116, 80}} /* radar */,
+		{1051, 51, 1, false, std::nullopt} /* RFID sensor */,
+		{1052, 52, 1, false, std::nullopt} /* radiological */,
+		{1053, 53, 1, false, std::nullopt} /* search and rescue */,
+		{1054, 54, 1, false, std::nullopt} /* security */,
+		{1055, 55, 1, false, BoundingBox{90, 55, 110, 75}} /* sensor */,
+		{1056, 56, 1, false, std::nullopt} /* weapons */,
+		{1057, 57, 1, false, BoundingBox{85, 55, 115, 78}} /* signals intelligence */,
+		{1058, 58, 1, false, BoundingBox{82.5, 60, 117.5, 75}} /* armored */,
+		{1059, 59, 1, false, BoundingBox{85, 60, 115, 75}} /* single rocket launcher */,
+		{1060, 60, 1, false, std::nullopt} /* smoke */,
+		{1061, 61, 1, false, std::nullopt} /* sniper */,
+		{1062, 62, 1, false, std::nullopt} /* sound ranging */,
+		{1063, 63, 1, false, std::nullopt} /* special operations forces */,
+		{1064, 64, 1, false, std::nullopt} /* special weapons and tactics */,
+		{1065, 65, 1, false, BoundingBox{92, 55, 115, 78}} /* survey */,
+		{1066, 66, 1, false, std::nullopt} /* tactical exploitation */,
+		{1067, 67, 1, false, std::nullopt} /* target acquisition */,
+		{1068, 68, 1, false, BoundingBox{90, 55, 110, 78}} /* topographical */,
+		{1069, 69, 1, false, std::nullopt} /* utility */,
+		{1070, 70, 1, false, BoundingBox{80, 61, 120, 79}} /* video imagery */,
+		{1071, 71, 1, false, std::nullopt} /* mobility assault */,
+		{1072, 72, 1, false, BoundingBox{90, 57, 113, 75}} /* amphibious warfare ship */,
+		{1073, 73, 1, false, std::nullopt} /* load handling system */,
+		{1074, 74, 1, false, std::nullopt} /* palletized load system */,
+		{1075, 75, 1, false, BoundingBox{86.5, 53, 113.5, 80}} /* medevac */,
+		{1076, 76, 1, false, std::nullopt} /* cyberspace */,
+		{1077, 77, 1, false, std::nullopt} /* support */,
+		{1078, 78, 1, false, BoundingBox{75, 60, 125, 75}} /* aviation */,
+		{1079, 79, 1, false, std::nullopt} /* route reconnaissance and clearance */,
+		{1080, 80, 1, false, std::nullopt} /* tiltrotor */,
+		{1081, 81, 1, false, std::nullopt} /* command post node */,
+		{1082, 82, 1, false, std::nullopt} /* joint network node */,
+		{1083, 83, 1, false, std::nullopt} /* retransmission site */,
+		{1084, 84, 1, false, std::nullopt} /* assault */,
+		{1085, 85, 1, false, std::nullopt} /* weapon */,
+		{1086, 86, 1, false, std::nullopt} /* criminal investigation division */,
+		{1087, 87, 1, false, std::nullopt} /* digital */,
+		{1088, 88, 1, false, std::nullopt} /* network */,
+		{1089, 89, 1, false, BoundingBox{80, 55, 120, 80}} /* aerial port of embarkation */,
+		{1090, 90, 1, false, BoundingBox{80, 55, 120, 78}} /* pipeline */,
+		{1091, 91, 1, false, BoundingBox{90, 60, 115, 75}} /* postal */,
+		{1092, 92, 1, false, BoundingBox{75, 55, 130, 75}} /* water */,
+		{1093, 93, 1, false, BoundingBox{80.2, 59.2, 119.7, 75}} /* independent command */,
+		{1094, 94, 1, false, std::nullopt} /* theater */,
+		{1095, 95, 1, false, std::nullopt} /* army */,
+		{1096, 96, 1, false, std::nullopt} /* corps */,
+		{1097, 97, 1, false, std::nullopt} /* brigade */,
+		{1098, 98, 1, false, std::nullopt} /* headquarters */
+	};
+	return build_layer_table(ENTRIES, COMMAND_INDICES, commands);
+}
+
+LayerTable build_modifier_2_table() {
+	std::vector<DrawCommand> commands;
+	commands.reserve(86);
+	commands.push_back(DrawCommand::path("M75,140 C75,125 100,125 100,140 C100,125 125,125 125,140", BoundingBox{75, 128.75, 125, 140}));
+	commands.push_back(DrawCommand::path("M115,125 C125,125 125,135 115,135 L85,135 C75,135 75,125 85,125", BoundingBox{77.5, 125, 122.5, 135}));
+	commands.push_back(DrawCommand::textm2("BDR"));
+	commands.push_back(DrawCommand::circle(Vector2{100, 132}, 11));
+	commands.push_back(DrawCommand::textm2("CS"));
+	commands.push_back(DrawCommand::textm2("CLR"));
+	commands.push_back(DrawCommand::textm2("CR"));
+	commands.push_back(DrawCommand::path("m 98,130 2,-4 2,4 m -8,8 -4,-2 4,-2 m 8,8 -2,4 -2,-4 m 8,-8 4,2 -4,2 m -14,-2 16,0 m -8,-8 0,16", BoundingBox{90, 126, 110, 146}));
+	commands.push_back(DrawCommand::textm2("D"));
+	commands.push_back(DrawCommand::textm2("DEM"));
+	commands.push_back(DrawCommand::text("D", Vector2{115, 133}, 25));
+	commands.push_back(DrawCommand::textm2("DIG"));
+	commands.push_back(DrawCommand::path("m 87,142 13,-12 13,12 m -13,-20 0,20 0,0", BoundingBox{87, 122, 113, 142}));
+	commands.push_back(DrawCommand::textm2("E"));
+	commands.push_back(DrawCommand::textm2("H"));
+	commands.push_back(DrawCommand::textm2("HA"));
+	commands.push_back(DrawCommand::path("m 80,125 40,0 0,-4 8,9 -8,9 0,-4 -40,0 0,4 -8,-9 8,-9 z", BoundingBox{72, 121, 128, 139}));
+	commands.push_back(DrawCommand::textm2("IC"));
+	commands.push_back(DrawCommand::textm2("L"));
+	commands.push_back(DrawCommand::textm2("LAB"));
+	commands.push_back(DrawCommand::path("M80,140 L115,120 120,140", BoundingBox{80, 120, 120, 140}));
+	commands.push_back(DrawCommand::textm2("LR"));
+	commands.push_back(DrawCommand::textm2("LA"));
+	commands.push_back(DrawCommand::textm2("M"));
+	commands.push_back(DrawCommand::textm2("MA"));
+	commands.push_back(DrawCommand::textm2("MR"));
+	commands.push_back(DrawCommand::path("M90,140 L100,120 110,140", BoundingBox{90, 120, 110, 140}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::textm2("HMA"));
+	commands.push_back(DrawCommand::textm2("MC"));
+	commands.push_back(DrawCommand::textm2("OPT"));
+	commands.push_back(DrawCommand::path("m 84,140 9,-15 7,15 7,-15 9,15", BoundingBox{84, 125, 116, 140}));
+	commands.push_back(DrawCommand::textm2("PEC"));
+	commands.push_back(DrawCommand::textm2("PM"));
+	commands.push_back(DrawCommand::text("P", Vector2{115, 133}, 25));
+	commands.push_back(DrawCommand::path("M 90.8 128.2 C 90.3 129.3 90 130.6 90 132 C 90 133.4 90.3 134.7 90.8 135.8 L 100 132 L 90.8 128.2 z M 100 132 L 109.3 135.8 C 109.7 134.7 110 133.4 110 132 C 110 130.6 109.7 129.3 109.3 128.2 L 100 132 z", BoundingBox{90, 128.2, 110, 135.8}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::path(PATH_4, BoundingBox{60, 120, 140, 120}));
+	commands.push_back(DrawCommand::circle(Vector2{65, 125}, 5));
+	commands.push_back(DrawCommand::circle(Vector2{75, 125}, 5));
+	commands.push_back(DrawCommand::circle(Vector2{125, 125}, 5));
+	commands.push_back(DrawCommand::circle(Vector2{135, 125}, 5));
+	commands.push_back(DrawCommand::path("m 70,125 c0,20 60,20 60,0", BoundingBox{70, 125, 130, 140}));
+	commands.push_back(DrawCommand::path("M75,125 c8,0 8,16 0,16 m8,-8 l35,0 m8,-8 c-8,0 -8,16 0,16", BoundingBox{75, 125, 126, 141}));
+	commands.push_back(DrawCommand::textm2("RCC"));
+	commands.push_back(DrawCommand::path("m 80,125 c 0,10 40,10 40,0 z", BoundingBox{80, 125, 120, 132.5}));
+	commands.push_back(DrawCommand::textm2("SC"));
+	commands.push_back(DrawCommand::path("m 95,145 -9,-8 m 28,0 -9,8 m -15,-24 20,20 m 0,-20 -20,20", BoundingBox{86, 121, 114, 145}));
+	commands.push_back(DrawCommand::textm2("SR"));
+	commands.push_back(DrawCommand::textm2("STR"));
+	commands.push_back(DrawCommand::textm2("SPT"));
+	commands.push_back(DrawCommand::textm2("TAC"));
+	commands.push_back(DrawCommand::path(PATH_5, BoundingBox{70, 120, 130, 120}));
+	commands.push_back(DrawCommand::circle(Vector2{65, 120}, 5));
+	commands.push_back(DrawCommand::circle(Vector2{135, 120}, 5));
+	commands.push_back(DrawCommand::textm2("T"));
+	commands.push_back(DrawCommand::textm2("VSTOL"));
+	commands.push_back(DrawCommand::text("V", Vector2{115, 133}, 25));
+	commands.push_back(DrawCommand::circle(Vector2{70, 125}, 5));
+	commands.push_back(DrawCommand::circle(Vector2{100, 125}, 5));
+	commands.push_back(DrawCommand::circle(Vector2{130, 125}, 5));
+	commands.push_back(DrawCommand::textm2("HLA"));
+	commands.push_back(DrawCommand::textm2("MLA"));
+	commands.push_back(DrawCommand::textm2("A"));
+	commands.push_back(DrawCommand::textm2("K"));
+	commands.push_back(DrawCommand::textm2("U"));
+	commands.push_back(DrawCommand::textm2("CSAR"));
+	commands.push_back(DrawCommand::textm2("G"));
+	commands.push_back(DrawCommand::path("m 85,125 15,20 15,-20", BoundingBox{85, 125, 115, 145}));
+	commands.push_back(DrawCommand::full_frame(DrawCommand::path("M 70.4 142.4 C 74.8 137 66.8 125 81.4 125 C 100.2 125 81.4 145 100.2 145 C 119 145 100.2 125 119 125 C 133.3 125 125.7 136.6 129.7 142.1 ", BoundingBox{70.4, 125, 129.7, 145}), DrawCommand::path("m 25,145 c 18.8,0 0,-20 18.8,-20 18.8,0 0,20 18.8,20 18.8,0 0,-20 18.8,-20 18.8,0 0,20 18.8,20 18.8,0 0,-20 18.8,-20 18.8,0 0,20 18.8,20 18.8,0 0,-20 18.8,-20 18.8,0 0,20 20,20", BoundingBox{25, 125, 176.6, 145}), DrawCommand::path("M 45 125 C 61.7 125.9 44.2 145 62.6 145 C 81.4 145 62.6 125 81.4 125 C 100.2 125 81.4 145 100.2 145 C 119 145 100.2 125 119 125 C 137.8 125 119 145 137.8 145 C 155.9 145 138.9 126.2 154.8 125 ", BoundingBox{45, 125, 154.8, 145}), DrawCommand::path("M 64 144.9 C 80.4 143.9 63.1 125 81.4 125 C 100.2 125 81.4 145 100.2 145 C 119 145 100.2 125 119 125 C 137.1 125 120.2 143.6 135.9 144.9", BoundingBox{64, 125, 135.9, 145})));
+	commands.push_back(DrawCommand::textm2("VH"));
+	commands.push_back(DrawCommand::full_frame(DrawCommand::path(PATH_6, BoundingBox{50, 120, 150, 120}), DrawCommand::path(PATH_7, BoundingBox{25, 120, 175, 120}), DrawCommand::path(PATH_8, BoundingBox{45, 120, 155, 120}), DrawCommand::path(PATH_9, BoundingBox{35, 120, 165, 120})));
+	commands.push_back(DrawCommand::textm2("CYB"));
+	commands.push_back(DrawCommand::textm2("YS"));
+	commands.push_back(DrawCommand::textm2("YB"));
+	commands.push_back(DrawCommand::textm2("YFT"));
+	commands.push_back(DrawCommand::textm2("LC"));
+	commands.push_back(DrawCommand::textm2("LS"));
+	commands.push_back(DrawCommand::textm2("YY"));
+	commands.push_back(DrawCommand::textm2("YT"));
+	commands.push_back(DrawCommand::textm2("AT"));
+	commands.push_back(DrawCommand::textm2("SDDC"));
+	commands.push_back(DrawCommand::path("m 95,135 0,-10 10,0 0,10 5,0 0,10 -20,0 0,-10 z", BoundingBox{90, 125, 110, 145}));
+	commands.push_back(DrawCommand::textm2("COMP"));
+	commands.push_back(DrawCommand::path("m 85,140 30,0 -5,-15 -10,-5 -10,5 z", BoundingBox{85, 120, 115, 140}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::textm2("L/M"));
+	commands.push_back(DrawCommand::path(PATH_3, BoundingBox{62.5, 120, 137.5, 130}));
+	commands.push_back(DrawCommand::textm2("SFA"));
+
+	static constexpr uint16_t COMMAND_INDICES[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 3, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85};
+	static constexpr LayerEntry ENTRIES[] = {
+		{1001, 0, 1, false, BoundingBox{75, 128.75, 125, 140}} /* airborne */,
+		{1002, 1, 1, false, BoundingBox{77.5, 125, 122.5, 135}} /* arctic */,
+		{1003, 2, 1, false, std::nullopt} /* battle damage repair */,
+		{1004, 3, 1, false, BoundingBox{89, 121, 111, 143}} /* bicycle equipped */,
+		{1005, 4, 1, false, std::nullopt} /* casualty staging */,
+		{1006, 5, 1, false, std::nullopt} /* clearing */,
+		{1007, 6, 1, false, std::nullopt} /* close range */,
+		{1008, 7, 1, false, BoundingBox{90, 126, 110, 146}} /* control */,
+		{1009, 8, 1, false, std::nullopt} /* decontamination */,
+		{1010, 9, 1, false, std::nullopt} /* demolition */,
+		{1011, 10, 1, false, std::nullopt} /* dental */,
+		{1012, 11, 1, false, std::nullopt} /* digital */,
+		{1013, 12, 1, false, BoundingBox{87, 122, 113, 142}} /* enhanced position location reporting system */,
+		{1014, 13, 1, false, std::nullopt} /* equipment */,
+		{1015, 14, 1, false, std::nullopt} /* heavy */,
+		{1016, 15, 1, false, std::nullopt} /* high altitude */,
+		{1017, 16, 1, false, BoundingBox{72, 121, 128, 139}} /* intermodal */,
+		{1018, 17, 1, false, std::nullopt} /* intensive care */,
+		{1019, 18, 1, false, std::nullopt} /* light */,
+		{1020, 19, 1, false, std::nullopt} /* laboratory */,
+		{1021, 20, 1, false, BoundingBox{80, 120, 120, 140}} /* launcher */,
+		{1022, 21, 1, false, std::nullopt} /* long range */,
+		{1023, 22, 1, false, std::nullopt} /* low altitude */,
+		{1024, 23, 1, false, std::nullopt} /* medium */,
+		{1025, 24, 1, false, std::nullopt} /* medium altitude */,
+		{1026, 25, 1, false, std::nullopt} /* medium range */,
+		{1027, 26, 1, false, BoundingBox{90, 120, 110, 140}} /* mountain */,
+		{1028, 27, 1, false, std::nullopt} /* high to medium altitude */,
+		{1029, 28, 1, false, std::nullopt} /* multi-channel */,
+		{1030, 29, 1, false, std::nullopt} /* optical */,
+		{1031, 30, 1, false, BoundingBox{84, 125, 116, 140}} /* pack animal */,
+		{1032, 31, 1, false, std::nullopt} /* patient evacuation coordination */,
+		{1033, 32, 1, false, std::nullopt} /* preventative maintenance */,
+		{1034, 33, 1, false, std::nullopt} /* psychological */,
+		{1035, 34, 2, false, BoundingBox{89, 121, 111, 143}} /* radio relay line of sight */,
+		{1036, 36, 5, false, BoundingBox{60, 120, 140, 130}} /* railroad */,
+		{1037, 41, 1, false, BoundingBox{70, 125, 130, 140}} /* unmanned systems recovery */,
+		{1038, 42, 1, false, BoundingBox{75, 125, 126, 141}} /* recovery (maintenance) */,
+		{1039, 43, 1, false, std::nullopt} /* rescue coordination center */,
+		{1040, 44, 1, false, BoundingBox{80, 125, 120, 132.5}} /* riverine */,
+		{1041, 45, 1, false, std::nullopt} /* single channel */,
+		{1042, 46, 1, false, BoundingBox{86, 121, 114, 145}} /* ski */,
+		{1043, 47, 1, false, std::nullopt} /* short range */,
+		{1044, 48, 1, false, std::nullopt} /* strategic */,
+		{1045, 49, 1, false, std::nullopt} /* support */,
+		{1046, 50, 1, false, std::nullopt} /* tactical */,
+		{1047, 51, 3, false, BoundingBox{60, 115, 140, 125}} /* towed */,
+		{1048, 54, 1, false, std::nullopt} /* troop */,
+		{1049, 55, 1, false, std::nullopt} /* vertical or short takeoff and landing */,
+		{1050, 56, 1, false, std::nullopt} /* veterinary */,
+		{1051, 57, 3, false, BoundingBox{65, 120, 135, 130}} /* wheeled */,
+		{1052, 60, 1, false, std::nullopt} /* high to low altitude */,
+		{1053, 61, 1, false, std::nullopt} /* medium to low altitude */,
+		{1054, 62, 1, false, std::nullopt} /* attack */,
+		{1055, 63, 1, false, std::nullopt} /* refuel */,
+		{1056, 64, 1, false, std::nullopt} /* utility */,
+		{1057, 65, 1, false, std::nullopt} /* combat search and rescue */,
+		{1058, 66, 1, false, std::nullopt} /* guerilla */,
+		{1059, 67, 1, false, BoundingBox{85, 125, 115, 145}} /* air assault */,
+		{1060, 68, 1, false, std::nullopt} /* amphibious */,
+		{1061, 69, 1, false, std::nullopt} /* very heavy */,
+		{1062, 70, 1, false, std::nullopt} /* supply */,
+		{1063, 71, 1, false, std::nullopt} /* cyberspace */,
+		{1064, 72, 1, false, std::nullopt} /* navy barge, self-propelled */,
+		{1065, 73, 1, false, std::nullopt} /* navy barge, not self-propelled */,
+		{1066, 74, 1, false, std::nullopt} /* launch */,
+		{1067, 75, 1, false, std::nullopt} /* landing craft */,
+		{1068, 76, 1, false, std::nullopt} /* landing ship */,
+		{1069, 77, 1, false, std::nullopt} /* service craft */,
+		{1070, 78, 1, false, std::nullopt} /* tug harbor */,
+		{1071, 79, 1, false, std::nullopt} /* ocean-going tugboat */,
+		{1072, 80, 1, false, std::nullopt} /* surface deployment and distribution command */,
+		{1073, 81, 1, false, BoundingBox{90, 125, 110, 145}} /* noncombatant generic vessel */,
+		{1074, 82, 1, false, std::nullopt} /* composite */,
+		{1075, 83, 1, false, BoundingBox{85, 120, 115, 140}} /* shelter */,
+		{1076, 84, 1, false, std::nullopt} /* light and medium */,
+		{1077, 85, 1, false, BoundingBox{62.5, 120, 137.5, 130}} /* tracked */,
+		{1078, 86, 1, false, std::nullopt} /* security force assistance */
+	};
+	return build_layer_table(ENTRIES, COMMAND_INDICES, commands);
+}
+
+const LayerTable& get_table(IconType symbol_type) noexcept {
+	if (symbol_type == IconType::ENTITY) {
+		static const LayerTable ENTITY_TABLE = build_entity_table();
+		return ENTITY_TABLE;
+	} else if (symbol_type == IconType::MODIFIER_1) {
+		static const LayerTable MODIFIER_1_TABLE = build_modifier_1_table();
+		return MODIFIER_1_TABLE;
+	}
+
+	static const LayerTable MODIFIER_2_TABLE = build_modifier_2_table();
+	return MODIFIER_2_TABLE;
+}
+
+}
+
+SymbolLayer get_land_unit_layer(int32_t code, IconType symbol_type) noexcept {
+	return get_table(symbol_type).find(code);
+}
+
+std::optional<BoundingBox> get_land_unit_bbox(int32_t code, IconType symbol_type) noexcept {
+	return get_table(symbol_type).find_bbox(code);
+}
+
+std::vector<int32_t> get_land_unit_symbols(IconType symbol_type) noexcept {
+	if (symbol_type == IconType::ENTITY) {
+		return {0 /*unspecified command and control*/, 110000 /*command and control*/, 110100 /*broadcast transmitter antenna*/, 110200 /*civil affairs*/, 110300 /*civil-military cooperation*/, 110400 /*information operations*/, 110500 /*liaison*/, 110501 /*reconnaissance liaison*/, 110600 /*PSYOP*/, 110601 /*PSYOP transmitter antenna*/, 110700 /*radio*/, 110800 /*radio relay*/, 110900 /*radio teletype center*/, 111000 /*signal*/, 111001 /*radio signal*/, 111002 /*radio relay signal*/, 111003 /*teletype signal*/, 111004 /*satellite signal*/, 111005 /*video imagery signal*/, 111100 /*satellite*/, 111200 /*video imagery*/, 111300 /*space*/, 111400 /*special troops*/, 120000 /*movement and maneuver*/, 120100 /*air assault*/, 120200 /*air traffic services*/, 120300 /*amphibious*/, 120400 /*antitank*/, 120401 /*armored anti-tank/anti-armor*/, 120402 /*motorized anti-tank/anti-armor*/, 120500 /*armor*/, 120501 /*armored reconnaissance*/, 120502 /*amphibious armor*/, 120600 /*aviation rotary wing*/, 120601 /*rotary wing reconnaissance*/, 120700 /*aviation composite*/, 120800 /*aviation fixed wing*/, 120801 /*fixed wing reconnaissance*/, 120900 /*combat*/, 121000 /*combined arms*/, 121100 /*infantry*/, 121101 /*amphibious infantry*/, 121102 /*armored infantry*/, 121103 /*infantry main gun system*/, 121104 /*motorized infantry*/, 121105 /*armored infantry main gun system*/, 121106 /*main gun system*/, 121200 /*observer*/, 121300 /*reconnaissance*/, 121301 /*reconnaissance surveillance*/, 121302 /*amphibious reconnaissance*/, 121303 /*motorized reconnaissance*/, 121400 /*sea-air-land*/, 121500 /*sniper*/, 121600 /*surveillance*/, 121700 /*special forces*/, 121800 /*special operations forces*/, 121801 /*fixed wing MISO*/, 121802 /*ground SOF*/, 121803 /*combatant SOF*/, 121804 /*submarine SOF*/, 121805 /*underwater demolition team*/, 121900 /*unmanned systems*/, 122000 /*ranger*/, 130000 /*fires*/, 130100 /*air defense*/, 130101 /*gun air defense*/, 130102 /*missile air defense*/, 130103 /*air and missile defense*/, 130200 /*air/land naval gunfire liaison*/, 130300 /*field artillery*/, 130301 /*self-propelled artillery*/, 130302 /*self-propelled artillery reconnaissance*/, 130303 /*artillery reconnaissance*/, 130400 /*field artillery observer*/, 130500 /*joint fire support*/, 130600 /*meteorological*/, 130700 /*missile*/, 130800 /*mortar*/, 130801 /*tracked mortar*/, 130802 /*truck mortar*/, 130803 /*towed mortar*/, 130900 /*survey*/, 140000 /*protection*/, 140100 /*CBRN*/, 140101 /*mechanized CBRN*/, 140102 /*motorized CBRN*/, 140103 /*CBRN reconnaissance*/, 140104 /*mechanized CBRN reconnaissance*/, 140105 /*motorized CBRN reconnaissance*/, 140106 /*CBRN and high-yield explosives*/, 140200 /*combat support (maneuver enhancement)*/, 140300 /*direction finding*/, 140400 /*diver*/, 140500 /*dog*/, 140600 /*drilling*/, 140700 /*engineer*/, 140701 /*mechanized engineer*/, 140702 /*motorized engineer*/, 140703 /*engineer reconnaissance*/, 140800 /*explosive ordnance disposal*/, 140900 /*field camp construction*/, 141000 /*fire protection*/, 141100 /*geospatial support*/, 141200 /*military police*/, 141300 /*mine*/, 141400 /*mine clearing*/, 141500 /*mine launching*/, 141600 /*mine laying*/, 141700 /*security*/, 141701 /*mechanized security*/, 141702 /*motorized security*/, 141800 /*search and rescue*/, 141900 /*security police (air)*/, 142000 /*shore patrol*/, 142100 /*topographic*/, 142200 /*m*/, 150000 /*intelligence*/, 150100 /*analysis*/, 150200 /*counterintelligence*/, 150300 /*electronic ranging*/, 150500 /*electronic warfare*/, 150501 /*electronic warfare analysis*/, 150502 /*direction finding electronic warfare*/, 150503 /*electronic warfare intercept*/, 150504 /*electronic warfare jamming*/, 150505 /*electronic warfare search*/, 150600 /*intercept*/, 150700 /*interrogation*/, 150800 /*jamming*/, 150900 /*joint intelligence center*/, 151000 /*military intelligence*/, 151100 /*search*/, 151200 /*sensor*/, 151300 /*military history*/, 160000 /*sustainment*/, 160100 /*administrative*/, 160200 /*all classes of supply*/, 160300 /*airport of debarkation*/, 160400 /*ammunition*/, 160500 /*band*/, 160501 /*army music*/, 160600 /*combat service support*/, 160700 /*finance*/, 160800 /*judge advocate general*/, 160900 /*labor*/, 161000 /*laundry*/, 161100 /*maintenance*/, 161200 /*material*/, 161300 /*medical*/, 161400 /*medical treatment facility*/, 161500 /*morale, welfare, and recreation*/, 161600 /*mortuary affairs*/, 161700 /*multiple classes of supply*/, 161800 /*NATO supply class I*/, 161900 /*NATO supply class II*/, 162000 /*NATO supply class III*/, 162100 /*NATO supply class IV*/, 162200 /*NATO supply class V*/, 162300 /*ordnance*/, 162400 /*personnel services*/, 162500 /*petroleum, oil, and lubricants*/, 162600 /*pipeline*/, 162700 /*postal*/, 162800 /*public affairs*/, 162900 /*quartermaster*/, 163000 /*railhead*/, 163100 /*religious support*/, 163200 /*replacement holding unit*/, 163300 /*seaport of debarkation*/, 163400 /*supply*/, 163500 /*joint information bureau*/, 163600 /*transportation*/, 163601 /*floating craft*/, 163700 /*US Supply Class I*/, 163800 /*US Supply Class II*/, 163900 /*US Supply Class III*/, 164000 /*US Supply Class IV*/, 164100 /*US Supply Class V*/, 164200 /*US Supply Class VI*/, 164300 /*US Supply Clas VII*/, 164400 /*US Supply Class VIII*/, 164500 /*US Supply Class IX*/, 164600 /*US Supply Class X*/, 164700 /*water*/, 164800 /*water purification*/, 164900 /*broadcast*/, 165000 /*NATO supply class all*/, 165100 /*interpreter*/, 165200 /*support*/, 165300 /*army field support*/, 165400 /*contracting services*/, 165500 /*parachute rigger*/, 170000 /*naval all*/, 170100 /*naval*/, 180000 /*named headquarters*/, 180100 /*Allied Command Europe Rapid Reaction Corps*/, 180200 /*Allied Command Operations*/, 180300 /*International Security Assistance Force*/, 180400 /*multinational*/, 190000 /*emergency operation*/, 200000 /*law enforcement*/, 200100 /*Bureau of Alcohol, Tobacco, Firearms and Explosives*/, 200200 /*border patrol*/, 200300 /*customs service*/, 200400 /*drug enforcement administration*/, 200600 /*Federal Bureau of Investigation*/, 200500 /*Department of Justice*/, 200700 /*police*/, 200800 /*prison*/, 200900 /*United States Secret Service*/, 201000 /*Transportation Security Administration*/, 201100 /*coast guard*/, 201200 /*US Marshals Service*/, 201300 /*internal security force*/};
+	}
+	else if (symbol_type == IconType::MODIFIER_1) {
+		return {1 /*tactical satellite communications*/, 2 /*area*/, 3 /*attack*/, 4 /*biological*/, 5 /*border*/, 6 /*bridging*/, 7 /*chemical*/, 8 /*close protection*/, 9 /*combat*/, 10 /*command and control*/, 11 /*communications contingency package*/, 12 /*construction*/, 13 /*cross cultural communication*/, 14 /*crowd and riot control*/, 15 /*decontamination*/, 16 /*detention*/, 17 /*direct communications*/, 18 /*diving*/, 19 /*division*/, 20 /*dog*/, 21 /*drilling*/, 22 /*electro-optical*/, 23 /*enhanced*/, 24 /*explosive ordnance disposal*/, 25 /*fire direction center*/, 26 /*force*/, 27 /*forward*/, 28 /*ground station module*/, 29 /*landing support*/, 30 /*large extension node*/, 31 /*maintenance*/, 32 /*meteorological*/, 33 /*mine countermeasure*/, 34 /*missile*/, 35 /*mobile advisor and support*/, 36 /*mobile subscriber equipment*/, 37 /*mobility support*/, 38 /*MCC*/, 39 /*multinational*/, 40 /*multinational specialized unit*/, 41 /*multiple rocket launcher*/, 42 /*medical role 1 NATO*/, 43 /*medical role 2 NATO*/, 44 /*medical role 3 NATO*/, 45 /*medical role 4 NATO*/, 46 /*naval*/, 47 /*unmanned aerial systems*/, 48 /*nuclear*/, 49 /*operations*/, 50 /*radar*/, 51 /*RFID sensor*/, 52 /*radiological*/, 53 /*search and rescue*/, 54 /*security*/, 55 /*sensor*/, 56 /*weapons*/, 57 /*signals intelligence*/, 58 /*armored*/, 59 /*single rocket launcher*/, 60 /*smoke*/, 61 /*sniper*/, 62 /*sound ranging*/, 63 /*special operations forces*/, 64 /*special weapons and tactics*/, 65 /*survey*/, 66 /*tactical exploitation*/, 67 /*target acquisition*/, 68 /*topographical*/, 69 /*utility*/, 70 /*video imagery*/, 71 /*mobility assault*/, 72 /*amphibious warfare ship*/, 73 /*load handling system*/, 74 /*palletized load system*/, 75 /*medevac*/, 76 /*cyberspace*/, 77 /*support*/, 78 /*aviation*/, 79 /*route reconnaissance and clearance*/, 80 /*tiltrotor*/, 81 /*command post node*/, 82 /*joint network node*/, 83 /*retransmission site*/, 84 /*assault*/, 85 /*weapon*/, 86 /*criminal investigation division*/, 87 /*digital*/, 88 /*network*/, 89 /*aerial port of embarkation*/, 90 /*pipeline*/, 91 /*postal*/, 92 /*water*/, 93 /*independent command*/, 94 /*theater*/, 95 /*army*/, 96 /*corps*/, 97 /*brigade*/, 98 /*headquarters*/};
+	}
+	else if (symbol_type == IconType::MODIFIER_2) {
+		return {1 /*airborne*/, 2 /*arctic*/, 3 /*battle damage repair*/, 4 /*bicycle equipped*/, 5 /*casualty staging*/, 6 /*clearing*/, 7 /*close range*/, 8 /*control*/, 9 /*decontamination*/, 10 /*demolition*/, 11 /*dental*/, 12 /*digital*/, 13 /*enhanced position location reporting system*/, 14 /*equipment*/, 15 /*heavy*/, 16 /*high altitude*/, 17 /*intermodal*/, 18 /*intensive care*/, 19 /*light*/, 20 /*laboratory*/, 21 /*launcher*/, 22 /*long range*/, 23 /*low altitude*/, 24 /*medium*/, 25 /*medium altitude*/, 26 /*medium range*/, 27 /*mountain*/, 28 /*high to medium altitude*/, 29 /*multi-channel*/, 30 /*optical*/, 31 /*pack animal*/, 32 /*patient evacuation coordination*/, 33 /*preventative maintenance*/, 34 /*psychological*/, 35 /*radio relay line of sight*/, 36 /*railroad*/, 37 /*unmanned systems recovery*/, 38 /*recovery (maintenance)*/, 39 /*rescue coordination center*/, 40 /*riverine*/, 41 /*single channel*/, 42 /*ski*/, 43 /*short range*/, 44 /*strategic*/, 45 /*support*/, 46 /*tactical*/, 47 /*towed*/, 48 /*troop*/, 49 /*vertical or short takeoff and landing*/, 50 /*veterinary*/, 51 /*wheeled*/, 52 /*high to low altitude*/, 53 /*medium to low altitude*/, 54 /*attack*/, 55 /*refuel*/, 56 /*utility*/, 57 /*combat search and rescue*/, 58 /*guerilla*/, 59 /*air assault*/, 60 /*amphibious*/, 61 /*very heavy*/, 62 /*supply*/, 63 /*cyberspace*/, 64 /*navy barge, self-propelled*/, 65 /*navy barge, not self-propelled*/, 66 /*launch*/, 67 /*landing craft*/, 68 /*landing ship*/, 69 /*service craft*/, 70 /*tug harbor*/, 71 /*ocean-going tugboat*/, 72 /*surface deployment and distribution command*/, 73 /*noncombatant generic vessel*/, 74 /*composite*/, 75 /*shelter*/, 76 /*light and medium*/, 77 /*tracked*/, 78 /*security force assistance*/};
+	}
+
+	// Default to nothing
+	return {};
+}
+
+}
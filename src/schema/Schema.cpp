@@ -0,0 +1,161 @@
+// Generated by generation/parse.py. Symbol sets the build leaves out, by defining
+// MILSYMBOL_WITHOUT_<SET>, have no tables, so their symbols are drawn with their frame only
+#include "Schema.hpp"
+
+#include <algorithm>
+
+namespace milsymbol::_impl {
+
+SymbolLayer LayerTable::find(int32_t code) const noexcept {
+	auto it = std::lower_bound(codes.begin(), codes.end(), code);
+	if (it == codes.end() || *it != code) {
+		return {};
+	}
+	return layers[it - codes.begin()];
+}
+
+std::optional<BoundingBox> LayerTable::find_bbox(int32_t code) const noexcept {
+	auto it = std::lower_bound(codes.begin(), codes.end(), code);
+	if (it == codes.end() || *it != code) {
+		return std::nullopt;
+	}
+	return layers[it - codes.begin()].bbox;
+}
+
+LayerTable build_layer_table(std::span<const LayerEntry> entries, std::span<const uint16_t> command_indices,
+	const std::vector<DrawCommand>& commands) {
+	LayerTable table;
+	table.codes.reserve(entries.size());
+	table.layers.reserve(entries.size());
+	for (const LayerEntry& entry : entries) {
+		SymbolLayer layer;
+		layer.draw_items.reserve(entry.command_count);
+		for (uint16_t index : command_indices.subspan(entry.first_command, entry.command_count)) {
+			layer.draw_items.push_back(commands[index]);
+		}
+		layer.civilian_override = entry.civilian_override;
+		layer.bbox = entry.bbox;
+		table.codes.push_back(entry.code);
+		table.layers.push_back(std::move(layer));
+	}
+	return table;
+}
+
+SymbolLayer get_symbol_layer(SymbolSet symbol_set, int32_t code, IconType symbol_type) noexcept {
+	switch (symbol_set) {
+#ifndef MILSYMBOL_WITHOUT_AIR
+	case SymbolSet::AIR: return get_air_layer(code, symbol_type);
+#endif
+#ifndef MILSYMBOL_WITHOUT_AIR_MISSILE
+	case SymbolSet::AIR_MISSILE: return get_air_missile_layer(code, symbol_type);
+#endif
+#ifndef MILSYMBOL_WITHOUT_SPACE
+	case SymbolSet::SPACE: return get_space_layer(code, symbol_type);
+#endif
+#ifndef MILSYMBOL_WITHOUT_SPACE_MISSILE
+	case SymbolSet::SPACE_MISSILE: return get_space_missile_layer(code, symbol_type);
+#endif
+#ifndef MILSYMBOL_WITHOUT_LAND_UNIT
+	case SymbolSet::LAND_UNIT: return get_land_unit_layer(code, symbol_type);
+#endif
+#ifndef MILSYMBOL_WITHOUT_LAND_CIVILIAN_UNIT_ORGANIZATION
+	case SymbolSet::LAND_CIVILIAN_UNIT_ORGANIZATION: return get_land_civilian_unit_organization_layer(code, symbol_type);
+#endif
+#ifndef MILSYMBOL_WITHOUT_LAND_EQUIPMENT
+	case SymbolSet::LAND_EQUIPMENT: return get_land_equipment_layer(code, symbol_type);
+#endif
+#ifndef MILSYMBOL_WITHOUT_LAND_INSTALLATION
+	case SymbolSet::LAND_INSTALLATION: return get_land_installation_layer(code, symbol_type);
+#endif
+#ifndef MILSYMBOL_WITHOUT_SEA_SURFACE
+	case SymbolSet::SEA_SURFACE: return get_sea_surface_layer(code, symbol_type);
+#endif
+#ifndef MILSYMBOL_WITHOUT_SEA_SUBSURFACE
+	case SymbolSet::SEA_SUBSURFACE: return get_sea_subsurface_layer(code, symbol_type);
+#endif
+#ifndef MILSYMBOL_WITHOUT_ACTIVITIES
+	case SymbolSet::ACTIVITIES: return get_activities_layer(code, symbol_type);
+#endif
+	default: return {};
+	}
+}
+
+std::optional<BoundingBox> get_symbol_bbox(SymbolSet symbol_set, int32_t code, IconType symbol_type) noexcept {
+	switch (symbol_set) {
+#ifndef MILSYMBOL_WITHOUT_AIR
+	case SymbolSet::AIR: return get_air_bbox(code, symbol_type);
+#endif
+#ifndef MILSYMBOL_WITHOUT_AIR_MISSILE
+	case SymbolSet::AIR_MISSILE: return get_air_missile_bbox(code, symbol_type);
+#endif
+#ifndef MILSYMBOL_WITHOUT_SPACE
+	case SymbolSet::SPACE: return get_space_bbox(code, symbol_type);
+#endif
+#ifndef MILSYMBOL_WITHOUT_SPACE_MISSILE
+	case SymbolSet::SPACE_MISSILE: return get_space_missile_bbox(code, symbol_type);
+#endif
+#ifndef MILSYMBOL_WITHOUT_LAND_UNIT
+	case SymbolSet::LAND_UNIT: return get_land_unit_bbox(code, symbol_type);
+#endif
+#ifndef MILSYMBOL_WITHOUT_LAND_CIVILIAN_UNIT_ORGANIZATION
+	case SymbolSet::LAND_CIVILIAN_UNIT_ORGANIZATION: return get_land_civilian_unit_organization_bbox(code, symbol_type);
+#endif
+#ifndef MILSYMBOL_WITHOUT_LAND_EQUIPMENT
+	case SymbolSet::LAND_EQUIPMENT: return get_land_equipment_bbox(code, symbol_type);
+#endif
+#ifndef MILSYMBOL_WITHOUT_LAND_INSTALLATION
+	case SymbolSet::LAND_INSTALLATION: return get_land_installation_bbox(code, symbol_type);
+#endif
+#ifndef MILSYMBOL_WITHOUT_SEA_SURFACE
+	case SymbolSet::SEA_SURFACE: return get_sea_surface_bbox(code, symbol_type);
+#endif
+#ifndef MILSYMBOL_WITHOUT_SEA_SUBSURFACE
+	case SymbolSet::SEA_SUBSURFACE: return get_sea_subsurface_bbox(code, symbol_type);
+#endif
+#ifndef MILSYMBOL_WITHOUT_ACTIVITIES
+	case SymbolSet::ACTIVITIES: return get_activities_bbox(code, symbol_type);
+#endif
+	default: return std::nullopt;
+	}
+}
+
+std::vector<int32_t> get_available_symbols(SymbolSet symbol_set, IconType symbol_type) noexcept {
+	switch (symbol_set) {
+#ifndef MILSYMBOL_WITHOUT_AIR
+	case SymbolSet::AIR: return get_air_symbols(symbol_type);
+#endif
+#ifndef MILSYMBOL_WITHOUT_AIR_MISSILE
+	case SymbolSet::AIR_MISSILE: return get_air_missile_symbols(symbol_type);
+#endif
+#ifndef MILSYMBOL_WITHOUT_SPACE
+	case SymbolSet::SPACE: return get_space_symbols(symbol_type);
+#endif
+#ifndef MILSYMBOL_WITHOUT_SPACE_MISSILE
+	case SymbolSet::SPACE_MISSILE: return get_space_missile_symbols(symbol_type);
+#endif
+#ifndef MILSYMBOL_WITHOUT_LAND_UNIT
+	case SymbolSet::LAND_UNIT: return get_land_unit_symbols(symbol_type);
+#endif
+#ifndef MILSYMBOL_WITHOUT_LAND_CIVILIAN_UNIT_ORGANIZATION
+	case SymbolSet::LAND_CIVILIAN_UNIT_ORGANIZATION: return get_land_civilian_unit_organization_symbols(symbol_type);
+#endif
+#ifndef MILSYMBOL_WITHOUT_LAND_EQUIPMENT
+	case SymbolSet::LAND_EQUIPMENT: return get_land_equipment_symbols(symbol_type);
+#endif
+#ifndef MILSYMBOL_WITHOUT_LAND_INSTALLATION
+	case SymbolSet::LAND_INSTALLATION: return get_land_installation_symbols(symbol_type);
+#endif
+#ifndef MILSYMBOL_WITHOUT_SEA_SURFACE
+	case SymbolSet::SEA_SURFACE: return get_sea_surface_symbols(symbol_type);
+#endif
+#ifndef MILSYMBOL_WITHOUT_SEA_SUBSURFACE
+	case SymbolSet::SEA_SUBSURFACE: return get_sea_subsurface_symbols(symbol_type);
+#endif
+#ifndef MILSYMBOL_WITHOUT_ACTIVITIES
+	case SymbolSet::ACTIVITIES: return get_activities_symbols(symbol_type);
+#endif
+	default: return {};
+	}
+}
+
+}
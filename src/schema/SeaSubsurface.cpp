@@ -0,0 +1,202 @@
+// Generated by generation/parse.py from the "sea subsurface" symbol set
+#include "Schema.hpp"
+
+namespace milsymbol::_impl {
+
+namespace {
+
+// Path data used by more than one draw command
+constexpr const char PATH_0[] = "m 85,90 0,-10 30,0 0,10 m 20,10 c 0,5.5 -15.7,10 -35,10 -19.3,0 -35,-4.5 -35,-10 0,-5.5 15.7,-10 35,-10 19.3,0 35,4.5 35,10 z";
+constexpr const char PATH_1[] = "m 60,84 40,20 40,-20 0,8 -40,25 -40,-25 z";
+
+LayerTable build_entity_table() {
+	std::vector<DrawCommand> commands;
+	commands.reserve(24);
+	commands.push_back(DrawCommand::autotext("MIL"));
+	commands.push_back(DrawCommand::path("m 75,85 50,0 15,15 -15,15 -50,0 -15,-15 z", BoundingBox{60, 85, 140, 115}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("m 75,80 50,0 15,15 -15,15 -50,0 -15,-15 z", BoundingBox{60, 80, 140, 110}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("m 65,120 10,-10 10,10 10,-10 10,10 10,-10 10,10 10,-10", BoundingBox{65, 110, 135, 120}));
+	commands.push_back(DrawCommand::path("m 75,120 -10,-10 10,-10 20,0 0,-20 10,0 0,20 20,0 10,10 -10,10 z", BoundingBox{65, 80, 135, 120}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("m 65,95 10,-10 10,10 10,-10 10,10 10,-10 10,10 10,-10", BoundingBox{65, 85, 135, 95}));
+	commands.push_back(DrawCommand::path("m 70,120 0,-5 60,0 0,5 z", BoundingBox{70, 115, 130, 120}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path(PATH_0, BoundingBox{65, 80, 135, 110}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::text("NON", Vector2{100, 100}, 25));
+	commands.push_back(DrawCommand::text("SUB", Vector2{100, 120}, 25));
+	commands.push_back(DrawCommand::path(PATH_1, BoundingBox{60, 84, 140, 117}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("M 100 80 C 93.7 80 88.3 82.7 85.8 88.3 L 85.8 88.3 L 77.8 88.3 L 77.8 105 L 85.8 105 L 85.8 104.8 C 87.3 108.2 88.8 110 92 111.7 L 92.1 111.7 L 84.2 120 L 115.8 120 L 107.9 111.7 L 108 111.7 C 111.1 110 112.8 108.3 114.3 105 L 122.2 105 L 122.2 88.3 L 114.3 88.3 L 114.3 88.3 C 111.7 82.8 106.3 80 100 80 z M 100 86.6 C 105.4 86.6 109.8 91.1 109.8 96.6 C 109.8 102.1 105.4 106.6 100 106.6 C 94.6 106.6 90.1 102.1 90.1 96.6 C 90.1 91.1 94.6 86.6 100 86.6 z M 100 89.6 C 96.2 89.6 93.1 92.7 93.1 96.6 C 93.1 100.5 96.2 103.6 100 103.6 C 103.8 103.6 106.8 100.5 106.8 96.6 C 106.8 92.7 103.8 89.6 100 89.6 z", BoundingBox{77.8, 80, 122.2, 120}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::autotext("CIV").with_fill(ColorType::WHITE).with_stroke(ColorType::ICON).with_stroke_width(4.0));
+	commands.push_back(DrawCommand::path(PATH_0, BoundingBox{65, 80, 135, 110}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::path(PATH_1, BoundingBox{60, 84, 140, 117}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::path("M 114.3,94 C 114.3,102.3 107.9,109 100,109 c -7.9,0 -14.2,-6.7 -14.2,-15 0,-8.3 6.4,-15 14.2,-15 7.9,0 14.3,6.7 14.3,15 z m 0,27 14.3,15 -57,0 14.3,-15 M 125.7,79 l 14.3,0 0,30 -14.3,0 m -51.3,0 -14.3,0 0,-30 14.3,0 m 54.2,15 c 0,16.6 -12.8,30 -28.5,30 -15.7,0 -28.5,-13.4 -28.5,-30 C 71.5,77.4 84.3,64 100,64 115.7,64 128.5,77.4 128.5,94 z", BoundingBox{60.1, 64, 140, 136}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::autotext("WPN"));
+	commands.push_back(DrawCommand::path("m 65,105 -5,-5 5,-5 60,0 c 0,0 5,5 5,5 l 5,-5 0,10 -5,-5 -5,5 z", BoundingBox{60, 95, 135, 105}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::autotext("IED"));
+	commands.push_back(DrawCommand::path("M 85 81 L 65 98 L 85 119 L 85 81 z M 110 81 L 90 98 L 110 119 L 110 81 z M 135 81 L 115 98 L 135 119 L 135 81 z", BoundingBox{65, 81, 135, 119}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::text("?", Vector2{100, 130}, 60));
+	commands.push_back(DrawCommand::path("m 70,65 10,35 -10,35 60,0 -10,-35 10,-35", BoundingBox{70, 65, 130, 135}));
+	commands.push_back(DrawCommand::autotext("?"));
+	commands.push_back(DrawCommand::autotext("MAN"));
+
+	static constexpr uint16_t COMMAND_INDICES[] = {0, 1, 2, 3, 4, 5, 2, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23};
+	static constexpr LayerEntry ENTRIES[] = {
+		{35110000, 0, 1, false, std::nullopt} /* military */,
+		{35110100, 1, 1, false, BoundingBox{60, 85, 140, 115}} /* submarine */,
+		{35110101, 2, 2, false, BoundingBox{60, 80, 140, 120}} /* submarine, surfaced */,
+		{35110102, 4, 2, false, BoundingBox{65, 80, 135, 120}} /* submarine, snorkeling */,
+		{35110103, 6, 2, false, BoundingBox{60, 80, 140, 120}} /* submarine, bottomed */,
+		{35110200, 8, 1, false, BoundingBox{65, 80, 135, 110}} /* other submersible */,
+		{35110300, 9, 2, false, std::nullopt} /* non-submarine */,
+		{35110400, 11, 1, false, BoundingBox{60, 84, 140, 117}} /* autonomous underwater vehicle */,
+		{35110500, 12, 1, false, BoundingBox{77.8, 80, 122.2, 120}} /* diver */,
+		{35120000, 13, 1, true, std::nullopt} /* civilian */,
+		{35120100, 14, 1, true, BoundingBox{65, 80, 135, 110}} /* submersible */,
+		{35120200, 15, 1, true, BoundingBox{60, 84, 140, 117}} /* civilian autonomous underwater vehicle */,
+		{35120300, 16, 1, true, BoundingBox{60.1, 64, 140, 136}} /* civilian diver */,
+		{35130000, 17, 1, false, std::nullopt} /* weapon */,
+		{35130100, 18, 1, false, BoundingBox{60, 95, 135, 105}} /* torpedo */,
+		{35130200, 19, 1, false, std::nullopt} /* improvised explosive device */,
+		{35130300, 20, 1, false, BoundingBox{65, 81, 135, 119}} /* decoy */,
+		{35140000, 21, 1, false, std::nullopt} /* echo tracker classifier */,
+		{35150000, 22, 2, false, BoundingBox{70, 65, 130, 135}} /* fused track */,
+		{35160000, 24, 1, false, std::nullopt} /* manual track */
+	};
+	return build_layer_table(ENTRIES, COMMAND_INDICES, commands);
+}
+
+LayerTable build_modifier_1_table() {
+	std::vector<DrawCommand> commands;
+	commands.reserve(22);
+	commands.push_back(DrawCommand::textm1("ASW"));
+	commands.push_back(DrawCommand::textm1("AUX"));
+	commands.push_back(DrawCommand::textm1("C2"));
+	commands.push_back(DrawCommand::textm1("ISR"));
+	commands.push_back(DrawCommand::textm1("MCM"));
+	commands.push_back(DrawCommand::textm1("MIW"));
+	commands.push_back(DrawCommand::textm1("SUW"));
+	commands.push_back(DrawCommand::textm1("A"));
+	commands.push_back(DrawCommand::textm1("B"));
+	commands.push_back(DrawCommand::textm1("G"));
+	commands.push_back(DrawCommand::textm1("M"));
+	commands.push_back(DrawCommand::textm1("SOF"));
+	commands.push_back(DrawCommand::textm1("P1"));
+	commands.push_back(DrawCommand::textm1("P2"));
+	commands.push_back(DrawCommand::textm1("P3"));
+	commands.push_back(DrawCommand::textm1("P4"));
+	commands.push_back(DrawCommand::textm1("PB"));
+	commands.push_back(DrawCommand::textm1("CT"));
+	commands.push_back(DrawCommand::textm1("ATT"));
+	commands.push_back(DrawCommand::textm1("H"));
+	commands.push_back(DrawCommand::textm1("HJ"));
+	commands.push_back(DrawCommand::textm1("CYB"));
+
+	static constexpr uint16_t COMMAND_INDICES[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21};
+	static constexpr LayerEntry ENTRIES[] = {
+		{3501, 0, 1, false, std::nullopt} /* antisubmarine warfare */,
+		{3502, 1, 1, false, std::nullopt} /* auxiliary */,
+		{3503, 2, 1, false, std::nullopt} /* command and control */,
+		{3504, 3, 1, false, std::nullopt} /* intelligence, surveillance, and reconnaissance */,
+		{3505, 4, 1, false, std::nullopt} /* mine countermeasures */,
+		{3506, 5, 1, false, std::nullopt} /* mine warfare */,
+		{3507, 6, 1, false, std::nullopt} /* surface warfare */,
+		{3508, 7, 1, false, std::nullopt} /* attack */,
+		{3509, 8, 1, false, std::nullopt} /* ballistic missile */,
+		{3510, 9, 1, false, std::nullopt} /* guided missile */,
+		{3511, 10, 1, false, std::nullopt} /* other guided missile */,
+		{3512, 11, 1, false, std::nullopt} /* special operations forces */,
+		{3513, 12, 1, false, std::nullopt} /* possible submarine low 1 */,
+		{3514, 13, 1, false, std::nullopt} /* possible submarine low 2 */,
+		{3515, 14, 1, false, std::nullopt} /* possible submarine high 3 */,
+		{3516, 15, 1, false, std::nullopt} /* possible submarine high 4 */,
+		{3517, 16, 1, false, std::nullopt} /* probable submarine */,
+		{3518, 17, 1, false, std::nullopt} /* certain submarine */,
+		{3519, 18, 1, false, std::nullopt} /* anti-torpedo torpedo */,
+		{3520, 19, 1, false, std::nullopt} /* hijacking */,
+		{3521, 20, 1, false, std::nullopt} /* hijacker */,
+		{3522, 21, 1, false, std::nullopt} /* cyberspace */
+	};
+	return build_layer_table(ENTRIES, COMMAND_INDICES, commands);
+}
+
+LayerTable build_modifier_2_table() {
+	std::vector<DrawCommand> commands;
+	commands.reserve(17);
+	commands.push_back(DrawCommand::textm2("AI"));
+	commands.push_back(DrawCommand::textm2("D"));
+	commands.push_back(DrawCommand::textm2("D1"));
+	commands.push_back(DrawCommand::textm2("D2"));
+	commands.push_back(DrawCommand::textm2("D3"));
+	commands.push_back(DrawCommand::textm2("N"));
+	commands.push_back(DrawCommand::textm2("N1"));
+	commands.push_back(DrawCommand::textm2("N2"));
+	commands.push_back(DrawCommand::textm2("N3"));
+	commands.push_back(DrawCommand::textm2("N4"));
+	commands.push_back(DrawCommand::textm2("N5"));
+	commands.push_back(DrawCommand::textm2("N6"));
+	commands.push_back(DrawCommand::textm2("N7"));
+	commands.push_back(DrawCommand::textm2("AUT"));
+	commands.push_back(DrawCommand::textm2("RP"));
+	commands.push_back(DrawCommand::textm2("EXP"));
+	commands.push_back(DrawCommand::textm2("CYB"));
+
+	static constexpr uint16_t COMMAND_INDICES[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+	static constexpr LayerEntry ENTRIES[] = {
+		{3501, 0, 1, false, std::nullopt} /* air independent propulsion */,
+		{3502, 1, 1, false, std::nullopt} /* diesel electric, general */,
+		{3503, 2, 1, false, std::nullopt} /* diesel type 1 */,
+		{3504, 3, 1, false, std::nullopt} /* diesel type 2 */,
+		{3505, 4, 1, false, std::nullopt} /* diesel type 3 */,
+		{3506, 5, 1, false, std::nullopt} /* nuclear powered, general */,
+		{3507, 6, 1, false, std::nullopt} /* nuclear type 1 */,
+		{3508, 7, 1, false, std::nullopt} /* nuclear type 2 */,
+		{3509, 8, 1, false, std::nullopt} /* nuclear type 3 */,
+		{3510, 9, 1, false, std::nullopt} /* nuclear type 4 */,
+		{3511, 10, 1, false, std::nullopt} /* nuclear type 5 */,
+		{3512, 11, 1, false, std::nullopt} /* nuclear type 6 */,
+		{3513, 12, 1, false, std::nullopt} /* nuclear type 7 */,
+		{3514, 13, 1, false, std::nullopt} /* autonomous control */,
+		{3515, 14, 1, false, std::nullopt} /* remotely-piloted */,
+		{3516, 15, 1, false, std::nullopt} /* expendable */,
+		{3517, 16, 1, false, std::nullopt} /* cyberspace */
+	};
+	return build_layer_table(ENTRIES, COMMAND_INDICES, commands);
+}
+
+const LayerTable& get_table(IconType symbol_type) noexcept {
+	if (symbol_type == IconType::ENTITY) {
+		static const LayerTable ENTITY_TABLE = build_entity_table();
+		return ENTITY_TABLE;
+	} else if (symbol_type == IconType::MODIFIER_1) {
+		static const LayerTable MODIFIER_1_TABLE = build_modifier_1_table();
+		return MODIFIER_1_TABLE;
+	}
+
+	static const LayerTable MODIFIER_2_TABLE = build_modifier_2_table();
+	return MODIFIER_2_TABLE;
+}
+
+}
+
+SymbolLayer get_sea_subsurface_layer(int32_t code, IconType symbol_type) noexcept {
+	return get_table(symbol_type).find(code);
+}
+
+std::optional<BoundingBox> get_sea_subsurface_bbox(int32_t code, IconType symbol_type) noexcept {
+	return get_table(symbol_type).find_bbox(code);
+}
+
+std::vector<int32_t> get_sea_subsurface_symbols(IconType symbol_type) noexcept {
+	if (symbol_type == IconType::ENTITY) {
+		return {110000 /*military*/, 110100 /*submarine*/, 110101 /*submarine, surfaced*/, 110102 /*submarine, snorkeling*/, 110103 /*submarine, bottomed*/, 110200 /*other submersible*/, 110300 /*non-submarine*/, 110400 /*autonomous underwater vehicle*/, 110500 /*diver*/, 120000 /*civilian*/, 120100 /*submersible*/, 120200 /*civilian autonomous underwater vehicle*/, 120300 /*civilian diver*/, 130000 /*weapon*/, 130100 /*torpedo*/, 130200 /*improvised explosive device*/, 130300 /*decoy*/, 140000 /*echo tracker classifier*/, 150000 /*fused track*/, 160000 /*manual track*/};
+	}
+	else if (symbol_type == IconType::MODIFIER_1) {
+		return {1 /*antisubmarine warfare*/, 2 /*auxiliary*/, 3 /*command and control*/, 4 /*intelligence, surveillance, and reconnaissance*/, 5 /*mine countermeasures*/, 6 /*mine warfare*/, 7 /*surface warfare*/, 8 /*attack*/, 9 /*ballistic missile*/, 10 /*guided missile*/, 11 /*other guided missile*/, 12 /*special operations forces*/, 13 /*possible submarine low 1*/, 14 /*possible submarine low 2*/, 15 /*possible submarine high 3*/, 16 /*possible submarine high 4*/, 17 /*probable submarine*/, 18 /*certain submarine*/, 19 /*anti-torpedo torpedo*/, 20 /*hijacking*/, 21 /*hijacker*/, 22 /*cyberspace*/};
+	}
+	else if (symbol_type == IconType::MODIFIER_2) {
+		return {1 /*air independent propulsion*/, 2 /*diesel electric, general*/, 3 /*diesel type 1*/, 4 /*diesel type 2*/, 5 /*diesel type 3*/, 6 /*nuclear powered, general*/, 7 /*nuclear type 1*/, 8 /*nuclear type 2*/, 9 /*nuclear type 3*/, 10 /*nuclear type 4*/, 11 /*nuclear type 5*/, 12 /*nuclear type 6*/, 13 /*nuclear type 7*/, 14 /*autonomous control*/, 15 /*remotely-piloted*/, 16 /*expendable*/, 17 /*cyberspace*/};
+	}
+
+	// Default to nothing
+	return {};
+}
+
+}
@@ -0,0 +1,348 @@
+// Generated by generation/parse.py from the "sea surface" symbol set
+#include "Schema.hpp"
+
+namespace milsymbol::_impl {
+
+namespace {
+
+// Path data used by more than one draw command
+constexpr const char PATH_0[] = "m 60,84 40,20 40,-20 0,8 -40,25 -40,-25 z";
+
+LayerTable build_entity_table() {
+	std::vector<DrawCommand> commands;
+	commands.reserve(95);
+	commands.push_back(DrawCommand::autotext("MIL"));
+	commands.push_back(DrawCommand::path("m 86.9,110 c -3.6,2 -7.2,3.9 -10.8,5.9 2.1,2.9 6.7,3.9 10,2.1 2.6,-0.9 4.7,-3.8 3.1,-6.1 -0.8,-0.6 -1.5,-1.3 -2.3,-1.9 z m 26.3,0.1 c 3.6,2 7.2,3.9 10.8,5.9 -2.1,2.9 -6.7,3.9 -10,2.1 -2.6,-0.9 -4.7,-3.8 -3.1,-6.1 0.8,-0.6 1.5,-1.3 2.3,-1.9 z", BoundingBox{76.1, 110, 124, 119.01}));
+	commands.push_back(DrawCommand::path("m 112.9,110 c -5.6,-4 -11.3,-7.9 -16.1,-12.5 -4.2,-4.5 -7,-9.8 -9.2,-15.1 -0.8,4.4 -0.9,9.3 2.4,13.2 3.6,4.5 8.6,8.1 13.5,11.8 2.3,1.7 4.7,3.3 7.1,4.8 0.8,-0.7 1.5,-1.5 2.3,-2.2 m -25.7,0 c 5.6,-4 11.3,-7.9 16.1,-12.5 4.2,-4.5 7,-9.8 9.2,-15.1 0.8,4.4 0.9,9.3 -2.4,13.2 -3.6,4.5 -8.6,8.1 -13.5,11.8 -2.3,1.7 -4.7,3.3 -7.1,4.8 -0.8,-0.7 -1.5,-1.5 -2.3,-2.2", BoundingBox{87.13, 82.4, 112.97, 112.2}).with_fill(ColorType::WHITE).with_stroke_width(2.0));
+	commands.push_back(DrawCommand::path("m 80,100 20,20 20,-20 -20,0 0,-20 -20,0 z", BoundingBox{80, 80, 120, 120}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("m 100,120 -25,-17 15,2 0,-10 5,0 0,-5 -15,0 0,-5 15,0 0,-5 10,0 0,5 15,0 0,5 -15,0 0,5 5,0 0,10 15,-2 z", BoundingBox{75, 80, 125, 120}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::autotext("BB"));
+	commands.push_back(DrawCommand::autotext("CG"));
+	commands.push_back(DrawCommand::autotext("DD"));
+	commands.push_back(DrawCommand::autotext("FS"));
+	commands.push_back(DrawCommand::autotext("LL"));
+	commands.push_back(DrawCommand::path("m 100,120 20,0 m -20,0 -20,-20 10,0 0,-20 20,0 0,20 10,0 z", BoundingBox{80, 80, 120, 120}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::autotext("LCC"));
+	commands.push_back(DrawCommand::autotext("LA"));
+	commands.push_back(DrawCommand::autotext("LHA"));
+	commands.push_back(DrawCommand::autotext("LHD"));
+	commands.push_back(DrawCommand::autotext("LPH"));
+	commands.push_back(DrawCommand::autotext("LPD"));
+	commands.push_back(DrawCommand::autotext("LS"));
+	commands.push_back(DrawCommand::autotext("LC"));
+	commands.push_back(DrawCommand::path("m 98.3,81 0,4.1 c -2.4,0.3 -4.6,1.4 -6.4,2.9 l -3.5,-3.5 -2.4,2.4 3.6,3.6 c -0.9,1.3 -1.5,4.9 -1.8,6.5 l -10.8,0 0,3 3,0 20,20 20,-20 3,0 0,-3 -10,0 c -1,-1.7 -2,-5.3 -3,-6.7 l 4,-3.7 -2,-2.4 -4,3.6 c -2,-1.4 -4,-2.4 -6,-2.7 l 0,-4.1 z", BoundingBox{77, 81, 123, 120}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::autotext("ML"));
+	commands.push_back(DrawCommand::autotext("MS"));
+	commands.push_back(DrawCommand::autotext("MSD"));
+	commands.push_back(DrawCommand::autotext("MH"));
+	commands.push_back(DrawCommand::autotext("MCM"));
+	commands.push_back(DrawCommand::autotext("MA"));
+	commands.push_back(DrawCommand::path("m 80,100 20,20 20,-20 -10,0 0,-20 -20,0 0,20 z", BoundingBox{80, 80, 120, 120}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::autotext("PC"));
+	commands.push_back(DrawCommand::autotext("PG"));
+	commands.push_back(DrawCommand::path("M 105,110 90,95 105,80 z M 85,110 70,95 85,80 z m 40,-30 -15,15 15,15 z m -55,40 0,-5 55,0 0,5 z", BoundingBox{70, 80, 125, 120}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::path(PATH_0, BoundingBox{60, 84, 140, 117}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::path("m 120,120 -40,0 -15,-25 15,0 5,-15 10,0 -5,15 45,0 z", BoundingBox{65, 80, 135, 120}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::path("M 85 80 L 80 95 L 65 95 L 80 120 L 120 120 L 135 95 L 90 95 L 95 80 L 85 80 z M 87 100.7 L 93.1 100.7 C 94.6 100.7 95.7 100.8 96.4 101.1 C 97.1 101.3 97.7 101.8 98.1 102.4 C 98.5 103.1 98.7 103.8 98.7 104.7 C 98.7 105.8 98.4 106.7 97.8 107.4 C 97.1 108.1 96.2 108.5 94.9 108.7 C 95.6 109.1 96.1 109.4 96.5 109.9 C 96.9 110.3 97.4 111.1 98.1 112.2 L 99.9 115 L 96.4 115 L 94.3 111.9 C 93.6 110.8 93.1 110.1 92.8 109.8 C 92.5 109.5 92.2 109.3 91.9 109.2 C 91.6 109.1 91.2 109 90.5 109 L 89.9 109 L 89.9 115 L 87 115 L 87 100.7 z M 101.5 100.7 L 107.2 100.7 C 108.3 100.7 109.2 100.7 109.7 100.8 C 110.3 100.9 110.8 101.1 111.2 101.4 C 111.7 101.7 112 102.1 112.3 102.6 C 112.6 103.1 112.7 103.7 112.8 104.3 C 112.7 105 112.6 105.6 112.2 106.1 C 111.9 106.7 111.4 107.1 110.8 107.4 C 111.6 107.7 112.3 108.1 112.8 108.7 C 113.2 109.3 113.5 110 113.5 110.8 C 113.5 111.5 113.3 112.1 113 112.8 C 112.7 113.4 112.3 113.8 111.8 114.2 C 111.2 114.6 110.6 114.8 109.8 114.9 C 109.3 115 108.2 115 106.3 115 L 101.5 115 L 101.5 100.7 z M 104.3 103.1 L 104.3 106.4 L 106.3 106.4 C 107.4 106.4 108.1 106.3 108.3 106.3 C 108.8 106.3 109.2 106.1 109.5 105.8 C 109.8 105.5 109.9 105.1 109.9 104.7 C 109.9 104.2 109.8 103.9 109.6 103.6 C 109.3 103.3 109 103.2 108.5 103.1 C 108.2 103.1 107.4 103.1 106 103.1 L 104.3 103.1 z M 89.9 103.1 L 89.9 106.8 L 92 106.8 C 93.4 106.8 94.3 106.7 94.6 106.6 C 95 106.4 95.2 106.3 95.4 106 C 95.6 105.7 95.7 105.3 95.8 104.9 C 95.7 104.4 95.6 104 95.3 103.7 C 95.1 103.4 94.7 103.2 94.3 103.2 C 94 103.1 93.3 103.1 92.2 103.1 L 89.9 103.1 z M 104.3 108.8 L 104.3 112.6 L 107 112.6 C 108.1 112.6 108.7 112.6 109 112.5 C 109.4 112.4 109.8 112.2 110.1 111.9 C 110.3 111.6 110.5 111.2 110.5 110.7 C 110.5 110.3 110.4 109.9 110.2 109.6 C 109.9 109.3 109.6 109.1 109.3 109 C 108.9 108.8 108 108.8 106.7 108.8 L 104.3 108.8 z", BoundingBox{65, 80, 135, 120}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::text("RB", Vector2{100, 115}, 20).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::path("m 135,105 0,15 -60,0 -10,-15 20,-25 10,0 0,10 -5,0 -5,15 z", BoundingBox{65, 80, 135, 120}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("m 110,80 15,15 0,25 M 90,80 75,95 l 0,25", BoundingBox{75, 80, 125, 120}));
+	commands.push_back(DrawCommand::path("m 100,80 -15,15 0,25 30,0 0,-25 -15,-15", BoundingBox{85, 80, 115, 120}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::text("TE", Vector2{100, 150}, 30));
+	commands.push_back(DrawCommand::text("TF", Vector2{100, 150}, 30));
+	commands.push_back(DrawCommand::text("TG", Vector2{100, 150}, 30));
+	commands.push_back(DrawCommand::text("TU", Vector2{100, 150}, 30));
+	commands.push_back(DrawCommand::path("m 80,115 -20,0 0,-35 80,0 0,35 -20,0 0,-20 -40,0 z", BoundingBox{60, 80, 140, 115}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("M72,95 l30,-25 0,25 30,-25 M70,70 c0,35 15,50 50,50", BoundingBox{70, 70, 132, 120}));
+	commands.push_back(DrawCommand::autotext("FF"));
+	commands.push_back(DrawCommand::path("m 80,100 0,-20 40,0 0,20 15,0 0,20 -70,0 0,-20 z", BoundingBox{65, 80, 135, 120}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::autotext("AR"));
+	commands.push_back(DrawCommand::autotext("AE"));
+	commands.push_back(DrawCommand::autotext("AF"));
+	commands.push_back(DrawCommand::autotext("AGF"));
+	commands.push_back(DrawCommand::autotext("JI"));
+	commands.push_back(DrawCommand::autotext("AGO"));
+	commands.push_back(DrawCommand::autotext("AGS"));
+	commands.push_back(DrawCommand::autotext("AH"));
+	commands.push_back(DrawCommand::autotext("AK"));
+	commands.push_back(DrawCommand::autotext("AOE"));
+	commands.push_back(DrawCommand::autotext("AO"));
+	commands.push_back(DrawCommand::autotext("AS"));
+	commands.push_back(DrawCommand::autotext("AT"));
+	commands.push_back(DrawCommand::autotext("YY"));
+	commands.push_back(DrawCommand::autotext("YB"));
+	commands.push_back(DrawCommand::autotext("YS"));
+	commands.push_back(DrawCommand::autotext("YT"));
+	commands.push_back(DrawCommand::autotext("YFT"));
+	commands.push_back(DrawCommand::autotext("CIV").with_fill(ColorType::WHITE).with_stroke(ColorType::ICON).with_stroke_width(4.0));
+	commands.push_back(DrawCommand::path("m 75,100 0,-35 50,0 0,35 20,0 -15,35 -60,0 -15,-35 z", BoundingBox{55, 65, 145, 135}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::text("CA", Vector2{100, 115}, 30));
+	commands.push_back(DrawCommand::text("C", Vector2{100, 115}, 30));
+	commands.push_back(DrawCommand::text("D", Vector2{100, 115}, 30));
+	commands.push_back(DrawCommand::text("RO", Vector2{100, 115}, 30));
+	commands.push_back(DrawCommand::text("FE", Vector2{100, 115}, 30));
+	commands.push_back(DrawCommand::text("H", Vector2{100, 115}, 30));
+	commands.push_back(DrawCommand::text("J", Vector2{100, 115}, 30));
+	commands.push_back(DrawCommand::text("L", Vector2{100, 115}, 30));
+	commands.push_back(DrawCommand::text("OT", Vector2{100, 115}, 30));
+	commands.push_back(DrawCommand::text("PA", Vector2{100, 115}, 30));
+	commands.push_back(DrawCommand::text("TU", Vector2{100, 115}, 30));
+	commands.push_back(DrawCommand::text("TW", Vector2{100, 115}, 30));
+	commands.push_back(DrawCommand::text("QJ", Vector2{100, 115}, 30));
+	commands.push_back(DrawCommand::text("YB", Vector2{100, 115}, 30));
+	commands.push_back(DrawCommand::path("m 95,95 0,-15 10,0 0,15 15,0 0,10 -15,0 0,15 -10,0 0,-15 -15,0 0,-10 z", BoundingBox{80, 80, 120, 120}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::path("m 75,100 0,-15 20,0 0,15 50,0 -15,35 -60,0 -15,-35 z M 105,57.4 105,100 m 30,-35 -30,35", BoundingBox{55, 57.4, 145, 135}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::text("DF", Vector2{100, 125}, 30));
+	commands.push_back(DrawCommand::text("TR", Vector2{100, 125}, 30));
+	commands.push_back(DrawCommand::text("DR", Vector2{100, 125}, 30));
+	commands.push_back(DrawCommand::path("m 135,100 -15,35 -10,0 15,-35 z", BoundingBox{110, 100, 135, 135}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("m 105,55 0,40 35,0 z m -5,-5 0,50 m 45,0 -15,35 -60,0 -15,-35 z", BoundingBox{55, 50, 145, 135}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::path("m 70,97.4 15,-30 10,0 -15,30 65,0 -15,35 -60,0 -15,-35 z", BoundingBox{55, 67.4, 145, 132.4}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::text("RB", Vector2{100, 125}, 30));
+	commands.push_back(DrawCommand::text("SP", Vector2{100, 125}, 30));
+	commands.push_back(DrawCommand::path("m 85,60 -30,45 10,15 75,0 0,-20 -60,0 10,-30 5,0 0,-10 z", BoundingBox{55, 60, 140, 120}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::path(PATH_0, BoundingBox{60, 84, 140, 117}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::autotext("@TODO"));
+	commands.push_back(DrawCommand::path("m 70,65 10,35 -10,35 60,0 -10,-35 10,-35 z", BoundingBox{70, 65, 130, 135}));
+	commands.push_back(DrawCommand::autotext("?"));
+	commands.push_back(DrawCommand::autotext("MAN"));
+
+	static constexpr uint16_t COMMAND_INDICES[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 35, 36, 37, 35, 36, 38, 35, 36, 39, 35, 36, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 45, 56, 57, 58, 59, 60, 61, 62, 63, 64, 64, 65, 64, 66, 64, 67, 64, 68, 64, 69, 64, 70, 64, 71, 64, 72, 64, 73, 64, 74, 64, 75, 64, 76, 64, 65, 64, 77, 64, 78, 64, 79, 80, 80, 81, 80, 82, 80, 83, 64, 84, 85, 86, 86, 87, 86, 88, 89, 90, 91, 92, 93, 94};
+	static constexpr LayerEntry ENTRIES[] = {
+		{30110000, 0, 1, false, std::nullopt} /* military */,
+		{30120000, 1, 2, false, BoundingBox{76.1, 82.4, 124, 119.01}} /* military combatant */,
+		{30120100, 3, 1, false, BoundingBox{80, 80, 120, 120}} /* carrier */,
+		{30120200, 4, 1, false, BoundingBox{75, 80, 125, 120}} /* surface combatant, line */,
+		{30120201, 5, 1, false, std::nullopt} /* battleship */,
+		{30120202, 6, 1, false, std::nullopt} /* cruiser */,
+		{30120203, 7, 1, false, std::nullopt} /* destroyer */,
+		{30120205, 8, 1, false, std::nullopt} /* corvette */,
+		{30120206, 9, 1, false, std::nullopt} /* littoral combat ship */,
+		{30120300, 10, 1, false, BoundingBox{80, 80, 120, 120}} /* amphibious warfare ship */,
+		{30120301, 11, 1, false, std::nullopt} /* amphibious command ship */,
+		{30120302, 12, 1, false, std::nullopt} /* amphibious assault ship (unspecified) */,
+		{30120303, 13, 1, false, std::nullopt} /* amphibious assault ship */,
+		{30120304, 14, 1, false, std::nullopt} /* amphibious assault ship (multipurpose) */,
+		{30120305, 15, 1, false, std::nullopt} /* amphibious assault ship, helicopter */,
+		{30120306, 16, 1, false, std::nullopt} /* amphibious transport dock */,
+		{30120307, 17, 1, false, std::nullopt} /* landing ship */,
+		{30120308, 18, 1, false, std::nullopt} /* landing craft */,
+		{30120400, 19, 1, false, BoundingBox{77, 81, 123, 120}} /* mine warfare ship */,
+		{30120401, 20, 1, false, std::nullopt} /* mine layer */,
+		{30120402, 21, 1, false, std::nullopt} /* mine sweeper */,
+		{30120403, 22, 1, false, std::nullopt} /* mine sweeper, drone */,
+		{30120404, 23, 1, false, std::nullopt} /* mine hunter */,
+		{30120405, 24, 1, false, std::nullopt} /* mine countermeasures */,
+		{30120406, 25, 1, false, std::nullopt} /* mine countermeasures support ship */,
+		{30120500, 26, 1, false, BoundingBox{80, 80, 120, 120}} /* patrol boat */,
+		{30120501, 27, 1, false, std::nullopt} /* patrol craft, submarine chaser */,
+		{30120502, 28, 1, false, std::nullopt} /* patrol ship, general */,
+		{30120600, 29, 1, false, BoundingBox{70, 80, 125, 120}} /* decoy */,
+		{30120700, 30, 1, false, BoundingBox{60, 84, 140, 117}} /* unmanned surface vehicle */,
+		{30120800, 31, 1, false, BoundingBox{65, 80, 135, 120}} /* speedboat */,
+		{30120801, 32, 2, false, BoundingBox{65, 80, 135, 120}} /* rigid-hull inflatable boat */,
+		{30120900, 34, 1, false, BoundingBox{65, 80, 135, 120}} /* jet ski */,
+		{30121000, 35, 2, false, BoundingBox{75, 80, 125, 120}} /* navy task organization */,
+		{30121001, 37, 3, false, BoundingBox{75, 80, 125, 120}} /* navy task element */,
+		{30121002, 40, 3, false, BoundingBox{75, 80, 125, 120}} /* navy task force */,
+		{30121003, 43, 3, false, BoundingBox{75, 80, 125, 120}} /* navy task group */,
+		{30121004, 46, 3, false, BoundingBox{75, 80, 125, 120}} /* navy task unit */,
+		{30121005, 49, 1, false, BoundingBox{60, 80, 140, 115}} /* convoy */,
+		{30121100, 50, 1, false, BoundingBox{70, 70, 132, 120}} /* sea-based X-band radar */,
+		{30121204, 51, 1, false, std::nullopt} /* frigate */,
+		{30130000, 52, 1, false, BoundingBox{65, 80, 135, 120}} /* military non-combatant */,
+		{30130100, 53, 1, false, std::nullopt} /* auxiliary ship */,
+		{30130101, 54, 1, false, std::nullopt} /* ammunition ship */,
+		{30130102, 55, 1, false, std::nullopt} /* naval stores ship */,
+		{30130103, 56, 1, false, std::nullopt} /* auxiliary flag ship */,
+		{30130104, 57, 1, false, std::nullopt} /* intelligence collector */,
+		{30130105, 58, 1, false, std::nullopt} /* oceanographic research ship */,
+		{30130106, 59, 1, false, std::nullopt} /* survey ship */,
+		{30130107, 60, 1, false, std::nullopt} /* hospital ship */,
+		{30130108, 61, 1, false, std::nullopt} /* naval cargo ship */,
+		{30130109, 62, 1, false, std::nullopt} /* fast combat support ship */,
+		{30130110, 63, 1, false, std::nullopt} /* oiler, replenishment */,
+		{30130111, 64, 1, false, std::nullopt} /* repair ship */,
+		{30130112, 65, 1, false, std::nullopt} /* submarine tender */,
+		{30130113, 66, 1, false, std::nullopt} /* ocean-going tug */,
+		{30130200, 67, 1, false, std::nullopt} /* service craft */,
+		{30130201, 68, 1, false, std::nullopt} /* barge, not self-propelled */,
+		{30130202, 69, 1, false, std::nullopt} /* barge, self-propelled */,
+		{30130203, 70, 1, false, std::nullopt} /* tug, harbor */,
+		{30130204, 71, 1, false, std::nullopt} /* launch */,
+		{30140000, 72, 1, true, std::nullopt} /* civilian */,
+		{30140100, 73, 1, true, BoundingBox{55, 65, 145, 135}} /* merchant ship */,
+		{30140101, 74, 2, true, BoundingBox{55, 65, 145, 135}} /* cargo ship */,
+		{30140102, 76, 2, true, BoundingBox{55, 65, 145, 135}} /* container ship */,
+		{30140103, 78, 2, true, BoundingBox{55, 65, 145, 135}} /* dredge */,
+		{30140104, 80, 2, true, BoundingBox{55, 65, 145, 135}} /* roll on/roll off */,
+		{30140105, 82, 2, true, BoundingBox{55, 65, 145, 135}} /* ferry */,
+		{30140106, 84, 2, true, BoundingBox{55, 65, 145, 135}} /* heavy lift */,
+		{30140107, 86, 2, true, BoundingBox{55, 65, 145, 135}} /* hovercraft */,
+		{30140108, 88, 2, true, BoundingBox{55, 65, 145, 135}} /* lash carrier (with barges) */,
+		{30140109, 90, 2, true, BoundingBox{55, 65, 145, 135}} /* oiler */,
+		{30140110, 92, 2, true, BoundingBox{55, 65, 145, 135}} /* passenger */,
+		{30140111, 94, 2, true, BoundingBox{55, 65, 145, 135}} /* tug, ocean-going */,
+		{30140112, 96, 2, true, BoundingBox{55, 65, 145, 135}} /* tow */,
+		{30140113, 98, 2, true, BoundingBox{55, 65, 145, 135}} /* transport ship, hazardous material */,
+		{30140114, 100, 2, true, BoundingBox{55, 65, 145, 135}} /* junk */,
+		{30140115, 102, 2, true, BoundingBox{55, 65, 145, 135}} /* civilian barge, not self-propelled */,
+		{30140116, 104, 2, true, BoundingBox{55, 65, 145, 135}} /* civilian hospital ship */,
+		{30140200, 106, 1, true, BoundingBox{55, 57.4, 145, 135}} /* fishing vessel */,
+		{30140201, 107, 2, true, BoundingBox{55, 57.4, 145, 135}} /* drifter */,
+		{30140202, 109, 2, true, BoundingBox{55, 57.4, 145, 135}} /* trawler */,
+		{30140203, 111, 2, true, BoundingBox{55, 57.4, 145, 135}} /* dredger */,
+		{30140300, 113, 2, true, BoundingBox{55, 65, 145, 135}} /* law enforcement vessel */,
+		{30140400, 115, 1, true, BoundingBox{55, 50, 145, 135}} /* leisure craft, sailing */,
+		{30140500, 116, 1, true, BoundingBox{55, 67.4, 145, 132.4}} /* leisure craft, motorized */,
+		{30140501, 117, 2, true, BoundingBox{55, 67.4, 145, 132.4}} /* civilian rigid-hull inflatable boat */,
+		{30140502, 119, 2, true, BoundingBox{55, 67.4, 145, 132.4}} /* speed boat */,
+		{30140600, 121, 1, true, BoundingBox{55, 60, 140, 120}} /* civilian jet ski */,
+		{30140700, 122, 1, true, BoundingBox{60, 84, 140, 117}} /* unmanned surface water vehicle */,
+		{30150000, 123, 1, false, std::nullopt} /* own ship */,
+		{30160000, 124, 2, false, BoundingBox{70, 65, 130, 135}} /* fused track */,
+		{30170000, 126, 1, false, std::nullopt} /* manual track */
+	};
+	return build_layer_table(ENTRIES, COMMAND_INDICES, commands);
+}
+
+LayerTable build_modifier_1_table() {
+	std::vector<DrawCommand> commands;
+	commands.reserve(24);
+	commands.push_back(DrawCommand::textm1("OWN"));
+	commands.push_back(DrawCommand::textm1("AAW"));
+	commands.push_back(DrawCommand::textm1("ASW"));
+	commands.push_back(DrawCommand::textm1("E"));
+	commands.push_back(DrawCommand::textm1("EW"));
+	commands.push_back(DrawCommand::textm1("IR"));
+	commands.push_back(DrawCommand::textm1("MCM"));
+	commands.push_back(DrawCommand::textm1("MD"));
+	commands.push_back(DrawCommand::textm1("ME"));
+	commands.push_back(DrawCommand::textm1("MIW"));
+	commands.push_back(DrawCommand::textm1("RMV"));
+	commands.push_back(DrawCommand::textm1("SOF"));
+	commands.push_back(DrawCommand::textm1("SUW"));
+	commands.push_back(DrawCommand::textm1("B"));
+	commands.push_back(DrawCommand::textm1("G"));
+	commands.push_back(DrawCommand::textm1("M"));
+	commands.push_back(DrawCommand::textm1("T"));
+	commands.push_back(DrawCommand::path("m 80,65 20,13 20,-13 0,-5 -20,10 -20,-10 z", BoundingBox{80, 60, 120, 78}).with_fill(ColorType::ICON).with_stroke(ColorType::NONE));
+	commands.push_back(DrawCommand::textm1("H"));
+	commands.push_back(DrawCommand::textm1("BM"));
+	commands.push_back(DrawCommand::textm1("ST"));
+	commands.push_back(DrawCommand::textm1("SBX"));
+	commands.push_back(DrawCommand::textm1("HJ"));
+	commands.push_back(DrawCommand::textm1("CYB"));
+
+	static constexpr uint16_t COMMAND_INDICES[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 18, 22, 23};
+	static constexpr LayerEntry ENTRIES[] = {
+		{3001, 0, 1, false, std::nullopt} /* own ship */,
+		{3002, 1, 1, false, std::nullopt} /* antiair warfare */,
+		{3003, 2, 1, false, std::nullopt} /* antisubmarine warfare */,
+		{3004, 3, 1, false, std::nullopt} /* escort */,
+		{3005, 4, 1, false, std::nullopt} /* electronic warfare */,
+		{3006, 5, 1, false, std::nullopt} /* intelligence, surveillance, and reconnaissance */,
+		{3007, 6, 1, false, std::nullopt} /* mine countermeasures */,
+		{3008, 7, 1, false, std::nullopt} /* missile defense */,
+		{3009, 8, 1, false, std::nullopt} /* medical */,
+		{3010, 9, 1, false, std::nullopt} /* mine warfare */,
+		{3011, 10, 1, false, std::nullopt} /* remote multi-mission vehicle */,
+		{3012, 11, 1, false, std::nullopt} /* special operations forces */,
+		{3013, 12, 1, false, std::nullopt} /* surface warfare */,
+		{3014, 13, 1, false, std::nullopt} /* ballistic missile */,
+		{3015, 14, 1, false, std::nullopt} /* guided missile */,
+		{3016, 15, 1, false, std::nullopt} /* other guided missile */,
+		{3017, 16, 1, false, std::nullopt} /* torpedo */,
+		{3018, 17, 1, false, BoundingBox{80, 60, 120, 78}} /* drone-equipped */,
+		{3019, 18, 1, false, std::nullopt} /* helicopter-equipped */,
+		{3020, 19, 1, false, std::nullopt} /* ballistic missile defense, shooter */,
+		{3021, 20, 1, false, std::nullopt} /* ballistic missile defense, long-range surveillance and track */,
+		{3022, 21, 1, false, std::nullopt} /* sea-based X-band */,
+		{3023, 22, 1, false, std::nullopt} /* hijacking */,
+		{3024, 23, 1, false, std::nullopt} /* hijacker */,
+		{3025, 24, 1, false, std::nullopt} /* cyberspace */
+	};
+	return build_layer_table(ENTRIES, COMMAND_INDICES, commands);
+}
+
+LayerTable build_modifier_2_table() {
+	std::vector<DrawCommand> commands;
+	commands.reserve(16);
+	commands.push_back(DrawCommand::textm2("N"));
+	commands.push_back(DrawCommand::textm2("H"));
+	commands.push_back(DrawCommand::textm2("L"));
+	commands.push_back(DrawCommand::textm2("M"));
+	commands.push_back(DrawCommand::textm2("D"));
+	commands.push_back(DrawCommand::textm2("LOG"));
+	commands.push_back(DrawCommand::textm2("T"));
+	commands.push_back(DrawCommand::textm2("V"));
+	commands.push_back(DrawCommand::textm2("F"));
+	commands.push_back(DrawCommand::textm2("AC"));
+	commands.push_back(DrawCommand::textm2("J"));
+	commands.push_back(DrawCommand::textm2("K"));
+	commands.push_back(DrawCommand::textm2("AUT"));
+	commands.push_back(DrawCommand::textm2("RP"));
+	commands.push_back(DrawCommand::textm2("USV"));
+	commands.push_back(DrawCommand::textm2("CYB"));
+
+	static constexpr uint16_t COMMAND_INDICES[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+	static constexpr LayerEntry ENTRIES[] = {
+		{3001, 0, 1, false, std::nullopt} /* nuclear-powered */,
+		{3002, 1, 1, false, std::nullopt} /* heavy */,
+		{3003, 2, 1, false, std::nullopt} /* light */,
+		{3004, 3, 1, false, std::nullopt} /* medium */,
+		{3005, 4, 1, false, std::nullopt} /* dock */,
+		{3006, 5, 1, false, std::nullopt} /* logistics */,
+		{3007, 6, 1, false, std::nullopt} /* tank */,
+		{3008, 7, 1, false, std::nullopt} /* vehicle */,
+		{3009, 8, 1, false, std::nullopt} /* fast */,
+		{3010, 9, 1, false, std::nullopt} /* air-cushioned (US) */,
+		{3011, 10, 1, false, std::nullopt} /* air-cushioned (NATO) */,
+		{3012, 11, 1, false, std::nullopt} /* hydrofoil */,
+		{3013, 12, 1, false, std::nullopt} /* autonomous control */,
+		{3014, 13, 1, false, std::nullopt} /* remotely-piloted */,
+		{3015, 14, 1, false, std::nullopt} /* expendable */,
+		{3016, 15, 1, false, std::nullopt} /* cyberspace */
+	};
+	return build_layer_table(ENTRIES, COMMAND_INDICES, commands);
+}
+
+const LayerTable& get_table(IconType symbol_type) noexcept {
+	if (symbol_type == IconType::ENTITY) {
+		static const LayerTable ENTITY_TABLE = build_entity_table();
+		return ENTITY_TABLE;
+	} else if (symbol_type == IconType::MODIFIER_1) {
+		static const LayerTable MODIFIER_1_TABLE = build_modifier_1_table();
+		return MODIFIER_1_TABLE;
+	}
+
+	static const LayerTable MODIFIER_2_TABLE = build_modifier_2_table();
+	return MODIFIER_2_TABLE;
+}
+
+}
+
+SymbolLayer get_sea_surface_layer(int32_t code, IconType symbol_type) noexcept {
+	return get_table(symbol_type).find(code);
+}
+
+std::optional<BoundingBox> get_sea_surface_bbox(int32_t code, IconType symbol_type) noexcept {
+	return get_table(symbol_type).find_bbox(code);
+}
+
+std::vector<int32_t> get_sea_surface_symbols(IconType symbol_type) noexcept {
+	if (symbol_type == IconType::ENTITY) {
+		return {110000 /*military*/, 120000 /*military combatant*/, 120100 /*carrier*/, 120200 /*surface combatant, line*/, 120201 /*battleship*/, 120202 /*cruiser*/, 120203 /*destroyer*/, 121204 /*frigate*/, 120205 /*corvette*/, 120206 /*littoral combat ship*/, 120300 /*amphibious warfare ship*/, 120301 /*amphibious command ship*/, 120302 /*amphibious assault ship (unspecified)*/, 120303 /*amphibious assault ship*/, 120304 /*amphibious assault ship (multipurpose)*/, 120305 /*amphibious assault ship, helicopter*/, 120306 /*amphibious transport dock*/, 120307 /*landing ship*/, 120308 /*landing craft*/, 120400 /*mine warfare ship*/, 120401 /*mine layer*/, 120402 /*mine sweeper*/, 120403 /*mine sweeper, drone*/, 120404 /*mine hunter*/, 120405 /*mine countermeasures*/, 120406 /*mine countermeasures support ship*/, 120500 /*patrol boat*/, 120501 /*patrol craft, submarine chaser*/, 120502 /*patrol ship, general*/, 120600 /*decoy*/, 120700 /*unmanned surface vehicle*/, 120800 /*speedboat*/, 120801 /*rigid-hull inflatable boat*/, 120900 /*jet ski*/, 121000 /*navy task organization*/, 121001 /*navy task element*/, 121002 /*navy task force*/, 121003 /*navy task group*/, 121004 /*navy task unit*/, 121005 /*convoy*/, 121100 /*sea-based X-band radar*/, 130000 /*military non-combatant*/, 130100 /*auxiliary ship*/, 130101 /*ammunition ship*/, 130102 /*naval stores ship*/, 130103 /*auxiliary flag ship*/, 130104 /*intelligence collector*/, 130105 /*oceanographic research ship*/, 130106 /*survey ship*/, 130107 /*hospital ship*/, 130108 /*naval cargo ship*/, 130109 /*fast combat support ship*/, 130110 /*oiler, replenishment*/, 130111 /*repair ship*/, 130112 /*submarine tender*/, 130113 /*ocean-going tug*/, 130200 /*service craft*/, 130201 /*barge, not self-propelled*/, 130202 /*barge, self-propelled*/, 130203 /*tug, harbor*/, 130204 /*launch*/, 140000 /*civilian*/, 140100 /*merchant ship*/, 140101 /*cargo ship*/, 140102 /*container ship*/, 140103 /*dredge*/, 140104 /*roll on/roll off*/, 140105 /*ferry*/, 140106 /*heavy lift*/, 140107 /*hovercraft*/, 140108 /*lash carrier (with barges)*/, 140109 /*oiler*/, 140110 /*passenger*/, 140111 /*tug, ocean-going*/, 140112 /*tow*/, 140113 /*transport ship, hazardous material*/, 140114 /*junk*/, 140115 /*civilian barge, not self-propelled*/, 140116 /*civilian hospital ship*/, 140200 /*fishing vessel*/, 140201 /*drifter*/, 140202 /*trawler*/, 140203 /*dredger*/, 140300 /*law enforcement vessel*/, 140400 /*leisure craft, sailing*/, 140500 /*leisure craft, motorized*/, 140501 /*civilian rigid-hull inflatable boat*/, 140502 /*speed boat*/, 140600 /*civilian jet ski*/, 140700 /*unmanned surface water vehicle*/, 150000 /*own ship*/, 160000 /*fused track*/, 170000 /*manual track*/};
+	}
+	else if (symbol_type == IconType::MODIFIER_1) {
+		return {1 /*own ship*/, 2 /*antiair warfare*/, 3 /*antisubmarine warfare*/, 4 /*escort*/, 5 /*electronic warfare*/, 6 /*intelligence, surveillance, and reconnaissance*/, 7 /*mine countermeasures*/, 8 /*missile defense*/, 9 /*medical*/, 10 /*mine warfare*/, 11 /*remote multi-mission vehicle*/, 12 /*special operations forces*/, 13 /*surface warfare*/, 14 /*ballistic missile*/, 15 /*guided missile*/, 16 /*other guided missile*/, 17 /*torpedo*/, 18 /*drone-equipped*/, 19 /*helicopter-equipped*/, 20 /*ballistic missile defense, shooter*/, 21 /*ballistic missile defense, long-range surveillance and track*/, 22 /*sea-based X-band*/, 23 /*hijacking*/, 24 /*hijacker*/, 25 /*cyberspace*/};
+	}
+	else if (symbol_type == IconType::MODIFIER_2) {
+		return {1 /*nuclear-powered*/, 2 /*heavy*/, 3 /*light*/, 4 /*medium*/, 5 /*dock*/, 6 /*logistics*/, 7 /*tank*/, 8 /*vehicle*/, 9 /*fast*/, 10 /*air-cushioned (US)*/, 11 /*air-cushioned (NATO)*/, 12 /*hydrofoil*/, 13 /*autonomous control*/, 14 /*remotely-piloted*/, 15 /*expendable*/, 16 /*cyberspace*/};
+	}
+
+	// Default to nothing
+	return {};
+}
+
+}
@@ -0,0 +1,196 @@
+// Generated by generation/parse.py from the "space" symbol set
+#include "Schema.hpp"
+
+namespace milsymbol::_impl {
+
+namespace {
+
+// Path data used by more than one draw command
+constexpr const char PATH_0[] = "m 89,115 6,-25 c 3,-12 7,-12 10,0 l 6,25 -10,0 -1,5 -1,-5 z";
+constexpr const char PATH_1[] = "m 85,115 c -2,5 32,5 30,0 l -5,-30 c -1,-5 -19,-5 -20,0 z";
+constexpr const char PATH_2[] = "m 110,100 10,0 m -40,0 10,0 m -10,-10 -25,0 0,20 25,0 z m 40,0 0,20 25,0 0,-20 z m -30,0 0,20 20,0 0,-20 z";
+constexpr const char PATH_3[] = "m 97,90 -1,-9 8,0 -1,9 m -5,20 1,9 2,0 1,-9 m 8,-10 5,0 m -30,0 5,0 m -5,-10 -25,0 0,20 25,0 z m 30,0 0,20 25,0 0,-20 z m -25,0 0,20 20,0 0,-20 z";
+constexpr const char PATH_4[] = "m 100,89 c 0,4.4 -3.6,8 -8,8 -4.4,0 -8,-3.6 -8,-8 0,-4.4 3.6,-8 8,-8 4.4,0 8,3.6 8,8 z m -10,10 0,20 20,0 0,-20 z m 25,0 0,20 25,0 0,-20 z m -30,0 -25,0 0,20 25,0 z m 0,10 5,0 m 20,0 5,0 m -17,-25 17,10 -1,2 -14,-7";
+constexpr const char PATH_5[] = "m 110,109 5,0 m -30,0 5,0 m -5,-10 -25,0 0,20 25,0 z m 30,0 0,20 25,0 0,-20 z m -25,0 0,20 20,0 0,-20 z";
+constexpr const char PATH_6[] = "m 107,113 c 0,3.9 -3.1,7 -7,7 -3.9,0 -7,-3.1 -7,-7 0,-3.9 3.1,-7 7,-7 3.9,0 7,3.1 7,7 z m -17,-33 0,20 20,0 0,-20 z m 25,0 0,20 25,0 0,-20 z m -30,0 -25,0 0,20 25,0 z m 0,10 5,0 m 20,0 5,0";
+constexpr const char PATH_7[] = "m 91.1,92 0,16 17.8,0 0,-16 z m 22.2,0 0,16 22.2,0 0,-16 z m -26.6,0 -22.2,0 0,16 22.2,0 z m 0,8 4.4,0 m 17.8,0 4.4,0";
+constexpr const char PATH_8[] = "m 97.5,112.5 0,7.5 5,0 0,-7.5 z m 0,-32.5 5,0 0,26.4 -5,0 z m -0.3,7.6 C 83.3,88.2 72.5,93.5 72.5,100 c 0,6.9 12.3,12.5 27.5,12.5 15.2,0 27.5,-5.6 27.5,-12.5 0,-6.5 -11,-11.9 -25,-12.4 l 0,5.6 c 9.9,0.4 17.5,3.2 17.5,6.6 0,3.7 -8.9,6.7 -19.8,6.7 -10.9,0 -19.8,-3 -19.8,-6.7 0,-3.4 7.4,-6.1 17.1,-6.6 l 0,-5.6 c -0.1,0 -0.2,-0 -0.3,0 z";
+constexpr const char PATH_9[] = "m 120,87 -20,12 m 33,-12 c 0,3.6 -2.9,6.5 -6.5,6.5 -3.6,0 -6.5,-2.9 -6.5,-6.5 0,-3.6 2.9,-6.5 6.5,-6.5 3.6,0 6.5,2.9 6.5,6.5 z m -23,22 5,0 m -30,0 5,0 m -5,-10 -25,0 0,20 25,0 z m 30,0 0,20 25,0 0,-20 z m -25,0 0,20 20,0 0,-20 z";
+
+LayerTable build_entity_table() {
+	std::vector<DrawCommand> commands;
+	commands.reserve(36);
+	commands.push_back(DrawCommand::autotext("MIL"));
+	commands.push_back(DrawCommand::autotext("SV"));
+	commands.push_back(DrawCommand::autotext("RV"));
+	commands.push_back(DrawCommand::autotext("PL"));
+	commands.push_back(DrawCommand::path(PATH_0, BoundingBox{89, 81, 111, 120}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path(PATH_1, BoundingBox{84.91, 81.25, 115.09, 118.75}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::autotext("SAT"));
+	commands.push_back(DrawCommand::path(PATH_2, BoundingBox{55, 90, 145, 110}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("m 100,110 0,9 m 0,-34 0,5 m 0,-9 -2,4 4,0 z m -10,9 0,20 20,0 0,-20 z m 25,0 0,20 25,0 0,-20 z m -30,0 -25,0 0,20 25,0 z m 0,10 5,0 m 20,0 5,0", BoundingBox{60, 81, 140, 119}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path(PATH_3, BoundingBox{60, 81, 140, 119}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path(PATH_4, BoundingBox{60, 81, 140, 119}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path(PATH_5, BoundingBox{60, 99, 140, 119}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("m 100,90 0,9 M 75,81 c 16,12 34,12 50,0", BoundingBox{75, 81, 125, 99}));
+	commands.push_back(DrawCommand::path(PATH_6, BoundingBox{60, 80, 140, 120}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("m 88,107 c 8,-9 16,-9 24,0", BoundingBox{88, 100.25, 112, 107}));
+	commands.push_back(DrawCommand::path(PATH_7, BoundingBox{64.5, 92, 135.5, 108}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path("m 90,119 10,-9 10,9 m -20,-38 10,9 10,-9 m 35,9 -10,10 10,10 M 55,90 65,100 55,110", BoundingBox{55, 81, 145, 119}));
+	commands.push_back(DrawCommand::path("m 88,87 c 8,6 16,6 24,0 m -20,8 8,-14 8,14", BoundingBox{88, 81, 112, 95}));
+	commands.push_back(DrawCommand::path("m 106,100 9,20 m -21,-20 -9,20 m 17,-20 3,20 m -7,-20 -3,20 m 15,-30 5,0 m -30,0 5,0 m -5,-10 -25,0 0,20 25,0 z m 30,0 0,20 25,0 0,-20 z m -25,0 0,20 20,0 0,-20 z", BoundingBox{60, 80, 140, 120}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path(PATH_8, BoundingBox{72.5, 80, 127.5, 120}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::path(PATH_9, BoundingBox{60, 80.5, 140, 119}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::text("WX", Vector2{100, 100}, 25));
+	commands.push_back(DrawCommand::autotext("SLV"));
+	commands.push_back(DrawCommand::autotext("CIV").with_fill(ColorType::WHITE).with_stroke(ColorType::ICON).with_stroke_width(4.0));
+	commands.push_back(DrawCommand::path(PATH_0, BoundingBox{89, 81, 111, 120}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::path(PATH_1, BoundingBox{84.91, 81.25, 115.09, 118.75}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::path(PATH_2, BoundingBox{55, 90, 145, 110}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::path(PATH_3, BoundingBox{60, 81, 140, 119}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::path(PATH_4, BoundingBox{60, 81, 140, 119}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::path(PATH_5, BoundingBox{60, 99, 140, 119}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::path(PATH_6, BoundingBox{60, 80, 140, 120}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::path(PATH_7, BoundingBox{64.5, 92, 135.5, 108}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::path(PATH_8, BoundingBox{72.5, 80, 127.5, 120}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::path(PATH_9, BoundingBox{60, 80.5, 140, 119}).with_fill(ColorType::WHITE));
+	commands.push_back(DrawCommand::autotext("SV").with_fill(ColorType::WHITE).with_stroke(ColorType::ICON).with_stroke_width(4.0));
+	commands.push_back(DrawCommand::autotext("MAN"));
+
+	static constexpr uint16_t COMMAND_INDICES[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 11, 17, 18, 19, 20, 11, 21, 22, 23, 24, 25, 26, 27, 28, 29, 12, 30, 14, 31, 16, 29, 17, 32, 33, 29, 21, 34, 35};
+	static constexpr LayerEntry ENTRIES[] = {
+		{5110000, 0, 1, false, std::nullopt} /* military space platform */,
+		{5110100, 1, 1, false, std::nullopt} /* military space vehicle */,
+		{5110200, 2, 1, false, std::nullopt} /* military re-entry vehicle */,
+		{5110300, 3, 1, false, std::nullopt} /* planet lander */,
+		{5110400, 4, 1, false, BoundingBox{89, 81, 111, 120}} /* orbiter shuttle */,
+		{5110500, 5, 1, false, BoundingBox{84.91, 81.25, 115.09, 118.75}} /* capsule */,
+		{5110600, 6, 1, false, std::nullopt} /* general satellite */,
+		{5110700, 7, 1, false, BoundingBox{55, 90, 145, 110}} /* satellite */,
+		{5110800, 8, 1, false, BoundingBox{60, 81, 140, 119}} /* anti-satellite weapon */,
+		{5110900, 9, 1, false, BoundingBox{60, 81, 140, 119}} /* astronomical satellite */,
+		{5111000, 10, 1, false, BoundingBox{60, 81, 140, 119}} /* biosatellite */,
+		{5111100, 11, 2, false, BoundingBox{60, 81, 140, 119}} /* communications satellite */,
+		{5111200, 13, 2, false, BoundingBox{60, 80, 140, 120}} /* earth observation satellite */,
+		{5111300, 15, 2, false, BoundingBox{55, 81, 145, 119}} /* miniaturized satellite */,
+		{5111400, 17, 2, false, BoundingBox{60, 81, 140, 119}} /* navigational satellite */,
+		{5111500, 19, 1, false, BoundingBox{60, 80, 140, 120}} /* reconnaissance satellite */,
+		{5111600, 20, 1, false, BoundingBox{72.5, 80, 127.5, 120}} /* space station */,
+		{5111700, 21, 1, false, BoundingBox{60, 80.5, 140, 119}} /* tethered satellite */,
+		{5111800, 22, 2, false, BoundingBox{60, 99, 140, 119}} /* weather satellite */,
+		{5111900, 24, 1, false, std::nullopt} /* space-launched vehicle */,
+		{5120000, 25, 1, true, std::nullopt} /* civilian space */,
+		{5120100, 26, 1, true, BoundingBox{89, 81, 111, 120}} /* civilian orbiter shuttle */,
+		{5120200, 27, 1, true, BoundingBox{84.91, 81.25, 115.09, 118.75}} /* civilian capsule */,
+		{5120300, 28, 1, true, BoundingBox{55, 90, 145, 110}} /* civilian satellite */,
+		{5120400, 29, 1, true, BoundingBox{60, 81, 140, 119}} /* civilian astronomical satellite */,
+		{5120500, 30, 1, true, BoundingBox{60, 81, 140, 119}} /* civilian biosatellite */,
+		{5120600, 31, 2, true, BoundingBox{60, 81, 140, 119}} /* civilian communications satellite */,
+		{5120700, 33, 2, true, BoundingBox{60, 80, 140, 120}} /* civilian earth observation satellite */,
+		{5120800, 35, 2, true, BoundingBox{55, 81, 145, 119}} /* civilian miniaturized satellite */,
+		{5120900, 37, 2, true, BoundingBox{60, 81, 140, 119}} /* civilian navigational satellite */,
+		{5121000, 39, 1, true, BoundingBox{72.5, 80, 127.5, 120}} /* civilian space station */,
+		{5121100, 40, 1, true, BoundingBox{60, 80.5, 140, 119}} /* civilian tethered satellite */,
+		{5121200, 41, 2, true, BoundingBox{60, 99, 140, 119}} /* civilian weather satellite */,
+		{5121300, 43, 1, true, std::nullopt} /* civilian space vehicle */,
+		{5130000, 44, 1, false, std::nullopt} /* manual track */
+	};
+	return build_layer_table(ENTRIES, COMMAND_INDICES, commands);
+}
+
+LayerTable build_modifier_1_table() {
+	std::vector<DrawCommand> commands;
+	commands.reserve(7);
+	commands.push_back(DrawCommand::textm1("LEO"));
+	commands.push_back(DrawCommand::textm1("MEO"));
+	commands.push_back(DrawCommand::textm1("HEO"));
+	commands.push_back(DrawCommand::textm1("GSO"));
+	commands.push_back(DrawCommand::textm1("GO"));
+	commands.push_back(DrawCommand::textm1("MO"));
+	commands.push_back(DrawCommand::textm1("CYB"));
+
+	static constexpr uint16_t COMMAND_INDICES[] = {0, 1, 2, 3, 4, 5, 6};
+	static constexpr LayerEntry ENTRIES[] = {
+		{501, 0, 1, false, std::nullopt} /* low earth orbit */,
+		{502, 1, 1, false, std::nullopt} /* medium earth orbit */,
+		{503, 2, 1, false, std::nullopt} /* high earth orbit */,
+		{504, 3, 1, false, std::nullopt} /* geosynchronous orbit */,
+		{505, 4, 1, false, std::nullopt} /* geostationary orbit */,
+		{506, 5, 1, false, std::nullopt} /* Molniya orbit */,
+		{507, 6, 1, false, std::nullopt} /* cyberspace */
+	};
+	return build_layer_table(ENTRIES, COMMAND_INDICES, commands);
+}
+
+LayerTable build_modifier_2_table() {
+	std::vector<DrawCommand> commands;
+	commands.reserve(11);
+	commands.push_back(DrawCommand::textm2("O"));
+	commands.push_back(DrawCommand::textm2("IR"));
+	commands.push_back(DrawCommand::textm2("R"));
+	commands.push_back(DrawCommand::textm2("SI"));
+	commands.push_back(DrawCommand::textm2("CYB"));
+	commands.push_back(DrawCommand::textm2("EW"));
+	commands.push_back(DrawCommand::path("m 130,129 h -17 l -3,7 -3,-13 -4,13 -3.1,-13 -3.4,6 h -9.9 l -3.3,7 -3.3,-13 -3.3,13 -3.3,-13 -3.3,13  m 52.9,-13 7,6 -7,7", BoundingBox{70.1, 123, 130, 136}));
+	commands.push_back(DrawCommand::path("M75,125 c8,0 8,16 0,16 m8,-8 l35,0 m8,-8 c-8,0 -8,16 0,16", BoundingBox{75, 125, 126, 141}));
+	commands.push_back(DrawCommand::path("m 111,133 c 0,4 -5,6 -11,6 -6.3,0 -11.4,-2 -11.4,-6 0,-2 5.1,-5 11.4,-5 6,0 11,3 11,5 z  m -2,-11 -17.5,23  m 0,-23 17.5,23  m -9,-23 v 23", BoundingBox{88.6, 122, 111, 145}).with_fill(ColorType::ICON));
+	commands.push_back(DrawCommand::textm2("K"));
+	commands.push_back(DrawCommand::textm2("tug"));
+
+	static constexpr uint16_t COMMAND_INDICES[] = {0, 1, 2, 3, 4, 5, 5, 6, 7, 8, 9, 10};
+	static constexpr LayerEntry ENTRIES[] = {
+		{501, 0, 1, false, std::nullopt} /* optical */,
+		{502, 1, 1, false, std::nullopt} /* infrared */,
+		{503, 2, 1, false, std::nullopt} /* radar */,
+		{504, 3, 1, false, std::nullopt} /* signals intelligence */,
+		{505, 4, 1, false, std::nullopt} /* cyberspace */,
+		{506, 5, 1, false, std::nullopt} /* electromagnetic warfare ASAT */,
+		{507, 6, 1, false, std::nullopt} /* high power microwave ASAT */,
+		{508, 7, 1, false, BoundingBox{70.1, 123, 130, 136}} /* laser ASAT */,
+		{509, 8, 1, false, BoundingBox{75, 125, 126, 141}} /* maintenance */,
+		{510, 9, 1, false, BoundingBox{88.6, 122, 111, 145}} /* mine */,
+		{511, 10, 1, false, std::nullopt} /* refuel */,
+		{512, 11, 1, false, std::nullopt} /* tug */
+	};
+	return build_layer_table(ENTRIES, COMMAND_INDICES, commands);
+}
+
+const LayerTable& get_table(IconType symbol_type) noexcept {
+	if (symbol_type == IconType::ENTITY) {
+		static const LayerTable ENTITY_TABLE = build_entity_table();
+		return ENTITY_TABLE;
+	} else if (symbol_type == IconType::MODIFIER_1) {
+		static const LayerTable MODIFIER_1_TABLE = build_modifier_1_table();
+		return MODIFIER_1_TABLE;
+	}
+
+	static const LayerTable MODIFIER_2_TABLE = build_modifier_2_table();
+	return MODIFIER_2_TABLE;
+}
+
+}
+
+SymbolLayer get_space_layer(int32_t code, IconType symbol_type) noexcept {
+	return get_table(symbol_type).find(code);
+}
+
+std::optional<BoundingBox> get_space_bbox(int32_t code, IconType symbol_type) noexcept {
+	return get_table(symbol_type).find_bbox(code);
+}
+
+std::vector<int32_t> get_space_symbols(IconType symbol_type) noexcept {
+	if (symbol_type == IconType::ENTITY) {
+		return {110000 /*military space platform*/, 110100 /*military space vehicle*/, 110200 /*military re-entry vehicle*/, 110300 /*planet lander*/, 110400 /*orbiter shuttle*/, 110500 /*capsule*/, 110600 /*general satellite*/, 110700 /*satellite*/, 110800 /*anti-satellite weapon*/, 110900 /*astronomical satellite*/, 111000 /*biosatellite*/, 111100 /*communications satellite*/, 111200 /*earth observation satellite*/, 111300 /*miniaturized satellite*/, 111400 /*navigational satellite*/, 111500 /*reconnaissance satellite*/, 111600 /*space station*/, 111700 /*tethered satellite*/, 111800 /*weather satellite*/, 111900 /*space-launched vehicle*/, 120000 /*civilian space*/, 120100 /*civilian orbiter shuttle*/, 120200 /*civilian capsule*/, 120300 /*civilian satellite*/, 120400 /*civilian astronomical satellite*/, 120500 /*civilian biosatellite*/, 120600 /*civilian communications satellite*/, 120700 /*civilian earth observation satellite*/, 120800 /*civilian miniaturized satellite*/, 120900 /*civilian navigational satellite*/, 121000 /*civilian space station*/, 121100 /*civilian tethered satellite*/, 121200 /*civilian weather satellite*/, 121300 /*civilian space vehicle*/, 130000 /*manual track*/};
+	}
+	else if (symbol_type == IconType::MODIFIER_1) {
+		return {1 /*low earth orbit*/, 2 /*medium earth orbit*/, 3 /*high earth orbit*/, 4 /*geosynchronous orbit*/, 5 /*geostationary orbit*/, 6 /*Molniya orbit*/, 7 /*cyberspace*/};
+	}
+	else if (symbol_type == IconType::MODIFIER_2) {
+		return {1 /*optical*/, 2 /*infrared*/, 3 /*radar*/, 4 /*signals intelligence*/, 5 /*cyberspace*/, 6 /*electromagnetic warfare ASAT*/, 7 /*high power microwave ASAT*/, 8 /*laser ASAT*/, 9 /*maintenance*/, 10 /*mine*/, 11 /*refuel*/, 12 /*tug*/};
+	}
+
+	// Default to nothing
+	return {};
+}
+
+}
@@ -0,0 +1,110 @@
+// Generated by generation/parse.py from the "space missile" symbol set
+#include "Schema.hpp"
+
+namespace milsymbol::_impl {
+
+namespace {
+
+LayerTable build_entity_table() {
+	std::vector<DrawCommand> commands;
+	commands.reserve(1);
+	commands.push_back(DrawCommand::path("M90,135 l0,-10 5,-5 0,-55 5,-5 5,5 0,55 5,5 0,10 -10,-10 z", BoundingBox{90, 60, 110, 135}).with_fill(ColorType::YELLOW));
+
+	static constexpr uint16_t COMMAND_INDICES[] = {0};
+	static constexpr LayerEntry ENTRIES[] = {
+		{6110000, 0, 1, false, BoundingBox{90, 60, 110, 135}} /* missile */
+	};
+	return build_layer_table(ENTRIES, COMMAND_INDICES, commands);
+}
+
+LayerTable build_modifier_1_table() {
+	std::vector<DrawCommand> commands;
+	commands.reserve(4);
+	commands.push_back(DrawCommand::text("B", Vector2{68, 110}, 30));
+	commands.push_back(DrawCommand::text("S", Vector2{68, 95}, 30));
+	commands.push_back(DrawCommand::text("P", Vector2{68, 125}, 30));
+	commands.push_back(DrawCommand::text("I", Vector2{68, 110}, 30));
+
+	static constexpr uint16_t COMMAND_INDICES[] = {0, 1, 2, 3};
+	static constexpr LayerEntry ENTRIES[] = {
+		{601, 0, 1, false, std::nullopt} /* ballistic */,
+		{602, 1, 2, false, std::nullopt} /* space */,
+		{603, 3, 1, false, std::nullopt} /* interceptor */
+	};
+	return build_layer_table(ENTRIES, COMMAND_INDICES, commands);
+}
+
+LayerTable build_modifier_2_table() {
+	std::vector<DrawCommand> commands;
+	commands.reserve(13);
+	commands.push_back(DrawCommand::text("S", Vector2{132, 95}, 30));
+	commands.push_back(DrawCommand::text("R", Vector2{132, 125}, 30));
+	commands.push_back(DrawCommand::text("M", Vector2{132, 95}, 30));
+	commands.push_back(DrawCommand::text("I", Vector2{132, 95}, 30));
+	commands.push_back(DrawCommand::text("L", Vector2{132, 95}, 30));
+	commands.push_back(DrawCommand::text("C", Vector2{132, 125}, 30));
+	commands.push_back(DrawCommand::text("A", Vector2{132, 95}, 30));
+	commands.push_back(DrawCommand::text("G", Vector2{132, 110}, 30));
+	commands.push_back(DrawCommand::text("P", Vector2{132, 110}, 30));
+	commands.push_back(DrawCommand::text("T", Vector2{132, 125}, 30));
+	commands.push_back(DrawCommand::text("3", Vector2{132, 125}, 30));
+	commands.push_back(DrawCommand::text("T", Vector2{132, 110}, 30));
+	commands.push_back(DrawCommand::text("P", Vector2{132, 125}, 30));
+
+	static constexpr uint16_t COMMAND_INDICES[] = {0, 1, 2, 1, 3, 1, 4, 1, 3, 5, 6, 1, 7, 8, 0, 9, 0, 10, 11, 0, 12};
+	static constexpr LayerEntry ENTRIES[] = {
+		{601, 0, 2, false, std::nullopt} /* short range */,
+		{602, 2, 2, false, std::nullopt} /* medium range */,
+		{603, 4, 2, false, std::nullopt} /* intermediate range */,
+		{604, 6, 2, false, std::nullopt} /* long range */,
+		{605, 8, 2, false, std::nullopt} /* intercontinental */,
+		{606, 10, 2, false, std::nullopt} /* Arrow */,
+		{607, 12, 1, false, std::nullopt} /* ground-based interceptor */,
+		{608, 13, 1, false, std::nullopt} /* Patriot */,
+		{609, 14, 2, false, std::nullopt} /* standard missile - terminal phase */,
+		{610, 16, 2, false, std::nullopt} /* standard missile - 3 */,
+		{611, 18, 1, false, std::nullopt} /* terminal high-altitude area defense */,
+		{612, 19, 2, false, std::nullopt} /* space */
+	};
+	return build_layer_table(ENTRIES, COMMAND_INDICES, commands);
+}
+
+const LayerTable& get_table(IconType symbol_type) noexcept {
+	if (symbol_type == IconType::ENTITY) {
+		static const LayerTable ENTITY_TABLE = build_entity_table();
+		return ENTITY_TABLE;
+	} else if (symbol_type == IconType::MODIFIER_1) {
+		static const LayerTable MODIFIER_1_TABLE = build_modifier_1_table();
+		return MODIFIER_1_TABLE;
+	}
+
+	static const LayerTable MODIFIER_2_TABLE = build_modifier_2_table();
+	return MODIFIER_2_TABLE;
+}
+
+}
+
+SymbolLayer get_space_missile_layer(int32_t code, IconType symbol_type) noexcept {
+	return get_table(symbol_type).find(code);
+}
+
+std::optional<BoundingBox> get_space_missile_bbox(int32_t code, IconType symbol_type) noexcept {
+	return get_table(symbol_type).find_bbox(code);
+}
+
+std::vector<int32_t> get_space_missile_symbols(IconType symbol_type) noexcept {
+	if (symbol_type == IconType::ENTITY) {
+		return {110000 /*missile*/};
+	}
+	else if (symbol_type == IconType::MODIFIER_1) {
+		return {1 /*ballistic*/, 2 /*space*/, 3 /*interceptor*/};
+	}
+	else if (symbol_type == IconType::MODIFIER_2) {
+		return {1 /*short range*/, 2 /*medium range*/, 3 /*intermediate range*/, 4 /*long range*/, 5 /*intercontinental*/, 6 /*Arrow*/, 7 /*ground-based interceptor*/, 8 /*Patriot*/, 9 /*standard missile - terminal phase*/, 10 /*standard missile - 3*/, 11 /*terminal high-altitude area defense*/, 12 /*space*/};
+	}
+
+	// Default to nothing
+	return {};
+}
+
+}
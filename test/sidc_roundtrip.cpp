@@ -0,0 +1,119 @@
+#include "Symbol.hpp"
+
+#include <array>
+#include <iostream>
+#include <string_view>
+#include <vector>
+
+using namespace milsymbol;
+
+namespace {
+
+constexpr std::array<Affiliation, 7> AFFILIATIONS = {Affiliation::PENDING, Affiliation::UNKNOWN, Affiliation::ASSUMED_FRIEND,
+                                                     Affiliation::FRIEND, Affiliation::NEUTRAL, Affiliation::SUSPECT,
+                                                     Affiliation::HOSTILE};
+
+/// Status digits a SIDC can hold; 1 (planned) is the only one for anticipated symbols too, which read back as planned
+constexpr std::array<char, 6> STATUSES = {'0', '1', '2', '3', '4', '5'};
+
+/// Checks that a symbol reads back unchanged from the SIDC to_sidc writes for it, into a buffer of N characters
+template<std::size_t N>
+bool round_trips(const Symbol& symbol) {
+    char sidc[N];
+    symbol.to_sidc(sidc);
+    if (Symbol::from_sidc(std::string_view{sidc, N}) == symbol) {
+        return true;
+    }
+    std::cerr << "SIDC round trip failed for " << std::string_view{sidc, N} << std::endl;
+    return false;
+}
+
+}
+
+/**
+ * @brief Round-trips every entity and modifier in the catalog through to_sidc and from_sidc, with every identity
+ * and status and a spread of contexts, echelons, mobilities and headquarters, task force and feint/dummy flags,
+ * then every echelon and every mobility on a land unit and a piece of land equipment, into both 20- and
+ * 30-character buffers. Fails if any symbol reads back differently.
+ */
+int main() {
+    std::vector<Symbol> symbols;
+    int index = 0;
+    for (auto symbol_set : Symbol::get_all_symbol_sets()) {
+        auto set = static_cast<SymbolSet>(symbol_set);
+        for (auto entity : Symbol::get_all_entities(set)) {
+            char entity_sidc[20];
+            Symbol{}.with_entity(static_cast<Entities>(symbol_set * 1000000 + entity)).to_sidc(entity_sidc);
+
+            for (auto affiliation : AFFILIATIONS) {
+                // Statuses only come through SIDCs
+                entity_sidc[6] = STATUSES[index % STATUSES.size()];
+
+                // Vary the remaining fields deterministically over the catalog
+                Symbol symbol = Symbol::from_sidc(std::string_view{entity_sidc, 20})
+                    .with_affiliation(affiliation)
+                    .with_context(static_cast<Context>(index % 3))
+                    .as_headquarters(index % 2)
+                    .as_task_force(index % 5 == 0)
+                    .as_feint_or_dummy(index % 3 == 0);
+                if (index % 4 == 0) {
+                    symbol.with_mobility(static_cast<Mobility>(index / 4 % 14));
+                } else {
+                    symbol.with_echelon(static_cast<Echelon>(index % 15 - 1));
+                }
+                symbols.push_back(symbol);
+                index++;
+            }
+        }
+
+        for (int modifier_index : {1, 2}) {
+            for (auto modifier : (modifier_index == 1 ? Symbol::get_all_modifier_1s(set) : Symbol::get_all_modifier_2s(set))) {
+                char sidc[21] = "10031000000000000000";
+                sidc[4] = static_cast<char>('0' + symbol_set / 10);
+                sidc[5] = static_cast<char>('0' + symbol_set % 10);
+                sidc[16 + 2 * (modifier_index - 1)] = static_cast<char>('0' + modifier / 10 % 10);
+                sidc[17 + 2 * (modifier_index - 1)] = static_cast<char>('0' + modifier % 10);
+                symbols.push_back(Symbol::from_sidc(sidc));
+            }
+        }
+    }
+
+    // Every echelon and mobility, which share a SIDC's amplifier digits, on a unit and a piece of equipment, with
+    // every combination of headquarters, task force and feint/dummy
+    for (auto symbol_set : {SymbolSet::LAND_UNIT, SymbolSet::LAND_EQUIPMENT}) {
+        std::vector<Symbol::entity_t> entities = Symbol::get_all_entities(symbol_set);
+        if (entities.empty()) {
+            continue;
+        }
+        Symbol base = Symbol{}.with_entity(static_cast<Entities>(static_cast<int>(symbol_set) * 1000000 + entities.front()));
+
+        for (int flags = 0; flags < 8; flags++) {
+            Symbol flagged = Symbol{base}.as_headquarters(flags & 1).as_task_force(flags & 2).as_feint_or_dummy(flags & 4);
+            for (int echelon = static_cast<int>(Echelon::UNDEFINED); echelon <= static_cast<int>(Echelon::COMMAND); echelon++) {
+                symbols.push_back(Symbol{flagged}.with_echelon(static_cast<Echelon>(echelon)));
+            }
+            for (int mobility = static_cast<int>(Mobility::UNDEFINED); mobility <= static_cast<int>(Mobility::LONG_TOWED_ARRAY); mobility++) {
+                symbols.push_back(Symbol{flagged}.with_mobility(static_cast<Mobility>(mobility)));
+            }
+        }
+    }
+
+    std::size_t failures = 0;
+    for (const auto& symbol : symbols) {
+        failures += !round_trips<20>(symbol);
+        failures += !round_trips<30>(symbol);
+    }
+
+    // The batch encoder writes the same SIDCs
+    std::vector<std::array<char, 20>> batch(symbols.size());
+    Symbol::to_sidc(symbols.data(), symbols.size(), reinterpret_cast<char(*)[20]>(batch.data()));
+    for (std::size_t i = 0; i < symbols.size(); i++) {
+        if (!(Symbol::from_sidc(std::string_view{batch[i].data(), 20}) == symbols[i])) {
+            std::cerr << "Batch SIDC round trip failed for " << std::string_view{batch[i].data(), 20} << std::endl;
+            failures++;
+        }
+    }
+
+    std::cout << "Round-tripped " << symbols.size() << " symbols with " << failures << " failures" << std::endl;
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,66 @@
+#include "Stats.hpp"
+
+#include <charconv>
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace milsymbol;
+
+/**
+ * @brief Checks that every exported Prometheus bucket bound parses back to exactly its power of two of
+ * nanoseconds in seconds, and that a sample of exactly a bound is counted under it but not under the bound below.
+ */
+int main() {
+    int failures = 0;
+
+    for (int bucket = 0; bucket < RenderStats::BUCKET_COUNT - 1; bucket++) {
+        std::uint64_t bound_ns = std::uint64_t{2} << bucket;
+
+        RenderStats stats;
+        stats.record(RenderStage::RENDER, bound_ns);
+        std::ostringstream out;
+        stats.get_snapshot().write_prometheus(out);
+
+        // Find this bucket's line and the one below it
+        std::istringstream lines{out.str()};
+        std::string line;
+        int index = 0;
+        while (std::getline(lines, line)) {
+            const std::string marker = "_stage_duration_seconds_bucket{stage=\"render\",le=\"";
+            std::size_t start = line.find(marker);
+            if (start == std::string::npos || line.find("+Inf") != std::string::npos) {
+                continue;
+            }
+            start += marker.size();
+            std::size_t end = line.find('"', start);
+
+            double le = 0;
+            std::from_chars(line.data() + start, line.data() + end, le);
+            double expected = static_cast<double>(std::uint64_t{2} << index) / 1e9;
+            if (le != expected) {
+                std::cerr << "Bound " << line.substr(start, end - start) << " doesn't round-trip to 2^" << (index + 1) << " ns" << std::endl;
+                failures++;
+            }
+
+            int cumulative = std::stoi(line.substr(line.rfind(' ') + 1));
+            if (index < bucket && cumulative != 0) {
+                std::cerr << "A sample of " << bound_ns << " ns is counted under " << line.substr(start, end - start) << std::endl;
+                failures++;
+            } else if (index >= bucket && cumulative != 1) {
+                std::cerr << "A sample of " << bound_ns << " ns is missing under " << line.substr(start, end - start) << std::endl;
+                failures++;
+            }
+            index++;
+        }
+
+        if (index != RenderStats::BUCKET_COUNT - 1) {
+            std::cerr << "Expected " << RenderStats::BUCKET_COUNT - 1 << " finite buckets, found " << index << std::endl;
+            failures++;
+        }
+    }
+
+    std::cout << "Checked " << RenderStats::BUCKET_COUNT - 1 << " bucket bounds with " << failures << " failures" << std::endl;
+    return failures == 0 ? 0 : 1;
+}